@@ -14,16 +14,22 @@ namespace UnrealMCP {
 			return FCommonUtils::CreateErrorResponse(FError(EErrorCode::InvalidInput, TEXT("Missing 'blueprint_name' parameter")));
 		}
 
-		const FVoidResult Result =
-			FBlueprintCreationService::CompileBlueprint(BlueprintName);
+		bool bProfile = false;
+		Params->TryGetBoolField(TEXT("profile"), bProfile);
+
+		bool bCollectGarbage = false;
+		Params->TryGetBoolField(TEXT("collect_garbage"), bCollectGarbage);
+
+		const TResult<FBlueprintCompileReport> Result =
+			FBlueprintCreationService::CompileBlueprint(BlueprintName, bProfile, bCollectGarbage);
 
 		if (Result.IsFailure()) {
 			return FCommonUtils::CreateErrorResponse(Result.GetError());
 		}
 
-		return FCommonUtils::CreateSuccessResponse([&](const TSharedPtr<FJsonObject>& Data) {
-			Data->SetStringField(TEXT("name"), BlueprintName);
-			Data->SetBoolField(TEXT("compiled"), true);
-		});
+		const TSharedPtr<FJsonObject> Data = Result.GetValue().ToJson();
+		Data->SetStringField(TEXT("name"), BlueprintName);
+		Data->SetBoolField(TEXT("compiled"), Result.GetValue().IsSuccess());
+		return FCommonUtils::CreateSuccessResponse(Data);
 	}
 }
@@ -0,0 +1,26 @@
+﻿#include "Commands/Blueprint/CompileBlueprints.h"
+
+#include "Core/CommonUtils.h"
+#include "Core/ErrorTypes.h"
+#include "Core/Result.h"
+#include "Services/BlueprintCreationService.h"
+
+namespace UnrealMCP {
+	auto FCompileBlueprints::Handle(
+		const TSharedPtr<FJsonObject>& Params
+	) -> TSharedPtr<FJsonObject> {
+		const TResult<FCompileBlueprintsParams> ParamsResult = FCompileBlueprintsParams::FromJson(Params);
+		if (ParamsResult.IsFailure()) {
+			return FCommonUtils::CreateErrorResponse(ParamsResult.GetError());
+		}
+
+		const TResult<FCompileBlueprintsResult> Result =
+			FBlueprintCreationService::CompileBlueprints(ParamsResult.GetValue());
+
+		if (Result.IsFailure()) {
+			return FCommonUtils::CreateErrorResponse(Result.GetError());
+		}
+
+		return FCommonUtils::CreateSuccessResponse(Result.GetValue().ToJson());
+	}
+}
@@ -12,7 +12,10 @@ namespace UnrealMCP {
 
 		const FString BlueprintName = Params->GetStringField(TEXT("blueprint_name"));
 
-		auto Result = FBlueprintMemberService::GetFunctions(BlueprintName);
+		bool bRequireCompiled = false;
+		Params->TryGetBoolField(TEXT("require_compiled"), bRequireCompiled);
+
+		auto Result = FBlueprintMemberService::GetFunctions(BlueprintName, bRequireCompiled);
 		if (Result.IsFailure()) {
 			return FCommonUtils::CreateErrorResponse(Result.GetError());
 		}
@@ -0,0 +1,26 @@
+﻿#include "Commands/Blueprint/IndexBlueprints.h"
+
+#include "Core/CommonUtils.h"
+#include "Core/ErrorTypes.h"
+#include "Core/Result.h"
+#include "Services/BlueprintIntrospectionService.h"
+
+namespace UnrealMCP {
+	auto FIndexBlueprints::Handle(
+		const TSharedPtr<FJsonObject>& Params
+	) -> TSharedPtr<FJsonObject> {
+		const TResult<FIndexBlueprintsParams> ParamsResult = FIndexBlueprintsParams::FromJson(Params);
+		if (ParamsResult.IsFailure()) {
+			return FCommonUtils::CreateErrorResponse(ParamsResult.GetError());
+		}
+
+		const TResult<FIndexBlueprintsResult> Result =
+			FBlueprintIntrospectionService::IndexBlueprints(ParamsResult.GetValue());
+
+		if (Result.IsFailure()) {
+			return FCommonUtils::CreateErrorResponse(Result.GetError());
+		}
+
+		return FCommonUtils::CreateSuccessResponse(Result.GetValue().ToJson());
+	}
+}
@@ -0,0 +1,26 @@
+﻿#include "Commands/Blueprint/SearchBlueprints.h"
+
+#include "Core/CommonUtils.h"
+#include "Core/ErrorTypes.h"
+#include "Core/Result.h"
+#include "Services/BlueprintIntrospectionService.h"
+
+namespace UnrealMCP {
+	auto FSearchBlueprints::Handle(
+		const TSharedPtr<FJsonObject>& Params
+	) -> TSharedPtr<FJsonObject> {
+		const TResult<FSearchBlueprintsParams> ParamsResult = FSearchBlueprintsParams::FromJson(Params);
+		if (ParamsResult.IsFailure()) {
+			return FCommonUtils::CreateErrorResponse(ParamsResult.GetError());
+		}
+
+		const TResult<FSearchBlueprintsResult> Result =
+			FBlueprintIntrospectionService::SearchBlueprints(ParamsResult.GetValue());
+
+		if (Result.IsFailure()) {
+			return FCommonUtils::CreateErrorResponse(Result.GetError());
+		}
+
+		return FCommonUtils::CreateSuccessResponse(Result.GetValue().ToJson());
+	}
+}
@@ -0,0 +1,23 @@
+﻿#include "Commands/BlueprintNode/BuildBlueprintGraph.h"
+#include "Core/CommonUtils.h"
+#include "Core/ErrorTypes.h"
+#include "Core/MCPTypes.h"
+#include "Services/BlueprintGraphService.h"
+
+namespace UnrealMCP {
+	auto FBuildBlueprintGraph::Handle(
+		const TSharedPtr<FJsonObject>& Params
+	) -> TSharedPtr<FJsonObject> {
+		const TResult<FBuildBlueprintGraphParams> ParamsResult = FBuildBlueprintGraphParams::FromJson(Params);
+		if (ParamsResult.IsFailure()) {
+			return FCommonUtils::CreateErrorResponse(ParamsResult.GetError());
+		}
+
+		const TResult<FBuildBlueprintGraphResult> Result = FBlueprintGraphService::BuildGraph(ParamsResult.GetValue());
+		if (Result.IsFailure()) {
+			return FCommonUtils::CreateErrorResponse(Result.GetError());
+		}
+
+		return FCommonUtils::CreateSuccessResponse(Result.GetValue().ToJson());
+	}
+}
@@ -0,0 +1,23 @@
+﻿#include "Commands/BlueprintNode/ExportBlueprintGraph.h"
+#include "Core/CommonUtils.h"
+#include "Core/ErrorTypes.h"
+#include "Core/MCPTypes.h"
+#include "Services/BlueprintGraphService.h"
+
+namespace UnrealMCP {
+	auto FExportBlueprintGraph::Handle(
+		const TSharedPtr<FJsonObject>& Params
+	) -> TSharedPtr<FJsonObject> {
+		const TResult<FExportBlueprintGraphParams> ParamsResult = FExportBlueprintGraphParams::FromJson(Params);
+		if (ParamsResult.IsFailure()) {
+			return FCommonUtils::CreateErrorResponse(ParamsResult.GetError());
+		}
+
+		const TResult<FBlueprintGraphExport> Result = FBlueprintGraphService::ExportGraph(ParamsResult.GetValue());
+		if (Result.IsFailure()) {
+			return FCommonUtils::CreateErrorResponse(Result.GetError());
+		}
+
+		return FCommonUtils::CreateSuccessResponse(Result.GetValue().ToJson());
+	}
+}
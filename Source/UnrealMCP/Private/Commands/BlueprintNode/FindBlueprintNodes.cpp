@@ -8,42 +8,16 @@ namespace UnrealMCP {
 		const TSharedPtr<FJsonObject>& Params
 	) -> TSharedPtr<FJsonObject> {
 
-		FString BlueprintName;
-		if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName)) {
-			return FCommonUtils::CreateErrorResponse(FError(EErrorCode::InvalidInput, TEXT("Missing 'blueprint_name' parameter")));
+		auto QueryResult = FBlueprintNodeQuery::FromJson(Params);
+		if (QueryResult.IsFailure()) {
+			return FCommonUtils::CreateErrorResponse(QueryResult.GetError());
 		}
 
-		FString NodeType;
-		if (!Params->TryGetStringField(TEXT("node_type"), NodeType)) {
-			return FCommonUtils::CreateErrorResponse(FError(EErrorCode::InvalidInput, TEXT("Missing 'node_type' parameter")));
-		}
-
-		TOptional<FString> EventName;
-		FString EventNameStr;
-		if (Params->TryGetStringField(TEXT("event_name"), EventNameStr)) {
-			EventName = EventNameStr;
-		}
-
-		TArray<FString> NodeGuids;
-		const FVoidResult Result = FBlueprintGraphService::FindNodes(
-			BlueprintName,
-			NodeType,
-			EventName,
-			NodeGuids
-		);
-
+		const TResult<FBlueprintNodeQueryResult> Result = FBlueprintGraphService::QueryNodes(QueryResult.GetValue());
 		if (Result.IsFailure()) {
 			return FCommonUtils::CreateErrorResponse(Result.GetError());
 		}
 
-
-		TArray<TSharedPtr<FJsonValue>> NodeGuidArray;
-		for (const FString& Guid : NodeGuids) {
-			NodeGuidArray.Add(MakeShared<FJsonValueString>(Guid));
-		}
-
-		return FCommonUtils::CreateSuccessResponse([&](const TSharedPtr<FJsonObject>& Data) {
-			Data->SetArrayField(TEXT("node_guids"), NodeGuidArray);
-		});
+		return FCommonUtils::CreateSuccessResponse(Result.GetValue().ToJson());
 	}
 }
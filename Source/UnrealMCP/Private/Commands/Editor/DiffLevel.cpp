@@ -0,0 +1,21 @@
+#include "Commands/Editor/DiffLevel.h"
+#include "Core/CommonUtils.h"
+#include "Core/MCPTypes.h"
+#include "Services/ActorService.h"
+
+namespace UnrealMCP {
+
+	auto FDiffLevel::Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject> {
+		const auto DiffLevelParams = FDiffLevelParams::FromJson(Params);
+		if (!DiffLevelParams.IsSuccess()) {
+			return FCommonUtils::CreateErrorResponse(DiffLevelParams.GetError());
+		}
+
+		const auto Result = FActorService::DiffLevel(DiffLevelParams.GetValue());
+		if (!Result.IsSuccess()) {
+			return FCommonUtils::CreateErrorResponse(Result.GetError());
+		}
+
+		return FCommonUtils::CreateSuccessResponse(Result.GetValue().ToJson());
+	}
+}
@@ -11,23 +11,22 @@ namespace UnrealMCP {
 		const TSharedPtr<FJsonObject>& Params
 	) -> TSharedPtr<FJsonObject> {
 
-		FString Pattern;
-		if (!Params->TryGetStringField(TEXT("pattern"), Pattern)) {
-			return FCommonUtils::CreateErrorResponse(FError(EErrorCode::InvalidInput, TEXT("Missing 'pattern' parameter")));
+		const auto SearchParams = FActorNameSearchParams::FromJson(Params);
+		if (!SearchParams.IsSuccess()) {
+			return FCommonUtils::CreateErrorResponse(SearchParams.GetError());
 		}
 
-		TArray<FString> ActorNames;
-
-		if (const FVoidResult Result = FActorService::FindActorsByName(Pattern, ActorNames);
-			Result.IsFailure()) {
+		const auto Result = FActorService::FindActorsByPattern(SearchParams.GetValue());
+		if (!Result.IsSuccess()) {
 			return FCommonUtils::CreateErrorResponse(Result.GetError());
 		}
 
-
 		TArray<TSharedPtr<FJsonValue>> ActorArray;
-		for (const FString& ActorName : ActorNames) {
+		ActorArray.Reserve(Result.GetValue().Num());
+		for (const AActor* Actor : Result.GetValue()) {
 			TSharedPtr<FJsonObject> ActorObj = MakeShared<FJsonObject>();
-			ActorObj->SetStringField(TEXT("name"), ActorName);
+			ActorObj->SetStringField(TEXT("name"), Actor->GetName());
+			ActorObj->SetStringField(TEXT("label"), Actor->GetActorLabel());
 			ActorArray.Add(MakeShared<FJsonValueObject>(ActorObj));
 		}
 
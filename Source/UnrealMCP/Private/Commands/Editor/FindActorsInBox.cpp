@@ -0,0 +1,33 @@
+#include "Commands/Editor/FindActorsInBox.h"
+#include "Core/CommonUtils.h"
+#include "Core/MCPTypes.h"
+#include "GameFramework/Actor.h"
+#include "Services/ActorService.h"
+
+namespace UnrealMCP {
+
+	auto FFindActorsInBox::Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject> {
+		const auto QueryParams = FActorBoxQueryParams::FromJson(Params);
+		if (!QueryParams.IsSuccess()) {
+			return FCommonUtils::CreateErrorResponse(QueryParams.GetError());
+		}
+
+		const FActorBoxQueryParams& Query = QueryParams.GetValue();
+		const auto Result = FActorService::FindActorsInBox(Query.Box, Query.Filter);
+		if (!Result.IsSuccess()) {
+			return FCommonUtils::CreateErrorResponse(Result.GetError());
+		}
+
+		TArray<TSharedPtr<FJsonValue>> ActorArray;
+		ActorArray.Reserve(Result.GetValue().Num());
+		for (const AActor* Actor : Result.GetValue()) {
+			ActorArray.Add(FCommonUtils::ActorToJson(Actor));
+		}
+
+		return FCommonUtils::CreateSuccessResponse([&](const TSharedPtr<FJsonObject>& Data) {
+			Data->SetArrayField(TEXT("actors"), ActorArray);
+			Data->SetNumberField(TEXT("count"), ActorArray.Num());
+		});
+	}
+
+}
@@ -0,0 +1,35 @@
+#include "Commands/Editor/FindNearestActors.h"
+#include "Core/CommonUtils.h"
+#include "Core/MCPTypes.h"
+#include "GameFramework/Actor.h"
+#include "Services/ActorService.h"
+
+namespace UnrealMCP {
+
+	auto FFindNearestActors::Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject> {
+		const auto QueryParams = FNearestActorsParams::FromJson(Params);
+		if (!QueryParams.IsSuccess()) {
+			return FCommonUtils::CreateErrorResponse(QueryParams.GetError());
+		}
+
+		const FNearestActorsParams& Query = QueryParams.GetValue();
+		const auto Result = FActorService::FindNearestActors(Query.Location, Query.Count, Query.MaxDistance, Query.Filter);
+		if (!Result.IsSuccess()) {
+			return FCommonUtils::CreateErrorResponse(Result.GetError());
+		}
+
+		TArray<TSharedPtr<FJsonValue>> ActorArray;
+		ActorArray.Reserve(Result.GetValue().Num());
+		for (const TPair<AActor*, double>& Hit : Result.GetValue()) {
+			const TSharedPtr<FJsonObject> ActorObj = FCommonUtils::ActorToJsonObject(Hit.Key);
+			ActorObj->SetNumberField(TEXT("distance"), Hit.Value);
+			ActorArray.Add(MakeShared<FJsonValueObject>(ActorObj));
+		}
+
+		return FCommonUtils::CreateSuccessResponse([&](const TSharedPtr<FJsonObject>& Data) {
+			Data->SetArrayField(TEXT("actors"), ActorArray);
+			Data->SetNumberField(TEXT("count"), ActorArray.Num());
+		});
+	}
+
+}
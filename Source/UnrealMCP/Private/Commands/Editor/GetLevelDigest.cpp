@@ -0,0 +1,21 @@
+#include "Commands/Editor/GetLevelDigest.h"
+#include "Core/CommonUtils.h"
+#include "Core/MCPTypes.h"
+#include "Services/ActorService.h"
+
+namespace UnrealMCP {
+
+	auto FGetLevelDigest::Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject> {
+		const auto GetLevelDigestParams = FGetLevelDigestParams::FromJson(Params);
+		if (!GetLevelDigestParams.IsSuccess()) {
+			return FCommonUtils::CreateErrorResponse(GetLevelDigestParams.GetError());
+		}
+
+		const auto Result = FActorService::GetLevelDigest(GetLevelDigestParams.GetValue());
+		if (!Result.IsSuccess()) {
+			return FCommonUtils::CreateErrorResponse(Result.GetError());
+		}
+
+		return FCommonUtils::CreateSuccessResponse(Result.GetValue().ToJson());
+	}
+}
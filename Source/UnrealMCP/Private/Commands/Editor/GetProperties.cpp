@@ -0,0 +1,21 @@
+#include "Commands/Editor/GetProperties.h"
+#include "Core/CommonUtils.h"
+#include "Core/MCPTypes.h"
+#include "Services/ActorService.h"
+
+namespace UnrealMCP {
+
+	auto FGetProperties::Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject> {
+		const auto GetParams = FGetPropertiesParams::FromJson(Params);
+		if (!GetParams.IsSuccess()) {
+			return FCommonUtils::CreateErrorResponse(GetParams.GetError());
+		}
+
+		const auto Result = FActorService::GetProperties(GetParams.GetValue());
+		if (!Result.IsSuccess()) {
+			return FCommonUtils::CreateErrorResponse(Result.GetError());
+		}
+
+		return FCommonUtils::CreateSuccessResponse(Result.GetValue().ToJson());
+	}
+}
@@ -0,0 +1,21 @@
+#include "Commands/Editor/LoadRegion.h"
+#include "Core/CommonUtils.h"
+#include "Core/MCPTypes.h"
+#include "Services/ActorService.h"
+
+namespace UnrealMCP {
+
+	auto FLoadRegion::Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject> {
+		const auto LoadRegionParams = FLoadRegionParams::FromJson(Params);
+		if (!LoadRegionParams.IsSuccess()) {
+			return FCommonUtils::CreateErrorResponse(LoadRegionParams.GetError());
+		}
+
+		const auto Result = FActorService::LoadRegion(LoadRegionParams.GetValue());
+		if (!Result.IsSuccess()) {
+			return FCommonUtils::CreateErrorResponse(Result.GetError());
+		}
+
+		return FCommonUtils::CreateSuccessResponse(Result.GetValue().ToJson());
+	}
+}
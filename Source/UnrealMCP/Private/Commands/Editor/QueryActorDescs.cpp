@@ -0,0 +1,21 @@
+#include "Commands/Editor/QueryActorDescs.h"
+#include "Core/CommonUtils.h"
+#include "Core/MCPTypes.h"
+#include "Services/ActorService.h"
+
+namespace UnrealMCP {
+
+	auto FQueryActorDescs::Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject> {
+		const auto QueryActorDescsParams = FQueryActorDescsParams::FromJson(Params);
+		if (!QueryActorDescsParams.IsSuccess()) {
+			return FCommonUtils::CreateErrorResponse(QueryActorDescsParams.GetError());
+		}
+
+		const auto Result = FActorService::QueryActorDescs(QueryActorDescsParams.GetValue());
+		if (!Result.IsSuccess()) {
+			return FCommonUtils::CreateErrorResponse(Result.GetError());
+		}
+
+		return FCommonUtils::CreateSuccessResponse(Result.GetValue().ToJson());
+	}
+}
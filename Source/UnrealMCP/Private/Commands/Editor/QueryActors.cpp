@@ -0,0 +1,32 @@
+#include "Commands/Editor/QueryActors.h"
+#include "Core/CommonUtils.h"
+#include "Core/MCPTypes.h"
+#include "GameFramework/Actor.h"
+#include "Services/ActorService.h"
+
+namespace UnrealMCP {
+
+	auto FQueryActors::Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject> {
+		const auto Filter = FActorQueryFilter::FromJson(Params);
+		if (!Filter.IsSuccess()) {
+			return FCommonUtils::CreateErrorResponse(Filter.GetError());
+		}
+
+		const auto Result = FActorService::QueryActors(Filter.GetValue());
+		if (!Result.IsSuccess()) {
+			return FCommonUtils::CreateErrorResponse(Result.GetError());
+		}
+
+		TArray<TSharedPtr<FJsonValue>> ActorArray;
+		ActorArray.Reserve(Result.GetValue().Num());
+		for (const AActor* Actor : Result.GetValue()) {
+			ActorArray.Add(FCommonUtils::ActorToJson(Actor));
+		}
+
+		return FCommonUtils::CreateSuccessResponse([&](const TSharedPtr<FJsonObject>& Data) {
+			Data->SetArrayField(TEXT("actors"), ActorArray);
+			Data->SetNumberField(TEXT("count"), ActorArray.Num());
+		});
+	}
+
+}
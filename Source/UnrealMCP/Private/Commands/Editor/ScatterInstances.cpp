@@ -0,0 +1,21 @@
+#include "Commands/Editor/ScatterInstances.h"
+#include "Core/CommonUtils.h"
+#include "Core/MCPTypes.h"
+#include "Services/ActorService.h"
+
+namespace UnrealMCP {
+
+	auto FScatterInstances::Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject> {
+		const auto ScatterParams = FScatterInstancesParams::FromJson(Params);
+		if (!ScatterParams.IsSuccess()) {
+			return FCommonUtils::CreateErrorResponse(ScatterParams.GetError());
+		}
+
+		const auto Result = FActorService::ScatterInstances(ScatterParams.GetValue());
+		if (!Result.IsSuccess()) {
+			return FCommonUtils::CreateErrorResponse(Result.GetError());
+		}
+
+		return FCommonUtils::CreateSuccessResponse(Result.GetValue().ToJson());
+	}
+}
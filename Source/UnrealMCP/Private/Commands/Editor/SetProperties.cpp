@@ -0,0 +1,21 @@
+#include "Commands/Editor/SetProperties.h"
+#include "Core/CommonUtils.h"
+#include "Core/MCPTypes.h"
+#include "Services/ActorService.h"
+
+namespace UnrealMCP {
+
+	auto FSetProperties::Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject> {
+		const auto SetParams = FSetPropertiesParams::FromJson(Params);
+		if (!SetParams.IsSuccess()) {
+			return FCommonUtils::CreateErrorResponse(SetParams.GetError());
+		}
+
+		const auto Result = FActorService::SetProperties(SetParams.GetValue());
+		if (!Result.IsSuccess()) {
+			return FCommonUtils::CreateErrorResponse(Result.GetError());
+		}
+
+		return FCommonUtils::CreateSuccessResponse(Result.GetValue().ToJson());
+	}
+}
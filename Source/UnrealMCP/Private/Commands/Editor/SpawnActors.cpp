@@ -0,0 +1,21 @@
+#include "Commands/Editor/SpawnActors.h"
+#include "Core/CommonUtils.h"
+#include "Core/MCPTypes.h"
+#include "Services/ActorService.h"
+
+namespace UnrealMCP {
+
+	auto FSpawnActors::Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject> {
+		const auto SpawnParams = FSpawnActorsParams::FromJson(Params);
+		if (!SpawnParams.IsSuccess()) {
+			return FCommonUtils::CreateErrorResponse(SpawnParams.GetError());
+		}
+
+		const auto Result = FActorService::SpawnActors(SpawnParams.GetValue());
+		if (!Result.IsSuccess()) {
+			return FCommonUtils::CreateErrorResponse(Result.GetError());
+		}
+
+		return FCommonUtils::CreateSuccessResponse(Result.GetValue().ToJson());
+	}
+}
@@ -0,0 +1,21 @@
+#include "Commands/Editor/Subscribe.h"
+#include "Core/CommonUtils.h"
+#include "Core/MCPTypes.h"
+#include "Services/ActorService.h"
+
+namespace UnrealMCP {
+
+	auto FSubscribe::Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject> {
+		const auto SubscribeParams = FSubscribeParams::FromJson(Params);
+		if (!SubscribeParams.IsSuccess()) {
+			return FCommonUtils::CreateErrorResponse(SubscribeParams.GetError());
+		}
+
+		const auto Result = FActorService::Subscribe(SubscribeParams.GetValue());
+		if (!Result.IsSuccess()) {
+			return FCommonUtils::CreateErrorResponse(Result.GetError());
+		}
+
+		return FCommonUtils::CreateSuccessResponse(Result.GetValue().ToJson());
+	}
+}
@@ -0,0 +1,21 @@
+#include "Commands/Editor/TransformActors.h"
+#include "Core/CommonUtils.h"
+#include "Core/MCPTypes.h"
+#include "Services/ActorService.h"
+
+namespace UnrealMCP {
+
+	auto FTransformActors::Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject> {
+		const auto TransformParams = FTransformActorsParams::FromJson(Params);
+		if (!TransformParams.IsSuccess()) {
+			return FCommonUtils::CreateErrorResponse(TransformParams.GetError());
+		}
+
+		const auto Result = FActorService::TransformActors(TransformParams.GetValue());
+		if (!Result.IsSuccess()) {
+			return FCommonUtils::CreateErrorResponse(Result.GetError());
+		}
+
+		return FCommonUtils::CreateSuccessResponse(Result.GetValue().ToJson());
+	}
+}
@@ -0,0 +1,23 @@
+#include "Commands/Editor/UnloadRegion.h"
+#include "Core/CommonUtils.h"
+#include "Core/ErrorTypes.h"
+#include "Core/MCPTypes.h"
+#include "Services/ActorService.h"
+
+namespace UnrealMCP {
+
+	auto FUnloadRegion::Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject> {
+		int32 RegionId = 0;
+		if (!Params->TryGetNumberField(TEXT("region_id"), RegionId)) {
+			return FCommonUtils::CreateErrorResponse(FError(EErrorCode::InvalidInput, TEXT("Missing 'region_id' parameter")));
+		}
+
+		if (const FVoidResult Result = FActorService::UnloadRegion(RegionId); Result.IsFailure()) {
+			return FCommonUtils::CreateErrorResponse(Result.GetError());
+		}
+
+		return FCommonUtils::CreateSuccessResponse([&](const TSharedPtr<FJsonObject>& Data) {
+			Data->SetNumberField(TEXT("region_id"), RegionId);
+		});
+	}
+}
@@ -0,0 +1,23 @@
+#include "Commands/Editor/Unsubscribe.h"
+#include "Core/CommonUtils.h"
+#include "Core/ErrorTypes.h"
+#include "Core/MCPTypes.h"
+#include "Services/ActorService.h"
+
+namespace UnrealMCP {
+
+	auto FUnsubscribe::Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject> {
+		int32 SubscriptionId = 0;
+		if (!Params->TryGetNumberField(TEXT("subscription_id"), SubscriptionId)) {
+			return FCommonUtils::CreateErrorResponse(FError(EErrorCode::InvalidInput, TEXT("Missing 'subscription_id' parameter")));
+		}
+
+		if (const FVoidResult Result = FActorService::Unsubscribe(SubscriptionId); Result.IsFailure()) {
+			return FCommonUtils::CreateErrorResponse(Result.GetError());
+		}
+
+		return FCommonUtils::CreateSuccessResponse([&](const TSharedPtr<FJsonObject>& Data) {
+			Data->SetNumberField(TEXT("subscription_id"), SubscriptionId);
+		});
+	}
+}
@@ -5,6 +5,7 @@
 #include "Commands/Blueprint/AddFunctionParameter.h"
 #include "Commands/Blueprint/BlueprintExists.h"
 #include "Commands/Blueprint/CompileBlueprint.h"
+#include "Commands/Blueprint/CompileBlueprints.h"
 #include "Commands/Blueprint/CreateBlueprint.h"
 #include "Commands/Blueprint/DeleteBlueprint.h"
 #include "Commands/Blueprint/DuplicateBlueprint.h"
@@ -13,6 +14,7 @@
 #include "Commands/Blueprint/GetBlueprintInfo.h"
 #include "Commands/Blueprint/GetBlueprintPath.h"
 #include "Commands/Blueprint/GetBlueprintVariables.h"
+#include "Commands/Blueprint/IndexBlueprints.h"
 #include "Core/ErrorTypes.h"
 #include "Commands/Blueprint/GetComponentHierarchy.h"
 #include "Commands/Blueprint/GetComponentProperties.h"
@@ -22,6 +24,7 @@
 #include "Commands/Blueprint/RemoveVariable.h"
 #include "Commands/Blueprint/RenameComponent.h"
 #include "Commands/Blueprint/RenameVariable.h"
+#include "Commands/Blueprint/SearchBlueprints.h"
 #include "Commands/Blueprint/SetBlueprintProperty.h"
 #include "Commands/Blueprint/SetComponentProperty.h"
 #include "Commands/Blueprint/SetComponentTransform.h"
@@ -41,6 +44,7 @@ namespace UnrealMCP {
 
 		CommandHandlers.Add(TEXT("create_blueprint"), &FCreateBlueprint::Handle);
 		CommandHandlers.Add(TEXT("compile_blueprint"), &FCompileBlueprint::Handle);
+		CommandHandlers.Add(TEXT("compile_blueprints"), &FCompileBlueprints::Handle);
 		CommandHandlers.Add(TEXT("spawn_blueprint_actor"), &FSpawnActorBlueprint::Handle);
 		CommandHandlers.Add(TEXT("add_component_to_blueprint"), &FAddComponent::Handle);
 		CommandHandlers.Add(TEXT("set_component_property"), &FSetComponentProperty::Handle);
@@ -59,6 +63,8 @@ namespace UnrealMCP {
 		CommandHandlers.Add(TEXT("get_component_properties"), &FGetComponentPropertiesCommand::Handle);
 		CommandHandlers.Add(TEXT("get_blueprint_functions"), &FGetBlueprintFunctionsCommand::Handle);
 		CommandHandlers.Add(TEXT("get_component_hierarchy"), &FGetComponentHierarchyCommand::Handle);
+		CommandHandlers.Add(TEXT("search_blueprints"), &FSearchBlueprints::Handle);
+		CommandHandlers.Add(TEXT("index_blueprints"), &FIndexBlueprints::Handle);
 
 		// Component management commands
 		CommandHandlers.Add(TEXT("remove_component"), &FRemoveComponentCommand::Handle);
@@ -6,6 +6,8 @@
 #include "Commands/BlueprintNode/AddBlueprintInputActionNode.h"
 #include "Commands/BlueprintNode/AddBlueprintSelfReference.h"
 #include "Commands/BlueprintNode/AddBlueprintVariable.h"
+#include "Commands/BlueprintNode/BuildBlueprintGraph.h"
+#include "Commands/BlueprintNode/ExportBlueprintGraph.h"
 #include "Commands/BlueprintNode/ConnectBlueprintNodes.h"
 #include "Commands/BlueprintNode/FindBlueprintNodes.h"
 #include "Core/ErrorTypes.h"
@@ -24,6 +26,8 @@ namespace UnrealMCP {
 		CommandHandlers.Add(TEXT("add_blueprint_input_action_node"), &FAddBlueprintInputActionNode::Handle);
 		CommandHandlers.Add(TEXT("add_blueprint_function_node"), &FAddBlueprintFunctionCall::Handle);
 		CommandHandlers.Add(TEXT("add_blueprint_variable"), &FAddBlueprintVariable::Handle);
+		CommandHandlers.Add(TEXT("build_blueprint_graph"), &FBuildBlueprintGraph::Handle);
+		CommandHandlers.Add(TEXT("export_blueprint_graph"), &FExportBlueprintGraph::Handle);
 	}
 
 	auto FUnrealMCPBlueprintNodeCommands::HandleCommand(
@@ -3,14 +3,31 @@
 #include "Commands/Blueprint/SpawnActorBlueprint.h"
 #include "Commands/Editor/DeleteActor.h"
 #include "Commands/Editor/FindActorsByName.h"
+#include "Commands/Editor/FindActorsInBox.h"
+#include "Commands/Editor/FindActorsInRadius.h"
+#include "Commands/Editor/FindNearestActors.h"
 #include "Commands/Editor/FocusViewport.h"
 #include "Commands/Editor/GetActorAvailableProperties.h"
 #include "Commands/Editor/GetActorProperties.h"
 #include "Commands/Editor/GetActorsInLevel.h"
+#include "Commands/Editor/QueryActors.h"
+#include "Commands/Editor/ScatterInstances.h"
+#include "Commands/Editor/SetProperties.h"
+#include "Commands/Editor/GetProperties.h"
+#include "Commands/Editor/Subscribe.h"
+#include "Commands/Editor/Unsubscribe.h"
+#include "Commands/Editor/GetLevelDigest.h"
+#include "Commands/Editor/DiffLevel.h"
+#include "Commands/Editor/QueryActorDescs.h"
+#include "Commands/Editor/LoadRegion.h"
+#include "Commands/Editor/UnloadRegion.h"
 #include "Commands/Editor/SetActorProperty.h"
 #include "Commands/Editor/SetActorTransform.h"
+#include "Commands/Editor/SetActorTransforms.h"
 #include "Commands/Editor/SpawnActor.h"
+#include "Commands/Editor/SpawnActors.h"
 #include "Commands/Editor/TakeScreenshot.h"
+#include "Commands/Editor/TransformActors.h"
 #include "Core/CommonUtils.h"
 
 namespace UnrealMCP {
@@ -18,9 +35,26 @@ namespace UnrealMCP {
 	FUnrealMCPEditorCommands::FUnrealMCPEditorCommands() {
 		CommandHandlers.Add(TEXT("get_actors_in_level"), &FGetActorsInLevel::Handle);
 		CommandHandlers.Add(TEXT("find_actors_by_name"), &FFindActorsByName::Handle);
+		CommandHandlers.Add(TEXT("find_actors_in_radius"), &FFindActorsInRadius::Handle);
+		CommandHandlers.Add(TEXT("find_actors_in_box"), &FFindActorsInBox::Handle);
+		CommandHandlers.Add(TEXT("find_nearest_actors"), &FFindNearestActors::Handle);
+		CommandHandlers.Add(TEXT("query_actors"), &FQueryActors::Handle);
 		CommandHandlers.Add(TEXT("spawn_actor"), &FSpawnActor::Handle);
+		CommandHandlers.Add(TEXT("spawn_actors"), &FSpawnActors::Handle);
 		CommandHandlers.Add(TEXT("delete_actor"), &FDeleteActor::Handle);
 		CommandHandlers.Add(TEXT("set_actor_transform"), &FSetActorTransform::Handle);
+		CommandHandlers.Add(TEXT("set_actor_transforms"), &FSetActorTransforms::Handle);
+		CommandHandlers.Add(TEXT("transform_actors"), &FTransformActors::Handle);
+		CommandHandlers.Add(TEXT("scatter_instances"), &FScatterInstances::Handle);
+		CommandHandlers.Add(TEXT("set_properties"), &FSetProperties::Handle);
+		CommandHandlers.Add(TEXT("get_properties"), &FGetProperties::Handle);
+		CommandHandlers.Add(TEXT("subscribe"), &FSubscribe::Handle);
+		CommandHandlers.Add(TEXT("unsubscribe"), &FUnsubscribe::Handle);
+		CommandHandlers.Add(TEXT("get_level_digest"), &FGetLevelDigest::Handle);
+		CommandHandlers.Add(TEXT("diff_level"), &FDiffLevel::Handle);
+		CommandHandlers.Add(TEXT("query_actor_descs"), &FQueryActorDescs::Handle);
+		CommandHandlers.Add(TEXT("load_region"), &FLoadRegion::Handle);
+		CommandHandlers.Add(TEXT("unload_region"), &FUnloadRegion::Handle);
 		CommandHandlers.Add(TEXT("get_actor_properties"), &FGetActorProperties::Handle);
 		CommandHandlers.Add(TEXT("get_actor_available_properties"), &FGetActorAvailableProperties::Handle);
 		CommandHandlers.Add(TEXT("set_actor_property"), &FSetActorProperty::Handle);
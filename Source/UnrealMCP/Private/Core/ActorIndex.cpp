@@ -0,0 +1,751 @@
+#include "Core/ActorIndex.h"
+#include "Core/LevelDigest.h"
+#include "Core/NamePattern.h"
+#include "EngineUtils.h"
+#include "Editor.h"
+#include "Components/ActorComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Async/ParallelFor.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/UObjectGlobals.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogMCPActorIndex, Log, All);
+
+namespace UnrealMCP {
+
+	namespace {
+		/** Below this many names the task overhead outweighs parallel matching */
+		constexpr int32 PatternMatchBatchSize = 1024;
+
+		/** True if ActorFolder is Folder itself or one of its subfolders */
+		auto IsInFolder(const FName ActorFolder, const FName Folder) -> bool {
+			if (ActorFolder == Folder) {
+				return true;
+			}
+			if (ActorFolder.IsNone() || Folder.IsNone()) {
+				return false;
+			}
+
+			const FString Path = ActorFolder.ToString();
+			const FString Prefix = Folder.ToString();
+			return Path.Len() > Prefix.Len() && Path.StartsWith(Prefix) && Path[Prefix.Len()] == TEXT('/');
+		}
+
+		template <typename KeyType>
+		auto RemoveFromBucket(TMap<KeyType, TSet<TWeakObjectPtr<AActor>>>& Buckets,
+		                      const KeyType& Key,
+		                      const TWeakObjectPtr<AActor>& Entry) -> void {
+			if (TSet<TWeakObjectPtr<AActor>>* Bucket = Buckets.Find(Key)) {
+				Bucket->Remove(Entry);
+				if (Bucket->Num() == 0) {
+					Buckets.Remove(Key);
+				}
+			}
+		}
+	}
+
+	// ============ FActorIndexQuery ============
+
+	auto FActorIndexQuery::Matches(const AActor* Actor) const -> bool {
+		if (!IsValid(Actor)) {
+			return false;
+		}
+		if (Class && !Actor->IsA(Class)) {
+			return false;
+		}
+		for (const FName Tag : Tags) {
+			if (!Actor->ActorHasTag(Tag)) {
+				return false;
+			}
+		}
+		if (ComponentClass && !Actor->FindComponentByClass(const_cast<UClass*>(ComponentClass))) {
+			return false;
+		}
+		if (Folder.IsSet() && !IsInFolder(Actor->GetFolderPath(), Folder.GetValue())) {
+			return false;
+		}
+		return true;
+	}
+
+	// ============ FWorldActorIndex ============
+
+	auto FWorldActorIndex::AddActor(AActor* Actor) -> void {
+		if (!IsValid(Actor)) {
+			return;
+		}
+
+		// Level-added and actor-added events can both report the same actor
+		if (IndexedKeys.Contains(FObjectKey(Actor))) {
+			RemoveActor(Actor);
+		}
+
+		ActorsByName.Add(Actor->GetFName(), Actor);
+
+		FIndexedKeys Keys;
+		Keys.Label = Actor->GetActorLabel();
+		ActorsByLabel.Add(Keys.Label, Actor);
+		LinkAttributes(Actor, Keys);
+		IndexedKeys.Add(FObjectKey(Actor), MoveTemp(Keys));
+
+		Spatial.UpdateActor(Actor);
+	}
+
+	auto FWorldActorIndex::RemoveActor(const AActor* Actor) -> void {
+		if (!Actor) {
+			return;
+		}
+
+		// The actor may already be flagged as garbage while its delete event is broadcast
+		if (const TWeakObjectPtr<AActor>* Existing = ActorsByName.Find(Actor->GetFName());
+			Existing && Existing->Get(true) == Actor) {
+			ActorsByName.Remove(Actor->GetFName());
+		}
+
+		FIndexedKeys Keys;
+		if (IndexedKeys.RemoveAndCopyValue(FObjectKey(Actor), Keys)) {
+			ActorsByLabel.RemoveSingle(Keys.Label, TWeakObjectPtr<AActor>(const_cast<AActor*>(Actor)));
+			UnlinkAttributes(Actor, Keys);
+		}
+
+		Spatial.RemoveActor(Actor);
+	}
+
+	auto FWorldActorIndex::RenameActor(AActor* Actor, const FName OldName) -> void {
+		if (const TWeakObjectPtr<AActor>* Existing = ActorsByName.Find(OldName);
+			Existing && Existing->Get(true) == Actor) {
+			ActorsByName.Remove(OldName);
+		}
+
+		if (IsValid(Actor)) {
+			ActorsByName.Add(Actor->GetFName(), Actor);
+		}
+	}
+
+	auto FWorldActorIndex::RelabelActor(AActor* Actor) -> void {
+		if (!Actor) {
+			return;
+		}
+
+		FIndexedKeys* Keys = IndexedKeys.Find(FObjectKey(Actor));
+		if (!Keys) {
+			AddActor(Actor);
+			return;
+		}
+
+		ActorsByLabel.RemoveSingle(Keys->Label, Actor);
+
+		if (IsValid(Actor)) {
+			Keys->Label = Actor->GetActorLabel();
+			ActorsByLabel.Add(Keys->Label, Actor);
+		}
+	}
+
+	auto FWorldActorIndex::MoveActor(AActor* Actor) -> void {
+		// Only actors this index already tracks are refreshed; unknown actors arrive via AddActor
+		if (IsValid(Actor) && IndexedKeys.Contains(FObjectKey(Actor))) {
+			Spatial.UpdateActor(Actor);
+		}
+	}
+
+	auto FWorldActorIndex::RefreshActorAttributes(AActor* Actor) -> void {
+		if (!Actor) {
+			return;
+		}
+
+		FIndexedKeys* Keys = IndexedKeys.Find(FObjectKey(Actor));
+		if (!Keys) {
+			return;
+		}
+
+		UnlinkAttributes(Actor, *Keys);
+		if (IsValid(Actor)) {
+			LinkAttributes(Actor, *Keys);
+
+			// Added, removed or resized components change the bounds without a move event
+			Spatial.UpdateActor(Actor);
+		}
+	}
+
+	auto FWorldActorIndex::LinkAttributes(AActor* Actor, FIndexedKeys& Keys) -> void {
+		const TWeakObjectPtr<AActor> Entry(Actor);
+
+		Keys.Class = Actor->GetClass();
+		ActorsByClass.FindOrAdd(Keys.Class).Add(Entry);
+
+		Keys.Tags.Reset();
+		for (const FName Tag : Actor->Tags) {
+			if (!Tag.IsNone() && !Keys.Tags.Contains(Tag)) {
+				Keys.Tags.Add(Tag);
+				ActorsByTag.FindOrAdd(Tag).Add(Entry);
+			}
+		}
+
+		Keys.ComponentClasses.Reset();
+		for (const UActorComponent* Component : Actor->GetComponents()) {
+			if (!Component) {
+				continue;
+			}
+
+			const TWeakObjectPtr<UClass> ComponentClass(Component->GetClass());
+			if (!Keys.ComponentClasses.Contains(ComponentClass)) {
+				Keys.ComponentClasses.Add(ComponentClass);
+				ActorsByComponentClass.FindOrAdd(ComponentClass).Add(Entry);
+			}
+		}
+
+		Keys.Folder = Actor->GetFolderPath();
+		ActorsByFolder.FindOrAdd(Keys.Folder).Add(Entry);
+	}
+
+	auto FWorldActorIndex::UnlinkAttributes(const AActor* Actor, const FIndexedKeys& Keys) -> void {
+		const TWeakObjectPtr<AActor> Entry(const_cast<AActor*>(Actor));
+
+		RemoveFromBucket(ActorsByClass, Keys.Class, Entry);
+		for (const FName Tag : Keys.Tags) {
+			RemoveFromBucket(ActorsByTag, Tag, Entry);
+		}
+		for (const TWeakObjectPtr<UClass>& ComponentClass : Keys.ComponentClasses) {
+			RemoveFromBucket(ActorsByComponentClass, ComponentClass, Entry);
+		}
+		RemoveFromBucket(ActorsByFolder, Keys.Folder, Entry);
+	}
+
+	auto FWorldActorIndex::CollectClassBuckets(
+		const TMap<TWeakObjectPtr<UClass>, FActorSet>& Buckets,
+		const UClass* BaseClass,
+		TArray<const FActorSet*>& OutSets
+	) -> int32 {
+		// Distinct classes are few compared to actors, so walking the class keys is cheap
+		int32 Total = 0;
+		for (const TPair<TWeakObjectPtr<UClass>, FActorSet>& Bucket : Buckets) {
+			const UClass* Class = Bucket.Key.Get();
+			if (Class && Class->IsChildOf(BaseClass)) {
+				OutSets.Add(&Bucket.Value);
+				Total += Bucket.Value.Num();
+			}
+		}
+		return Total;
+	}
+
+	auto FWorldActorIndex::QueryActors(const FActorIndexQuery& Query, TArray<AActor*>& OutActors) const -> void {
+		if (Query.IsEmpty()) {
+			for (const TPair<FName, TWeakObjectPtr<AActor>>& Entry : ActorsByName) {
+				// An entry under a name the actor no longer has would list it twice
+				if (AActor* Actor = Entry.Value.Get(); IsValid(Actor) && Actor->GetFName() == Entry.Key) {
+					OutActors.Add(Actor);
+				}
+			}
+			return;
+		}
+
+		// Walk only the constraint with the fewest candidates; the rest are checked per actor
+		TArray<const FActorSet*> BestSets;
+		int32 BestSize = MAX_int32;
+		auto Consider = [&BestSets, &BestSize](TArray<const FActorSet*>&& Sets, const int32 Size) {
+			if (Size < BestSize) {
+				BestSize = Size;
+				BestSets = MoveTemp(Sets);
+			}
+		};
+
+		if (Query.Class) {
+			TArray<const FActorSet*> Sets;
+			const int32 Size = CollectClassBuckets(ActorsByClass, Query.Class, Sets);
+			Consider(MoveTemp(Sets), Size);
+		}
+
+		for (const FName Tag : Query.Tags) {
+			TArray<const FActorSet*> Sets;
+			const FActorSet* Bucket = ActorsByTag.Find(Tag);
+			if (Bucket) {
+				Sets.Add(Bucket);
+			}
+			Consider(MoveTemp(Sets), Bucket ? Bucket->Num() : 0);
+		}
+
+		if (Query.ComponentClass) {
+			TArray<const FActorSet*> Sets;
+			const int32 Size = CollectClassBuckets(ActorsByComponentClass, Query.ComponentClass, Sets);
+			Consider(MoveTemp(Sets), Size);
+		}
+
+		if (Query.Folder.IsSet()) {
+			TArray<const FActorSet*> Sets;
+			int32 Size = 0;
+			for (const TPair<FName, FActorSet>& Bucket : ActorsByFolder) {
+				if (IsInFolder(Bucket.Key, Query.Folder.GetValue())) {
+					Sets.Add(&Bucket.Value);
+					Size += Bucket.Value.Num();
+				}
+			}
+			Consider(MoveTemp(Sets), Size);
+		}
+
+		if (BestSize == 0) {
+			return;
+		}
+
+		// Component buckets overlap (one actor, several component classes), the others are disjoint
+		TSet<const AActor*> Seen;
+		const bool bDeduplicate = BestSets.Num() > 1;
+
+		for (const FActorSet* Set : BestSets) {
+			for (const TWeakObjectPtr<AActor>& Entry : *Set) {
+				AActor* Actor = Entry.Get();
+
+				// Also rejects stale entries whose attributes changed without an event
+				if (!Query.Matches(Actor)) {
+					continue;
+				}
+
+				if (bDeduplicate) {
+					bool bAlreadySeen = false;
+					Seen.Add(Actor, &bAlreadySeen);
+					if (bAlreadySeen) {
+						continue;
+					}
+				}
+
+				OutActors.Add(Actor);
+			}
+		}
+	}
+
+	auto FWorldActorIndex::FindByName(const FName ActorName) -> AActor* {
+		const TWeakObjectPtr<AActor>* Entry = ActorsByName.Find(ActorName);
+		if (!Entry) {
+			return nullptr;
+		}
+
+		AActor* Actor = Entry->Get();
+		if (!IsValid(Actor) || Actor->GetFName() != ActorName) {
+			// Stale entry left behind by a missed event
+			ActorsByName.Remove(ActorName);
+			return nullptr;
+		}
+
+		return Actor;
+	}
+
+	auto FWorldActorIndex::FindByLabel(const FString& ActorLabel) -> AActor* {
+		TArray<TWeakObjectPtr<AActor>, TInlineAllocator<4>> Candidates;
+		ActorsByLabel.MultiFind(ActorLabel, Candidates);
+
+		for (const TWeakObjectPtr<AActor>& Candidate : Candidates) {
+			AActor* Actor = Candidate.Get();
+			if (IsValid(Actor) && Actor->GetActorLabel() == ActorLabel) {
+				return Actor;
+			}
+			ActorsByLabel.RemoveSingle(ActorLabel, Candidate);
+		}
+
+		return nullptr;
+	}
+
+	auto FWorldActorIndex::Reset() -> void {
+		ActorsByName.Reset();
+		ActorsByLabel.Reset();
+		ActorsByClass.Reset();
+		ActorsByTag.Reset();
+		ActorsByComponentClass.Reset();
+		ActorsByFolder.Reset();
+		IndexedKeys.Reset();
+		Spatial.Reset();
+		bStale = false;
+	}
+
+	auto FWorldActorIndex::Reconcile(UWorld* World) -> void {
+		TSet<FObjectKey> Live;
+		Live.Reserve(IndexedKeys.Num());
+
+		for (TActorIterator<AActor> It(World); It; ++It) {
+			AActor* Actor = *It;
+			const FObjectKey Key(Actor);
+			Live.Add(Key);
+
+			const FIndexedKeys* Keys = IndexedKeys.Find(Key);
+			if (!Keys) {
+				AddActor(Actor);
+				continue;
+			}
+
+			// Undo can restore an earlier name or label without a rename or label event
+			if (FindByName(Actor->GetFName()) != Actor) {
+				ActorsByName.Add(Actor->GetFName(), Actor);
+			}
+			if (Keys->Label != Actor->GetActorLabel()) {
+				RelabelActor(Actor);
+			}
+		}
+
+		// Drop the entries left under names those actors no longer have
+		for (auto It = ActorsByName.CreateIterator(); It; ++It) {
+			const AActor* Actor = It.Value().Get();
+			if (Actor && Actor->GetFName() != It.Key()) {
+				It.RemoveCurrent();
+			}
+		}
+
+		TArray<FObjectKey> Gone;
+		for (const TPair<FObjectKey, FIndexedKeys>& Pair : IndexedKeys) {
+			if (!Live.Contains(Pair.Key)) {
+				Gone.Add(Pair.Key);
+			}
+		}
+		for (const FObjectKey& Key : Gone) {
+			// Deleted actors stay in memory (flagged as garbage) for undo; collected ones leave only weak entries
+			if (const AActor* Actor = Cast<AActor>(Key.ResolveObjectPtrEvenIfGarbage())) {
+				RemoveActor(Actor);
+			}
+			else {
+				IndexedKeys.Remove(Key);
+			}
+		}
+
+		bStale = false;
+	}
+
+	auto FWorldActorIndex::FindByPattern(const FNamePattern& Pattern,
+	                                     const bool bIncludeLabels,
+	                                     TArray<AActor*>& OutActors) const -> void {
+		struct FNameEntry {
+			FName Name;
+			const FString* Label;
+			AActor* Actor;
+		};
+
+		TArray<FNameEntry> Snapshot;
+		Snapshot.Reserve(ActorsByName.Num());
+		for (const TPair<FName, TWeakObjectPtr<AActor>>& Entry : ActorsByName) {
+			AActor* Actor = Entry.Value.Get();
+			if (!IsValid(Actor) || Actor->GetFName() != Entry.Key) {
+				continue;
+			}
+
+			const FIndexedKeys* Keys = bIncludeLabels ? IndexedKeys.Find(FObjectKey(Actor)) : nullptr;
+			Snapshot.Add({Entry.Key, Keys ? &Keys->Label : nullptr, Actor});
+		}
+
+		// Workers only read interned names and labels owned by this index, neither of which
+		// can change while the game thread is blocked in ParallelFor
+		TArray<bool> Matched;
+		Matched.SetNumZeroed(Snapshot.Num());
+
+		ParallelFor(
+			TEXT("UnrealMCP.MatchActorNames"),
+			Snapshot.Num(),
+			PatternMatchBatchSize,
+			[&Snapshot, &Matched, &Pattern](const int32 Index) {
+				const FNameEntry& Entry = Snapshot[Index];
+
+				TStringBuilder<256> NameBuffer;
+				Entry.Name.AppendString(NameBuffer);
+
+				Matched[Index] = Pattern.Matches(NameBuffer.ToView()) || (Entry.Label && Pattern.Matches(*Entry.Label));
+			}
+		);
+
+		for (int32 Index = 0; Index < Snapshot.Num(); ++Index) {
+			if (Matched[Index]) {
+				OutActors.Add(Snapshot[Index].Actor);
+			}
+		}
+	}
+
+	// ============ FActorIndex ============
+
+	TMap<FObjectKey, FWorldActorIndex> FActorIndex::WorldIndices;
+	bool FActorIndex::bInitialized = false;
+
+	FDelegateHandle FActorIndex::ActorAddedHandle;
+	FDelegateHandle FActorIndex::ActorDeletedHandle;
+	FDelegateHandle FActorIndex::ActorListChangedHandle;
+	FDelegateHandle FActorIndex::ActorMovedHandle;
+	FDelegateHandle FActorIndex::ActorLabelChangedHandle;
+	FDelegateHandle FActorIndex::ActorFolderChangedHandle;
+	FDelegateHandle FActorIndex::ObjectPropertyChangedHandle;
+	FDelegateHandle FActorIndex::ObjectRenamedHandle;
+	FDelegateHandle FActorIndex::LevelAddedHandle;
+	FDelegateHandle FActorIndex::LevelRemovedHandle;
+	FDelegateHandle FActorIndex::WorldCleanupHandle;
+	FDelegateHandle FActorIndex::MapChangeHandle;
+
+	auto FActorIndex::Initialize() -> void {
+		if (bInitialized || !GEngine) {
+			return;
+		}
+
+		ActorAddedHandle = GEngine->OnLevelActorAdded().AddStatic(&FActorIndex::HandleActorAdded);
+		ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddStatic(&FActorIndex::HandleActorDeleted);
+		ActorListChangedHandle = GEngine->OnLevelActorListChanged().AddStatic(&FActorIndex::HandleActorListChanged);
+		ActorMovedHandle = GEngine->OnActorMoved().AddStatic(&FActorIndex::HandleActorMoved);
+		ActorLabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddStatic(&FActorIndex::HandleActorLabelChanged);
+		ActorFolderChangedHandle = GEngine->OnLevelActorFolderChanged().AddStatic(&FActorIndex::HandleActorFolderChanged);
+		ObjectPropertyChangedHandle =
+			FCoreUObjectDelegates::OnObjectPropertyChanged.AddStatic(&FActorIndex::HandleObjectPropertyChanged);
+		ObjectRenamedHandle = FCoreUObjectDelegates::OnObjectRenamed.AddStatic(&FActorIndex::HandleObjectRenamed);
+		LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddStatic(&FActorIndex::HandleLevelAdded);
+		LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddStatic(&FActorIndex::HandleLevelRemoved);
+		WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddStatic(&FActorIndex::HandleWorldCleanup);
+		MapChangeHandle = FEditorDelegates::MapChange.AddStatic(&FActorIndex::HandleMapChange);
+
+		bInitialized = true;
+		UE_LOG(LogMCPActorIndex, Display, TEXT("Actor index initialized"));
+	}
+
+	auto FActorIndex::Shutdown() -> void {
+		if (!bInitialized) {
+			return;
+		}
+
+		if (GEngine) {
+			GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+			GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+			GEngine->OnLevelActorListChanged().Remove(ActorListChangedHandle);
+			GEngine->OnActorMoved().Remove(ActorMovedHandle);
+			GEngine->OnLevelActorFolderChanged().Remove(ActorFolderChangedHandle);
+		}
+		FCoreDelegates::OnActorLabelChanged.Remove(ActorLabelChangedHandle);
+		FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+		FCoreUObjectDelegates::OnObjectRenamed.Remove(ObjectRenamedHandle);
+		FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+		FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+		FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+		FEditorDelegates::MapChange.Remove(MapChangeHandle);
+
+		WorldIndices.Empty();
+		bInitialized = false;
+	}
+
+	auto FActorIndex::FindActor(UWorld* World, const FString& ActorName, const bool bIncludeLabels) -> AActor* {
+		if (ActorName.IsEmpty()) {
+			return nullptr;
+		}
+
+		FWorldActorIndex* Index = GetWorldIndex(World);
+		if (!Index) {
+			return nullptr;
+		}
+
+		// FNAME_Find keeps unknown names (e.g. labels) from being added to the global name table
+		if (const FName Name(*ActorName, FNAME_Find); !Name.IsNone()) {
+			if (AActor* Actor = Index->FindByName(Name)) {
+				return Actor;
+			}
+		}
+
+		return bIncludeLabels ? Index->FindByLabel(ActorName) : nullptr;
+	}
+
+	auto FActorIndex::FindByName(UWorld* World, const FName ActorName) -> AActor* {
+		FWorldActorIndex* Index = GetWorldIndex(World);
+		return Index ? Index->FindByName(ActorName) : nullptr;
+	}
+
+	auto FActorIndex::FindByLabel(UWorld* World, const FString& ActorLabel) -> AActor* {
+		FWorldActorIndex* Index = GetWorldIndex(World);
+		return Index ? Index->FindByLabel(ActorLabel) : nullptr;
+	}
+
+	auto FActorIndex::GetWorldIndex(UWorld* World) -> FWorldActorIndex* {
+		if (!World) {
+			return nullptr;
+		}
+
+		// Without event subscriptions a built index would silently go stale
+		Initialize();
+
+		if (FWorldActorIndex* Existing = WorldIndices.Find(FObjectKey(World))) {
+			if (Existing->IsStale()) {
+				ReconcileWorldIndex(World, *Existing);
+			}
+			return Existing;
+		}
+
+		FWorldActorIndex& Index = WorldIndices.Add(FObjectKey(World));
+		BuildWorldIndex(World, Index);
+		return &Index;
+	}
+
+	auto FActorIndex::Invalidate(const UWorld* World) -> void {
+		WorldIndices.Remove(FObjectKey(World));
+	}
+
+	auto FActorIndex::NotifyActorMoved(AActor* Actor) -> void {
+		HandleActorMoved(Actor);
+		FLevelDigest::MarkDirty(Actor);
+	}
+
+	auto FActorIndex::NotifyActorChanged(AActor* Actor) -> void {
+		FLevelDigest::MarkDirty(Actor);
+		if (FWorldActorIndex* Index = Actor ? FindBuiltIndex(Actor->GetWorld()) : nullptr) {
+			Index->RefreshActorAttributes(Actor);
+		}
+	}
+
+	auto FActorIndex::QueryActors(UWorld* World, const FActorIndexQuery& Query, TArray<AActor*>& OutActors) -> void {
+		if (const FWorldActorIndex* Index = GetWorldIndex(World)) {
+			Index->QueryActors(Query, OutActors);
+		}
+	}
+
+	auto FActorIndex::FindByPattern(
+		UWorld* World,
+		const FNamePattern& Pattern,
+		const bool bIncludeLabels,
+		TArray<AActor*>& OutActors
+	) -> void {
+		if (const FWorldActorIndex* Index = GetWorldIndex(World)) {
+			Index->FindByPattern(Pattern, bIncludeLabels, OutActors);
+		}
+	}
+
+	auto FActorIndex::BuildWorldIndex(UWorld* World, FWorldActorIndex& Index) -> void {
+		const double StartTime = FPlatformTime::Seconds();
+
+		Index.Reset();
+		for (TActorIterator<AActor> It(World); It; ++It) {
+			Index.AddActor(*It);
+		}
+
+		UE_LOG(LogMCPActorIndex,
+		       Verbose,
+		       TEXT("Indexed %d actors of world '%s' in %.3f ms"),
+		       Index.Num(),
+		       *World->GetName(),
+		       (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+
+	auto FActorIndex::ReconcileWorldIndex(UWorld* World, FWorldActorIndex& Index) -> void {
+		const double StartTime = FPlatformTime::Seconds();
+		const int32 NumBefore = Index.Num();
+
+		Index.Reconcile(World);
+
+		UE_LOG(LogMCPActorIndex,
+		       Verbose,
+		       TEXT("Reconciled actor index of world '%s' (%d -> %d actors) in %.3f ms"),
+		       *World->GetName(),
+		       NumBefore,
+		       Index.Num(),
+		       (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+
+	auto FActorIndex::FindBuiltIndex(const UWorld* World) -> FWorldActorIndex* {
+		// Worlds that were never queried are not tracked; they are built on first lookup
+		return World ? WorldIndices.Find(FObjectKey(World)) : nullptr;
+	}
+
+	auto FActorIndex::HandleActorAdded(AActor* Actor) -> void {
+		if (FWorldActorIndex* Index = Actor ? FindBuiltIndex(Actor->GetWorld()) : nullptr) {
+			Index->AddActor(Actor);
+		}
+	}
+
+	auto FActorIndex::HandleActorDeleted(AActor* Actor) -> void {
+		if (FWorldActorIndex* Index = Actor ? FindBuiltIndex(Actor->GetWorld()) : nullptr) {
+			Index->RemoveActor(Actor);
+		}
+	}
+
+	auto FActorIndex::HandleActorListChanged() -> void {
+		// Bulk changes (undo/redo, paste, level reloads) carry no per-actor detail; reconcile on the next lookup
+		for (TPair<FObjectKey, FWorldActorIndex>& Pair : WorldIndices) {
+			Pair.Value.MarkStale();
+		}
+	}
+
+	auto FActorIndex::HandleActorMoved(AActor* Actor) -> void {
+		if (FWorldActorIndex* Index = Actor ? FindBuiltIndex(Actor->GetWorld()) : nullptr) {
+			Index->MoveActor(Actor);
+		}
+	}
+
+	auto FActorIndex::HandleActorLabelChanged(AActor* Actor) -> void {
+		if (FWorldActorIndex* Index = Actor ? FindBuiltIndex(Actor->GetWorld()) : nullptr) {
+			Index->RelabelActor(Actor);
+		}
+	}
+
+	auto FActorIndex::HandleActorFolderChanged(const AActor* Actor, [[maybe_unused]] FName OldPath) -> void {
+		NotifyActorChanged(const_cast<AActor*>(Actor));
+	}
+
+	auto FActorIndex::HandleObjectPropertyChanged(UObject* Object, [[maybe_unused]] FPropertyChangedEvent& Event) -> void {
+		// Tag and component edits arrive as property changes on the actor or one of its components
+		AActor* Actor = Cast<AActor>(Object);
+		if (!Actor) {
+			if (const UActorComponent* Component = Cast<UActorComponent>(Object)) {
+				Actor = Component->GetOwner();
+			}
+		}
+
+		NotifyActorChanged(Actor);
+	}
+
+	auto FActorIndex::HandleObjectRenamed(UObject* Object, UObject* OldOuter, const FName OldName) -> void {
+		AActor* Actor = Cast<AActor>(Object);
+		if (!Actor) {
+			return;
+		}
+
+		// A rename can also move the actor to another level (and possibly another world)
+		const UWorld* OldWorld = OldOuter ? OldOuter->GetWorld() : nullptr;
+		const UWorld* NewWorld = Actor->GetWorld();
+
+		if (OldWorld && OldWorld != NewWorld) {
+			if (FWorldActorIndex* OldIndex = FindBuiltIndex(OldWorld)) {
+				OldIndex->RenameActor(Actor, OldName);
+				OldIndex->RemoveActor(Actor);
+			}
+			HandleActorAdded(Actor);
+			return;
+		}
+
+		if (FWorldActorIndex* Index = FindBuiltIndex(NewWorld)) {
+			Index->RenameActor(Actor, OldName);
+		}
+	}
+
+	auto FActorIndex::HandleLevelAdded(ULevel* Level, UWorld* World) -> void {
+		FWorldActorIndex* Index = FindBuiltIndex(World);
+		if (!Index || !Level) {
+			return;
+		}
+
+		for (AActor* Actor : Level->Actors) {
+			Index->AddActor(Actor);
+		}
+	}
+
+	auto FActorIndex::HandleLevelRemoved(ULevel* Level, UWorld* World) -> void {
+		FWorldActorIndex* Index = FindBuiltIndex(World);
+		if (!Index) {
+			return;
+		}
+
+		// A null level means every level of the world was removed
+		if (!Level) {
+			Invalidate(World);
+			return;
+		}
+
+		for (const AActor* Actor : Level->Actors) {
+			Index->RemoveActor(Actor);
+		}
+	}
+
+	auto FActorIndex::HandleWorldCleanup(UWorld* World,
+	                                     [[maybe_unused]] bool bSessionEnded,
+	                                     [[maybe_unused]] bool bCleanupResources) -> void {
+		Invalidate(World);
+	}
+
+	auto FActorIndex::HandleMapChange([[maybe_unused]] uint32 MapChangeFlags) -> void {
+		WorldIndices.Empty();
+	}
+
+}
@@ -0,0 +1,421 @@
+#include "Core/ActorSpatialIndex.h"
+#include "GameFramework/Actor.h"
+#include "Math/VectorRegister.h"
+
+namespace UnrealMCP {
+
+	namespace {
+		/** Full scans are cheaper than visiting this many grid cells */
+		constexpr int64 MaxCellsPerQuery = 4096;
+
+		struct FMaxDistanceFirst {
+			auto operator()(const TPair<float, int32>& A, const TPair<float, int32>& B) const -> bool {
+				return A.Key > B.Key;
+			}
+		};
+	}
+
+	auto FActorSpatialIndex::UpdateActor(AActor* Actor) -> void {
+		if (!IsValid(Actor)) {
+			return;
+		}
+
+		const FBox NewBounds = GetActorBounds(Actor);
+
+		if (const int32* ExistingSlot = SlotByActor.Find(FObjectKey(Actor))) {
+			const int32 Slot = *ExistingSlot;
+			const FBox OldBounds = ReadBounds(Slot);
+
+			WriteBounds(Slot, NewBounds);
+			const FBox StoredBounds = ReadBounds(Slot);
+			if (StoredBounds.Min == OldBounds.Min && StoredBounds.Max == OldBounds.Max) {
+				return;
+			}
+
+			UnlinkCells(Slot, OldBounds);
+			LinkCells(Slot, StoredBounds);
+			return;
+		}
+
+		const int32 Slot = AllocateSlot();
+		SlotActors[Slot] = Actor;
+		SlotByActor.Add(FObjectKey(Actor), Slot);
+		WriteBounds(Slot, NewBounds);
+		LinkCells(Slot, ReadBounds(Slot));
+	}
+
+	auto FActorSpatialIndex::RemoveActor(const AActor* Actor) -> void {
+		int32 Slot = INDEX_NONE;
+		if (!Actor || !SlotByActor.RemoveAndCopyValue(FObjectKey(Actor), Slot)) {
+			return;
+		}
+
+		UnlinkCells(Slot, ReadBounds(Slot));
+
+		// Inverted bounds never pass a region test, so freed slots need no special casing in scans
+		WriteBounds(Slot, FBox(ForceInit));
+		SlotActors[Slot].Reset();
+		FreeSlots.Add(Slot);
+	}
+
+	auto FActorSpatialIndex::Reset() -> void {
+		MinX.Reset();
+		MinY.Reset();
+		MinZ.Reset();
+		MaxX.Reset();
+		MaxY.Reset();
+		MaxZ.Reset();
+		SlotActors.Reset();
+		FreeSlots.Reset();
+		SlotByActor.Reset();
+		Cells.Reset();
+		OversizedSlots.Reset();
+	}
+
+	auto FActorSpatialIndex::QueryBox(const FBox& Box, TArray<AActor*>& OutActors) const -> void {
+		TArray<int32> Candidates;
+		if (GatherCandidates(Box, Candidates)) {
+			TestSlots(&Candidates, Box, FVector::ZeroVector, 0.0, OutActors);
+		}
+		else {
+			TestSlots(nullptr, Box, FVector::ZeroVector, 0.0, OutActors);
+		}
+	}
+
+	auto FActorSpatialIndex::QuerySphere(const FVector& Center, const double Radius, TArray<AActor*>& OutActors) const -> void {
+		if (Radius <= 0.0) {
+			return;
+		}
+
+		const FBox Box(Center - FVector(Radius), Center + FVector(Radius));
+
+		TArray<int32> Candidates;
+		if (GatherCandidates(Box, Candidates)) {
+			TestSlots(&Candidates, Box, Center, Radius, OutActors);
+		}
+		else {
+			TestSlots(nullptr, Box, Center, Radius, OutActors);
+		}
+	}
+
+	auto FActorSpatialIndex::QueryNearest(
+		const FVector& Point,
+		const double MaxDistance,
+		const TFunctionRef<bool(const AActor*)>& Accept,
+		const int32 MaxCount,
+		TArray<TPair<AActor*, double>>& OutHits
+	) const -> void {
+		if (MaxCount <= 0) {
+			return;
+		}
+
+		const float MaxDistSquared = MaxDistance > 0.0
+			                             ? static_cast<float>(MaxDistance * MaxDistance)
+			                             : TNumericLimits<float>::Max();
+
+		const VectorRegister4Float PX = VectorSetFloat1(static_cast<float>(Point.X));
+		const VectorRegister4Float PY = VectorSetFloat1(static_cast<float>(Point.Y));
+		const VectorRegister4Float PZ = VectorSetFloat1(static_cast<float>(Point.Z));
+		const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+
+		// Max-heap on squared distance holding the best MaxCount candidates seen so far
+		TArray<TPair<float, int32>> Heap;
+		Heap.Reserve(MaxCount + 1);
+
+		alignas(16) float DistSquared[4];
+		const int32 NumSlots = SlotActors.Num();
+
+		for (int32 Base = 0; Base < NumSlots; Base += 4) {
+			const VectorRegister4Float CX = VectorMultiply(VectorAdd(VectorLoad(&MinX[Base]), VectorLoad(&MaxX[Base])), Half);
+			const VectorRegister4Float CY = VectorMultiply(VectorAdd(VectorLoad(&MinY[Base]), VectorLoad(&MaxY[Base])), Half);
+			const VectorRegister4Float CZ = VectorMultiply(VectorAdd(VectorLoad(&MinZ[Base]), VectorLoad(&MaxZ[Base])), Half);
+
+			const VectorRegister4Float DX = VectorSubtract(CX, PX);
+			const VectorRegister4Float DY = VectorSubtract(CY, PY);
+			const VectorRegister4Float DZ = VectorSubtract(CZ, PZ);
+			VectorStoreAligned(VectorMultiplyAdd(DZ, DZ, VectorMultiplyAdd(DY, DY, VectorMultiply(DX, DX))), DistSquared);
+
+			for (int32 Lane = 0; Lane < 4 && Base + Lane < NumSlots; ++Lane) {
+				const float D2 = DistSquared[Lane];
+				if (!(D2 <= MaxDistSquared)) {
+					continue;
+				}
+				if (Heap.Num() == MaxCount && D2 >= Heap.HeapTop().Key) {
+					continue;
+				}
+
+				// Only candidates that would enter the result pay for the filter
+				const AActor* Actor = SlotActors[Base + Lane].Get();
+				if (!Actor || !Accept(Actor)) {
+					continue;
+				}
+
+				Heap.HeapPush(TPair<float, int32>(D2, Base + Lane), FMaxDistanceFirst());
+				if (Heap.Num() > MaxCount) {
+					Heap.HeapPopDiscard(FMaxDistanceFirst());
+				}
+			}
+		}
+
+		Heap.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B) {
+			return A.Key < B.Key;
+		});
+
+		OutHits.Reserve(OutHits.Num() + Heap.Num());
+		for (const TPair<float, int32>& Entry : Heap) {
+			OutHits.Emplace(SlotActors[Entry.Value].Get(), FMath::Sqrt(static_cast<double>(Entry.Key)));
+		}
+	}
+
+	auto FActorSpatialIndex::AllocateSlot() -> int32 {
+		if (FreeSlots.Num() > 0) {
+			return FreeSlots.Pop(EAllowShrinking::No);
+		}
+
+		const int32 Slot = SlotActors.AddDefaulted();
+
+		// Keep the bounds arrays padded to a whole SIMD register
+		if (Slot >= MinX.Num()) {
+			constexpr float Inf = TNumericLimits<float>::Max();
+			for (int32 Lane = 0; Lane < 4; ++Lane) {
+				MinX.Add(Inf);
+				MinY.Add(Inf);
+				MinZ.Add(Inf);
+				MaxX.Add(-Inf);
+				MaxY.Add(-Inf);
+				MaxZ.Add(-Inf);
+			}
+		}
+
+		return Slot;
+	}
+
+	auto FActorSpatialIndex::WriteBounds(const int32 Slot, const FBox& Bounds) -> void {
+		if (!Bounds.IsValid) {
+			constexpr float Inf = TNumericLimits<float>::Max();
+			MinX[Slot] = MinY[Slot] = MinZ[Slot] = Inf;
+			MaxX[Slot] = MaxY[Slot] = MaxZ[Slot] = -Inf;
+			return;
+		}
+
+		MinX[Slot] = static_cast<float>(Bounds.Min.X);
+		MinY[Slot] = static_cast<float>(Bounds.Min.Y);
+		MinZ[Slot] = static_cast<float>(Bounds.Min.Z);
+		MaxX[Slot] = static_cast<float>(Bounds.Max.X);
+		MaxY[Slot] = static_cast<float>(Bounds.Max.Y);
+		MaxZ[Slot] = static_cast<float>(Bounds.Max.Z);
+	}
+
+	auto FActorSpatialIndex::ReadBounds(const int32 Slot) const -> FBox {
+		if (MinX[Slot] > MaxX[Slot]) {
+			return FBox(ForceInit);
+		}
+
+		return FBox(FVector(MinX[Slot], MinY[Slot], MinZ[Slot]), FVector(MaxX[Slot], MaxY[Slot], MaxZ[Slot]));
+	}
+
+	auto FActorSpatialIndex::LinkCells(const int32 Slot, const FBox& Bounds) -> void {
+		if (!Bounds.IsValid) {
+			return;
+		}
+
+		FIntVector CellMin, CellMax;
+		CellRange(Bounds, CellMin, CellMax);
+
+		const FIntVector Span = CellMax - CellMin;
+		if (Span.GetMax() >= MaxCellsPerAxis) {
+			OversizedSlots.Add(Slot);
+			return;
+		}
+
+		for (int32 X = CellMin.X; X <= CellMax.X; ++X) {
+			for (int32 Y = CellMin.Y; Y <= CellMax.Y; ++Y) {
+				for (int32 Z = CellMin.Z; Z <= CellMax.Z; ++Z) {
+					Cells.FindOrAdd(FIntVector(X, Y, Z)).Add(Slot);
+				}
+			}
+		}
+	}
+
+	auto FActorSpatialIndex::UnlinkCells(const int32 Slot, const FBox& Bounds) -> void {
+		if (!Bounds.IsValid) {
+			return;
+		}
+
+		if (OversizedSlots.Remove(Slot) > 0) {
+			return;
+		}
+
+		FIntVector CellMin, CellMax;
+		CellRange(Bounds, CellMin, CellMax);
+
+		for (int32 X = CellMin.X; X <= CellMax.X; ++X) {
+			for (int32 Y = CellMin.Y; Y <= CellMax.Y; ++Y) {
+				for (int32 Z = CellMin.Z; Z <= CellMax.Z; ++Z) {
+					const FIntVector Cell(X, Y, Z);
+					if (TArray<int32>* CellSlots = Cells.Find(Cell)) {
+						CellSlots->RemoveSingleSwap(Slot, EAllowShrinking::No);
+						if (CellSlots->Num() == 0) {
+							Cells.Remove(Cell);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	auto FActorSpatialIndex::GetActorBounds(const AActor* Actor) -> FBox {
+		FVector Origin;
+		FVector Extent;
+		Actor->GetActorBounds(false, Origin, Extent, true);
+
+		// Actors without primitive components are indexed as a point at their location
+		if (Extent.IsNearlyZero()) {
+			const FVector Location = Actor->GetActorLocation();
+			return FBox(Location, Location);
+		}
+
+		return FBox(Origin - Extent, Origin + Extent);
+	}
+
+	auto FActorSpatialIndex::CellRange(const FBox& Bounds, FIntVector& OutMin, FIntVector& OutMax) -> void {
+		auto ToCell = [](const double Value) -> int32 {
+			return static_cast<int32>(FMath::Clamp(FMath::FloorToDouble(Value / CellSize), -1.0e9, 1.0e9));
+		};
+
+		OutMin = FIntVector(ToCell(Bounds.Min.X), ToCell(Bounds.Min.Y), ToCell(Bounds.Min.Z));
+		OutMax = FIntVector(ToCell(Bounds.Max.X), ToCell(Bounds.Max.Y), ToCell(Bounds.Max.Z));
+	}
+
+	auto FActorSpatialIndex::GatherCandidates(const FBox& Box, TArray<int32>& OutSlots) const -> bool {
+		FIntVector CellMin, CellMax;
+		CellRange(Box, CellMin, CellMax);
+
+		const FIntVector Span = CellMax - CellMin + FIntVector(1);
+		const int64 CellCount = static_cast<int64>(Span.X) * Span.Y * Span.Z;
+		if (CellCount > MaxCellsPerQuery || CellCount > Cells.Num()) {
+			return false;
+		}
+
+		TBitArray<> Seen(false, SlotActors.Num());
+		auto AddSlot = [&](const int32 Slot) {
+			if (!Seen[Slot]) {
+				Seen[Slot] = true;
+				OutSlots.Add(Slot);
+			}
+		};
+
+		for (int32 X = CellMin.X; X <= CellMax.X; ++X) {
+			for (int32 Y = CellMin.Y; Y <= CellMax.Y; ++Y) {
+				for (int32 Z = CellMin.Z; Z <= CellMax.Z; ++Z) {
+					if (const TArray<int32>* CellSlots = Cells.Find(FIntVector(X, Y, Z))) {
+						for (const int32 Slot : *CellSlots) {
+							AddSlot(Slot);
+						}
+					}
+				}
+			}
+		}
+
+		for (const int32 Slot : OversizedSlots) {
+			AddSlot(Slot);
+		}
+
+		return true;
+	}
+
+	auto FActorSpatialIndex::TestSlots(
+		const TArray<int32>* Slots,
+		const FBox& Box,
+		const FVector& SphereCenter,
+		const double Radius,
+		TArray<AActor*>& OutActors
+	) const -> void {
+		const bool bSphere = Radius > 0.0;
+
+		const VectorRegister4Float QMinX = VectorSetFloat1(static_cast<float>(Box.Min.X));
+		const VectorRegister4Float QMinY = VectorSetFloat1(static_cast<float>(Box.Min.Y));
+		const VectorRegister4Float QMinZ = VectorSetFloat1(static_cast<float>(Box.Min.Z));
+		const VectorRegister4Float QMaxX = VectorSetFloat1(static_cast<float>(Box.Max.X));
+		const VectorRegister4Float QMaxY = VectorSetFloat1(static_cast<float>(Box.Max.Y));
+		const VectorRegister4Float QMaxZ = VectorSetFloat1(static_cast<float>(Box.Max.Z));
+		const VectorRegister4Float CX = VectorSetFloat1(static_cast<float>(SphereCenter.X));
+		const VectorRegister4Float CY = VectorSetFloat1(static_cast<float>(SphereCenter.Y));
+		const VectorRegister4Float CZ = VectorSetFloat1(static_cast<float>(SphereCenter.Z));
+		const VectorRegister4Float RadiusSquared = VectorSetFloat1(static_cast<float>(Radius * Radius));
+		const VectorRegister4Float Zero = VectorZeroFloat();
+
+		// Returns a 4-bit lane mask of boxes that pass the region test
+		auto TestLanes = [&](const float* LMinX, const float* LMinY, const float* LMinZ,
+		                     const float* LMaxX, const float* LMaxY, const float* LMaxZ) -> int32 {
+			const VectorRegister4Float BMinX = VectorLoad(LMinX);
+			const VectorRegister4Float BMinY = VectorLoad(LMinY);
+			const VectorRegister4Float BMinZ = VectorLoad(LMinZ);
+			const VectorRegister4Float BMaxX = VectorLoad(LMaxX);
+			const VectorRegister4Float BMaxY = VectorLoad(LMaxY);
+			const VectorRegister4Float BMaxZ = VectorLoad(LMaxZ);
+
+			if (bSphere) {
+				// Squared distance from the sphere center to the closest point of each box
+				const VectorRegister4Float DX = VectorMax(VectorMax(VectorSubtract(BMinX, CX), VectorSubtract(CX, BMaxX)), Zero);
+				const VectorRegister4Float DY = VectorMax(VectorMax(VectorSubtract(BMinY, CY), VectorSubtract(CY, BMaxY)), Zero);
+				const VectorRegister4Float DZ = VectorMax(VectorMax(VectorSubtract(BMinZ, CZ), VectorSubtract(CZ, BMaxZ)), Zero);
+				const VectorRegister4Float DistSquared =
+					VectorMultiplyAdd(DZ, DZ, VectorMultiplyAdd(DY, DY, VectorMultiply(DX, DX)));
+				return VectorMaskBits(VectorCompareLE(DistSquared, RadiusSquared));
+			}
+
+			VectorRegister4Float Mask = VectorBitwiseAnd(VectorCompareLE(BMinX, QMaxX), VectorCompareGE(BMaxX, QMinX));
+			Mask = VectorBitwiseAnd(Mask, VectorBitwiseAnd(VectorCompareLE(BMinY, QMaxY), VectorCompareGE(BMaxY, QMinY)));
+			Mask = VectorBitwiseAnd(Mask, VectorBitwiseAnd(VectorCompareLE(BMinZ, QMaxZ), VectorCompareGE(BMaxZ, QMinZ)));
+			return VectorMaskBits(Mask);
+		};
+
+		auto EmitLanes = [&](const int32 Mask, const TFunctionRef<int32(int32)>& LaneToSlot, const int32 NumLanes) {
+			for (int32 Lane = 0; Lane < NumLanes; ++Lane) {
+				if (Mask & (1 << Lane)) {
+					if (AActor* Actor = SlotActors[LaneToSlot(Lane)].Get()) {
+						OutActors.Add(Actor);
+					}
+				}
+			}
+		};
+
+		if (!Slots) {
+			// Contiguous scan straight over the SoA store
+			const int32 NumSlots = SlotActors.Num();
+			for (int32 Base = 0; Base < NumSlots; Base += 4) {
+				const int32 Mask = TestLanes(&MinX[Base], &MinY[Base], &MinZ[Base], &MaxX[Base], &MaxY[Base], &MaxZ[Base]);
+				if (Mask != 0) {
+					EmitLanes(Mask, [Base](const int32 Lane) { return Base + Lane; }, FMath::Min(4, NumSlots - Base));
+				}
+			}
+			return;
+		}
+
+		// Gather scattered candidate slots into 4-wide batches
+		alignas(16) float GMinX[4], GMinY[4], GMinZ[4], GMaxX[4], GMaxY[4], GMaxZ[4];
+		int32 GSlots[4];
+
+		for (int32 Base = 0; Base < Slots->Num(); Base += 4) {
+			const int32 NumLanes = FMath::Min(4, Slots->Num() - Base);
+			for (int32 Lane = 0; Lane < 4; ++Lane) {
+				// Unused lanes repeat the last slot; they are masked out by NumLanes
+				const int32 Slot = (*Slots)[Base + FMath::Min(Lane, NumLanes - 1)];
+				GSlots[Lane] = Slot;
+				GMinX[Lane] = MinX[Slot];
+				GMinY[Lane] = MinY[Slot];
+				GMinZ[Lane] = MinZ[Slot];
+				GMaxX[Lane] = MaxX[Slot];
+				GMaxY[Lane] = MaxY[Slot];
+				GMaxZ[Lane] = MaxZ[Slot];
+			}
+
+			const int32 Mask = TestLanes(GMinX, GMinY, GMinZ, GMaxX, GMaxY, GMaxZ);
+			if (Mask != 0) {
+				EmitLanes(Mask, [&GSlots](const int32 Lane) { return GSlots[Lane]; }, NumLanes);
+			}
+		}
+	}
+
+}
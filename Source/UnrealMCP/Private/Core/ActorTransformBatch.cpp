@@ -0,0 +1,165 @@
+#include "Core/ActorTransformBatch.h"
+#include "Math/VectorRegister.h"
+
+namespace UnrealMCP {
+
+	auto FActorTransformBatch::Reserve(const int32 Num) -> void {
+		const int32 Padded = Align(Num, 4);
+		for (TArray<double>* Axis : {&LocationX, &LocationY, &LocationZ, &ScaleX, &ScaleY, &ScaleZ}) {
+			Axis->Reserve(Padded);
+		}
+		Rotations.Reserve(Num);
+	}
+
+	auto FActorTransformBatch::Add(const FTransform& Transform) -> int32 {
+		const int32 Index = Rotations.Add(Transform.GetRotation());
+
+		// Grow the SoA store one quad at a time so every 4-wide load stays in bounds
+		if (Index == PaddedNum()) {
+			for (TArray<double>* Axis : {&LocationX, &LocationY, &LocationZ, &ScaleX, &ScaleY, &ScaleZ}) {
+				Axis->AddZeroed(4);
+			}
+		}
+
+		const FVector Location = Transform.GetLocation();
+		const FVector Scale = Transform.GetScale3D();
+		LocationX[Index] = Location.X;
+		LocationY[Index] = Location.Y;
+		LocationZ[Index] = Location.Z;
+		ScaleX[Index] = Scale.X;
+		ScaleY[Index] = Scale.Y;
+		ScaleZ[Index] = Scale.Z;
+		return Index;
+	}
+
+	auto FActorTransformBatch::GetTransform(const int32 Index) const -> FTransform {
+		return FTransform(
+			Rotations[Index],
+			FVector(LocationX[Index], LocationY[Index], LocationZ[Index]),
+			FVector(ScaleX[Index], ScaleY[Index], ScaleZ[Index])
+		);
+	}
+
+	auto FActorTransformBatch::GetCentroid() const -> FVector {
+		const int32 Count = Num();
+		if (Count == 0) {
+			return FVector::ZeroVector;
+		}
+
+		// Padding lanes may hold transformed values, so only whole quads go through SIMD
+		const int32 FullQuads = Count & ~3;
+		VectorRegister4Double SumX = VectorZeroDouble();
+		VectorRegister4Double SumY = VectorZeroDouble();
+		VectorRegister4Double SumZ = VectorZeroDouble();
+		for (int32 Base = 0; Base < FullQuads; Base += 4) {
+			SumX = VectorAdd(SumX, VectorLoad(&LocationX[Base]));
+			SumY = VectorAdd(SumY, VectorLoad(&LocationY[Base]));
+			SumZ = VectorAdd(SumZ, VectorLoad(&LocationZ[Base]));
+		}
+
+		alignas(16) double Lanes[3][4];
+		VectorStoreAligned(SumX, Lanes[0]);
+		VectorStoreAligned(SumY, Lanes[1]);
+		VectorStoreAligned(SumZ, Lanes[2]);
+
+		FVector Sum(
+			Lanes[0][0] + Lanes[0][1] + Lanes[0][2] + Lanes[0][3],
+			Lanes[1][0] + Lanes[1][1] + Lanes[1][2] + Lanes[1][3],
+			Lanes[2][0] + Lanes[2][1] + Lanes[2][2] + Lanes[2][3]
+		);
+		for (int32 Index = FullQuads; Index < Count; ++Index) {
+			Sum += FVector(LocationX[Index], LocationY[Index], LocationZ[Index]);
+		}
+		return Sum / Count;
+	}
+
+	auto FActorTransformBatch::Translate(const FVector& Offset) -> void {
+		const VectorRegister4Double OX = VectorSetFloat1(Offset.X);
+		const VectorRegister4Double OY = VectorSetFloat1(Offset.Y);
+		const VectorRegister4Double OZ = VectorSetFloat1(Offset.Z);
+
+		for (int32 Base = 0; Base < PaddedNum(); Base += 4) {
+			VectorStore(VectorAdd(VectorLoad(&LocationX[Base]), OX), &LocationX[Base]);
+			VectorStore(VectorAdd(VectorLoad(&LocationY[Base]), OY), &LocationY[Base]);
+			VectorStore(VectorAdd(VectorLoad(&LocationZ[Base]), OZ), &LocationZ[Base]);
+		}
+	}
+
+	auto FActorTransformBatch::RotateAround(const FVector& Pivot, const FQuat& Rotation) -> void {
+		// Row-vector convention, matching FMatrix::TransformVector: v' = v.X * Row0 + v.Y * Row1 + v.Z * Row2
+		const FMatrix M = FRotationMatrix::Make(Rotation);
+		VectorRegister4Double Rows[3][3];
+		for (int32 Row = 0; Row < 3; ++Row) {
+			for (int32 Column = 0; Column < 3; ++Column) {
+				Rows[Row][Column] = VectorSetFloat1(M.M[Row][Column]);
+			}
+		}
+
+		const VectorRegister4Double PX = VectorSetFloat1(Pivot.X);
+		const VectorRegister4Double PY = VectorSetFloat1(Pivot.Y);
+		const VectorRegister4Double PZ = VectorSetFloat1(Pivot.Z);
+
+		for (int32 Base = 0; Base < PaddedNum(); Base += 4) {
+			const VectorRegister4Double DX = VectorSubtract(VectorLoad(&LocationX[Base]), PX);
+			const VectorRegister4Double DY = VectorSubtract(VectorLoad(&LocationY[Base]), PY);
+			const VectorRegister4Double DZ = VectorSubtract(VectorLoad(&LocationZ[Base]), PZ);
+
+			VectorStore(
+				VectorMultiplyAdd(DZ, Rows[2][0], VectorMultiplyAdd(DY, Rows[1][0], VectorMultiplyAdd(DX, Rows[0][0], PX))),
+				&LocationX[Base]);
+			VectorStore(
+				VectorMultiplyAdd(DZ, Rows[2][1], VectorMultiplyAdd(DY, Rows[1][1], VectorMultiplyAdd(DX, Rows[0][1], PY))),
+				&LocationY[Base]);
+			VectorStore(
+				VectorMultiplyAdd(DZ, Rows[2][2], VectorMultiplyAdd(DY, Rows[1][2], VectorMultiplyAdd(DX, Rows[0][2], PZ))),
+				&LocationZ[Base]);
+		}
+
+		// The group rotation applies after each actor's own rotation
+		const VectorRegister4Double R = VectorLoad(&Rotation.X);
+		for (FQuat& Quat : Rotations) {
+			VectorStore(VectorQuaternionMultiply2(R, VectorLoad(&Quat.X)), &Quat.X);
+		}
+	}
+
+	auto FActorTransformBatch::ScaleAround(const FVector& Pivot, const double Factor) -> void {
+		// p' = Pivot + Factor * (p - Pivot) = p * Factor + Pivot * (1 - Factor)
+		const VectorRegister4Double F = VectorSetFloat1(Factor);
+		const VectorRegister4Double TX = VectorSetFloat1(Pivot.X * (1.0 - Factor));
+		const VectorRegister4Double TY = VectorSetFloat1(Pivot.Y * (1.0 - Factor));
+		const VectorRegister4Double TZ = VectorSetFloat1(Pivot.Z * (1.0 - Factor));
+
+		for (int32 Base = 0; Base < PaddedNum(); Base += 4) {
+			VectorStore(VectorMultiplyAdd(VectorLoad(&LocationX[Base]), F, TX), &LocationX[Base]);
+			VectorStore(VectorMultiplyAdd(VectorLoad(&LocationY[Base]), F, TY), &LocationY[Base]);
+			VectorStore(VectorMultiplyAdd(VectorLoad(&LocationZ[Base]), F, TZ), &LocationZ[Base]);
+			VectorStore(VectorMultiply(VectorLoad(&ScaleX[Base]), F), &ScaleX[Base]);
+			VectorStore(VectorMultiply(VectorLoad(&ScaleY[Base]), F), &ScaleY[Base]);
+			VectorStore(VectorMultiply(VectorLoad(&ScaleZ[Base]), F), &ScaleZ[Base]);
+		}
+	}
+
+	auto FActorTransformBatch::SnapToGrid(const FVector& GridSize) -> void {
+		const VectorRegister4Double Half = VectorSetFloat1(0.5);
+
+		for (const TPair<TArray<double>*, double>& Axis : {
+			     TPair<TArray<double>*, double>(&LocationX, GridSize.X),
+			     TPair<TArray<double>*, double>(&LocationY, GridSize.Y),
+			     TPair<TArray<double>*, double>(&LocationZ, GridSize.Z)
+		     }) {
+			if (Axis.Value <= 0.0) {
+				continue;
+			}
+
+			const VectorRegister4Double Grid = VectorSetFloat1(Axis.Value);
+			const VectorRegister4Double InvGrid = VectorSetFloat1(1.0 / Axis.Value);
+			double* Values = Axis.Key->GetData();
+
+			for (int32 Base = 0; Base < PaddedNum(); Base += 4) {
+				const VectorRegister4Double Cells = VectorFloor(VectorMultiplyAdd(VectorLoad(&Values[Base]), InvGrid, Half));
+				VectorStore(VectorMultiply(Cells, Grid), &Values[Base]);
+			}
+		}
+	}
+
+}
@@ -0,0 +1,324 @@
+#include "Core/BlueprintCompileCoordinator.h"
+#include "BlueprintCompilationManager.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "Kismet2/CompilerResultsLog.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogMCPCompile, Log, All);
+
+namespace UnrealMCP {
+
+	TArray<FBlueprintCompileCoordinator::FPendingCompile> FBlueprintCompileCoordinator::Pending;
+	TSet<TWeakObjectPtr<UBlueprint>> FBlueprintCompileCoordinator::SkeletonOnlyCompiled;
+	TArray<FBlueprintCompileCoordinator::FCompileRecord> FBlueprintCompileCoordinator::CompletedCompiles;
+	double FBlueprintCompileCoordinator::LastRequestTime = 0.0;
+	FTSTicker::FDelegateHandle FBlueprintCompileCoordinator::TickerHandle;
+
+	auto FBlueprintCompileCoordinator::Initialize() -> void {
+		if (!TickerHandle.IsValid()) {
+			TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+				FTickerDelegate::CreateStatic(&FBlueprintCompileCoordinator::Tick),
+				0.1f);
+		}
+	}
+
+	auto FBlueprintCompileCoordinator::Shutdown() -> void {
+		if (TickerHandle.IsValid()) {
+			FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+			TickerHandle.Reset();
+		}
+		Pending.Empty();
+		SkeletonOnlyCompiled.Empty();
+		CompletedCompiles.Empty();
+	}
+
+	auto FBlueprintCompileCoordinator::RequestCompile(UBlueprint* Blueprint, const EBlueprintCompileMode Mode) -> void {
+		if (!Blueprint) {
+			return;
+		}
+
+		FPendingCompile* Existing = Pending.FindByPredicate([Blueprint](const FPendingCompile& Entry) {
+			return Entry.Blueprint.Get() == Blueprint;
+		});
+		if (Existing) {
+			Existing->Mode = FMath::Max(Existing->Mode, Mode);
+		}
+		else {
+			Pending.Add({Blueprint, Mode});
+		}
+		LastRequestTime = FPlatformTime::Seconds();
+
+		UE_LOG(LogMCPCompile,
+		       Verbose,
+		       TEXT("Deferred %s compile of '%s' (%d pending)"),
+		       GetModeName(Mode),
+		       *Blueprint->GetName(),
+		       Pending.Num());
+	}
+
+	auto FBlueprintCompileCoordinator::Flush(UBlueprint* Blueprint) -> bool {
+		if (!Blueprint || (!IsPending(Blueprint) && !SkeletonOnlyCompiled.Contains(Blueprint))) {
+			return false;
+		}
+
+		CompileNow(Blueprint, EBlueprintCompileMode::Full);
+		return true;
+	}
+
+	auto FBlueprintCompileCoordinator::FlushAll() -> int32 {
+		// Compiling can request further compiles (e.g. dependents), so drain a snapshot at a time
+		int32 NumCompiled = 0;
+		while (Pending.Num() > 0) {
+			TArray<FPendingCompile> Snapshot = MoveTemp(Pending);
+			Pending.Reset();
+
+			for (const FPendingCompile& Entry : Snapshot) {
+				if (UBlueprint* Blueprint = Entry.Blueprint.Get()) {
+					CompileNow(Blueprint, Entry.Mode);
+					++NumCompiled;
+				}
+			}
+		}
+		return NumCompiled;
+	}
+
+	auto FBlueprintCompileCoordinator::CompileNow(UBlueprint* Blueprint,
+	                                              const EBlueprintCompileMode Mode,
+	                                              FCompilerResultsLog* ResultsLog) -> void {
+		if (!Blueprint) {
+			return;
+		}
+
+		Cancel(Blueprint);
+
+		EBlueprintCompileOptions Options = EBlueprintCompileOptions::SkipGarbageCollection | EBlueprintCompileOptions::SkipSave;
+		if (Mode == EBlueprintCompileMode::SkeletonOnly) {
+			Options |= EBlueprintCompileOptions::RegenerateSkeletonOnly;
+		}
+
+		FCompilerResultsLog LocalResultsLog;
+		FCompilerResultsLog& Log = ResultsLog ? *ResultsLog : LocalResultsLog;
+
+		const double StartTime = FPlatformTime::Seconds();
+		FBlueprintCompilationManager::CompileSynchronously(FBPCompileRequest(Blueprint, Options, &Log));
+		const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+		if (Mode == EBlueprintCompileMode::SkeletonOnly) {
+			SkeletonOnlyCompiled.Add(Blueprint);
+		}
+		else {
+			SkeletonOnlyCompiled.Remove(Blueprint);
+		}
+
+		AddCompletedCompile(Blueprint, Mode, Seconds, 1, &Log);
+
+		UE_LOG(LogMCPCompile,
+		       Log,
+		       TEXT("Compiled '%s' (%s) in %.1f ms (%s, %d error(s), %d warning(s))"),
+		       *Blueprint->GetName(),
+		       GetModeName(Mode),
+		       Seconds * 1000.0,
+		       GetStatusName(Blueprint),
+		       Log.NumErrors,
+		       Log.NumWarnings);
+	}
+
+	auto FBlueprintCompileCoordinator::CompileProfiled(UBlueprint* Blueprint,
+	                                                   FCompilerResultsLog& ResultsLog,
+	                                                   const bool bCollectGarbage,
+	                                                   TArray<UBlueprint*>& OutRecompiledDependents) -> FCompilePhaseTimings {
+		FCompilePhaseTimings Timings;
+		OutRecompiledDependents.Reset();
+		if (!Blueprint) {
+			return Timings;
+		}
+
+		Cancel(Blueprint);
+
+		// The compilation manager announces every blueprint it compiles, including dependents it queues itself
+		TSet<UBlueprint*> Recompiled;
+		FDelegateHandle PreCompileHandle;
+		if (GEditor) {
+			PreCompileHandle = GEditor->OnBlueprintPreCompile().AddLambda([Blueprint, &Recompiled](UBlueprint* Compiled) {
+				if (Compiled && Compiled != Blueprint) {
+					Recompiled.Add(Compiled);
+				}
+			});
+		}
+
+		const EBlueprintCompileOptions Options = EBlueprintCompileOptions::SkipGarbageCollection | EBlueprintCompileOptions::SkipSave;
+
+		double StartTime = FPlatformTime::Seconds();
+		FBlueprintCompilationManager::CompileSynchronously(
+			FBPCompileRequest(Blueprint, Options | EBlueprintCompileOptions::RegenerateSkeletonOnly, &ResultsLog));
+		Timings.SkeletonSeconds = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		FBlueprintCompilationManager::CompileSynchronously(
+			FBPCompileRequest(Blueprint, Options | EBlueprintCompileOptions::SkeletonUpToDate, &ResultsLog));
+		Timings.CompileSeconds = FPlatformTime::Seconds() - StartTime;
+
+		if (GEditor) {
+			GEditor->OnBlueprintPreCompile().Remove(PreCompileHandle);
+		}
+
+		if (bCollectGarbage) {
+			StartTime = FPlatformTime::Seconds();
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+			Timings.GarbageCollectionSeconds = FPlatformTime::Seconds() - StartTime;
+		}
+
+		SkeletonOnlyCompiled.Remove(Blueprint);
+		AddCompletedCompile(Blueprint, EBlueprintCompileMode::Full, Timings.SkeletonSeconds + Timings.CompileSeconds, 1, &ResultsLog);
+
+		for (UBlueprint* Dependent : Recompiled) {
+			if (IsValid(Dependent)) {
+				OutRecompiledDependents.Add(Dependent);
+			}
+		}
+
+		UE_LOG(LogMCPCompile,
+		       Log,
+		       TEXT("Profiled compile of '%s': skeleton %.1f ms, bytecode+reinstancing %.1f ms, GC %.1f ms, %d dependent(s)"),
+		       *Blueprint->GetName(),
+		       Timings.SkeletonSeconds * 1000.0,
+		       Timings.CompileSeconds * 1000.0,
+		       Timings.GarbageCollectionSeconds * 1000.0,
+		       OutRecompiledDependents.Num());
+
+		return Timings;
+	}
+
+	auto FBlueprintCompileCoordinator::CompileBatch(const TArray<UBlueprint*>& Blueprints,
+	                                                const TArray<FCompilerResultsLog*>& ResultsLogs) -> double {
+		check(ResultsLogs.Num() == Blueprints.Num());
+
+		const EBlueprintCompileOptions Options = EBlueprintCompileOptions::SkipGarbageCollection | EBlueprintCompileOptions::SkipSave;
+		int32 NumQueued = 0;
+		for (int32 Index = 0; Index < Blueprints.Num(); ++Index) {
+			if (UBlueprint* Blueprint = Blueprints[Index]) {
+				Cancel(Blueprint);
+				FBlueprintCompilationManager::QueueForCompilation(FBPCompileRequest(Blueprint, Options, ResultsLogs[Index]));
+				++NumQueued;
+			}
+		}
+		if (NumQueued == 0) {
+			return 0.0;
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+		FBlueprintCompilationManager::FlushCompilationQueueAndReinstance();
+		const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+		for (int32 Index = 0; Index < Blueprints.Num(); ++Index) {
+			if (UBlueprint* Blueprint = Blueprints[Index]) {
+				SkeletonOnlyCompiled.Remove(Blueprint);
+				AddCompletedCompile(Blueprint, EBlueprintCompileMode::Full, Seconds, NumQueued, ResultsLogs[Index]);
+			}
+		}
+
+		UE_LOG(LogMCPCompile, Log, TEXT("Compiled %d blueprint(s) in one flush in %.1f ms"), NumQueued, Seconds * 1000.0);
+		return Seconds;
+	}
+
+	auto FBlueprintCompileCoordinator::Cancel(const UBlueprint* Blueprint) -> void {
+		Pending.RemoveAll([Blueprint](const FPendingCompile& Entry) {
+			return !Entry.Blueprint.IsValid() || Entry.Blueprint.Get() == Blueprint;
+		});
+	}
+
+	auto FBlueprintCompileCoordinator::IsPending(const UBlueprint* Blueprint) -> bool {
+		return Blueprint && Pending.ContainsByPredicate([Blueprint](const FPendingCompile& Entry) {
+			return Entry.Blueprint.Get() == Blueprint;
+		});
+	}
+
+	auto FBlueprintCompileCoordinator::HasPending() -> bool {
+		return Pending.Num() > 0;
+	}
+
+	auto FBlueprintCompileCoordinator::GetPending() -> TArray<TPair<FString, EBlueprintCompileMode>> {
+		TArray<TPair<FString, EBlueprintCompileMode>> Result;
+		Result.Reserve(Pending.Num());
+		for (const FPendingCompile& Entry : Pending) {
+			if (const UBlueprint* Blueprint = Entry.Blueprint.Get()) {
+				Result.Emplace(Blueprint->GetName(), Entry.Mode);
+			}
+		}
+		return Result;
+	}
+
+	auto FBlueprintCompileCoordinator::TakeCompletedCompiles() -> TArray<FCompileRecord> {
+		return MoveTemp(CompletedCompiles);
+	}
+
+	auto FBlueprintCompileCoordinator::GetModeName(const EBlueprintCompileMode Mode) -> const TCHAR* {
+		switch (Mode) {
+			case EBlueprintCompileMode::SkeletonOnly:
+				return TEXT("skeleton");
+			case EBlueprintCompileMode::Full:
+				return TEXT("full");
+		}
+		return TEXT("full");
+	}
+
+	auto FBlueprintCompileCoordinator::GetStatusName(const UBlueprint* Blueprint) -> const TCHAR* {
+		if (!Blueprint) {
+			return TEXT("dirty");
+		}
+		switch (Blueprint->Status) {
+			case BS_UpToDate:
+				return TEXT("up_to_date");
+			case BS_UpToDateWithWarnings:
+				return TEXT("up_to_date_with_warnings");
+			case BS_Error:
+				return TEXT("error");
+			default:
+				return TEXT("dirty");
+		}
+	}
+
+	auto FBlueprintCompileCoordinator::CollectMessages(const FCompilerResultsLog& ResultsLog,
+	                                                   TArray<FString>& OutErrors,
+	                                                   TArray<FString>& OutWarnings) -> void {
+		// AddUnique: profiled compiles share one log across passes, which can repeat a message
+		for (const TSharedRef<FTokenizedMessage>& Message : ResultsLog.Messages) {
+			switch (Message->GetSeverity()) {
+				case EMessageSeverity::Error:
+					OutErrors.AddUnique(Message->ToText().ToString());
+					break;
+				case EMessageSeverity::Warning:
+				case EMessageSeverity::PerformanceWarning:
+					OutWarnings.AddUnique(Message->ToText().ToString());
+					break;
+				default:
+					break;
+			}
+		}
+	}
+
+	auto FBlueprintCompileCoordinator::AddCompletedCompile(UBlueprint* Blueprint,
+	                                                       const EBlueprintCompileMode Mode,
+	                                                       const double Seconds,
+	                                                       const int32 BatchSize,
+	                                                       const FCompilerResultsLog* ResultsLog) -> void {
+		FCompileRecord& Record = CompletedCompiles.AddDefaulted_GetRef();
+		Record.BlueprintName = Blueprint->GetName();
+		Record.Mode = Mode;
+		Record.Seconds = Seconds;
+		Record.BatchSize = BatchSize;
+		Record.Status = GetStatusName(Blueprint);
+		if (ResultsLog) {
+			CollectMessages(*ResultsLog, Record.Errors, Record.Warnings);
+		}
+	}
+
+	auto FBlueprintCompileCoordinator::Tick(float DeltaTime) -> bool {
+		if (Pending.Num() > 0 && FPlatformTime::Seconds() - LastRequestTime >= IdleFlushDelaySeconds) {
+			const int32 NumCompiled = FlushAll();
+			UE_LOG(LogMCPCompile, Verbose, TEXT("Idle flush compiled %d blueprint(s)"), NumCompiled);
+		}
+		return true;
+	}
+
+}
@@ -0,0 +1,444 @@
+#include "Core/BlueprintSearchIndex.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Event.h"
+#include "K2Node_InputAction.h"
+#include "K2Node_VariableGet.h"
+#include "K2Node_VariableSet.h"
+#include "Async/Async.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "EdGraph/EdGraph.h"
+#include "Engine/Blueprint.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeRWLock.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/Package.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogMCPBlueprintSearch, Log, All);
+
+namespace UnrealMCP {
+
+	TMap<FString, FBlueprintSearchIndex::FRecord> FBlueprintSearchIndex::Records;
+	TMap<FName, TArray<FBlueprintSearchIndex::FPosting>> FBlueprintSearchIndex::Postings;
+	FRWLock FBlueprintSearchIndex::Lock;
+	TFuture<void> FBlueprintSearchIndex::LoadTask;
+	TFuture<void> FBlueprintSearchIndex::SaveTask;
+	std::atomic<bool> FBlueprintSearchIndex::bDirty{false};
+	std::atomic<bool> FBlueprintSearchIndex::bSaveInFlight{false};
+	bool FBlueprintSearchIndex::bInitialized = false;
+	FDelegateHandle FBlueprintSearchIndex::PackageSavedHandle;
+	FDelegateHandle FBlueprintSearchIndex::AssetRemovedHandle;
+	FDelegateHandle FBlueprintSearchIndex::AssetRenamedHandle;
+
+	auto FBlueprintSearchIndex::Initialize() -> void {
+		if (bInitialized) {
+			return;
+		}
+		bInitialized = true;
+
+		PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddStatic(&FBlueprintSearchIndex::OnPackageSaved);
+
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+		AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddStatic(&FBlueprintSearchIndex::OnAssetRemoved);
+		AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddStatic(&FBlueprintSearchIndex::OnAssetRenamed);
+
+		LoadTask = Async(EAsyncExecution::ThreadPool, &FBlueprintSearchIndex::LoadFromDisk);
+	}
+
+	auto FBlueprintSearchIndex::Shutdown() -> void {
+		if (!bInitialized) {
+			return;
+		}
+		bInitialized = false;
+
+		UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+		if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry")) {
+			AssetRegistryModule->Get().OnAssetRemoved().Remove(AssetRemovedHandle);
+			AssetRegistryModule->Get().OnAssetRenamed().Remove(AssetRenamedHandle);
+		}
+		PackageSavedHandle.Reset();
+		AssetRemovedHandle.Reset();
+		AssetRenamedHandle.Reset();
+
+		if (LoadTask.IsValid()) {
+			LoadTask.Wait();
+		}
+		if (SaveTask.IsValid()) {
+			SaveTask.Wait();
+		}
+		if (bDirty.exchange(false)) {
+			SaveToDisk();
+		}
+
+		FWriteScopeLock WriteLock(Lock);
+		Records.Empty();
+		Postings.Empty();
+	}
+
+	auto FBlueprintSearchIndex::IndexBlueprint(const UBlueprint* Blueprint, const FDateTime& PackageTimestamp) -> void {
+		if (!Blueprint) {
+			return;
+		}
+
+		FRecord Record;
+		Record.PackageTimestamp = PackageTimestamp;
+		ExtractReferences(Blueprint, Record.References);
+
+		const FString BlueprintPath = Blueprint->GetPathName();
+		UE_LOG(LogMCPBlueprintSearch, Verbose, TEXT("Indexed '%s': %d reference(s)"), *BlueprintPath, Record.References.Num());
+		{
+			FWriteScopeLock WriteLock(Lock);
+			RemoveRecordLocked(BlueprintPath);
+			AddRecordLocked(BlueprintPath, MoveTemp(Record));
+		}
+		ScheduleSave();
+	}
+
+	auto FBlueprintSearchIndex::RemoveBlueprint(const FString& BlueprintPath) -> void {
+		{
+			FWriteScopeLock WriteLock(Lock);
+			if (!Records.Contains(BlueprintPath)) {
+				return;
+			}
+			RemoveRecordLocked(BlueprintPath);
+		}
+		ScheduleSave();
+	}
+
+	auto FBlueprintSearchIndex::IsIndexed(const FString& BlueprintPath) -> bool {
+		FReadScopeLock ReadLock(Lock);
+		return Records.Contains(BlueprintPath);
+	}
+
+	auto FBlueprintSearchIndex::Search(
+		const FString& Name,
+		const TOptional<EBlueprintReferenceKind>& Kind,
+		const FString& PathPrefix,
+		const int32 Limit,
+		TArray<FBlueprintSearchHit>& OutHits
+	) -> int32 {
+		// A name that was never interned cannot have been indexed
+		const FName Key(*Name, FNAME_Find);
+		if (Key.IsNone()) {
+			return 0;
+		}
+
+		FReadScopeLock ReadLock(Lock);
+
+		const TArray<FPosting>* NamePostings = Postings.Find(Key);
+		if (!NamePostings) {
+			return 0;
+		}
+
+		int32 TotalMatches = 0;
+		for (const FPosting& Posting : *NamePostings) {
+			if (!PathPrefix.IsEmpty() && !Posting.BlueprintPath.StartsWith(PathPrefix)) {
+				continue;
+			}
+			const FReference& Reference = Records.FindChecked(Posting.BlueprintPath).References[Posting.ReferenceIndex];
+			if (Kind.IsSet() && Reference.Kind != Kind.GetValue()) {
+				continue;
+			}
+
+			++TotalMatches;
+			if (OutHits.Num() < Limit) {
+				OutHits.Add({Posting.BlueprintPath, Reference.Graph, Reference.NodeGuid, Reference.Kind, Reference.Name});
+			}
+		}
+		return TotalMatches;
+	}
+
+	auto FBlueprintSearchIndex::Num() -> int32 {
+		FReadScopeLock ReadLock(Lock);
+		return Records.Num();
+	}
+
+	auto FBlueprintSearchIndex::GetPackageTimestamp(const FString& PackageName) -> FDateTime {
+		FString FileName;
+		if (!FPackageName::TryConvertLongPackageNameToFilename(PackageName, FileName, FPackageName::GetAssetPackageExtension())) {
+			return FDateTime::MinValue();
+		}
+		return IFileManager::Get().GetTimeStamp(*FileName);
+	}
+
+	auto FBlueprintSearchIndex::GetKindName(const EBlueprintReferenceKind Kind) -> const TCHAR* {
+		switch (Kind) {
+			case EBlueprintReferenceKind::FunctionCall:
+				return TEXT("function_call");
+			case EBlueprintReferenceKind::VariableRead:
+				return TEXT("variable_read");
+			case EBlueprintReferenceKind::VariableWrite:
+				return TEXT("variable_write");
+			case EBlueprintReferenceKind::Event:
+				return TEXT("event");
+			case EBlueprintReferenceKind::InputAction:
+				return TEXT("input_action");
+		}
+		return TEXT("unknown");
+	}
+
+	auto FBlueprintSearchIndex::ParseKindName(const FString& KindName, EBlueprintReferenceKind& OutKind) -> bool {
+		for (const EBlueprintReferenceKind Kind : {
+			     EBlueprintReferenceKind::FunctionCall, EBlueprintReferenceKind::VariableRead,
+			     EBlueprintReferenceKind::VariableWrite, EBlueprintReferenceKind::Event,
+			     EBlueprintReferenceKind::InputAction
+		     }) {
+			if (KindName.Equals(GetKindName(Kind), ESearchCase::IgnoreCase)) {
+				OutKind = Kind;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	auto FBlueprintSearchIndex::OnPackageSaved(
+		const FString& PackageFileName,
+		UPackage* Package,
+		const FObjectPostSaveContext SaveContext
+	) -> void {
+		if (!Package || SaveContext.IsProceduralSave()) {
+			return;
+		}
+		if (const UBlueprint* Blueprint = Cast<UBlueprint>(Package->FindAssetInPackage())) {
+			IndexBlueprint(Blueprint, IFileManager::Get().GetTimeStamp(*PackageFileName));
+		}
+	}
+
+	auto FBlueprintSearchIndex::OnAssetRemoved(const FAssetData& AssetData) -> void {
+		RemoveBlueprint(AssetData.GetObjectPathString());
+	}
+
+	auto FBlueprintSearchIndex::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath) -> void {
+		{
+			FWriteScopeLock WriteLock(Lock);
+			const FRecord* Existing = Records.Find(OldObjectPath);
+			if (!Existing) {
+				return;
+			}
+			// Postings hold the path, so the record is re-added under the new one rather than patched
+			FRecord Record = *Existing;
+			RemoveRecordLocked(OldObjectPath);
+			RemoveRecordLocked(AssetData.GetObjectPathString());
+			AddRecordLocked(AssetData.GetObjectPathString(), MoveTemp(Record));
+		}
+		ScheduleSave();
+	}
+
+	auto FBlueprintSearchIndex::ExtractReferences(const UBlueprint* Blueprint, TArray<FReference>& OutReferences) -> void {
+		TArray<UEdGraph*> Graphs;
+		Blueprint->GetAllGraphs(Graphs);
+
+		for (const UEdGraph* Graph : Graphs) {
+			if (!Graph) {
+				continue;
+			}
+			const FString GraphName = Graph->GetName();
+
+			for (const UEdGraphNode* Node : Graph->Nodes) {
+				if (!Node) {
+					continue;
+				}
+
+				if (const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node)) {
+					OutReferences.Add({EBlueprintReferenceKind::FunctionCall, CallNode->FunctionReference.GetMemberName(), GraphName, Node->NodeGuid});
+				}
+				else if (const UK2Node_VariableGet* GetNode = Cast<UK2Node_VariableGet>(Node)) {
+					OutReferences.Add({EBlueprintReferenceKind::VariableRead, GetNode->VariableReference.GetMemberName(), GraphName, Node->NodeGuid});
+				}
+				else if (const UK2Node_VariableSet* SetNode = Cast<UK2Node_VariableSet>(Node)) {
+					OutReferences.Add({EBlueprintReferenceKind::VariableWrite, SetNode->VariableReference.GetMemberName(), GraphName, Node->NodeGuid});
+				}
+				else if (const UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node)) {
+					const FName EventName = EventNode->CustomFunctionName.IsNone()
+						                        ? EventNode->EventReference.GetMemberName()
+						                        : EventNode->CustomFunctionName;
+					OutReferences.Add({EBlueprintReferenceKind::Event, EventName, GraphName, Node->NodeGuid});
+				}
+				else if (const UK2Node_InputAction* InputActionNode = Cast<UK2Node_InputAction>(Node)) {
+					OutReferences.Add({EBlueprintReferenceKind::InputAction, InputActionNode->InputActionName, GraphName, Node->NodeGuid});
+				}
+				else if (const FObjectPropertyBase* ActionProperty = FindFProperty<FObjectPropertyBase>(Node->GetClass(), TEXT("InputAction"))) {
+					// Enhanced input action events live in the InputBlueprintNodes module; read the bound asset reflectively
+					if (const UObject* InputAction = ActionProperty->GetObjectPropertyValue_InContainer(Node)) {
+						OutReferences.Add({EBlueprintReferenceKind::InputAction, InputAction->GetFName(), GraphName, Node->NodeGuid});
+					}
+				}
+			}
+		}
+
+		OutReferences.RemoveAll([](const FReference& Reference) { return Reference.Name.IsNone(); });
+	}
+
+	auto FBlueprintSearchIndex::AddRecordLocked(const FString& BlueprintPath, FRecord&& Record) -> void {
+		const FRecord& Added = Records.Add(BlueprintPath, MoveTemp(Record));
+		for (int32 Index = 0; Index < Added.References.Num(); ++Index) {
+			Postings.FindOrAdd(Added.References[Index].Name).Add({BlueprintPath, Index});
+		}
+	}
+
+	auto FBlueprintSearchIndex::RemoveRecordLocked(const FString& BlueprintPath) -> void {
+		const FRecord* Existing = Records.Find(BlueprintPath);
+		if (!Existing) {
+			return;
+		}
+
+		TSet<FName> Names;
+		for (const FReference& Reference : Existing->References) {
+			Names.Add(Reference.Name);
+		}
+		for (const FName& Name : Names) {
+			if (TArray<FPosting>* NamePostings = Postings.Find(Name)) {
+				NamePostings->RemoveAllSwap([&BlueprintPath](const FPosting& Posting) {
+					return Posting.BlueprintPath == BlueprintPath;
+				});
+				if (NamePostings->IsEmpty()) {
+					Postings.Remove(Name);
+				}
+			}
+		}
+		Records.Remove(BlueprintPath);
+	}
+
+	auto FBlueprintSearchIndex::GetIndexFilePath() -> FString {
+		return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealMCP"), TEXT("BlueprintSearchIndex.json"));
+	}
+
+	auto FBlueprintSearchIndex::LoadFromDisk() -> void {
+		const double StartTime = FPlatformTime::Seconds();
+
+		FString FileContents;
+		if (!FFileHelper::LoadFileToString(FileContents, *GetIndexFilePath())) {
+			return;
+		}
+
+		TSharedPtr<FJsonObject> Root;
+		const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(FileContents);
+		if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid()
+			|| Root->GetIntegerField(TEXT("version")) != FileVersion) {
+			UE_LOG(LogMCPBlueprintSearch, Warning, TEXT("Ignoring unreadable or outdated blueprint search index '%s'"), *GetIndexFilePath());
+			return;
+		}
+
+		const TSharedPtr<FJsonObject>* BlueprintsObj = nullptr;
+		if (!Root->TryGetObjectField(TEXT("blueprints"), BlueprintsObj)) {
+			return;
+		}
+
+		TArray<TPair<FString, FRecord>> Loaded;
+		int32 StaleCount = 0;
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Entry : (*BlueprintsObj)->Values) {
+			const TSharedPtr<FJsonObject>* EntryObj = nullptr;
+			if (!Entry.Value.IsValid() || !Entry.Value->TryGetObject(EntryObj)) {
+				continue;
+			}
+
+			FRecord Record;
+			FDateTime::ParseIso8601(*(*EntryObj)->GetStringField(TEXT("timestamp")), Record.PackageTimestamp);
+
+			// Entries for packages that changed (or vanished) since they were indexed are dropped
+			if (GetPackageTimestamp(FPackageName::ObjectPathToPackageName(Entry.Key)) != Record.PackageTimestamp) {
+				++StaleCount;
+				continue;
+			}
+
+			const TArray<TSharedPtr<FJsonValue>>* ReferenceValues = nullptr;
+			if ((*EntryObj)->TryGetArrayField(TEXT("refs"), ReferenceValues)) {
+				Record.References.Reserve(ReferenceValues->Num());
+				for (const TSharedPtr<FJsonValue>& ReferenceValue : *ReferenceValues) {
+					const TArray<TSharedPtr<FJsonValue>>* Fields = nullptr;
+					if (!ReferenceValue->TryGetArray(Fields) || Fields->Num() != 4) {
+						continue;
+					}
+					FReference Reference;
+					if (!ParseKindName((*Fields)[0]->AsString(), Reference.Kind)) {
+						continue;
+					}
+					Reference.Name = FName(*(*Fields)[1]->AsString());
+					Reference.Graph = (*Fields)[2]->AsString();
+					FGuid::Parse((*Fields)[3]->AsString(), Reference.NodeGuid);
+					Record.References.Add(MoveTemp(Reference));
+				}
+			}
+			Loaded.Emplace(Entry.Key, MoveTemp(Record));
+		}
+
+		{
+			FWriteScopeLock WriteLock(Lock);
+			for (TPair<FString, FRecord>& Entry : Loaded) {
+				// Blueprints saved while the file was loading are already newer
+				if (!Records.Contains(Entry.Key)) {
+					AddRecordLocked(Entry.Key, MoveTemp(Entry.Value));
+				}
+			}
+		}
+		if (StaleCount > 0) {
+			bDirty = true;
+		}
+
+		UE_LOG(LogMCPBlueprintSearch, Display, TEXT("Loaded blueprint search index: %d blueprint(s), %d stale entr%s dropped in %.3f s"),
+		       Loaded.Num(), StaleCount, StaleCount == 1 ? TEXT("y") : TEXT("ies"), FPlatformTime::Seconds() - StartTime);
+	}
+
+	auto FBlueprintSearchIndex::ScheduleSave() -> void {
+		bDirty = true;
+		if (bSaveInFlight.exchange(true)) {
+			// The running write picks the change up before it finishes
+			return;
+		}
+
+		SaveTask = Async(EAsyncExecution::ThreadPool, [] {
+			do {
+				while (bDirty.exchange(false)) {
+					SaveToDisk();
+				}
+				bSaveInFlight = false;
+				// A change may have landed between the last write and clearing the flag
+			}
+			while (bDirty && !bSaveInFlight.exchange(true));
+		});
+	}
+
+	auto FBlueprintSearchIndex::SaveToDisk() -> void {
+		const TSharedPtr<FJsonObject> Root = MakeShared<FJsonObject>();
+		Root->SetNumberField(TEXT("version"), FileVersion);
+
+		const TSharedPtr<FJsonObject> BlueprintsObj = MakeShared<FJsonObject>();
+		{
+			FReadScopeLock ReadLock(Lock);
+			for (const TPair<FString, FRecord>& Entry : Records) {
+				const TSharedPtr<FJsonObject> EntryObj = MakeShared<FJsonObject>();
+				EntryObj->SetStringField(TEXT("timestamp"), Entry.Value.PackageTimestamp.ToIso8601());
+
+				// [kind, name, graph, node guid] keeps the file compact
+				TArray<TSharedPtr<FJsonValue>> ReferenceValues;
+				ReferenceValues.Reserve(Entry.Value.References.Num());
+				for (const FReference& Reference : Entry.Value.References) {
+					TArray<TSharedPtr<FJsonValue>> Fields;
+					Fields.Add(MakeShared<FJsonValueString>(GetKindName(Reference.Kind)));
+					Fields.Add(MakeShared<FJsonValueString>(Reference.Name.ToString()));
+					Fields.Add(MakeShared<FJsonValueString>(Reference.Graph));
+					Fields.Add(MakeShared<FJsonValueString>(Reference.NodeGuid.ToString()));
+					ReferenceValues.Add(MakeShared<FJsonValueArray>(Fields));
+				}
+				EntryObj->SetArrayField(TEXT("refs"), ReferenceValues);
+				BlueprintsObj->SetObjectField(Entry.Key, EntryObj);
+			}
+		}
+		Root->SetObjectField(TEXT("blueprints"), BlueprintsObj);
+
+		FString Output;
+		const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+			TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Output);
+		FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
+
+		if (!FFileHelper::SaveStringToFile(Output, *GetIndexFilePath(), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)) {
+			UE_LOG(LogMCPBlueprintSearch, Warning, TEXT("Failed to write blueprint search index '%s'"), *GetIndexFilePath());
+		}
+	}
+}
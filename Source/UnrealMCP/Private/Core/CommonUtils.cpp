@@ -7,6 +7,7 @@
 #include "K2Node_VariableGet.h"
 #include "K2Node_VariableSet.h"
 #include "MCPPropertyHandlers.h"
+#include "Core/PinLookupCache.h"
 #include "Components/PrimitiveComponent.h"
 #include "Components/SceneComponent.h"
 #include "Components/StaticMeshComponent.h"
@@ -387,56 +388,7 @@ auto FCommonUtils::CreateEventNode(UEdGraph* Graph,
 	}
 
 	UClass* EventSourceClass = nullptr;
-	const UFunction* EventFunction = nullptr;
-
-	if (UClass* BlueprintClass = Blueprint->GeneratedClass) {
-		EventFunction = BlueprintClass->FindFunctionByName(FName(*EventName));
-		if (EventFunction) {
-			EventSourceClass = BlueprintClass;
-		}
-
-		if (!EventFunction) {
-			for (UClass* ParentClass = BlueprintClass->GetSuperClass(); ParentClass; ParentClass = ParentClass->
-			     GetSuperClass()) {
-				EventFunction = ParentClass->FindFunctionByName(FName(*EventName));
-				if (EventFunction) {
-					EventSourceClass = ParentClass;
-					break;
-				}
-			}
-		}
-
-
-		if (!EventFunction && BlueprintClass->IsChildOf(AActor::StaticClass())) {
-			TMap<FString, FString> EventNameMapping = {
-				{TEXT("BeginPlay"), TEXT("ReceiveBeginPlay")},
-				{TEXT("EndPlay"), TEXT("ReceiveEndPlay")},
-				{TEXT("ActorBeginPlay"), TEXT("ReceiveBeginPlay")}, // ActorBeginPlay is the same as BeginPlay
-				{TEXT("Tick"), TEXT("ReceiveTick")},
-				{TEXT("ReceiveBeginPlay"), TEXT("ReceiveBeginPlay")},
-				{TEXT("ReceiveEndPlay"), TEXT("ReceiveEndPlay")},
-				{TEXT("ReceiveTick"), TEXT("ReceiveTick")}
-			};
-
-			TArray<FString> NamesToTry = {EventName};
-			if (EventNameMapping.Contains(EventName)) {
-				NamesToTry.Add(EventNameMapping[EventName]);
-			}
-
-			for (const FString& NameToTry : NamesToTry) {
-				EventFunction = AActor::StaticClass()->FindFunctionByName(FName(*NameToTry));
-				if (EventFunction) {
-					EventSourceClass = AActor::StaticClass();
-					UE_LOG(LogTemp,
-					       Display,
-					       TEXT("Found common Actor event '%s' using fallback method (tried: %s)"),
-					       *EventName,
-					       *NameToTry);
-					break;
-				}
-			}
-		}
-	}
+	const UFunction* EventFunction = ResolveEventFunction(Blueprint, EventName, EventSourceClass);
 
 	if (EventSourceClass && EventFunction) {
 		const FName ActualFunctionName = EventFunction->GetFName();
@@ -487,6 +439,68 @@ auto FCommonUtils::CreateEventNode(UEdGraph* Graph,
 	return nullptr;
 }
 
+auto FCommonUtils::ResolveEventFunction(const UBlueprint* Blueprint,
+                                        const FString& EventName,
+                                        UClass*& OutEventSourceClass) -> const UFunction* {
+	OutEventSourceClass = nullptr;
+	if (!Blueprint) {
+		return nullptr;
+	}
+
+	const UFunction* EventFunction = nullptr;
+
+	if (UClass* BlueprintClass = Blueprint->GeneratedClass) {
+		EventFunction = BlueprintClass->FindFunctionByName(FName(*EventName));
+		if (EventFunction) {
+			OutEventSourceClass = BlueprintClass;
+		}
+
+		if (!EventFunction) {
+			for (UClass* ParentClass = BlueprintClass->GetSuperClass(); ParentClass; ParentClass = ParentClass->
+			     GetSuperClass()) {
+				EventFunction = ParentClass->FindFunctionByName(FName(*EventName));
+				if (EventFunction) {
+					OutEventSourceClass = ParentClass;
+					break;
+				}
+			}
+		}
+
+
+		if (!EventFunction && BlueprintClass->IsChildOf(AActor::StaticClass())) {
+			TMap<FString, FString> EventNameMapping = {
+				{TEXT("BeginPlay"), TEXT("ReceiveBeginPlay")},
+				{TEXT("EndPlay"), TEXT("ReceiveEndPlay")},
+				{TEXT("ActorBeginPlay"), TEXT("ReceiveBeginPlay")}, // ActorBeginPlay is the same as BeginPlay
+				{TEXT("Tick"), TEXT("ReceiveTick")},
+				{TEXT("ReceiveBeginPlay"), TEXT("ReceiveBeginPlay")},
+				{TEXT("ReceiveEndPlay"), TEXT("ReceiveEndPlay")},
+				{TEXT("ReceiveTick"), TEXT("ReceiveTick")}
+			};
+
+			TArray<FString> NamesToTry = {EventName};
+			if (EventNameMapping.Contains(EventName)) {
+				NamesToTry.Add(EventNameMapping[EventName]);
+			}
+
+			for (const FString& NameToTry : NamesToTry) {
+				EventFunction = AActor::StaticClass()->FindFunctionByName(FName(*NameToTry));
+				if (EventFunction) {
+					OutEventSourceClass = AActor::StaticClass();
+					UE_LOG(LogTemp,
+					       Display,
+					       TEXT("Found common Actor event '%s' using fallback method (tried: %s)"),
+					       *EventName,
+					       *NameToTry);
+					break;
+				}
+			}
+		}
+	}
+
+	return OutEventSourceClass ? EventFunction : nullptr;
+}
+
 auto FCommonUtils::CreateFunctionCallNode(UEdGraph* Graph,
                                           const UFunction* Function,
                                           const FVector2D& Position) -> UK2Node_CallFunction* {
@@ -609,13 +623,7 @@ auto FCommonUtils::ConnectGraphNodes(const UEdGraph* Graph,
 		return false;
 	}
 
-	// Break any existing connections on the target pin (to avoid conflicts)
-	if (TargetPin->LinkedTo.Num() > 0) {
-		TargetPin->BreakAllPinLinks();
-	}
-
-	// Make the direct connection using the standard approach
-	SourcePin->MakeLinkTo(TargetPin);
+	LinkGraphPins(SourcePin, TargetPin);
 
 	// Notify the graph that the topology has changed (cast away const for modification)
 	const auto MutableGraph = const_cast<UEdGraph*>(Graph);
@@ -629,69 +637,20 @@ auto FCommonUtils::ConnectGraphNodes(const UEdGraph* Graph,
 	return true;
 }
 
-auto FCommonUtils::FindPin(UEdGraphNode* Node,
-                           const FString& PinName,
-                           const EEdGraphPinDirection Direction) -> UEdGraphPin* {
-	if (!Node) {
-		return nullptr;
-	}
-
-	// Log all pins for debugging
-	UE_LOG(LogTemp,
-	       Display,
-	       TEXT("FindPin: Looking for pin '%s' (Direction: %d) in node '%s'"),
-	       *PinName,
-	       (int32)Direction,
-	       *Node->GetName());
-
-	for (const UEdGraphPin* Pin : Node->Pins) {
-		UE_LOG(LogTemp,
-		       Display,
-		       TEXT("  - Available pin: '%s', Direction: %d, Category: %s"),
-		       *Pin->PinName.ToString(),
-		       (int32)Pin->Direction,
-		       *Pin->PinType.PinCategory.ToString());
-	}
-
-	// First try exact match
-	for (UEdGraphPin* Pin : Node->Pins) {
-		if (Pin->PinName.ToString() == PinName && (Direction == EGPD_MAX || Pin->Direction == Direction)) {
-			UE_LOG(LogTemp, Display, TEXT("  - Found exact matching pin: '%s'"), *Pin->PinName.ToString());
-			return Pin;
-		}
-	}
-
-	// If no exact match and we're looking for a component reference, try case-insensitive match
-	for (UEdGraphPin* Pin : Node->Pins) {
-		if (Pin->PinName.ToString().Equals(PinName, ESearchCase::IgnoreCase) &&
-			(Direction == EGPD_MAX || Pin->Direction == Direction)) {
-			UE_LOG(LogTemp, Display, TEXT("  - Found case-insensitive matching pin: '%s'"), *Pin->PinName.ToString());
-			return Pin;
-		}
-	}
-
-	// If we're looking for a component output and didn't find it by name, try to find the first data output pin
-	if (Direction == EGPD_Output && Cast<UK2Node_VariableGet>(Node) != nullptr) {
-		for (UEdGraphPin* Pin : Node->Pins) {
-			if (Pin->Direction == EGPD_Output && Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec) {
-				UE_LOG(LogTemp, Display, TEXT("  - Found fallback data output pin: '%s'"), *Pin->PinName.ToString());
-				return Pin;
-			}
-		}
+auto FCommonUtils::LinkGraphPins(UEdGraphPin* SourcePin, UEdGraphPin* TargetPin) -> void {
+	// Break any existing connections on the target pin (to avoid conflicts)
+	if (TargetPin->LinkedTo.Num() > 0) {
+		TargetPin->BreakAllPinLinks();
 	}
 
-	// If pin name is empty, try to find default execution pin
-	if (PinName.IsEmpty()) {
-		for (UEdGraphPin* Pin : Node->Pins) {
-			if (Pin->Direction == Direction && Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec) {
-				UE_LOG(LogTemp, Display, TEXT("  - Found default execution pin: '%s'"), *Pin->PinName.ToString());
-				return Pin;
-			}
-		}
-	}
+	// Make the direct connection using the standard approach
+	SourcePin->MakeLinkTo(TargetPin);
+}
 
-	UE_LOG(LogTemp, Warning, TEXT("  - No matching pin found for '%s'"), *PinName);
-	return nullptr;
+auto FCommonUtils::FindPin(UEdGraphNode* Node,
+                           const FString& PinName,
+                           const EEdGraphPinDirection Direction) -> UEdGraphPin* {
+	return UnrealMCP::FPinLookupCache::FindPin(Node, PinName, Direction);
 }
 
 auto FCommonUtils::FindExistingEventNode(UEdGraph* Graph, const FString& EventName) -> UK2Node_Event* {
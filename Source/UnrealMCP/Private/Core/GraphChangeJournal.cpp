@@ -0,0 +1,176 @@
+#include "Core/GraphChangeJournal.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Event.h"
+#include "K2Node_Variable.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogMCPGraphJournal, Log, All);
+
+namespace UnrealMCP {
+
+	namespace {
+		/** Case-sensitive, unlike GetTypeHash(FString); default values and names differ by case */
+		auto HashString(const FString& Value) -> uint32 {
+			return FCrc::StrCrc32(*Value);
+		}
+	}
+
+	TMap<FObjectKey, FGraphChangeJournal::FGraphJournal> FGraphChangeJournal::Journals;
+	int64 FGraphChangeJournal::LastVersion = 0;
+
+	auto FGraphChangeJournal::GetChanges(
+		UEdGraph* Graph,
+		const TOptional<int64>& Since,
+		FGraphChanges& OutChanges
+	) -> void {
+		const FGraphJournal& Journal = Update(Graph);
+
+		OutChanges.Version = Journal.Version;
+		OutChanges.bFull = !Since.IsSet() || Since.GetValue() < Journal.TrackedSince || Since.GetValue() > LastVersion;
+
+		for (UEdGraphNode* Node : Graph->Nodes) {
+			if (!Node) {
+				continue;
+			}
+			const FNodeState* State = Journal.Nodes.Find(Node->NodeGuid);
+			if (OutChanges.bFull || (State && State->Version > Since.GetValue())) {
+				OutChanges.ChangedNodes.Add(Node);
+			}
+		}
+
+		if (!OutChanges.bFull) {
+			for (const TPair<FGuid, int64>& Removed : Journal.Removed) {
+				if (Removed.Value > Since.GetValue()) {
+					OutChanges.RemovedNodes.Add(Removed.Key);
+				}
+			}
+		}
+	}
+
+	auto FGraphChangeJournal::Reset() -> void {
+		Journals.Empty();
+	}
+
+	auto FGraphChangeJournal::Update(UEdGraph* Graph) -> FGraphJournal& {
+		FGraphJournal* Journal = Journals.Find(FObjectKey(Graph));
+		if (!Journal) {
+			// Drop journals of graphs that no longer exist before adding one
+			for (auto It = Journals.CreateIterator(); It; ++It) {
+				if (!It.Value().Graph.IsValid()) {
+					It.RemoveCurrent();
+				}
+			}
+			Journal = &Journals.Add(FObjectKey(Graph));
+			Journal->Graph = Graph;
+		}
+
+		// The version is taken lazily, so an unchanged graph keeps its version
+		int64 ChangeVersion = 0;
+		const auto Stamp = [&ChangeVersion]() -> int64 {
+			if (ChangeVersion == 0) {
+				ChangeVersion = NextVersion();
+			}
+			return ChangeVersion;
+		};
+
+		TSet<FGuid> Seen;
+		Seen.Reserve(Graph->Nodes.Num());
+
+		for (const UEdGraphNode* Node : Graph->Nodes) {
+			if (!Node) {
+				continue;
+			}
+			Seen.Add(Node->NodeGuid);
+
+			const uint32 Hash = HashNode(Node);
+			FNodeState& State = Journal->Nodes.FindOrAdd(Node->NodeGuid);
+			if (State.Version == 0 || State.Hash != Hash) {
+				State.Hash = Hash;
+				State.Version = Stamp();
+				Journal->Removed.Remove(Node->NodeGuid);
+			}
+		}
+
+		for (auto It = Journal->Nodes.CreateIterator(); It; ++It) {
+			if (!Seen.Contains(It.Key())) {
+				Journal->Removed.Add(It.Key(), Stamp());
+				It.RemoveCurrent();
+			}
+		}
+
+		if (Journal->TrackedSince == 0) {
+			Journal->TrackedSince = Stamp();
+		}
+		if (ChangeVersion != 0) {
+			Journal->Version = ChangeVersion;
+			Journal->Versions.Add(ChangeVersion);
+			if (Journal->Versions.Num() > MaxRetainedVersions) {
+				Journal->Versions.RemoveAt(0, Journal->Versions.Num() - MaxRetainedVersions);
+
+				// Diffs never reach back past the oldest retained version, so older tombstones are not needed
+				const int64 OldestVersion = Journal->Versions[0];
+				for (auto It = Journal->Removed.CreateIterator(); It; ++It) {
+					if (It.Value() <= OldestVersion) {
+						It.RemoveCurrent();
+					}
+				}
+				Journal->TrackedSince = FMath::Max(Journal->TrackedSince, OldestVersion);
+			}
+			UE_LOG(LogMCPGraphJournal, Verbose, TEXT("Graph '%s' is now at version %lld"), *Graph->GetName(), ChangeVersion);
+		}
+
+		return *Journal;
+	}
+
+	auto FGraphChangeJournal::NextVersion() -> int64 {
+		// Milliseconds since the Unix epoch keep versions increasing across editor restarts
+		const int64 Now = static_cast<int64>((FDateTime::UtcNow() - FDateTime(1970, 1, 1)).GetTotalMilliseconds());
+		LastVersion = FMath::Max(LastVersion + 1, Now);
+		return LastVersion;
+	}
+
+	auto FGraphChangeJournal::HashNode(const UEdGraphNode* Node) -> uint32 {
+		uint32 Hash = GetTypeHash(Node->GetClass()->GetFName());
+		Hash = HashCombine(Hash, GetTypeHash(Node->NodePosX));
+		Hash = HashCombine(Hash, GetTypeHash(Node->NodePosY));
+		Hash = HashCombine(Hash, HashString(Node->NodeComment));
+
+		if (const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node)) {
+			Hash = HashCombine(Hash, GetTypeHash(CallNode->FunctionReference.GetMemberName()));
+		}
+		else if (const UK2Node_Variable* VariableNode = Cast<UK2Node_Variable>(Node)) {
+			Hash = HashCombine(Hash, GetTypeHash(VariableNode->VariableReference.GetMemberName()));
+		}
+		else if (const UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node)) {
+			Hash = HashCombine(Hash, GetTypeHash(EventNode->EventReference.GetMemberName()));
+			Hash = HashCombine(Hash, GetTypeHash(EventNode->CustomFunctionName));
+		}
+
+		for (const UEdGraphPin* Pin : Node->Pins) {
+			if (!Pin) {
+				continue;
+			}
+			Hash = HashCombine(Hash, HashString(Pin->PinName.ToString()));
+			Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Pin->Direction)));
+			Hash = HashCombine(Hash, GetTypeHash(Pin->PinType.PinCategory));
+			Hash = HashCombine(Hash, GetTypeHash(Pin->PinType.PinSubCategory));
+			Hash = HashCombine(Hash, GetTypeHash(Pin->PinType.PinSubCategoryObject.Get()));
+			Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Pin->PinType.ContainerType)));
+			Hash = HashCombine(Hash, HashString(Pin->DefaultValue));
+			Hash = HashCombine(Hash, GetTypeHash(Pin->DefaultObject.Get()));
+			Hash = HashCombine(Hash, HashString(Pin->DefaultTextValue.ToString()));
+			Hash = HashCombine(Hash, GetTypeHash(Pin->bHidden));
+
+			for (const UEdGraphPin* Linked : Pin->LinkedTo) {
+				if (Linked && Linked->GetOwningNodeUnchecked()) {
+					Hash = HashCombine(Hash, GetTypeHash(Linked->GetOwningNode()->NodeGuid));
+					Hash = HashCombine(Hash, HashString(Linked->PinName.ToString()));
+				}
+			}
+		}
+		return Hash;
+	}
+
+}
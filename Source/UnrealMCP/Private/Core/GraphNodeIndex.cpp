@@ -0,0 +1,183 @@
+#include "Core/GraphNodeIndex.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "Engine/Blueprint.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogMCPGraphNodeIndex, Log, All);
+
+namespace UnrealMCP {
+
+	TMap<FObjectKey, FGraphNodeIndex::FGraphTable> FGraphNodeIndex::Tables;
+	TMap<FObjectKey, FGraphNodeIndex::FBlueprintTable> FGraphNodeIndex::BlueprintTables;
+
+	auto FGraphNodeIndex::FindNode(UEdGraph* Graph, const FGuid& NodeGuid) -> UEdGraphNode* {
+		if (!Graph || !NodeGuid.IsValid()) {
+			return nullptr;
+		}
+
+		FGraphTable& Table = GetTable(Graph);
+		FlushPending(Table);
+
+		if (const TWeakObjectPtr<UEdGraphNode>* Entry = Table.Nodes.Find(NodeGuid)) {
+			UEdGraphNode* Node = Entry->Get();
+			if (IsValid(Node) && Node->NodeGuid == NodeGuid && Node->GetGraph() == Graph) {
+				return Node;
+			}
+		}
+		else if (Table.Nodes.Num() == Graph->Nodes.Num()) {
+			// Table agrees with the graph, so the GUID is genuinely absent
+			return nullptr;
+		}
+
+		// Stale hit or a node added without a notification
+		RebuildTable(Graph, Table);
+
+		const TWeakObjectPtr<UEdGraphNode>* Entry = Table.Nodes.Find(NodeGuid);
+		return Entry ? Entry->Get() : nullptr;
+	}
+
+	auto FGraphNodeIndex::FindNode(UBlueprint* Blueprint, const FGuid& NodeGuid) -> UEdGraphNode* {
+		if (!Blueprint || !NodeGuid.IsValid()) {
+			return nullptr;
+		}
+
+		FBlueprintTable& Table = GetBlueprintTable(Blueprint);
+
+		if (const TWeakObjectPtr<UEdGraph>* Known = Table.GraphByNode.Find(NodeGuid)) {
+			if (UEdGraphNode* Node = FindNode(Known->Get(), NodeGuid)) {
+				return Node;
+			}
+			Table.GraphByNode.Remove(NodeGuid);
+		}
+
+		if (UEdGraphNode* Node = FindInGraphs(Table, NodeGuid)) {
+			return Node;
+		}
+
+		// The node may live in a graph added since the list was taken
+		RefreshGraphs(Blueprint, Table);
+		return FindInGraphs(Table, NodeGuid);
+	}
+
+	auto FGraphNodeIndex::Reset() -> void {
+		for (TPair<FObjectKey, FGraphTable>& Pair : Tables) {
+			if (UEdGraph* Graph = Pair.Value.Graph.Get()) {
+				Graph->RemoveOnGraphChangedHandler(Pair.Value.GraphChangedHandle);
+			}
+		}
+		Tables.Empty();
+		BlueprintTables.Empty();
+	}
+
+	auto FGraphNodeIndex::GetBlueprintTable(UBlueprint* Blueprint) -> FBlueprintTable& {
+		if (FBlueprintTable* Existing = BlueprintTables.Find(FObjectKey(Blueprint))) {
+			return *Existing;
+		}
+
+		for (auto It = BlueprintTables.CreateIterator(); It; ++It) {
+			if (!It.Value().Blueprint.IsValid()) {
+				It.RemoveCurrent();
+			}
+		}
+
+		FBlueprintTable& Table = BlueprintTables.Add(FObjectKey(Blueprint));
+		Table.Blueprint = Blueprint;
+		RefreshGraphs(Blueprint, Table);
+		return Table;
+	}
+
+	auto FGraphNodeIndex::RefreshGraphs(UBlueprint* Blueprint, FBlueprintTable& Table) -> void {
+		TArray<UEdGraph*> Graphs;
+		Blueprint->GetAllGraphs(Graphs);
+
+		Table.Graphs.Reset(Graphs.Num());
+		for (UEdGraph* Graph : Graphs) {
+			Table.Graphs.Add(Graph);
+		}
+	}
+
+	auto FGraphNodeIndex::FindInGraphs(FBlueprintTable& Table, const FGuid& NodeGuid) -> UEdGraphNode* {
+		for (const TWeakObjectPtr<UEdGraph>& Graph : Table.Graphs) {
+			if (UEdGraphNode* Node = FindNode(Graph.Get(), NodeGuid)) {
+				Table.GraphByNode.Add(NodeGuid, Graph);
+				return Node;
+			}
+		}
+		return nullptr;
+	}
+
+	auto FGraphNodeIndex::GetTable(UEdGraph* Graph) -> FGraphTable& {
+		if (FGraphTable* Existing = Tables.Find(FObjectKey(Graph))) {
+			return *Existing;
+		}
+
+		PruneStaleTables();
+
+		FGraphTable& Table = Tables.Add(FObjectKey(Graph));
+		Table.Graph = Graph;
+		Table.GraphChangedHandle = Graph->AddOnGraphChangedHandler(
+			FOnGraphChanged::FDelegate::CreateStatic(&FGraphNodeIndex::HandleGraphChanged));
+		RebuildTable(Graph, Table);
+		return Table;
+	}
+
+	auto FGraphNodeIndex::RebuildTable(UEdGraph* Graph, FGraphTable& Table) -> void {
+		Table.Nodes.Reset();
+		Table.PendingNodes.Reset();
+		Table.Nodes.Reserve(Graph->Nodes.Num());
+
+		for (UEdGraphNode* Node : Graph->Nodes) {
+			if (Node) {
+				Table.Nodes.Add(Node->NodeGuid, Node);
+			}
+		}
+
+		UE_LOG(LogMCPGraphNodeIndex, Verbose, TEXT("Indexed %d nodes of graph '%s'"), Table.Nodes.Num(), *Graph->GetName());
+	}
+
+	auto FGraphNodeIndex::FlushPending(FGraphTable& Table) -> void {
+		for (const TWeakObjectPtr<UEdGraphNode>& Pending : Table.PendingNodes) {
+			if (UEdGraphNode* Node = Pending.Get()) {
+				Table.Nodes.Add(Node->NodeGuid, Node);
+			}
+		}
+		Table.PendingNodes.Reset();
+	}
+
+	auto FGraphNodeIndex::PruneStaleTables() -> void {
+		for (auto It = Tables.CreateIterator(); It; ++It) {
+			if (!It.Value().Graph.IsValid()) {
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	auto FGraphNodeIndex::HandleGraphChanged(const FEdGraphEditAction& Action) -> void {
+		FGraphTable* Table = Action.Graph ? Tables.Find(FObjectKey(Action.Graph)) : nullptr;
+		if (!Table) {
+			return;
+		}
+
+		// Link edits and other topology notifications do not change which nodes exist
+		if (Action.Action & GRAPHACTION_AddNode) {
+			// GUIDs are usually assigned after AddNode, so key these on the next lookup
+			for (const UEdGraphNode* Node : Action.Nodes) {
+				Table->PendingNodes.Add(const_cast<UEdGraphNode*>(Node));
+			}
+		}
+
+		if (Action.Action & GRAPHACTION_RemoveNode) {
+			for (const UEdGraphNode* Node : Action.Nodes) {
+				if (!Node) {
+					continue;
+				}
+				if (const TWeakObjectPtr<UEdGraphNode>* Entry = Table->Nodes.Find(Node->NodeGuid);
+					Entry && Entry->Get(true) == Node) {
+					Table->Nodes.Remove(Node->NodeGuid);
+				}
+				Table->PendingNodes.Remove(const_cast<UEdGraphNode*>(Node));
+			}
+		}
+	}
+
+}
@@ -0,0 +1,511 @@
+#include "Core/LevelDigest.h"
+#include "EngineUtils.h"
+#include "Editor.h"
+#include "Components/ActorComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Hash/CityHash.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/UObjectGlobals.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogMCPLevelDigest, Log, All);
+
+namespace UnrealMCP {
+
+	namespace {
+		auto HashText(const FString& Text) -> uint64 {
+			return CityHash64(reinterpret_cast<const char*>(*Text), Text.Len() * sizeof(TCHAR));
+		}
+
+		/** Editable properties that differ from the archetype, as Name=Value */
+		auto AppendOverrides(const UObject* Object, FString& Text) -> void {
+			const UObject* Archetype = Object->GetArchetype();
+			for (TFieldIterator<FProperty> It(Object->GetClass()); It; ++It) {
+				const FProperty* Property = *It;
+				if (!Property->HasAnyPropertyFlags(CPF_Edit) || Property->HasAnyPropertyFlags(CPF_Deprecated | CPF_Transient)) {
+					continue;
+				}
+				for (int32 Index = 0; Index < Property->ArrayDim; ++Index) {
+					if (Archetype && Property->Identical_InContainer(Object, Archetype, Index, PPF_DeepComparison)) {
+						continue;
+					}
+					Text.AppendChar(TEXT('|'));
+					Text += Property->GetName();
+					Text.Appendf(TEXT("[%d]="), Index);
+					Property->ExportText_InContainer(Index, Text, Object, nullptr, nullptr, PPF_None);
+				}
+			}
+		}
+	}
+
+	bool FLevelDigest::bInitialized = false;
+	FObjectKey FLevelDigest::World;
+	TMap<FObjectKey, FLevelDigest::FActorEntry> FLevelDigest::Actors;
+	TMap<FString, FLevelDigest::FNode> FLevelDigest::Nodes;
+	TSet<FObjectKey> FLevelDigest::Dirty;
+	bool FLevelDigest::bSweepPending = false;
+	TMap<FString, int64> FLevelDigest::Removed;
+	TArray<TPair<uint64, int64>> FLevelDigest::History;
+	int64 FLevelDigest::TrackedSince = 0;
+	int64 FLevelDigest::LastVersion = 0;
+
+	FDelegateHandle FLevelDigest::ActorAddedHandle;
+	FDelegateHandle FLevelDigest::ActorDeletedHandle;
+	FDelegateHandle FLevelDigest::ActorListChangedHandle;
+	FDelegateHandle FLevelDigest::ActorMovedHandle;
+	FDelegateHandle FLevelDigest::ActorLabelChangedHandle;
+	FDelegateHandle FLevelDigest::ActorFolderChangedHandle;
+	FDelegateHandle FLevelDigest::ObjectPropertyChangedHandle;
+	FDelegateHandle FLevelDigest::ObjectRenamedHandle;
+	FDelegateHandle FLevelDigest::LevelAddedHandle;
+	FDelegateHandle FLevelDigest::LevelRemovedHandle;
+	FDelegateHandle FLevelDigest::MapChangeHandle;
+
+	auto FLevelDigest::Initialize() -> void {
+		if (bInitialized || !GEngine) {
+			return;
+		}
+
+		ActorAddedHandle = GEngine->OnLevelActorAdded().AddStatic(&FLevelDigest::HandleActorChanged);
+		ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddStatic(&FLevelDigest::HandleActorChanged);
+		ActorListChangedHandle = GEngine->OnLevelActorListChanged().AddStatic(&FLevelDigest::HandleActorListChanged);
+		ActorMovedHandle = GEngine->OnActorMoved().AddStatic(&FLevelDigest::HandleActorChanged);
+		ActorLabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddStatic(&FLevelDigest::HandleActorChanged);
+		ActorFolderChangedHandle = GEngine->OnLevelActorFolderChanged().AddStatic(&FLevelDigest::HandleActorFolderChanged);
+		ObjectPropertyChangedHandle =
+			FCoreUObjectDelegates::OnObjectPropertyChanged.AddStatic(&FLevelDigest::HandleObjectPropertyChanged);
+		ObjectRenamedHandle = FCoreUObjectDelegates::OnObjectRenamed.AddStatic(&FLevelDigest::HandleObjectRenamed);
+		LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddStatic(&FLevelDigest::HandleLevelChanged);
+		LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddStatic(&FLevelDigest::HandleLevelChanged);
+		MapChangeHandle = FEditorDelegates::MapChange.AddStatic(&FLevelDigest::HandleMapChange);
+
+		bInitialized = true;
+		UE_LOG(LogMCPLevelDigest, Display, TEXT("Level digest initialized"));
+	}
+
+	auto FLevelDigest::Shutdown() -> void {
+		if (!bInitialized) {
+			return;
+		}
+
+		if (GEngine) {
+			GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+			GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+			GEngine->OnLevelActorListChanged().Remove(ActorListChangedHandle);
+			GEngine->OnActorMoved().Remove(ActorMovedHandle);
+			GEngine->OnLevelActorFolderChanged().Remove(ActorFolderChangedHandle);
+		}
+		FCoreDelegates::OnActorLabelChanged.Remove(ActorLabelChangedHandle);
+		FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+		FCoreUObjectDelegates::OnObjectRenamed.Remove(ObjectRenamedHandle);
+		FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+		FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+		FEditorDelegates::MapChange.Remove(MapChangeHandle);
+
+		Reset();
+		bInitialized = false;
+	}
+
+	auto FLevelDigest::GetDigest(
+		UWorld* InWorld,
+		const FString& Path,
+		const int32 Depth,
+		const bool bIncludeActors,
+		const bool bRehash,
+		FNodeDigest& OutNode
+	) -> bool {
+		Update(InWorld, bRehash);
+		if (!Nodes.Contains(Path)) {
+			return false;
+		}
+
+		FillNode(Path, Depth, bIncludeActors, OutNode);
+		return true;
+	}
+
+	auto FLevelDigest::GetChanges(UWorld* InWorld, const uint64 SinceDigest, FChanges& OutChanges) -> void {
+		Update(InWorld, false);
+		OutChanges.Digest = Nodes.FindChecked(FString()).Digest;
+
+		// The most recent match wins when the level returned to an earlier state
+		const TPair<uint64, int64>* Since = nullptr;
+		for (int32 Index = History.Num() - 1; Index >= 0 && !Since; --Index) {
+			if (History[Index].Key == SinceDigest) {
+				Since = &History[Index];
+			}
+		}
+		if (!Since) {
+			OutChanges.bFull = true;
+			return;
+		}
+
+		const int64 SinceVersion = Since->Value;
+		for (const TPair<FObjectKey, FActorEntry>& Pair : Actors) {
+			if (Pair.Value.Version > SinceVersion) {
+				OutChanges.ChangedActors.Emplace(Pair.Value.Name, Pair.Value.NodePath);
+			}
+		}
+		for (const TPair<FString, int64>& Pair : Removed) {
+			if (Pair.Value > SinceVersion) {
+				OutChanges.RemovedActors.Add(Pair.Key);
+			}
+		}
+	}
+
+	auto FLevelDigest::MarkDirty(const AActor* Actor) -> void {
+		// Nothing to keep current until a digest was requested
+		if (Actor && Nodes.Num() > 0) {
+			Dirty.Add(FObjectKey(Actor));
+		}
+	}
+
+	auto FLevelDigest::Reset() -> void {
+		World = FObjectKey();
+		Actors.Empty();
+		Nodes.Empty();
+		Dirty.Empty();
+		bSweepPending = false;
+		Removed.Empty();
+		History.Empty();
+		TrackedSince = 0;
+	}
+
+	auto FLevelDigest::ToHex(const uint64 Digest) -> FString {
+		return FString::Printf(TEXT("%016llx"), Digest);
+	}
+
+	auto FLevelDigest::ParseHex(const FString& Text, uint64& OutDigest) -> bool {
+		if (Text.IsEmpty() || Text.Len() > 16) {
+			return false;
+		}
+
+		uint64 Value = 0;
+		for (const TCHAR Char : Text) {
+			if (!FChar::IsHexDigit(Char)) {
+				return false;
+			}
+			Value = (Value << 4) | static_cast<uint64>(FParse::HexDigit(Char));
+		}
+		OutDigest = Value;
+		return true;
+	}
+
+	auto FLevelDigest::Update(UWorld* InWorld, const bool bRehash) -> void {
+		// Without event subscriptions the digest would only change on rehash
+		Initialize();
+
+		const double StartTime = FPlatformTime::Seconds();
+		const bool bRebuild = FObjectKey(InWorld) != World || Nodes.Num() == 0;
+		if (bRebuild) {
+			Reset();
+			World = FObjectKey(InWorld);
+			Nodes.Add(FString());
+		}
+
+		if (bRebuild || bRehash || bSweepPending) {
+			bSweepPending = false;
+
+			// Known actors are included so that ones gone without an event are removed
+			for (const TPair<FObjectKey, FActorEntry>& Pair : Actors) {
+				Dirty.Add(Pair.Key);
+			}
+			for (TActorIterator<AActor> It(InWorld); It; ++It) {
+				Dirty.Add(FObjectKey(*It));
+			}
+		}
+
+		int64 ChangeVersion = 0;
+		int32 NumChanged = 0;
+		for (const FObjectKey& Key : Dirty) {
+			AActor* Actor = Cast<AActor>(Key.ResolveObjectPtr());
+			if (IsTracked(Actor)) {
+				NumChanged += UpdateActor(Actor, ChangeVersion) ? 1 : 0;
+			} else if (Actors.Contains(Key)) {
+				RemoveActor(Key, ChangeVersion);
+				++NumChanged;
+			}
+		}
+		Dirty.Reset();
+
+		if (TrackedSince == 0) {
+			TrackedSince = ChangeVersion != 0 ? ChangeVersion : NextVersion();
+		}
+
+		const uint64 RootDigest = Nodes.FindChecked(FString()).Digest;
+		if (History.Num() == 0 || History.Last().Key != RootDigest) {
+			History.Emplace(RootDigest, ChangeVersion != 0 ? ChangeVersion : LastVersion);
+			if (History.Num() > MaxHistory) {
+				History.RemoveAt(0, History.Num() - MaxHistory);
+			}
+
+			// Diffs never reach back past the oldest remembered digest
+			const int64 OldestVersion = History[0].Value;
+			for (auto It = Removed.CreateIterator(); It; ++It) {
+				if (It.Value() <= OldestVersion) {
+					It.RemoveCurrent();
+				}
+			}
+		}
+
+		if (NumChanged > 0) {
+			UE_LOG(LogMCPLevelDigest,
+			       Verbose,
+			       TEXT("Rehashed %d actors of world '%s' in %.3f ms"),
+			       NumChanged,
+			       *InWorld->GetName(),
+			       (FPlatformTime::Seconds() - StartTime) * 1000.0);
+		}
+	}
+
+	auto FLevelDigest::UpdateActor(AActor* Actor, int64& ChangeVersion) -> bool {
+		const FObjectKey Key(Actor);
+		const FString Name = Actor->GetName();
+		const FString NodePath = GetNodePath(Actor);
+		const uint64 Digest = HashActor(Actor);
+
+		FActorEntry* Entry = Actors.Find(Key);
+		if (Entry && Entry->Digest == Digest && Entry->NodePath == NodePath && Entry->Name == Name) {
+			return false;
+		}
+
+		const int64 Version = Stamp(ChangeVersion);
+		if (Entry) {
+			Nodes.FindChecked(Entry->NodePath).Actors.Remove(Key);
+			Propagate(Entry->NodePath, 0, KeyDigest(Entry->Name, Entry->Digest), -1);
+			if (Entry->Name != Name) {
+				Removed.Add(Entry->Name, Version);
+			}
+		} else {
+			Entry = &Actors.Add(Key);
+			Entry->Actor = Actor;
+		}
+
+		Entry->Name = Name;
+		Entry->NodePath = NodePath;
+		Entry->Digest = Digest;
+		Entry->Version = Version;
+		Removed.Remove(Name);
+
+		FindOrAddNode(NodePath).Actors.Add(Key);
+		Propagate(NodePath, KeyDigest(Name, Digest), 0, 1);
+		return true;
+	}
+
+	auto FLevelDigest::RemoveActor(const FObjectKey& Key, int64& ChangeVersion) -> void {
+		FActorEntry Entry;
+		if (!Actors.RemoveAndCopyValue(Key, Entry)) {
+			return;
+		}
+
+		Removed.Add(Entry.Name, Stamp(ChangeVersion));
+		Nodes.FindChecked(Entry.NodePath).Actors.Remove(Key);
+		Propagate(Entry.NodePath, 0, KeyDigest(Entry.Name, Entry.Digest), -1);
+	}
+
+	auto FLevelDigest::IsTracked(const AActor* Actor) -> bool {
+		return IsValid(Actor) && Actor->GetLevel() && FObjectKey(Actor->GetWorld()) == World;
+	}
+
+	auto FLevelDigest::Propagate(const FString& NodePath, uint64 Added, uint64 Subtracted, int32 ActorDelta) -> void {
+		FString Path = NodePath;
+		while (true) {
+			FNode& Node = Nodes.FindChecked(Path);
+
+			// An empty node contributes nothing, so removing the last actor restores the parent exactly
+			const uint64 OldContribution = Node.ActorCount > 0 ? KeyDigest(Path, Node.Digest) : 0;
+			Node.Digest = Node.Digest + Added - Subtracted;
+			Node.ActorCount += ActorDelta;
+			const uint64 NewContribution = Node.ActorCount > 0 ? KeyDigest(Path, Node.Digest) : 0;
+
+			if (Path.IsEmpty()) {
+				return;
+			}
+
+			FString Parent = Node.Parent;
+			if (Node.ActorCount == 0) {
+				Nodes.Remove(Path);
+				Nodes.FindChecked(Parent).Children.Remove(Path);
+			}
+
+			Added = NewContribution;
+			Subtracted = OldContribution;
+			Path = MoveTemp(Parent);
+		}
+	}
+
+	auto FLevelDigest::FindOrAddNode(const FString& Path) -> FNode& {
+		if (FNode* Existing = Nodes.Find(Path)) {
+			return *Existing;
+		}
+
+		const FString Parent = GetParentPath(Path);
+		FindOrAddNode(Parent).Children.Add(Path);
+
+		FNode& Node = Nodes.Add(Path);
+		Node.Parent = Parent;
+		return Node;
+	}
+
+	auto FLevelDigest::GetNodePath(const AActor* Actor) -> FString {
+		FString Path = Actor->GetLevel()->GetOutermost()->GetName();
+		if (const FName Folder = Actor->GetFolderPath(); !Folder.IsNone()) {
+			Path.AppendChar(TEXT(':'));
+			Path += Folder.ToString();
+		}
+		return Path;
+	}
+
+	auto FLevelDigest::GetParentPath(const FString& Path) -> FString {
+		int32 Separator = INDEX_NONE;
+		if (!Path.FindChar(TEXT(':'), Separator)) {
+			return FString();
+		}
+
+		// Package names contain slashes too, so only search the folder part
+		const int32 Slash = Path.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+		return Slash > Separator ? Path.Left(Slash) : Path.Left(Separator);
+	}
+
+	auto FLevelDigest::HashActor(const AActor* Actor) -> uint64 {
+		FString Text;
+		Text.Reserve(512);
+		Text += Actor->GetName();
+		Text.AppendChar(TEXT('|'));
+		Text += Actor->GetClass()->GetPathName();
+		Text.AppendChar(TEXT('|'));
+		Text += Actor->GetActorLabel();
+		Text.AppendChar(TEXT('|'));
+		Text += Actor->GetFolderPath().ToString();
+
+		// Rounded so that float noise from round trips does not count as a change
+		const FTransform Transform = Actor->GetActorTransform();
+		const FVector Location = Transform.GetLocation();
+		const FRotator Rotation = Transform.Rotator();
+		const FVector Scale = Transform.GetScale3D();
+		Text.Appendf(TEXT("|%.3f,%.3f,%.3f|%.3f,%.3f,%.3f|%.4f,%.4f,%.4f"),
+		             Location.X, Location.Y, Location.Z,
+		             Rotation.Pitch, Rotation.Yaw, Rotation.Roll,
+		             Scale.X, Scale.Y, Scale.Z);
+
+		for (const FName Tag : Actor->Tags) {
+			Text.AppendChar(TEXT('#'));
+			Text += Tag.ToString();
+		}
+		if (const AActor* Parent = Actor->GetAttachParentActor()) {
+			Text += TEXT("|^");
+			Text += Parent->GetName();
+		}
+
+		AppendOverrides(Actor, Text);
+
+		TInlineComponentArray<UActorComponent*> Components(Actor);
+		Components.Sort([](const UActorComponent& A, const UActorComponent& B) {
+			return A.GetFName().LexicalLess(B.GetFName());
+		});
+		for (const UActorComponent* Component : Components) {
+			Text += TEXT("|@");
+			Text += Component->GetName();
+			Text.AppendChar(TEXT(':'));
+			Text += Component->GetClass()->GetName();
+			AppendOverrides(Component, Text);
+		}
+
+		return HashText(Text);
+	}
+
+	auto FLevelDigest::KeyDigest(const FString& Key, const uint64 Digest) -> uint64 {
+		// Finalizer of MurmurHash3; summing unmixed digests would let changes cancel out
+		uint64 Mixed = HashText(Key) ^ (Digest * 0x9E3779B97F4A7C15ull);
+		Mixed ^= Mixed >> 33;
+		Mixed *= 0xFF51AFD7ED558CCDull;
+		Mixed ^= Mixed >> 33;
+		Mixed *= 0xC4CEB9FE1A85EC53ull;
+		Mixed ^= Mixed >> 33;
+		return Mixed;
+	}
+
+	auto FLevelDigest::FillNode(const FString& Path, const int32 Depth, const bool bIncludeActors, FNodeDigest& OutNode) -> void {
+		const FNode& Node = Nodes.FindChecked(Path);
+		OutNode.Path = Path;
+		OutNode.Digest = Node.Digest;
+		OutNode.ActorCount = Node.ActorCount;
+
+		if (bIncludeActors) {
+			OutNode.Actors.Reserve(Node.Actors.Num());
+			for (const FObjectKey& Key : Node.Actors) {
+				const FActorEntry& Entry = Actors.FindChecked(Key);
+				OutNode.Actors.Add({Entry.Name, Entry.Digest});
+			}
+			OutNode.Actors.Sort([](const FActorDigest& A, const FActorDigest& B) { return A.Name < B.Name; });
+		}
+
+		if (Depth <= 0) {
+			return;
+		}
+
+		TArray<FString> ChildPaths = Node.Children.Array();
+		ChildPaths.Sort();
+		OutNode.Children.SetNum(ChildPaths.Num());
+		for (int32 Index = 0; Index < ChildPaths.Num(); ++Index) {
+			FillNode(ChildPaths[Index], Depth - 1, bIncludeActors, OutNode.Children[Index]);
+		}
+	}
+
+	auto FLevelDigest::NextVersion() -> int64 {
+		// Milliseconds since the Unix epoch keep versions increasing across editor restarts
+		const int64 Now = static_cast<int64>((FDateTime::UtcNow() - FDateTime(1970, 1, 1)).GetTotalMilliseconds());
+		LastVersion = FMath::Max(LastVersion + 1, Now);
+		return LastVersion;
+	}
+
+	auto FLevelDigest::Stamp(int64& ChangeVersion) -> int64 {
+		if (ChangeVersion == 0) {
+			ChangeVersion = NextVersion();
+		}
+		return ChangeVersion;
+	}
+
+	auto FLevelDigest::HandleActorChanged(AActor* Actor) -> void {
+		MarkDirty(Actor);
+	}
+
+	auto FLevelDigest::HandleActorListChanged() -> void {
+		// Bulk changes (undo/redo, level reloads) carry no per-actor detail. The next request rehashes
+		// every known and live actor without dropping the history; several bulk changes cost one sweep
+		if (Nodes.Num() > 0) {
+			bSweepPending = true;
+		}
+	}
+
+	auto FLevelDigest::HandleActorFolderChanged(const AActor* Actor, [[maybe_unused]] FName OldPath) -> void {
+		MarkDirty(Actor);
+	}
+
+	auto FLevelDigest::HandleObjectPropertyChanged(UObject* Object, [[maybe_unused]] FPropertyChangedEvent& Event) -> void {
+		const AActor* Actor = Cast<AActor>(Object);
+		if (!Actor) {
+			if (const UActorComponent* Component = Cast<UActorComponent>(Object)) {
+				Actor = Component->GetOwner();
+			}
+		}
+		MarkDirty(Actor);
+	}
+
+	auto FLevelDigest::HandleObjectRenamed(UObject* Object, [[maybe_unused]] UObject* OldOuter, [[maybe_unused]] FName OldName) -> void {
+		MarkDirty(Cast<AActor>(Object));
+	}
+
+	auto FLevelDigest::HandleLevelChanged([[maybe_unused]] ULevel* Level, UWorld* InWorld) -> void {
+		// Streaming a level in or out rebuilds the digest; clients holding older digests walk the tree
+		if (FObjectKey(InWorld) == World) {
+			Reset();
+		}
+	}
+
+	auto FLevelDigest::HandleMapChange([[maybe_unused]] uint32 MapChangeFlags) -> void {
+		Reset();
+	}
+
+}
@@ -0,0 +1,532 @@
+#include "Core/LevelEventStream.h"
+#include "Core/BlueprintCompileCoordinator.h"
+#include "Editor.h"
+#include "Components/ActorComponent.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Engine/Blueprint.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/ScopeLock.h"
+#include "UObject/UObjectGlobals.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogMCPLevelEvents, Log, All);
+
+namespace UnrealMCP {
+
+	namespace {
+		const TCHAR* const KindNames[] = {
+			TEXT("actor_added"),
+			TEXT("actor_removed"),
+			TEXT("actor_renamed"),
+			TEXT("transform_changed"),
+			TEXT("property_changed"),
+			TEXT("blueprint_compiled")
+		};
+
+		auto MakeVectorArray(const double X, const double Y, const double Z) -> TArray<TSharedPtr<FJsonValue>> {
+			return {MakeShared<FJsonValueNumber>(X), MakeShared<FJsonValueNumber>(Y), MakeShared<FJsonValueNumber>(Z)};
+		}
+	}
+
+	// ============ FLevelEvent ============
+
+	auto FLevelEvent::ToJson() const -> TSharedPtr<FJsonObject> {
+		auto Json = MakeShared<FJsonObject>();
+		Json->SetNumberField(TEXT("sequence"), static_cast<double>(Sequence));
+		Json->SetStringField(TEXT("event"), GetKindName(Kind));
+
+		if (Kind == ELevelEventKind::BlueprintCompiled) {
+			Json->SetStringField(TEXT("blueprint"), Name);
+			Json->SetStringField(TEXT("status"), Status);
+			return Json;
+		}
+
+		Json->SetStringField(TEXT("actor"), Name);
+		Json->SetStringField(TEXT("class"), ClassName);
+		if (!Label.IsEmpty()) {
+			Json->SetStringField(TEXT("label"), Label);
+		}
+		if (Kind == ELevelEventKind::ActorRenamed) {
+			Json->SetStringField(TEXT("old_name"), OldName);
+		}
+		if (Transform.IsSet()) {
+			const FVector Location = Transform->GetLocation();
+			const FRotator Rotation = Transform->Rotator();
+			const FVector Scale = Transform->GetScale3D();
+			Json->SetArrayField(TEXT("location"), MakeVectorArray(Location.X, Location.Y, Location.Z));
+			Json->SetArrayField(TEXT("rotation"), MakeVectorArray(Rotation.Pitch, Rotation.Yaw, Rotation.Roll));
+			Json->SetArrayField(TEXT("scale"), MakeVectorArray(Scale.X, Scale.Y, Scale.Z));
+		}
+		if (Kind == ELevelEventKind::PropertyChanged) {
+			TArray<TSharedPtr<FJsonValue>> PropertyArray;
+			PropertyArray.Reserve(Properties.Num());
+			for (const FString& Property : Properties) {
+				PropertyArray.Add(MakeShared<FJsonValueString>(Property));
+			}
+			Json->SetArrayField(TEXT("properties"), PropertyArray);
+		}
+		return Json;
+	}
+
+	auto FLevelEvent::GetKindName(const ELevelEventKind Kind) -> const TCHAR* {
+		return KindNames[static_cast<uint8>(Kind)];
+	}
+
+	auto FLevelEvent::ParseKind(const FString& KindName, ELevelEventKind& OutKind) -> bool {
+		for (uint8 Index = 0; Index < UE_ARRAY_COUNT(KindNames); ++Index) {
+			if (KindName.Equals(KindNames[Index], ESearchCase::IgnoreCase)) {
+				OutKind = static_cast<ELevelEventKind>(Index);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	auto FLevelEventBatch::ToJson() const -> TSharedPtr<FJsonObject> {
+		auto Json = MakeShared<FJsonObject>();
+		Json->SetStringField(TEXT("type"), TEXT("event"));
+		Json->SetNumberField(TEXT("subscription_id"), SubscriptionId);
+
+		TArray<TSharedPtr<FJsonValue>> EventArray;
+		EventArray.Reserve(Events.Num());
+		for (const FLevelEvent& Event : Events) {
+			EventArray.Add(MakeShared<FJsonValueObject>(Event.ToJson()));
+		}
+		Json->SetArrayField(TEXT("events"), EventArray);
+		Json->SetNumberField(TEXT("dropped"), Dropped);
+		return Json;
+	}
+
+	// ============ FLevelEventStream ============
+
+	bool FLevelEventStream::bInitialized = false;
+	FCriticalSection FLevelEventStream::Mutex;
+	TMap<int32, FLevelEventStream::FSubscriber> FLevelEventStream::Subscribers;
+	std::atomic<int32> FLevelEventStream::NumSubscribers{0};
+	int32 FLevelEventStream::CurrentSession = 0;
+	int32 FLevelEventStream::LastSessionId = 0;
+	int32 FLevelEventStream::LastSubscriptionId = 0;
+	int64 FLevelEventStream::LastSequence = 0;
+	TArray<FLevelEventStream::FPendingActor> FLevelEventStream::PendingActors;
+	TMap<FObjectKey, int32> FLevelEventStream::PendingIndex;
+	TArray<TWeakObjectPtr<UBlueprint>> FLevelEventStream::CompilingBlueprints;
+	TArray<TWeakObjectPtr<UBlueprint>> FLevelEventStream::CompiledBlueprints;
+
+	FTSTicker::FDelegateHandle FLevelEventStream::TickerHandle;
+	FDelegateHandle FLevelEventStream::ActorAddedHandle;
+	FDelegateHandle FLevelEventStream::ActorDeletedHandle;
+	FDelegateHandle FLevelEventStream::ActorMovedHandle;
+	FDelegateHandle FLevelEventStream::ActorLabelChangedHandle;
+	FDelegateHandle FLevelEventStream::ObjectPropertyChangedHandle;
+	FDelegateHandle FLevelEventStream::ObjectRenamedHandle;
+	FDelegateHandle FLevelEventStream::BlueprintPreCompileHandle;
+	FDelegateHandle FLevelEventStream::BlueprintCompiledHandle;
+
+	auto FLevelEventStream::Initialize() -> void {
+		if (bInitialized || !GEngine) {
+			return;
+		}
+
+		ActorAddedHandle = GEngine->OnLevelActorAdded().AddStatic(&FLevelEventStream::HandleActorAdded);
+		ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddStatic(&FLevelEventStream::HandleActorDeleted);
+		ActorMovedHandle = GEngine->OnActorMoved().AddStatic(&FLevelEventStream::HandleActorMoved);
+		ActorLabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddStatic(&FLevelEventStream::HandleActorLabelChanged);
+		ObjectPropertyChangedHandle =
+			FCoreUObjectDelegates::OnObjectPropertyChanged.AddStatic(&FLevelEventStream::HandleObjectPropertyChanged);
+		ObjectRenamedHandle = FCoreUObjectDelegates::OnObjectRenamed.AddStatic(&FLevelEventStream::HandleObjectRenamed);
+		if (GEditor) {
+			BlueprintPreCompileHandle = GEditor->OnBlueprintPreCompile().AddStatic(&FLevelEventStream::HandleBlueprintPreCompile);
+			BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddStatic(&FLevelEventStream::HandleBlueprintCompiled);
+		}
+
+		// A zero delay ticks once per frame
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FLevelEventStream::Tick), 0.0f);
+
+		bInitialized = true;
+	}
+
+	auto FLevelEventStream::Shutdown() -> void {
+		if (!bInitialized) {
+			return;
+		}
+
+		if (GEngine) {
+			GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+			GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+			GEngine->OnActorMoved().Remove(ActorMovedHandle);
+		}
+		if (GEditor) {
+			GEditor->OnBlueprintPreCompile().Remove(BlueprintPreCompileHandle);
+			GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+		}
+		FCoreDelegates::OnActorLabelChanged.Remove(ActorLabelChangedHandle);
+		FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+		FCoreUObjectDelegates::OnObjectRenamed.Remove(ObjectRenamedHandle);
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+
+		{
+			FScopeLock Lock(&Mutex);
+			Subscribers.Empty();
+			NumSubscribers = 0;
+			CurrentSession = 0;
+		}
+		PendingActors.Empty();
+		PendingIndex.Empty();
+		CompilingBlueprints.Empty();
+		CompiledBlueprints.Empty();
+		bInitialized = false;
+	}
+
+	auto FLevelEventStream::OpenSession() -> int32 {
+		FScopeLock Lock(&Mutex);
+		CurrentSession = ++LastSessionId;
+		return CurrentSession;
+	}
+
+	auto FLevelEventStream::CloseSession(const int32 SessionId) -> void {
+		FScopeLock Lock(&Mutex);
+		for (auto It = Subscribers.CreateIterator(); It; ++It) {
+			if (It->Value.SessionId == SessionId) {
+				It.RemoveCurrent();
+			}
+		}
+		NumSubscribers = Subscribers.Num();
+		if (CurrentSession == SessionId) {
+			CurrentSession = 0;
+		}
+	}
+
+	auto FLevelEventStream::GetCurrentSession() -> int32 {
+		FScopeLock Lock(&Mutex);
+		return CurrentSession;
+	}
+
+	auto FLevelEventStream::Subscribe(FLevelEventFilter Filter, const int32 MaxQueued) -> int32 {
+		// Without engine subscriptions the queue would never fill
+		Initialize();
+
+		FScopeLock Lock(&Mutex);
+		const int32 Id = ++LastSubscriptionId;
+
+		FSubscriber& Subscriber = Subscribers.Add(Id);
+		Subscriber.SessionId = CurrentSession;
+		Subscriber.Class = Filter.Query.Class;
+		Subscriber.ComponentClass = Filter.Query.ComponentClass;
+		Subscriber.Filter = MoveTemp(Filter);
+		Subscriber.MaxQueued = FMath::Clamp(MaxQueued, 1, MaxMaxQueued);
+		NumSubscribers = Subscribers.Num();
+
+		UE_LOG(LogMCPLevelEvents, Verbose, TEXT("Subscription %d added to session %d"), Id, Subscriber.SessionId);
+		return Id;
+	}
+
+	auto FLevelEventStream::Unsubscribe(const int32 SubscriptionId, const int32 SessionId) -> bool {
+		FScopeLock Lock(&Mutex);
+		const FSubscriber* Subscriber = Subscribers.Find(SubscriptionId);
+		if (!Subscriber || Subscriber->SessionId != SessionId) {
+			return false;
+		}
+
+		Subscribers.Remove(SubscriptionId);
+		NumSubscribers = Subscribers.Num();
+		return true;
+	}
+
+	auto FLevelEventStream::HasSubscriptions(const int32 SessionId) -> bool {
+		if (NumSubscribers.load() == 0) {
+			return false;
+		}
+		FScopeLock Lock(&Mutex);
+		for (const TPair<int32, FSubscriber>& Entry : Subscribers) {
+			if (Entry.Value.SessionId == SessionId) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	auto FLevelEventStream::TakeBatches(const int32 SessionId, TArray<FLevelEventBatch>& OutBatches) -> void {
+		FScopeLock Lock(&Mutex);
+		for (TPair<int32, FSubscriber>& Entry : Subscribers) {
+			FSubscriber& Subscriber = Entry.Value;
+			if (Subscriber.SessionId != SessionId || (Subscriber.Queue.Num() == 0 && Subscriber.Dropped == 0)) {
+				continue;
+			}
+			OutBatches.Add({Entry.Key, MoveTemp(Subscriber.Queue), Subscriber.Dropped});
+			Subscriber.Queue.Reset();
+			Subscriber.Dropped = 0;
+		}
+	}
+
+	auto FLevelEventStream::TakeBatch(const int32 SubscriptionId, FLevelEventBatch& OutBatch) -> bool {
+		FScopeLock Lock(&Mutex);
+		FSubscriber* Subscriber = Subscribers.Find(SubscriptionId);
+		if (!Subscriber) {
+			return false;
+		}
+		OutBatch = {SubscriptionId, MoveTemp(Subscriber->Queue), Subscriber->Dropped};
+		Subscriber->Queue.Reset();
+		Subscriber->Dropped = 0;
+		return true;
+	}
+
+	auto FLevelEventStream::Flush() -> void {
+		if (PendingActors.Num() == 0 && CompiledBlueprints.Num() == 0) {
+			return;
+		}
+
+		const TArray<FPendingActor> Actors = MoveTemp(PendingActors);
+		const TArray<TWeakObjectPtr<UBlueprint>> Blueprints = MoveTemp(CompiledBlueprints);
+		PendingActors.Reset();
+		PendingIndex.Reset();
+		CompiledBlueprints.Reset();
+
+		FScopeLock Lock(&Mutex);
+		if (Subscribers.Num() == 0) {
+			return;
+		}
+
+		TArray<FLevelEvent, TInlineAllocator<3>> Events;
+		for (const FPendingActor& Pending : Actors) {
+			Events.Reset();
+
+			if (Pending.Changes & Removed) {
+				// Added and deleted within one frame: the client never saw it
+				if (Pending.Changes & Added) {
+					continue;
+				}
+				FLevelEvent Event;
+				Event.Kind = ELevelEventKind::ActorRemoved;
+				Event.Sequence = ++LastSequence;
+				Event.Name = (Pending.Changes & Renamed) ? Pending.OldName : Pending.Name;
+				Event.ClassName = Pending.ClassName;
+				for (const int32 SubscriptionId : Pending.RemovedFor) {
+					if (FSubscriber* Subscriber = Subscribers.Find(SubscriptionId); Subscriber && Subscriber->Filter.IncludesKind(Event.Kind)) {
+						Enqueue(*Subscriber, Event);
+					}
+				}
+				continue;
+			}
+
+			const AActor* Actor = Pending.Actor.Get();
+			if (!Actor) {
+				continue;
+			}
+
+			const FString Name = Actor->GetName();
+			auto AddEvent = [&](const ELevelEventKind Kind) -> FLevelEvent& {
+				FLevelEvent& Event = Events.AddDefaulted_GetRef();
+				Event.Kind = Kind;
+				Event.Sequence = ++LastSequence;
+				Event.Name = Name;
+				Event.ClassName = Pending.ClassName;
+				return Event;
+			};
+
+			// A new actor is reported once with its final state
+			if (Pending.Changes & Added) {
+				FLevelEvent& Event = AddEvent(ELevelEventKind::ActorAdded);
+				Event.Label = Actor->GetActorLabel();
+				Event.Transform = Actor->GetActorTransform();
+			}
+			else {
+				if ((Pending.Changes & Renamed) && Pending.OldName != Name) {
+					AddEvent(ELevelEventKind::ActorRenamed).OldName = Pending.OldName;
+				}
+				if (Pending.Changes & Moved) {
+					AddEvent(ELevelEventKind::TransformChanged).Transform = Actor->GetActorTransform();
+				}
+				if (Pending.Changes & Changed) {
+					AddEvent(ELevelEventKind::PropertyChanged).Properties = Pending.Properties;
+				}
+			}
+
+			for (TPair<int32, FSubscriber>& Entry : Subscribers) {
+				FSubscriber& Subscriber = Entry.Value;
+				if (!Matches(Subscriber, Actor, Name)) {
+					continue;
+				}
+				for (const FLevelEvent& Event : Events) {
+					if (!Subscriber.Filter.IncludesKind(Event.Kind)) {
+						continue;
+					}
+					// An edit without a named property may have touched any of them
+					if (Event.Kind != ELevelEventKind::PropertyChanged || Subscriber.Filter.Properties.Num() == 0 || Event.Properties.Num() == 0) {
+						Enqueue(Subscriber, Event);
+						continue;
+					}
+					FLevelEvent Filtered = Event;
+					Filtered.Properties.RemoveAll([&Subscriber](const FString& Property) {
+						int32 Dot = INDEX_NONE;
+						return !Subscriber.Filter.Properties.Contains(Property)
+							&& !(Property.FindLastChar(TEXT('.'), Dot) && Subscriber.Filter.Properties.Contains(Property.RightChop(Dot + 1)));
+					});
+					if (Filtered.Properties.Num() > 0) {
+						Enqueue(Subscriber, Filtered);
+					}
+				}
+			}
+		}
+
+		for (const TWeakObjectPtr<UBlueprint>& BlueprintPtr : Blueprints) {
+			const UBlueprint* Blueprint = BlueprintPtr.Get();
+			if (!Blueprint) {
+				continue;
+			}
+			FLevelEvent Event;
+			Event.Kind = ELevelEventKind::BlueprintCompiled;
+			Event.Sequence = ++LastSequence;
+			Event.Name = Blueprint->GetName();
+			Event.Status = FBlueprintCompileCoordinator::GetStatusName(Blueprint);
+			for (TPair<int32, FSubscriber>& Entry : Subscribers) {
+				const FLevelEventFilter& Filter = Entry.Value.Filter;
+				if (Filter.IncludesKind(Event.Kind) && (!Filter.NamePattern.IsSet() || Filter.NamePattern->Matches(Event.Name))) {
+					Enqueue(Entry.Value, Event);
+				}
+			}
+		}
+	}
+
+	auto FLevelEventStream::Record(AActor* Actor) -> FPendingActor* {
+		if (NumSubscribers.load() == 0 || !Actor) {
+			return nullptr;
+		}
+		// PIE and preview worlds fire the same events
+		const UWorld* World = Actor->GetWorld();
+		if (!World || World->WorldType != EWorldType::Editor) {
+			return nullptr;
+		}
+
+		int32& Index = PendingIndex.FindOrAdd(FObjectKey(Actor), INDEX_NONE);
+		if (Index == INDEX_NONE) {
+			Index = PendingActors.Num();
+			FPendingActor& Pending = PendingActors.AddDefaulted_GetRef();
+			Pending.Actor = Actor;
+			Pending.Name = Actor->GetName();
+			Pending.ClassName = Actor->GetClass()->GetName();
+		}
+		return &PendingActors[Index];
+	}
+
+	auto FLevelEventStream::Matches(const FSubscriber& Subscriber, const AActor* Actor, const FString& Name) -> bool {
+		const FLevelEventFilter& Filter = Subscriber.Filter;
+		if ((Filter.Query.Class && !Subscriber.Class.IsValid()) || (Filter.Query.ComponentClass && !Subscriber.ComponentClass.IsValid())) {
+			return false;
+		}
+		if (!Filter.Query.IsEmpty() && !Filter.Query.Matches(Actor)) {
+			return false;
+		}
+		return !Filter.NamePattern.IsSet() || Filter.NamePattern->Matches(Name);
+	}
+
+	auto FLevelEventStream::Enqueue(FSubscriber& Subscriber, const FLevelEvent& Event) -> void {
+		if (Subscriber.Queue.Num() >= Subscriber.MaxQueued) {
+			++Subscriber.Dropped;
+			return;
+		}
+		Subscriber.Queue.Add(Event);
+	}
+
+	auto FLevelEventStream::Tick(float DeltaTime) -> bool {
+		Flush();
+		return true;
+	}
+
+	auto FLevelEventStream::HandleActorAdded(AActor* Actor) -> void {
+		if (FPendingActor* Pending = Record(Actor)) {
+			// Deleted and restored (undo) within one frame: the client still has it, in an unknown state
+			if (Pending->Changes & Removed) {
+				Pending->Changes = (Pending->Changes & Added) ? Added : (Moved | Changed);
+				Pending->RemovedFor.Reset();
+			}
+			else {
+				Pending->Changes |= Added;
+			}
+		}
+	}
+
+	auto FLevelEventStream::HandleActorDeleted(AActor* Actor) -> void {
+		FPendingActor* Pending = Record(Actor);
+		if (!Pending) {
+			return;
+		}
+		Pending->Changes |= Removed;
+		Pending->Name = Actor->GetName();
+
+		// The actor may be gone by the flush, so the filters are applied now
+		FScopeLock Lock(&Mutex);
+		Pending->RemovedFor.Reset();
+		for (const TPair<int32, FSubscriber>& Entry : Subscribers) {
+			if (Matches(Entry.Value, Actor, Pending->Name)) {
+				Pending->RemovedFor.Add(Entry.Key);
+			}
+		}
+	}
+
+	auto FLevelEventStream::HandleActorMoved(AActor* Actor) -> void {
+		if (FPendingActor* Pending = Record(Actor)) {
+			Pending->Changes |= Moved;
+		}
+	}
+
+	auto FLevelEventStream::HandleActorLabelChanged(AActor* Actor) -> void {
+		if (FPendingActor* Pending = Record(Actor)) {
+			Pending->Changes |= Changed;
+			Pending->Properties.AddUnique(TEXT("ActorLabel"));
+		}
+	}
+
+	auto FLevelEventStream::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event) -> void {
+		if (NumSubscribers.load() == 0 || !Object) {
+			return;
+		}
+
+		AActor* Actor = Cast<AActor>(Object);
+		if (!Actor) {
+			const UActorComponent* Component = Cast<UActorComponent>(Object);
+			Actor = Component ? Component->GetOwner() : Object->GetTypedOuter<AActor>();
+		}
+		FPendingActor* Pending = Record(Actor);
+		if (!Pending) {
+			return;
+		}
+
+		Pending->Changes |= Changed;
+		const FName MemberName = Event.GetMemberPropertyName();
+		const FName PropertyName = MemberName.IsNone() ? Event.GetPropertyName() : MemberName;
+		if (!PropertyName.IsNone()) {
+			Pending->Properties.AddUnique(Object == Actor ? PropertyName.ToString() : Object->GetName() + TEXT(".") + PropertyName.ToString());
+		}
+	}
+
+	auto FLevelEventStream::HandleObjectRenamed(UObject* Object, UObject* OldOuter, const FName OldName) -> void {
+		AActor* Actor = Cast<AActor>(Object);
+		FPendingActor* Pending = Record(Actor);
+		if (!Pending) {
+			return;
+		}
+		// The first rename of the frame holds the name the client knows
+		if (!(Pending->Changes & Renamed)) {
+			Pending->OldName = OldName.ToString();
+		}
+		Pending->Changes |= Renamed;
+	}
+
+	auto FLevelEventStream::HandleBlueprintPreCompile(UBlueprint* Blueprint) -> void {
+		if (NumSubscribers.load() > 0 && Blueprint) {
+			CompilingBlueprints.AddUnique(Blueprint);
+		}
+	}
+
+	auto FLevelEventStream::HandleBlueprintCompiled() -> void {
+		for (const TWeakObjectPtr<UBlueprint>& Blueprint : CompilingBlueprints) {
+			CompiledBlueprints.AddUnique(Blueprint);
+		}
+		CompilingBlueprints.Reset();
+	}
+
+}
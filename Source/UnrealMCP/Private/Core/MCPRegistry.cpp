@@ -176,6 +176,7 @@ namespace UnrealMCP {
 		const TArray<FString> BlueprintMethods = {
 			TEXT("create_blueprint"),
 			TEXT("compile_blueprint"),
+			TEXT("compile_blueprints"),
 			TEXT("spawn_blueprint_actor"),
 			TEXT("set_blueprint_property"),
 			TEXT("set_pawn_properties"),
@@ -184,6 +185,8 @@ namespace UnrealMCP {
 			TEXT("get_blueprint_variables"),
 			TEXT("get_blueprint_functions"),
 			TEXT("blueprint_exists"),
+			TEXT("search_blueprints"),
+			TEXT("index_blueprints"),
 			TEXT("delete_blueprint"),
 			TEXT("duplicate_blueprint"),
 			TEXT("get_blueprint_path"),
@@ -224,6 +227,8 @@ namespace UnrealMCP {
 			TEXT("add_blueprint_input_action_node"),
 			TEXT("add_blueprint_self_reference"),
 			TEXT("add_blueprint_get_self_component_reference"),
+			TEXT("build_blueprint_graph"),
+			TEXT("export_blueprint_graph"),
 			TEXT("get_blueprint_graph_nodes"),
 			TEXT("remove_node"),
 			TEXT("get_node_info")
@@ -233,12 +238,29 @@ namespace UnrealMCP {
 		// Actor methods
 		const TArray<FString> ActorMethods = {
 			TEXT("spawn_actor"),
+			TEXT("spawn_actors"),
 			TEXT("delete_actor"),
 			TEXT("get_actors_in_level"),
 			TEXT("find_actors_by_name"),
+			TEXT("find_actors_in_radius"),
+			TEXT("find_actors_in_box"),
+			TEXT("find_nearest_actors"),
+			TEXT("query_actors"),
 			TEXT("get_actor_properties"),
 			TEXT("set_actor_property"),
-			TEXT("set_actor_transform")
+			TEXT("set_actor_transform"),
+			TEXT("set_actor_transforms"),
+			TEXT("transform_actors"),
+			TEXT("scatter_instances"),
+			TEXT("set_properties"),
+			TEXT("get_properties"),
+			TEXT("subscribe"),
+			TEXT("unsubscribe"),
+			TEXT("get_level_digest"),
+			TEXT("diff_level"),
+			TEXT("query_actor_descs"),
+			TEXT("load_region"),
+			TEXT("unload_region")
 		};
 		OutMethods.Add(TEXT("actor"), ActorMethods);
 
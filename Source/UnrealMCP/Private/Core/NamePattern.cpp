@@ -0,0 +1,189 @@
+#include "Core/NamePattern.h"
+#include "Core/ErrorTypes.h"
+#include "Internationalization/Regex.h"
+#include "String/Find.h"
+
+namespace UnrealMCP {
+
+	auto FNamePattern::Compile(const FString& Pattern, const EMode Mode, const bool bCaseSensitive) -> TResult<FNamePattern> {
+		FNamePattern Compiled;
+		Compiled.Mode = Mode;
+		Compiled.bCaseSensitive = bCaseSensitive;
+		Compiled.Source = Pattern;
+
+		if (Mode == EMode::Regex) {
+			Compiled.Regex = MakeShared<FRegexPattern>(
+				Pattern,
+				bCaseSensitive ? ERegexPatternFlags::None : ERegexPatternFlags::CaseInsensitive);
+			return TResult<FNamePattern>::Success(MoveTemp(Compiled));
+		}
+
+		if (Mode == EMode::Contains) {
+			return TResult<FNamePattern>::Success(MoveTemp(Compiled));
+		}
+
+		auto Fold = [bCaseSensitive](const TCHAR Char) {
+			return bCaseSensitive ? Char : FChar::ToLower(Char);
+		};
+
+		const int32 Length = Pattern.Len();
+		for (int32 Index = 0; Index < Length; ++Index) {
+			const TCHAR Char = Pattern[Index];
+			FGlobToken Token;
+
+			if (Char == TEXT('*')) {
+				// Consecutive stars are equivalent to one
+				if (Compiled.GlobTokens.Num() > 0 && Compiled.GlobTokens.Last().Kind == FGlobToken::EKind::AnyRun) {
+					continue;
+				}
+				Token.Kind = FGlobToken::EKind::AnyRun;
+			}
+			else if (Char == TEXT('?')) {
+				Token.Kind = FGlobToken::EKind::AnyChar;
+			}
+			else if (Char == TEXT('[')) {
+				Token.Kind = FGlobToken::EKind::CharSet;
+
+				int32 Cursor = Index + 1;
+				if (Cursor < Length && (Pattern[Cursor] == TEXT('!') || Pattern[Cursor] == TEXT('^'))) {
+					Token.bNegated = true;
+					++Cursor;
+				}
+
+				// A leading ']' is a literal member of the set
+				bool bFirst = true;
+				while (Cursor < Length && (bFirst || Pattern[Cursor] != TEXT(']'))) {
+					bFirst = false;
+					const TCHAR Low = Fold(Pattern[Cursor]);
+					if (Cursor + 2 < Length && Pattern[Cursor + 1] == TEXT('-') && Pattern[Cursor + 2] != TEXT(']')) {
+						const TCHAR High = Fold(Pattern[Cursor + 2]);
+						Token.Ranges.Emplace(FMath::Min(Low, High), FMath::Max(Low, High));
+						Cursor += 3;
+					}
+					else {
+						Token.Ranges.Emplace(Low, Low);
+						++Cursor;
+					}
+				}
+
+				if (Cursor >= Length) {
+					return TResult<FNamePattern>::Failure(
+						EErrorCode::InvalidInput,
+						FString::Printf(TEXT("Unterminated '[' in pattern '%s'"), *Pattern));
+				}
+				Index = Cursor;
+			}
+			else {
+				if (Char == TEXT('\\') && Index + 1 < Length) {
+					++Index;
+				}
+				Token.Kind = FGlobToken::EKind::Literal;
+				Token.Char = Fold(Pattern[Index]);
+			}
+
+			Compiled.GlobTokens.Add(MoveTemp(Token));
+		}
+
+		return TResult<FNamePattern>::Success(MoveTemp(Compiled));
+	}
+
+	auto FNamePattern::ParseMode(const FString& ModeName, EMode& OutMode) -> bool {
+		if (ModeName.Equals(TEXT("contains"), ESearchCase::IgnoreCase)) {
+			OutMode = EMode::Contains;
+			return true;
+		}
+		if (ModeName.Equals(TEXT("glob"), ESearchCase::IgnoreCase) || ModeName.Equals(TEXT("wildcard"), ESearchCase::IgnoreCase)) {
+			OutMode = EMode::Glob;
+			return true;
+		}
+		if (ModeName.Equals(TEXT("regex"), ESearchCase::IgnoreCase)) {
+			OutMode = EMode::Regex;
+			return true;
+		}
+		return false;
+	}
+
+	auto FNamePattern::Matches(const FStringView Text) const -> bool {
+		switch (Mode) {
+			case EMode::Contains:
+				return UE::String::FindFirst(
+					Text,
+					Source,
+					bCaseSensitive ? ESearchCase::CaseSensitive : ESearchCase::IgnoreCase) != INDEX_NONE;
+
+			case EMode::Glob:
+				return MatchGlob(Text);
+
+			case EMode::Regex: {
+				FRegexMatcher Matcher(*Regex, FString(Text));
+				return Matcher.FindNext();
+			}
+		}
+
+		return false;
+	}
+
+	auto FNamePattern::MatchGlob(const FStringView Text) const -> bool {
+		// Greedy match with a single backtrack point: on a mismatch, let the last '*' absorb one more character
+		const int32 NumTokens = GlobTokens.Num();
+		int32 TextIndex = 0;
+		int32 TokenIndex = 0;
+		int32 StarToken = INDEX_NONE;
+		int32 StarText = 0;
+
+		while (TextIndex < Text.Len()) {
+			if (TokenIndex < NumTokens && GlobTokens[TokenIndex].Kind == FGlobToken::EKind::AnyRun) {
+				StarToken = TokenIndex++;
+				StarText = TextIndex;
+			}
+			else if (TokenIndex < NumTokens && TokenMatches(GlobTokens[TokenIndex], Text[TextIndex])) {
+				++TokenIndex;
+				++TextIndex;
+			}
+			else if (StarToken != INDEX_NONE) {
+				TokenIndex = StarToken + 1;
+				TextIndex = ++StarText;
+			}
+			else {
+				return false;
+			}
+		}
+
+		while (TokenIndex < NumTokens && GlobTokens[TokenIndex].Kind == FGlobToken::EKind::AnyRun) {
+			++TokenIndex;
+		}
+
+		return TokenIndex == NumTokens;
+	}
+
+	auto FNamePattern::TokenMatches(const FGlobToken& Token, TCHAR Char) const -> bool {
+		if (!bCaseSensitive) {
+			Char = FChar::ToLower(Char);
+		}
+
+		switch (Token.Kind) {
+			case FGlobToken::EKind::Literal:
+				return Token.Char == Char;
+
+			case FGlobToken::EKind::AnyChar:
+				return true;
+
+			case FGlobToken::EKind::CharSet: {
+				bool bInSet = false;
+				for (const TPair<TCHAR, TCHAR>& Range : Token.Ranges) {
+					if (Char >= Range.Key && Char <= Range.Value) {
+						bInSet = true;
+						break;
+					}
+				}
+				return bInSet != Token.bNegated;
+			}
+
+			case FGlobToken::EKind::AnyRun:
+				return true;
+		}
+
+		return false;
+	}
+
+}
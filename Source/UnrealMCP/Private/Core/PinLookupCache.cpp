@@ -0,0 +1,165 @@
+#include "Core/PinLookupCache.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_VariableGet.h"
+#include "EdGraph/EdGraphNode.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogMCPPinLookup, Log, All);
+
+namespace UnrealMCP {
+
+	TMap<FObjectKey, FPinLookupCache::FNodeTable> FPinLookupCache::Tables;
+	int32 FPinLookupCache::NextPruneSize = 256;
+
+	auto FPinLookupCache::FindPin(UEdGraphNode* Node, const FString& PinName, const EEdGraphPinDirection Direction) -> UEdGraphPin* {
+		if (!Node) {
+			return nullptr;
+		}
+
+		LogPins(Node, PinName, Direction);
+
+		FNodeTable& Table = GetTable(Node);
+		if (Table.Pins != Node->Pins) {
+			// Pins were reallocated (ReconstructNode, added/removed pins)
+			BuildTable(Node, Table);
+		}
+
+		UEdGraphPin* Pin = FindInTable(Table, Node, PinName, Direction);
+		if (Pin) {
+			UE_LOG(LogMCPPinLookup, Verbose, TEXT("  - Resolved pin '%s'"), *Pin->PinName.ToString());
+		}
+		else {
+			UE_LOG(LogMCPPinLookup, Warning, TEXT("No pin matching '%s' on node '%s'"), *PinName, *Node->GetName());
+		}
+		return Pin;
+	}
+
+	auto FPinLookupCache::Invalidate(const UEdGraphNode* Node) -> void {
+		if (Node) {
+			Tables.Remove(FObjectKey(Node));
+		}
+	}
+
+	auto FPinLookupCache::Reset() -> void {
+		Tables.Empty();
+		NextPruneSize = 256;
+	}
+
+	auto FPinLookupCache::GetTable(UEdGraphNode* Node) -> FNodeTable& {
+		if (FNodeTable* Existing = Tables.Find(FObjectKey(Node))) {
+			return *Existing;
+		}
+
+		// Prune at doubling sizes so bulk wiring of fresh nodes stays linear
+		if (Tables.Num() >= NextPruneSize) {
+			PruneStaleTables();
+			NextPruneSize = FMath::Max(256, Tables.Num() * 2);
+		}
+
+		FNodeTable& Table = Tables.Add(FObjectKey(Node));
+		Table.Node = Node;
+		BuildTable(Node, Table);
+		return Table;
+	}
+
+	auto FPinLookupCache::BuildTable(UEdGraphNode* Node, FNodeTable& Table) -> void {
+		Table.Pins = Node->Pins;
+		Table.PinsByName.Reset();
+		Table.DefaultExecPin[0] = INDEX_NONE;
+		Table.DefaultExecPin[1] = INDEX_NONE;
+		Table.DefaultDataOutputPin = INDEX_NONE;
+
+		for (int32 Index = 0; Index < Table.Pins.Num(); ++Index) {
+			const UEdGraphPin* Pin = Table.Pins[Index];
+			if (!Pin) {
+				continue;
+			}
+
+			Table.PinsByName.FindOrAdd(Pin->PinName).Add(Index);
+
+			const bool bExec = Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+			if (bExec && (Pin->Direction == EGPD_Input || Pin->Direction == EGPD_Output)
+				&& Table.DefaultExecPin[Pin->Direction] == INDEX_NONE) {
+				Table.DefaultExecPin[Pin->Direction] = Index;
+			}
+			if (!bExec && Pin->Direction == EGPD_Output && Table.DefaultDataOutputPin == INDEX_NONE) {
+				Table.DefaultDataOutputPin = Index;
+			}
+		}
+
+		UE_LOG(LogMCPPinLookup, Verbose, TEXT("Indexed %d pins of node '%s'"), Table.Pins.Num(), *Node->GetName());
+	}
+
+	auto FPinLookupCache::FindInTable(const FNodeTable& Table,
+	                                  const UEdGraphNode* Node,
+	                                  const FString& PinName,
+	                                  const EEdGraphPinDirection Direction) -> UEdGraphPin* {
+		// FNAME_Find avoids growing the name table with names no pin can carry
+		const FName Key = PinName.IsEmpty() ? NAME_None : FName(*PinName, FNAME_Find);
+		if (!Key.IsNone()) {
+			if (const TArray<int32, TInlineAllocator<2>>* Indices = Table.PinsByName.Find(Key)) {
+				TArray<UEdGraphPin*, TInlineAllocator<2>> Candidates;
+				for (const int32 Index : *Indices) {
+					UEdGraphPin* Pin = Table.Pins[Index];
+					if (Direction == EGPD_MAX || Pin->Direction == Direction) {
+						Candidates.Add(Pin);
+					}
+				}
+
+				// Only names differing in case need the exact-case tie break
+				if (Candidates.Num() > 1) {
+					for (UEdGraphPin* Pin : Candidates) {
+						if (Pin->PinName.ToString().Equals(PinName, ESearchCase::CaseSensitive)) {
+							return Pin;
+						}
+					}
+				}
+				if (Candidates.Num() > 0) {
+					return Candidates[0];
+				}
+			}
+		}
+
+		// Component references: fall back to the first data output of a variable getter
+		if (Direction == EGPD_Output && Table.DefaultDataOutputPin != INDEX_NONE && Node->IsA<UK2Node_VariableGet>()) {
+			return Table.Pins[Table.DefaultDataOutputPin];
+		}
+
+		if (PinName.IsEmpty() && (Direction == EGPD_Input || Direction == EGPD_Output)
+			&& Table.DefaultExecPin[Direction] != INDEX_NONE) {
+			return Table.Pins[Table.DefaultExecPin[Direction]];
+		}
+
+		return nullptr;
+	}
+
+	auto FPinLookupCache::PruneStaleTables() -> void {
+		for (auto It = Tables.CreateIterator(); It; ++It) {
+			if (!It.Value().Node.IsValid()) {
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	auto FPinLookupCache::LogPins(const UEdGraphNode* Node, const FString& PinName, const EEdGraphPinDirection Direction) -> void {
+		if (!UE_LOG_ACTIVE(LogMCPPinLookup, Verbose)) {
+			return;
+		}
+
+		UE_LOG(LogMCPPinLookup,
+		       Verbose,
+		       TEXT("FindPin: Looking for pin '%s' (Direction: %d) in node '%s'"),
+		       *PinName,
+		       static_cast<int32>(Direction),
+		       *Node->GetName());
+
+		for (const UEdGraphPin* Pin : Node->Pins) {
+			UE_LOG(LogMCPPinLookup,
+			       Verbose,
+			       TEXT("  - Available pin: '%s', Direction: %d, Category: %s"),
+			       *Pin->PinName.ToString(),
+			       static_cast<int32>(Pin->Direction),
+			       *Pin->PinType.PinCategory.ToString());
+		}
+	}
+
+}
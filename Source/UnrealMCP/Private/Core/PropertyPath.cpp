@@ -0,0 +1,1046 @@
+#include "Core/PropertyPath.h"
+#include "Editor.h"
+#include "JsonObjectConverter.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Engine/Blueprint.h"
+#include "Misc/OutputDeviceNull.h"
+#include "UObject/UObjectGlobals.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogMCPPropertyPath, Log, All);
+
+namespace UnrealMCP {
+
+	namespace {
+		/** Plans are small; a runaway caller writing unique paths only costs a rebuild after this many */
+		constexpr int32 MaxPlans = 4096;
+
+		struct FPathSegment {
+			FString Name;
+			bool bHasIndex = false;
+			FString Index;
+		};
+
+		auto ParsePath(const FString& Path, TArray<FPathSegment>& OutSegments) -> bool {
+			TArray<FString> Parts;
+			Path.ParseIntoArray(Parts, TEXT("."), false);
+
+			for (const FString& Part : Parts) {
+				FPathSegment& Segment = OutSegments.AddDefaulted_GetRef();
+				int32 Open = INDEX_NONE;
+				if (Part.FindChar(TEXT('['), Open)) {
+					if (!Part.EndsWith(TEXT("]")) || Open == 0) {
+						return false;
+					}
+					Segment.Name = Part.Left(Open).TrimStartAndEnd();
+					Segment.Index = Part.Mid(Open + 1, Part.Len() - Open - 2).TrimStartAndEnd().TrimQuotes();
+					Segment.bHasIndex = true;
+				}
+				else {
+					Segment.Name = Part.TrimStartAndEnd();
+				}
+				if (Segment.Name.IsEmpty()) {
+					return false;
+				}
+			}
+			return OutSegments.Num() > 0;
+		}
+
+		auto ParseIndex(const FString& Text, int32& OutIndex) -> bool {
+			return Text.IsNumeric() && LexTryParseString(OutIndex, *Text) && OutIndex >= 0;
+		}
+
+		auto DescribeJson(const TSharedPtr<FJsonValue>& Value) -> const TCHAR* {
+			switch (Value->Type) {
+			case EJson::Null: return TEXT("null");
+			case EJson::String: return TEXT("a string");
+			case EJson::Number: return TEXT("a number");
+			case EJson::Boolean: return TEXT("a boolean");
+			case EJson::Array: return TEXT("an array");
+			case EJson::Object: return TEXT("an object");
+			default: return TEXT("no value");
+			}
+		}
+	}
+
+	TMap<FPropertyPath::FPlanKey, TSharedRef<const FPropertyPath::FPlan>> FPropertyPath::Plans;
+	bool FPropertyPath::bInitialized = false;
+	FDelegateHandle FPropertyPath::BlueprintCompiledHandle;
+	FDelegateHandle FPropertyPath::ObjectsReplacedHandle;
+
+	auto FPropertyPath::Initialize() -> void {
+		if (bInitialized || !GEditor) {
+			return;
+		}
+
+		// Compiles and reinstancing replace the classes and properties plans point into
+		BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddStatic(&FPropertyPath::Reset);
+		ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddLambda(
+			[](const TMap<UObject*, UObject*>&) {
+				Reset();
+			});
+		bInitialized = true;
+	}
+
+	auto FPropertyPath::Shutdown() -> void {
+		if (!bInitialized) {
+			return;
+		}
+
+		if (GEditor) {
+			GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+		}
+		FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+		Reset();
+		bInitialized = false;
+	}
+
+	auto FPropertyPath::SetValue(
+		UObject* Object,
+		const FString& Path,
+		const TSharedPtr<FJsonValue>& Value,
+		const bool bNotify
+	) -> FVoidResult {
+		UObject* Owner = nullptr;
+		FProperty* OwnerProperty = nullptr;
+		const FVoidResult Result = SetValue(Object, Path, Value, [bNotify, &Owner, &OwnerProperty](UObject* InOwner, FProperty* InOwnerProperty) {
+			if (bNotify) {
+				InOwner->Modify();
+				InOwner->PreEditChange(InOwnerProperty);
+			}
+			Owner = InOwner;
+			OwnerProperty = InOwnerProperty;
+		});
+
+		// Owner is only set when the write happened
+		if (bNotify && Owner) {
+			FPropertyChangedEvent ChangedEvent(OwnerProperty, EPropertyChangeType::ValueSet);
+			Owner->PostEditChangeProperty(ChangedEvent);
+		}
+		return Result;
+	}
+
+	auto FPropertyPath::SetValue(
+		UObject* Object,
+		const FString& Path,
+		const TSharedPtr<FJsonValue>& Value,
+		const FPreWrite PreWrite
+	) -> FVoidResult {
+		if (!Object) {
+			return FVoidResult::Failure(EErrorCode::InvalidInput, Path, TEXT("No object to write to"));
+		}
+		if (!Value.IsValid()) {
+			return FVoidResult::Failure(EErrorCode::InvalidPropertyValue, Path, TEXT("No value given"));
+		}
+
+		// Held for the whole write: converting an object value may load an asset, and the compile or
+		// reinstancing that triggers resets the cache
+		TSharedPtr<const FPlan> Plan;
+		if (const FVoidResult Found = FindPlan(Object, Path, Plan); Found.IsFailure()) {
+			return Found;
+		}
+
+		UObject* Owner = nullptr;
+		bool bStale = false;
+		FString Error;
+		void* Data = Execute(Plan->Steps, Object, EAccess::Find, Owner, bStale, Error);
+
+		// A subobject of another class than the plan saw; resolve this write on its own
+		if (bStale) {
+			TSharedRef<FPlan> LocalPlan = MakeShared<FPlan>();
+			if (const FVoidResult Built = BuildPlan(Object, Path, *LocalPlan); Built.IsFailure()) {
+				return Built;
+			}
+			Plan = LocalPlan;
+			Data = Execute(Plan->Steps, Object, EAccess::Find, Owner, bStale, Error);
+		}
+		const FProperty* Leaf = Plan->Converter.Property;
+		bool bConverted = false;
+		if (Data) {
+			// Convert aside so a value that fails halfway leaves the current value untouched
+			bConverted = ConvertToTemporary(Plan->Converter, Value, Data, Error, [&](const void* Converted) {
+				PreWrite(Owner, Plan->OwnerProperty);
+				Leaf->CopySingleValue(Data, Converted);
+			});
+		}
+		else if (!bStale && Execute(Plan->Steps, Object, EAccess::Probe, Owner, bStale, Error)) {
+			// Appending an array element or adding a map key is part of the write, so it waits until
+			// the value has converted; a new element starts from the default value
+			bConverted = ConvertToTemporary(Plan->Converter, Value, nullptr, Error, [&](const void* Converted) {
+				PreWrite(Owner, Plan->OwnerProperty);
+				Data = Execute(Plan->Steps, Object, EAccess::Add, Owner, bStale, Error);
+				if (ensure(Data)) {
+					Leaf->CopySingleValue(Data, Converted);
+				}
+			});
+		}
+		else {
+			return FVoidResult::Failure(EErrorCode::PropertyNotFound, Path, Error);
+		}
+		if (!bConverted) {
+			return FVoidResult::Failure(EErrorCode::InvalidPropertyValue, Path, Error);
+		}
+		return FVoidResult::Success();
+	}
+
+	auto FPropertyPath::Resolve(
+		UObject* Object,
+		const FString& Path,
+		const FProperty*& OutProperty,
+		void*& OutData
+	) -> FVoidResult {
+		if (!Object) {
+			return FVoidResult::Failure(EErrorCode::InvalidInput, Path, TEXT("No object to read from"));
+		}
+
+		TSharedPtr<const FPlan> Plan;
+		if (const FVoidResult Found = FindPlan(Object, Path, Plan); Found.IsFailure()) {
+			return Found;
+		}
+
+		UObject* Owner = nullptr;
+		bool bStale = false;
+		FString Error;
+		void* Data = Execute(Plan->Steps, Object, EAccess::Find, Owner, bStale, Error);
+
+		if (bStale) {
+			TSharedRef<FPlan> LocalPlan = MakeShared<FPlan>();
+			if (const FVoidResult Built = BuildPlan(Object, Path, *LocalPlan); Built.IsFailure()) {
+				return Built;
+			}
+			Plan = LocalPlan;
+			Data = Execute(Plan->Steps, Object, EAccess::Find, Owner, bStale, Error);
+		}
+		if (!Data) {
+			return FVoidResult::Failure(EErrorCode::PropertyNotFound, Path, Error);
+		}
+
+		OutProperty = Plan->Converter.Property;
+		OutData = Data;
+		return FVoidResult::Success();
+	}
+
+	auto FPropertyPath::Reset() -> void {
+		Plans.Empty();
+	}
+
+	auto FPropertyPath::Num() -> int32 {
+		return Plans.Num();
+	}
+
+	auto FPropertyPath::FindPlan(UObject* Object, const FString& Path, TSharedPtr<const FPlan>& OutPlan) -> FVoidResult {
+		const FPlanKey Key{FObjectKey(Object->GetClass()), Path};
+		if (const TSharedRef<const FPlan>* Existing = Plans.Find(Key)) {
+			OutPlan = *Existing;
+			return FVoidResult::Success();
+		}
+
+		TSharedRef<FPlan> NewPlan = MakeShared<FPlan>();
+		if (const FVoidResult Built = BuildPlan(Object, Path, *NewPlan); Built.IsFailure()) {
+			return Built;
+		}
+		if (Plans.Num() >= MaxPlans) {
+			Plans.Reset();
+		}
+		Plans.Add(Key, NewPlan);
+		OutPlan = NewPlan;
+		return FVoidResult::Success();
+	}
+
+	auto FPropertyPath::BuildPlan(UObject* Object, const FString& Path, FPlan& OutPlan) -> FVoidResult {
+		TArray<FPathSegment> Segments;
+		if (!ParsePath(Path, Segments)) {
+			return FVoidResult::Failure(
+				EErrorCode::InvalidInput,
+				Path,
+				TEXT("Expected a property path like 'Name', 'Component.Name', 'Array[2]' or 'Map[Key]'"));
+		}
+
+		const UStruct* Scope = Object->GetClass();
+		const FProperty* Leaf = nullptr;
+
+		for (int32 SegmentIndex = 0; SegmentIndex < Segments.Num(); ++SegmentIndex) {
+			const FPathSegment& Segment = Segments[SegmentIndex];
+
+			FProperty* Property = FindFProperty<FProperty>(Scope, *Segment.Name);
+			if (!Property) {
+				return FVoidResult::Failure(
+					EErrorCode::PropertyNotFound,
+					Path,
+					FString::Printf(TEXT("'%s' has no property '%s'"), *Scope->GetName(), *Segment.Name));
+			}
+
+			if (OutPlan.Steps.Num() > 0 && OutPlan.Steps.Last().Kind == EStepKind::Dereference) {
+				OutPlan.Steps.Last().ExpectedClass = Property->GetOwnerClass();
+			}
+			if (!OutPlan.OwnerProperty) {
+				OutPlan.OwnerProperty = Property;
+			}
+
+			FStep& Member = OutPlan.Steps.AddDefaulted_GetRef();
+			Member.Kind = EStepKind::Member;
+			Member.Property = Property;
+			Member.Offset = Property->GetOffset_ForInternal();
+			Leaf = Property;
+
+			if (Segment.bHasIndex) {
+				int32 Index = 0;
+				if (Property->ArrayDim > 1) {
+					if (!ParseIndex(Segment.Index, Index) || Index >= Property->ArrayDim) {
+						return FVoidResult::Failure(
+							EErrorCode::PropertyNotFound,
+							Path,
+							FString::Printf(TEXT("'%s' has %d elements; [%s] is out of range"), *Segment.Name, Property->ArrayDim, *Segment.Index));
+					}
+					Member.Offset += Property->GetElementSize() * Index;
+				}
+				else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property)) {
+					if (!ParseIndex(Segment.Index, Index)) {
+						return FVoidResult::Failure(
+							EErrorCode::PropertyNotFound,
+							Path,
+							FString::Printf(TEXT("'%s' is an array; [%s] is not an index"), *Segment.Name, *Segment.Index));
+					}
+					FStep& Element = OutPlan.Steps.AddDefaulted_GetRef();
+					Element.Kind = EStepKind::ArrayElement;
+					Element.Property = ArrayProperty;
+					Element.Index = Index;
+					Leaf = ArrayProperty->Inner;
+				}
+				else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property)) {
+					FStep& Element = OutPlan.Steps.AddDefaulted_GetRef();
+					Element.Kind = EStepKind::MapValue;
+					Element.Property = MapProperty;
+					Element.Key = MakeShared<FJsonValueString>(Segment.Index);
+					Element.KeyConverter = MakeShared<FConverter>(MakeConverter(MapProperty->KeyProp));
+					Leaf = MapProperty->ValueProp;
+				}
+				else {
+					return FVoidResult::Failure(
+						EErrorCode::PropertyNotFound,
+						Path,
+						FString::Printf(TEXT("'%s' is not an array or map and cannot be indexed"), *Segment.Name));
+				}
+			}
+
+			if (SegmentIndex == Segments.Num() - 1) {
+				break;
+			}
+
+			if (const FStructProperty* StructProperty = CastField<FStructProperty>(Leaf)) {
+				// Struct members are plain offsets from the struct
+				Scope = StructProperty->Struct;
+				continue;
+			}
+
+			const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Leaf);
+			if (!ObjectProperty || CastField<FSoftObjectProperty>(Leaf)) {
+				return FVoidResult::Failure(
+					EErrorCode::PropertyNotFound,
+					Path,
+					FString::Printf(TEXT("'%s' is not a struct or object and has no property '%s'"), *Segment.Name, *Segments[SegmentIndex + 1].Name));
+			}
+
+			// The next scope is the class of the object held right now
+			UObject* Owner = nullptr;
+			bool bStale = false;
+			FString Error;
+			const void* Data = Execute(OutPlan.Steps, Object, EAccess::Find, Owner, bStale, Error);
+			UObject* Next = Data ? ObjectProperty->GetObjectPropertyValue(Data) : nullptr;
+			if (!Next) {
+				return FVoidResult::Failure(
+					EErrorCode::PropertyNotFound,
+					Path,
+					Data ? FString::Printf(TEXT("'%s' is None"), *Segment.Name) : Error);
+			}
+
+			FStep& Dereference = OutPlan.Steps.AddDefaulted_GetRef();
+			Dereference.Kind = EStepKind::Dereference;
+			Dereference.Property = ObjectProperty;
+			Scope = Next->GetClass();
+			OutPlan.OwnerProperty = nullptr;
+		}
+
+		OutPlan.Converter = MakeConverter(Leaf);
+		UE_LOG(LogMCPPropertyPath, Verbose, TEXT("Resolved '%s' on %s in %d steps"), *Path, *Object->GetClass()->GetName(), OutPlan.Steps.Num());
+		return FVoidResult::Success();
+	}
+
+	auto FPropertyPath::Execute(
+		const TArray<FStep>& Steps,
+		UObject* Object,
+		const EAccess Access,
+		UObject*& OutOwner,
+		bool& OutStale,
+		FString& OutError
+	) -> void* {
+		uint8* Data = reinterpret_cast<uint8*>(Object);
+		OutOwner = Object;
+		OutStale = false;
+
+		// Probing past an element Add would create; the rest of the path walks default values
+		bool bAdded = false;
+
+		for (const FStep& Step : Steps) {
+			if (bAdded) {
+				// Default arrays are empty and default object references are None
+				if (Step.Kind == EStepKind::ArrayElement && Step.Index != 0) {
+					OutError = FString::Printf(TEXT("Index %d is out of range for '%s' with 0 elements"), Step.Index, *Step.Property->GetName());
+					return nullptr;
+				}
+				if (Step.Kind == EStepKind::MapValue
+					&& !ConvertToTemporary(*Step.KeyConverter, Step.Key, nullptr, OutError, [](const void*) {})) {
+					OutError = FString::Printf(TEXT("Invalid key for '%s': %s"), *Step.Property->GetName(), *OutError);
+					return nullptr;
+				}
+				if (Step.Kind == EStepKind::Dereference) {
+					OutError = FString::Printf(TEXT("'%s' is None"), *Step.Property->GetName());
+					return nullptr;
+				}
+				continue;
+			}
+
+			switch (Step.Kind) {
+			case EStepKind::Member:
+				Data += Step.Offset;
+				break;
+
+			case EStepKind::ArrayElement: {
+				FScriptArrayHelper Helper(CastFieldChecked<FArrayProperty>(Step.Property), Data);
+				if (Access == EAccess::Probe && Step.Index == Helper.Num()) {
+					bAdded = true;
+					break;
+				}
+				if (Access == EAccess::Add && Step.Index == Helper.Num()) {
+					Helper.AddValue();
+				}
+				if (!Helper.IsValidIndex(Step.Index)) {
+					OutError = FString::Printf(
+						TEXT("Index %d is out of range for '%s' with %d elements"),
+						Step.Index,
+						*Step.Property->GetName(),
+						Helper.Num());
+					return nullptr;
+				}
+				Data = Helper.GetRawPtr(Step.Index);
+				break;
+			}
+
+			case EStepKind::MapValue: {
+				const FMapProperty* MapProperty = CastFieldChecked<FMapProperty>(Step.Property);
+				FScriptMapHelper Helper(MapProperty, Data);
+				uint8* ValueData = nullptr;
+				const bool bKeyConverted = ConvertToTemporary(*Step.KeyConverter, Step.Key, nullptr, OutError, [&](const void* KeyData) {
+					ValueData = Helper.FindValueFromHash(KeyData);
+					if (!ValueData && Access == EAccess::Probe) {
+						bAdded = true;
+					}
+					else if (!ValueData && Access == EAccess::Add) {
+						const int32 Index = Helper.AddDefaultValue_Invalid_NeedsRehash();
+						MapProperty->KeyProp->CopySingleValue(Helper.GetKeyPtr(Index), KeyData);
+						Helper.Rehash();
+						ValueData = Helper.FindValueFromHash(KeyData);
+					}
+				});
+				if (!bKeyConverted) {
+					OutError = FString::Printf(TEXT("Invalid key for '%s': %s"), *Step.Property->GetName(), *OutError);
+					return nullptr;
+				}
+				if (bAdded) {
+					break;
+				}
+				if (!ValueData) {
+					OutError = FString::Printf(TEXT("'%s' has no key '%s'"), *Step.Property->GetName(), *Step.Key->AsString());
+					return nullptr;
+				}
+				Data = ValueData;
+				break;
+			}
+
+			case EStepKind::Dereference: {
+				UObject* Next = CastFieldChecked<FObjectPropertyBase>(Step.Property)->GetObjectPropertyValue(Data);
+				if (!Next) {
+					OutError = FString::Printf(TEXT("'%s' is None"), *Step.Property->GetName());
+					return nullptr;
+				}
+				if (Step.ExpectedClass && !Next->IsA(Step.ExpectedClass)) {
+					OutStale = true;
+					return nullptr;
+				}
+				Data = reinterpret_cast<uint8*>(Next);
+				OutOwner = Next;
+				break;
+			}
+			}
+		}
+		return bAdded ? Object : Data;
+	}
+
+	auto FPropertyPath::MakeConverter(const FProperty* Property) -> FConverter {
+		FConverter Converter;
+		Converter.Property = Property;
+
+		const FByteProperty* ByteProperty = CastField<FByteProperty>(Property);
+		if (CastField<FBoolProperty>(Property)) {
+			Converter.Function = &ConvertBool;
+		}
+		else if (CastField<FEnumProperty>(Property) || (ByteProperty && ByteProperty->Enum)) {
+			Converter.Function = &ConvertEnum;
+		}
+		else if (CastField<FNumericProperty>(Property)) {
+			Converter.Function = &ConvertNumeric;
+		}
+		else if (CastField<FStrProperty>(Property)) {
+			Converter.Function = &ConvertString;
+		}
+		else if (CastField<FNameProperty>(Property)) {
+			Converter.Function = &ConvertName;
+		}
+		else if (CastField<FTextProperty>(Property)) {
+			Converter.Function = &ConvertText;
+		}
+		else if (CastField<FSoftObjectProperty>(Property)) {
+			Converter.Function = &ConvertSoftObject;
+		}
+		else if (CastField<FObjectPropertyBase>(Property)) {
+			Converter.Function = &ConvertObject;
+		}
+		else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property)) {
+			Converter.Function = &ConvertStruct;
+
+			// Structs made only of numbers (vectors, rotators, colors, quats...) also take a number array
+			const UScriptStruct* Struct = StructProperty->Struct;
+			if (Struct != TBaseStructure<FColor>::Get() && Struct != TBaseStructure<FTransform>::Get()) {
+				TArray<FConverter> Fields;
+				for (TFieldIterator<FProperty> It(Struct); It; ++It) {
+					const FNumericProperty* Field = CastField<FNumericProperty>(*It);
+					if (!Field || Field->IsEnum() || Field->ArrayDim != 1) {
+						Fields.Reset();
+						break;
+					}
+					Fields.Add(MakeConverter(Field));
+				}
+				if (Fields.Num() >= 2) {
+					Converter.Inner = MoveTemp(Fields);
+				}
+			}
+		}
+		else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property)) {
+			Converter.Function = &ConvertArray;
+			Converter.Inner.Add(MakeConverter(ArrayProperty->Inner));
+		}
+		else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property)) {
+			Converter.Function = &ConvertSet;
+			Converter.Inner.Add(MakeConverter(SetProperty->ElementProp));
+		}
+		else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property)) {
+			Converter.Function = &ConvertMap;
+			Converter.Inner.Add(MakeConverter(MapProperty->KeyProp));
+			Converter.Inner.Add(MakeConverter(MapProperty->ValueProp));
+		}
+		else {
+			// Interfaces, delegates, field paths...
+			Converter.Function = &ConvertImportText;
+		}
+		return Converter;
+	}
+
+	auto FPropertyPath::ConvertToTemporary(
+		const FConverter& Converter,
+		const TSharedPtr<FJsonValue>& Value,
+		const void* Initial,
+		FString& OutError,
+		const TFunctionRef<void(const void*)> Consumer
+	) -> bool {
+		const FProperty* Property = Converter.Property;
+		void* Temporary = FMemory::Malloc(Property->GetSize(), Property->GetMinAlignment());
+		Property->InitializeValue(Temporary);
+		if (Initial) {
+			Property->CopySingleValue(Temporary, Initial);
+		}
+
+		const bool bConverted = Converter.Function(Converter, Temporary, Value, OutError);
+		if (bConverted) {
+			Consumer(Temporary);
+		}
+
+		Property->DestroyValue(Temporary);
+		FMemory::Free(Temporary);
+		return bConverted;
+	}
+
+	auto FPropertyPath::ConvertBool(
+		const FConverter& Converter,
+		void* Data,
+		const TSharedPtr<FJsonValue>& Value,
+		FString& OutError
+	) -> bool {
+		bool bValue = false;
+		FString Text;
+		if (Value->Type == EJson::Boolean) {
+			bValue = Value->AsBool();
+		}
+		else if (Value->Type == EJson::Number) {
+			bValue = Value->AsNumber() != 0.0;
+		}
+		else if (Value->TryGetString(Text) && (Text.Equals(TEXT("true"), ESearchCase::IgnoreCase) || Text == TEXT("1"))) {
+			bValue = true;
+		}
+		else if (Value->TryGetString(Text) && (Text.Equals(TEXT("false"), ESearchCase::IgnoreCase) || Text == TEXT("0"))) {
+			bValue = false;
+		}
+		else {
+			OutError = FString::Printf(TEXT("'%s' is a boolean. Expected: true/false or 1/0"), *Converter.Property->GetName());
+			return false;
+		}
+
+		CastFieldChecked<FBoolProperty>(Converter.Property)->SetPropertyValue(Data, bValue);
+		return true;
+	}
+
+	auto FPropertyPath::ConvertNumeric(
+		const FConverter& Converter,
+		void* Data,
+		const TSharedPtr<FJsonValue>& Value,
+		FString& OutError
+	) -> bool {
+		const FNumericProperty* Property = CastFieldChecked<FNumericProperty>(Converter.Property);
+
+		// 64-bit integers would lose precision through a double
+		FString Text;
+		if (!Property->IsFloatingPoint() && Value->Type == EJson::String && Value->TryGetString(Text)) {
+			if (int64 Integer = 0; LexTryParseString(Integer, *Text.TrimStartAndEnd())) {
+				Property->SetIntPropertyValue(Data, Integer);
+				return true;
+			}
+		}
+
+		double Number = 0.0;
+		if (Value->Type == EJson::Boolean || !Value->TryGetNumber(Number) || !FMath::IsFinite(Number)) {
+			OutError = FString::Printf(
+				TEXT("'%s' is a %s. Expected: %s"),
+				*Converter.Property->GetName(),
+				*Property->GetCPPType(),
+				Property->IsFloatingPoint() ? TEXT("number (e.g., 1.5, 3.14)") : TEXT("whole number (e.g., 1, -5, 42)"));
+			return false;
+		}
+
+		if (Property->IsFloatingPoint()) {
+			Property->SetFloatingPointPropertyValue(Data, Number);
+		}
+		else {
+			Property->SetIntPropertyValue(Data, static_cast<int64>(FMath::RoundToDouble(Number)));
+		}
+		return true;
+	}
+
+	auto FPropertyPath::ConvertEnum(
+		const FConverter& Converter,
+		void* Data,
+		const TSharedPtr<FJsonValue>& Value,
+		FString& OutError
+	) -> bool {
+		const UEnum* Enum = nullptr;
+		const FNumericProperty* Underlying = nullptr;
+		if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Converter.Property)) {
+			Enum = EnumProperty->GetEnum();
+			Underlying = EnumProperty->GetUnderlyingProperty();
+		}
+		else {
+			const FByteProperty* ByteProperty = CastFieldChecked<FByteProperty>(Converter.Property);
+			Enum = ByteProperty->Enum;
+			Underlying = ByteProperty;
+		}
+
+		int64 EnumValue = INDEX_NONE;
+		FString Text;
+		bool bFound = false;
+		if (Value->Type == EJson::Number) {
+			EnumValue = static_cast<int64>(Value->AsNumber());
+			bFound = Enum->IsValidEnumValue(EnumValue);
+		}
+		else if (Value->TryGetString(Text)) {
+			// Name ("Movable", "EComponentMobility::Movable") first, then display name
+			const int32 Index = Enum->GetIndexByNameString(Text);
+			if (Index != INDEX_NONE) {
+				EnumValue = Enum->GetValueByIndex(Index);
+				bFound = true;
+			}
+			for (int32 EnumIndex = 0; !bFound && EnumIndex < Enum->NumEnums() - 1; ++EnumIndex) {
+				if (Enum->GetDisplayNameTextByIndex(EnumIndex).ToString().Equals(Text, ESearchCase::IgnoreCase)) {
+					EnumValue = Enum->GetValueByIndex(EnumIndex);
+					bFound = true;
+				}
+			}
+		}
+
+		if (!bFound) {
+			TArray<FString> Names;
+			for (int32 EnumIndex = 0; EnumIndex < Enum->NumEnums() - 1; ++EnumIndex) {
+				Names.Add(Enum->GetNameStringByIndex(EnumIndex));
+			}
+			OutError = FString::Printf(
+				TEXT("%s is not a value of %s. Valid values: %s"),
+				Text.IsEmpty() ? DescribeJson(Value) : *FString::Printf(TEXT("'%s'"), *Text),
+				*Enum->GetName(),
+				*FString::Join(Names, TEXT(", ")));
+			return false;
+		}
+
+		Underlying->SetIntPropertyValue(Data, EnumValue);
+		return true;
+	}
+
+	auto FPropertyPath::ConvertString(
+		const FConverter& Converter,
+		void* Data,
+		const TSharedPtr<FJsonValue>& Value,
+		FString& OutError
+	) -> bool {
+		FString Text;
+		if (!Value->TryGetString(Text)) {
+			OutError = FString::Printf(TEXT("'%s' is a string. Expected: text in quotes (e.g., \"MyActor\")"), *Converter.Property->GetName());
+			return false;
+		}
+		CastFieldChecked<FStrProperty>(Converter.Property)->SetPropertyValue(Data, Text);
+		return true;
+	}
+
+	auto FPropertyPath::ConvertName(
+		const FConverter& Converter,
+		void* Data,
+		const TSharedPtr<FJsonValue>& Value,
+		FString& OutError
+	) -> bool {
+		FString Text;
+		if (!Value->TryGetString(Text)) {
+			OutError = FString::Printf(TEXT("'%s' is a name. Expected: a string"), *Converter.Property->GetName());
+			return false;
+		}
+		CastFieldChecked<FNameProperty>(Converter.Property)->SetPropertyValue(Data, FName(*Text));
+		return true;
+	}
+
+	auto FPropertyPath::ConvertText(
+		const FConverter& Converter,
+		void* Data,
+		const TSharedPtr<FJsonValue>& Value,
+		FString& OutError
+	) -> bool {
+		FString Text;
+		if (!Value->TryGetString(Text)) {
+			OutError = FString::Printf(TEXT("'%s' is a text. Expected: a string"), *Converter.Property->GetName());
+			return false;
+		}
+		CastFieldChecked<FTextProperty>(Converter.Property)->SetPropertyValue(Data, FText::FromString(Text));
+		return true;
+	}
+
+	auto FPropertyPath::ConvertObject(
+		const FConverter& Converter,
+		void* Data,
+		const TSharedPtr<FJsonValue>& Value,
+		FString& OutError
+	) -> bool {
+		const FObjectPropertyBase* Property = CastFieldChecked<FObjectPropertyBase>(Converter.Property);
+		const FClassProperty* ClassProperty = CastField<FClassProperty>(Property);
+
+		FString Text;
+		if (Value->Type != EJson::Null && !Value->TryGetString(Text)) {
+			OutError = FString::Printf(TEXT("'%s' is an object reference. Expected: an object path or null"), *Property->GetName());
+			return false;
+		}
+		Text.TrimStartAndEndInline();
+
+		UObject* Target = nullptr;
+		if (!Text.IsEmpty() && Text != TEXT("None")) {
+			if (Text.StartsWith(TEXT("/"))) {
+				Target = StaticFindObject(UObject::StaticClass(), nullptr, *Text);
+				if (!Target) {
+					Target = StaticLoadObject(UObject::StaticClass(), nullptr, *Text, nullptr, LOAD_NoWarn);
+				}
+			}
+			else if (ClassProperty) {
+				Target = UClass::TryFindTypeSlow<UClass>(Text);
+			}
+
+			// A blueprint asset stands for its generated class
+			if (const UBlueprint* Blueprint = Cast<UBlueprint>(Target); Blueprint && ClassProperty) {
+				Target = Blueprint->GeneratedClass;
+			}
+
+			if (!Target) {
+				OutError = FString::Printf(TEXT("Could not find or load '%s'"), *Text);
+				return false;
+			}
+			if (!Target->IsA(Property->PropertyClass)) {
+				OutError = FString::Printf(
+					TEXT("'%s' is a %s; '%s' needs a %s"),
+					*Text,
+					*Target->GetClass()->GetName(),
+					*Property->GetName(),
+					*Property->PropertyClass->GetName());
+				return false;
+			}
+			if (ClassProperty && !CastChecked<UClass>(Target)->IsChildOf(ClassProperty->MetaClass)) {
+				OutError = FString::Printf(
+					TEXT("'%s' is not a subclass of %s"),
+					*Text,
+					*ClassProperty->MetaClass->GetName());
+				return false;
+			}
+		}
+
+		Property->SetObjectPropertyValue(Data, Target);
+		return true;
+	}
+
+	auto FPropertyPath::ConvertSoftObject(
+		const FConverter& Converter,
+		void* Data,
+		const TSharedPtr<FJsonValue>& Value,
+		FString& OutError
+	) -> bool {
+		FString Text;
+		if (Value->Type != EJson::Null && !Value->TryGetString(Text)) {
+			OutError = FString::Printf(TEXT("'%s' is a soft reference. Expected: an object path or null"), *Converter.Property->GetName());
+			return false;
+		}
+		Text.TrimStartAndEndInline();
+
+		// Soft references are stored as paths; the target is not loaded
+		const FSoftObjectPath SoftPath(Text == TEXT("None") ? FString() : Text);
+		CastFieldChecked<FSoftObjectProperty>(Converter.Property)->SetPropertyValue(Data, FSoftObjectPtr(SoftPath));
+		return true;
+	}
+
+	auto FPropertyPath::ConvertStruct(
+		const FConverter& Converter,
+		void* Data,
+		const TSharedPtr<FJsonValue>& Value,
+		FString& OutError
+	) -> bool {
+		const UScriptStruct* Struct = CastFieldChecked<FStructProperty>(Converter.Property)->Struct;
+
+		if (Value->Type == EJson::String) {
+			return ConvertImportText(Converter, Data, Value, OutError);
+		}
+
+		if (Value->Type == EJson::Object) {
+			const TSharedPtr<FJsonObject>& Object = Value->AsObject();
+
+			// Transforms are written by their editor-facing parts rather than Rotation (a quat)/Translation/Scale3D
+			if (Struct == TBaseStructure<FTransform>::Get()
+				&& (Object->HasField(TEXT("location")) || Object->HasField(TEXT("rotation")) || Object->HasField(TEXT("scale")))) {
+				FTransform& Transform = *static_cast<FTransform*>(Data);
+				FVector Location = Transform.GetLocation();
+				FRotator Rotation = Transform.Rotator();
+				FVector Scale = Transform.GetScale3D();
+
+				const auto ReadPart = [&Object, &OutError](const TCHAR* Field, const UScriptStruct* PartStruct, void* PartData) -> bool {
+					const TSharedPtr<FJsonValue> Part = Object->TryGetField(Field);
+					if (!Part.IsValid()) {
+						return true;
+					}
+					const TArray<TSharedPtr<FJsonValue>>* Numbers = nullptr;
+					if (Part->TryGetArray(Numbers) && Numbers->Num() == 3) {
+						double* Components = static_cast<double*>(PartData);
+						for (int32 Index = 0; Index < 3; ++Index) {
+							if (!(*Numbers)[Index]->TryGetNumber(Components[Index])) {
+								OutError = FString::Printf(TEXT("%s[%d] is not a number"), Field, Index);
+								return false;
+							}
+						}
+						return true;
+					}
+					if (Part->Type == EJson::Object && FJsonObjectConverter::JsonObjectToUStruct(Part->AsObject().ToSharedRef(), PartStruct, PartData)) {
+						return true;
+					}
+					OutError = FString::Printf(TEXT("'%s' expects 3 numbers or an object"), Field);
+					return false;
+				};
+
+				// FVector is X, Y, Z and FRotator is Pitch, Yaw, Roll in memory
+				if (!ReadPart(TEXT("location"), TBaseStructure<FVector>::Get(), &Location)
+					|| !ReadPart(TEXT("rotation"), TBaseStructure<FRotator>::Get(), &Rotation)
+					|| !ReadPart(TEXT("scale"), TBaseStructure<FVector>::Get(), &Scale)) {
+					return false;
+				}
+				Transform = FTransform(Rotation, Location, Scale);
+				return true;
+			}
+
+			// Fields missing from the object keep their current value
+			if (!FJsonObjectConverter::JsonObjectToUStruct(Object.ToSharedRef(), Struct, Data)) {
+				OutError = FString::Printf(TEXT("The object does not match struct %s"), *Struct->GetName());
+				return false;
+			}
+			return true;
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* Items = nullptr;
+		if (Value->TryGetArray(Items)) {
+			if (Struct == TBaseStructure<FColor>::Get()) {
+				// FColor is BGRA in memory; arrays are RGBA like every other color
+				double Channels[4] = {0.0, 0.0, 0.0, 255.0};
+				bool bValid = Items->Num() == 3 || Items->Num() == 4;
+				for (int32 Index = 0; bValid && Index < Items->Num(); ++Index) {
+					bValid = (*Items)[Index]->TryGetNumber(Channels[Index]);
+				}
+				if (!bValid) {
+					OutError = TEXT("Color expects [R, G, B] or [R, G, B, A] with values 0-255");
+					return false;
+				}
+				FColor& Color = *static_cast<FColor*>(Data);
+				Color.R = static_cast<uint8>(FMath::Clamp(FMath::RoundToInt(Channels[0]), 0, 255));
+				Color.G = static_cast<uint8>(FMath::Clamp(FMath::RoundToInt(Channels[1]), 0, 255));
+				Color.B = static_cast<uint8>(FMath::Clamp(FMath::RoundToInt(Channels[2]), 0, 255));
+				Color.A = static_cast<uint8>(FMath::Clamp(FMath::RoundToInt(Channels[3]), 0, 255));
+				return true;
+			}
+
+			if (Converter.Inner.Num() > 0 && Items->Num() == Converter.Inner.Num()) {
+				for (int32 Index = 0; Index < Items->Num(); ++Index) {
+					const FConverter& Field = Converter.Inner[Index];
+					void* FieldData = Field.Property->ContainerPtrToValuePtr<void>(Data);
+					if (!Field.Function(Field, FieldData, (*Items)[Index], OutError)) {
+						return false;
+					}
+				}
+				return true;
+			}
+		}
+
+		TArray<FString> FieldNames;
+		for (const FConverter& Field : Converter.Inner) {
+			FieldNames.Add(Field.Property->GetName());
+		}
+		OutError = FieldNames.Num() > 0
+			? FString::Printf(
+				TEXT("%s expects %d numbers [%s], an object or its text form"),
+				*Struct->GetName(),
+				FieldNames.Num(),
+				*FString::Join(FieldNames, TEXT(", ")))
+			: FString::Printf(TEXT("%s expects an object or its text form, not %s"), *Struct->GetName(), DescribeJson(Value));
+		return false;
+	}
+
+	auto FPropertyPath::ConvertArray(
+		const FConverter& Converter,
+		void* Data,
+		const TSharedPtr<FJsonValue>& Value,
+		FString& OutError
+	) -> bool {
+		if (Value->Type == EJson::String) {
+			return ConvertImportText(Converter, Data, Value, OutError);
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* Items = nullptr;
+		if (!Value->TryGetArray(Items)) {
+			OutError = FString::Printf(TEXT("'%s' is an array. Expected: an array, not %s"), *Converter.Property->GetName(), DescribeJson(Value));
+			return false;
+		}
+
+		FScriptArrayHelper Helper(CastFieldChecked<FArrayProperty>(Converter.Property), Data);
+		Helper.EmptyAndAddValues(Items->Num());
+
+		const FConverter& Element = Converter.Inner[0];
+		for (int32 Index = 0; Index < Items->Num(); ++Index) {
+			if (!Element.Function(Element, Helper.GetRawPtr(Index), (*Items)[Index], OutError)) {
+				OutError = FString::Printf(TEXT("[%d]: %s"), Index, *OutError);
+				return false;
+			}
+		}
+		return true;
+	}
+
+	auto FPropertyPath::ConvertSet(
+		const FConverter& Converter,
+		void* Data,
+		const TSharedPtr<FJsonValue>& Value,
+		FString& OutError
+	) -> bool {
+		if (Value->Type == EJson::String) {
+			return ConvertImportText(Converter, Data, Value, OutError);
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* Items = nullptr;
+		if (!Value->TryGetArray(Items)) {
+			OutError = FString::Printf(TEXT("'%s' is a set. Expected: an array, not %s"), *Converter.Property->GetName(), DescribeJson(Value));
+			return false;
+		}
+
+		FScriptSetHelper Helper(CastFieldChecked<FSetProperty>(Converter.Property), Data);
+		Helper.EmptyElements(Items->Num());
+
+		for (int32 Index = 0; Index < Items->Num(); ++Index) {
+			const bool bConverted = ConvertToTemporary(Converter.Inner[0], (*Items)[Index], nullptr, OutError, [&Helper](const void* Element) {
+				Helper.AddElement(Element);
+			});
+			if (!bConverted) {
+				OutError = FString::Printf(TEXT("[%d]: %s"), Index, *OutError);
+				return false;
+			}
+		}
+		return true;
+	}
+
+	auto FPropertyPath::ConvertMap(
+		const FConverter& Converter,
+		void* Data,
+		const TSharedPtr<FJsonValue>& Value,
+		FString& OutError
+	) -> bool {
+		if (Value->Type == EJson::String) {
+			return ConvertImportText(Converter, Data, Value, OutError);
+		}
+		if (Value->Type != EJson::Object) {
+			OutError = FString::Printf(TEXT("'%s' is a map. Expected: an object, not %s"), *Converter.Property->GetName(), DescribeJson(Value));
+			return false;
+		}
+
+		FScriptMapHelper Helper(CastFieldChecked<FMapProperty>(Converter.Property), Data);
+		const TMap<FString, TSharedPtr<FJsonValue>>& Pairs = Value->AsObject()->Values;
+		Helper.EmptyValues(Pairs.Num());
+
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Pairs) {
+			const TSharedPtr<FJsonValue> KeyValue = MakeShared<FJsonValueString>(Pair.Key);
+			bool bValueConverted = true;
+			const bool bKeyConverted = ConvertToTemporary(Converter.Inner[0], KeyValue, nullptr, OutError, [&](const void* KeyData) {
+				bValueConverted = ConvertToTemporary(Converter.Inner[1], Pair.Value, nullptr, OutError, [&](const void* ValueData) {
+					Helper.AddPair(KeyData, ValueData);
+				});
+			});
+			if (!bKeyConverted || !bValueConverted) {
+				OutError = FString::Printf(TEXT("[%s]: %s"), *Pair.Key, *OutError);
+				return false;
+			}
+		}
+		return true;
+	}
+
+	auto FPropertyPath::ConvertImportText(
+		const FConverter& Converter,
+		void* Data,
+		const TSharedPtr<FJsonValue>& Value,
+		FString& OutError
+	) -> bool {
+		FString Text;
+		if (!Value->TryGetString(Text)) {
+			OutError = FString::Printf(
+				TEXT("'%s' (%s) is written from its text form. Expected: a string, not %s"),
+				*Converter.Property->GetName(),
+				*Converter.Property->GetCPPType(),
+				DescribeJson(Value));
+			return false;
+		}
+
+		FOutputDeviceNull Errors;
+		if (!Converter.Property->ImportText_Direct(*Text, Data, nullptr, PPF_None, &Errors)) {
+			OutError = FString::Printf(TEXT("'%s' is not a valid %s"), *Text, *Converter.Property->GetCPPType());
+			return false;
+		}
+		return true;
+	}
+
+}
@@ -0,0 +1,219 @@
+#include "Core/PropertyReader.h"
+#include "Core/PropertyPath.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+namespace UnrealMCP {
+
+	auto FPropertyReader::Read(UObject* Object, const FPropertyReadOptions& Options) -> TResult<TSharedPtr<FJsonObject>> {
+		if (!Object) {
+			return TResult<TSharedPtr<FJsonObject>>::Failure(EErrorCode::InvalidInput, TEXT("No object to read"));
+		}
+
+		FContext Context{Options, Object, {}};
+		if (Options.Paths.Num() == 0) {
+			return TResult<TSharedPtr<FJsonObject>>::Success(ReadObject(Context, Object, Options.Depth));
+		}
+
+		UObject* Archetype = Options.bChangedOnly ? Object->GetArchetype() : nullptr;
+		auto Properties = MakeShared<FJsonObject>();
+		Context.Expanded.Add(Object);
+
+		for (const FString& Path : Options.Paths) {
+			const FProperty* Leaf = nullptr;
+			void* Data = nullptr;
+			if (const FVoidResult Resolved = FPropertyPath::Resolve(Object, Path, Leaf, Data); Resolved.IsFailure()) {
+				return TResult<TSharedPtr<FJsonObject>>::Failure(Resolved.GetError());
+			}
+
+			if (Archetype) {
+				const FProperty* ArchetypeLeaf = nullptr;
+				void* ArchetypeData = nullptr;
+				if (FPropertyPath::Resolve(Archetype, Path, ArchetypeLeaf, ArchetypeData).IsSuccess()
+					&& ArchetypeLeaf == Leaf
+					&& Leaf->Identical(Data, ArchetypeData, PPF_DeepComparison)) {
+					continue;
+				}
+			}
+
+			// An indexed path addresses one element; a bare fixed-size array is returned whole
+			Properties->SetField(
+				Path,
+				Path.EndsWith(TEXT("]")) ? ValueToJson(Context, Leaf, Data, Options.Depth) : PropertyToJson(Context, Leaf, Data, Options.Depth));
+		}
+		return TResult<TSharedPtr<FJsonObject>>::Success(Properties);
+	}
+
+	auto FPropertyReader::ReadObject(FContext& Context, const UObject* Object, const int32 Depth) -> TSharedPtr<FJsonObject> {
+		Context.Expanded.Add(Object);
+
+		const UObject* Archetype = Context.Options.bChangedOnly ? Object->GetArchetype() : nullptr;
+		auto Properties = MakeShared<FJsonObject>();
+
+		for (TFieldIterator<FProperty> It(Object->GetClass()); It; ++It) {
+			const FProperty* Property = *It;
+			if (!Property->HasAnyPropertyFlags(CPF_Edit) || Property->HasAnyPropertyFlags(CPF_Deprecated)) {
+				continue;
+			}
+			const void* Data = Property->ContainerPtrToValuePtr<void>(Object);
+
+			// Owned subobjects are compared by their own overrides rather than by pointer
+			if (const UObject* Subobject = GetOwnedSubobject(Context, Property, Data); Subobject && Depth > 0) {
+				if (Context.Expanded.Contains(Subobject)) {
+					if (!Context.Options.bChangedOnly) {
+						Properties->SetStringField(Property->GetName(), Subobject->GetPathName());
+					}
+					continue;
+				}
+				TSharedPtr<FJsonObject> Nested = ReadObject(Context, Subobject, Depth - 1);
+				if (!Context.Options.bChangedOnly || Nested->Values.Num() > 0) {
+					Properties->SetObjectField(Property->GetName(), Nested);
+				}
+				continue;
+			}
+
+			if (Archetype) {
+				bool bIdentical = true;
+				for (int32 Index = 0; bIdentical && Index < Property->ArrayDim; ++Index) {
+					bIdentical = Property->Identical_InContainer(Object, Archetype, Index, PPF_DeepComparison);
+				}
+				if (bIdentical) {
+					continue;
+				}
+			}
+
+			Properties->SetField(Property->GetName(), PropertyToJson(Context, Property, Data, Depth));
+		}
+		return Properties;
+	}
+
+	auto FPropertyReader::PropertyToJson(
+		FContext& Context,
+		const FProperty* Property,
+		const void* Data,
+		const int32 Depth
+	) -> TSharedPtr<FJsonValue> {
+		if (Property->ArrayDim == 1) {
+			return ValueToJson(Context, Property, Data, Depth);
+		}
+
+		TArray<TSharedPtr<FJsonValue>> Elements;
+		Elements.Reserve(Property->ArrayDim);
+		for (int32 Index = 0; Index < Property->ArrayDim; ++Index) {
+			Elements.Add(ValueToJson(Context, Property, static_cast<const uint8*>(Data) + Property->GetElementSize() * Index, Depth));
+		}
+		return MakeShared<FJsonValueArray>(Elements);
+	}
+
+	auto FPropertyReader::ValueToJson(
+		FContext& Context,
+		const FProperty* Property,
+		const void* Data,
+		const int32 Depth
+	) -> TSharedPtr<FJsonValue> {
+		if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property)) {
+			return MakeShared<FJsonValueBoolean>(BoolProperty->GetPropertyValue(Data));
+		}
+
+		if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property)) {
+			const int64 Value = EnumProperty->GetUnderlyingProperty()->GetSignedIntPropertyValue(Data);
+			return MakeShared<FJsonValueString>(EnumProperty->GetEnum()->GetNameStringByValue(Value));
+		}
+		if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Property); ByteProperty && ByteProperty->Enum) {
+			return MakeShared<FJsonValueString>(ByteProperty->Enum->GetNameStringByValue(ByteProperty->GetPropertyValue(Data)));
+		}
+		if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property)) {
+			return MakeShared<FJsonValueNumber>(
+				NumericProperty->IsFloatingPoint()
+					? NumericProperty->GetFloatingPointPropertyValue(Data)
+					: static_cast<double>(NumericProperty->GetSignedIntPropertyValue(Data)));
+		}
+
+		if (const FStrProperty* StrProperty = CastField<FStrProperty>(Property)) {
+			return MakeShared<FJsonValueString>(StrProperty->GetPropertyValue(Data));
+		}
+		if (const FNameProperty* NameProperty = CastField<FNameProperty>(Property)) {
+			return MakeShared<FJsonValueString>(NameProperty->GetPropertyValue(Data).ToString());
+		}
+		if (const FTextProperty* TextProperty = CastField<FTextProperty>(Property)) {
+			return MakeShared<FJsonValueString>(TextProperty->GetPropertyValue(Data).ToString());
+		}
+
+		if (const FSoftObjectProperty* SoftProperty = CastField<FSoftObjectProperty>(Property)) {
+			const FSoftObjectPath Path = SoftProperty->GetPropertyValue(Data).ToSoftObjectPath();
+			return Path.IsNull() ? MakeShared<FJsonValueNull>() : StaticCastSharedRef<FJsonValue>(MakeShared<FJsonValueString>(Path.ToString()));
+		}
+		if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property)) {
+			const UObject* Object = ObjectProperty->GetObjectPropertyValue(Data);
+			if (!Object) {
+				return MakeShared<FJsonValueNull>();
+			}
+			if (Depth > 0 && GetOwnedSubobject(Context, Property, Data) && !Context.Expanded.Contains(Object)) {
+				return MakeShared<FJsonValueObject>(ReadObject(Context, Object, Depth - 1));
+			}
+			return MakeShared<FJsonValueString>(Object->GetPathName());
+		}
+
+		// Containers and structs below the depth limit keep their full value in text form
+		if (Depth <= 0) {
+			return MakeShared<FJsonValueString>(ExportText(Property, Data));
+		}
+
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property)) {
+			auto Fields = MakeShared<FJsonObject>();
+			for (TFieldIterator<FProperty> It(StructProperty->Struct); It; ++It) {
+				Fields->SetField(It->GetName(), PropertyToJson(Context, *It, It->ContainerPtrToValuePtr<void>(Data), Depth - 1));
+			}
+			return MakeShared<FJsonValueObject>(Fields);
+		}
+
+		if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property)) {
+			FScriptArrayHelper Helper(ArrayProperty, Data);
+			TArray<TSharedPtr<FJsonValue>> Elements;
+			Elements.Reserve(Helper.Num());
+			for (int32 Index = 0; Index < Helper.Num(); ++Index) {
+				Elements.Add(ValueToJson(Context, ArrayProperty->Inner, Helper.GetRawPtr(Index), Depth - 1));
+			}
+			return MakeShared<FJsonValueArray>(Elements);
+		}
+
+		if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property)) {
+			FScriptSetHelper Helper(SetProperty, Data);
+			TArray<TSharedPtr<FJsonValue>> Elements;
+			Elements.Reserve(Helper.Num());
+			for (FScriptSetHelper::FIterator It(Helper); It; ++It) {
+				Elements.Add(ValueToJson(Context, SetProperty->ElementProp, Helper.GetElementPtr(It), Depth - 1));
+			}
+			return MakeShared<FJsonValueArray>(Elements);
+		}
+
+		if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property)) {
+			FScriptMapHelper Helper(MapProperty, Data);
+			auto Pairs = MakeShared<FJsonObject>();
+			for (FScriptMapHelper::FIterator It(Helper); It; ++It) {
+				Pairs->SetField(
+					ExportText(MapProperty->KeyProp, Helper.GetKeyPtr(It)),
+					ValueToJson(Context, MapProperty->ValueProp, Helper.GetValuePtr(It), Depth - 1));
+			}
+			return MakeShared<FJsonValueObject>(Pairs);
+		}
+
+		return MakeShared<FJsonValueString>(ExportText(Property, Data));
+	}
+
+	auto FPropertyReader::GetOwnedSubobject(const FContext& Context, const FProperty* Property, const void* Data) -> const UObject* {
+		const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property);
+		if (!ObjectProperty || CastField<FSoftObjectProperty>(Property) || Property->ArrayDim != 1) {
+			return nullptr;
+		}
+		const UObject* Object = ObjectProperty->GetObjectPropertyValue(Data);
+		return Object && Object->IsIn(Context.Root) ? Object : nullptr;
+	}
+
+	auto FPropertyReader::ExportText(const FProperty* Property, const void* Data) -> FString {
+		FString Text;
+		Property->ExportText_Direct(Text, Data, Data, nullptr, PPF_None);
+		return Text;
+	}
+
+}
@@ -0,0 +1,124 @@
+#include "Core/ScatterSampler.h"
+#include "Async/ParallelFor.h"
+
+namespace UnrealMCP {
+
+	namespace {
+		auto CellCount(const double Extent, const double CellSize) -> int32 {
+			return FMath::Max(1, FMath::CeilToInt32(Extent / CellSize));
+		}
+	}
+
+	auto FScatterSampler::JitteredGrid(
+		const FVector2D& Size,
+		const double Spacing,
+		const double Jitter,
+		const int32 Seed,
+		TArray<FVector2D>& OutPoints
+	) -> void {
+		const int32 Columns = FMath::Max(1, FMath::FloorToInt32(Size.X / Spacing));
+		const int32 Rows = FMath::Max(1, FMath::FloorToInt32(Size.Y / Spacing));
+
+		// Center the grid in the domain
+		const FVector2D Margin((Size.X - Columns * Spacing) * 0.5, (Size.Y - Rows * Spacing) * 0.5);
+
+		const int32 First = OutPoints.Num();
+		OutPoints.AddUninitialized(Columns * Rows);
+		FVector2D* Points = OutPoints.GetData() + First;
+
+		ParallelFor(TEXT("UnrealMCP.ScatterGrid"), Rows, 1, [&](const int32 Row) {
+			FRandomStream Random(HashCombine(GetTypeHash(Seed), GetTypeHash(Row)));
+			for (int32 Column = 0; Column < Columns; ++Column) {
+				const double X = Column + 0.5 + Jitter * (Random.FRand() - 0.5);
+				const double Y = Row + 0.5 + Jitter * (Random.FRand() - 0.5);
+				Points[Row * Columns + Column] = Margin + FVector2D(X, Y) * Spacing;
+			}
+		});
+	}
+
+	auto FScatterSampler::PoissonDisk(
+		const FVector2D& Size,
+		const double MinDistance,
+		const int32 Seed,
+		TArray<FVector2D>& OutPoints
+	) -> void {
+		const double CellSize = MinDistance / UE_SQRT_2;
+		const int32 GridX = CellCount(Size.X, CellSize);
+		const int32 GridY = CellCount(Size.Y, CellSize);
+		const double MinDistanceSquared = MinDistance * MinDistance;
+
+		TArray<FVector2D> Cells;
+		TArray<bool> Occupied;
+		Cells.SetNumUninitialized(GridX * GridY);
+		Occupied.SetNumZeroed(GridX * GridY);
+
+		// A conflicting point is at most two cells away along either axis
+		const auto Conflicts = [&](const int32 CellX, const int32 CellY, const FVector2D& Point) -> bool {
+			for (int32 Y = FMath::Max(0, CellY - 2); Y <= FMath::Min(GridY - 1, CellY + 2); ++Y) {
+				for (int32 X = FMath::Max(0, CellX - 2); X <= FMath::Min(GridX - 1, CellX + 2); ++X) {
+					const int32 Neighbour = Y * GridX + X;
+					if (Occupied[Neighbour] && FVector2D::DistSquared(Cells[Neighbour], Point) < MinDistanceSquared) {
+						return true;
+					}
+				}
+			}
+			return false;
+		};
+
+		for (int32 Pass = 0; Pass < PoissonPasses; ++Pass) {
+			for (int32 Phase = 0; Phase < 9; ++Phase) {
+				const int32 OffsetX = Phase % 3;
+				const int32 OffsetY = Phase / 3;
+				const int32 PhaseX = (GridX - OffsetX + 2) / 3;
+				const int32 PhaseY = (GridY - OffsetY + 2) / 3;
+				if (PhaseX <= 0 || PhaseY <= 0) {
+					continue;
+				}
+
+				// Cells of one phase are three apart, so none reads a cell another one writes
+				ParallelFor(TEXT("UnrealMCP.ScatterPoisson"), PhaseX * PhaseY, 256, [&](const int32 Item) {
+					const int32 CellX = OffsetX + (Item % PhaseX) * 3;
+					const int32 CellY = OffsetY + (Item / PhaseX) * 3;
+					const int32 Cell = CellY * GridX + CellX;
+					if (Occupied[Cell]) {
+						return;
+					}
+
+					FRandomStream Random(HashCombine(HashCombine(GetTypeHash(Seed), GetTypeHash(Cell)), GetTypeHash(Pass)));
+					for (int32 Attempt = 0; Attempt < PoissonAttempts; ++Attempt) {
+						const FVector2D Point((CellX + Random.FRand()) * CellSize, (CellY + Random.FRand()) * CellSize);
+						if (Point.X > Size.X || Point.Y > Size.Y || Conflicts(CellX, CellY, Point)) {
+							continue;
+						}
+						Cells[Cell] = Point;
+						Occupied[Cell] = true;
+						break;
+					}
+				});
+			}
+		}
+
+		int32 NumPoints = 0;
+		for (const bool bOccupied : Occupied) {
+			NumPoints += bOccupied ? 1 : 0;
+		}
+		OutPoints.Reserve(OutPoints.Num() + NumPoints);
+		for (int32 Cell = 0; Cell < Cells.Num(); ++Cell) {
+			if (Occupied[Cell]) {
+				OutPoints.Add(Cells[Cell]);
+			}
+		}
+	}
+
+	auto FScatterSampler::EstimateGridCount(const FVector2D& Size, const double Spacing) -> int64 {
+		return static_cast<int64>(FMath::Max(1.0, FMath::FloorToDouble(Size.X / Spacing)))
+			* static_cast<int64>(FMath::Max(1.0, FMath::FloorToDouble(Size.Y / Spacing)));
+	}
+
+	auto FScatterSampler::EstimatePoissonCount(const FVector2D& Size, const double MinDistance) -> int64 {
+		const double CellSize = MinDistance / UE_SQRT_2;
+		return static_cast<int64>(FMath::Max(1.0, FMath::CeilToDouble(Size.X / CellSize)))
+			* static_cast<int64>(FMath::Max(1.0, FMath::CeilToDouble(Size.Y / CellSize)));
+	}
+
+}
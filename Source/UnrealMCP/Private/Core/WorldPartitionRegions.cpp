@@ -0,0 +1,56 @@
+#include "Core/WorldPartitionRegions.h"
+#include "Engine/World.h"
+#include "WorldPartition/WorldPartition.h"
+#include "WorldPartition/WorldPartitionEditorLoaderAdapter.h"
+#include "WorldPartition/LoaderAdapter/LoaderAdapterShape.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogMCPWorldPartition, Log, All);
+
+namespace UnrealMCP {
+
+	TMap<int32, FWorldPartitionRegions::FRegion> FWorldPartitionRegions::Regions;
+	int32 FWorldPartitionRegions::LastRegionId = 0;
+
+	auto FWorldPartitionRegions::Load(UWorld* World, const FBox& Bounds) -> int32 {
+		UWorldPartition* WorldPartition = World ? World->GetWorldPartition() : nullptr;
+		if (!WorldPartition) {
+			return 0;
+		}
+
+		const int32 RegionId = ++LastRegionId;
+		UWorldPartitionEditorLoaderAdapter* Adapter = WorldPartition->CreateEditorLoaderAdapter<FLoaderAdapterShape>(
+			World,
+			Bounds,
+			FString::Printf(TEXT("MCP Region %d"), RegionId));
+
+		// User-created adapters are listed in the World Partition editor and survive its refreshes
+		Adapter->GetLoaderAdapter()->SetUserCreated(true);
+		Adapter->GetLoaderAdapter()->Load();
+
+		Regions.Add(RegionId, {World, Adapter});
+		UE_LOG(LogMCPWorldPartition, Verbose, TEXT("Loaded region %d %s"), RegionId, *Bounds.ToString());
+		return RegionId;
+	}
+
+	auto FWorldPartitionRegions::Unload(const int32 RegionId) -> bool {
+		FRegion Region;
+		if (!Regions.RemoveAndCopyValue(RegionId, Region)) {
+			return false;
+		}
+
+		// A region whose world closed was unloaded with it
+		UWorld* World = Region.World.Get();
+		UWorldPartition* WorldPartition = World ? World->GetWorldPartition() : nullptr;
+		UWorldPartitionEditorLoaderAdapter* Adapter = Region.Adapter.Get();
+		if (WorldPartition && Adapter) {
+			Adapter->GetLoaderAdapter()->Unload();
+			WorldPartition->ReleaseEditorLoaderAdapter(Adapter);
+		}
+		return true;
+	}
+
+	auto FWorldPartitionRegions::Reset() -> void {
+		Regions.Empty();
+	}
+
+}
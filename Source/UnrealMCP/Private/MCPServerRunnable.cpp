@@ -3,11 +3,13 @@
 #include "SocketSubsystem.h"
 #include "Sockets.h"
 #include "UnrealMCPBridge.h"
+#include "Core/LevelEventStream.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
 #include "HAL/PlatformTime.h"
 #include "Interfaces/IPv4/IPv4Address.h"
 #include "Misc/ScopeLock.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 
@@ -49,8 +51,20 @@ auto FMCPServerRunnable::Run() -> uint32 {
 				ClientSocket->SetSendBufferSize(SocketBufferSize, SocketBufferSize);
 				ClientSocket->SetReceiveBufferSize(SocketBufferSize, SocketBufferSize);
 
+				// Level event subscriptions made over this connection live as long as it does
+				const int32 SessionId = UnrealMCP::FLevelEventStream::OpenSession();
+
 				uint8 Buffer[MCPBufferSize];
 				while (bRunning) {
+					// Events are pushed between requests; wake up every 10 ms while the client is idle
+					if (UnrealMCP::FLevelEventStream::HasSubscriptions(SessionId)) {
+						PushEvents(SessionId);
+						if (!ClientSocket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromMilliseconds(10))
+							&& ClientSocket->GetConnectionState() == SCS_Connected) {
+							continue;
+						}
+					}
+
 					int32 BytesRead = 0;
 					if (ClientSocket->Recv(Buffer, sizeof(Buffer), BytesRead)) {
 						if (BytesRead == 0) {
@@ -80,15 +94,11 @@ auto FMCPServerRunnable::Run() -> uint32 {
 								UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Sending response: %s"), *Response);
 
 								// Send response
-								int32 BytesSent = 0;
-								if (!ClientSocket->Send((uint8*)TCHAR_TO_UTF8(*Response), Response.Len(), BytesSent)) {
+								if (!SendMessage(*ClientSocket, Response)) {
 									UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to send response"));
 								}
 								else {
-									UE_LOG(LogTemp,
-									       Display,
-									       TEXT("MCPServerRunnable: Response sent successfully, bytes: %d"),
-									       BytesSent);
+									UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Response sent successfully"));
 								}
 							}
 							else {
@@ -132,6 +142,8 @@ auto FMCPServerRunnable::Run() -> uint32 {
 						}
 					}
 				}
+
+				UnrealMCP::FLevelEventStream::CloseSession(SessionId);
 			}
 			else {
 				UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to accept client connection"));
@@ -299,15 +311,51 @@ auto FMCPServerRunnable::ProcessMessage(TSharedPtr<FSocket> Client, const FStrin
 	UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Executing command: %s"), *CommandType);
 
 	// Execute command
-	FString Response = Bridge->ExecuteCommand(CommandType, Params);
-
-	// Send response with newline terminator
-	Response += TEXT("\n");
-	int32 BytesSent = 0;
+	const FString Response = Bridge->ExecuteCommand(CommandType, Params);
 
 	UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Sending response: %s"), *Response);
 
-	if (!Client->Send((uint8*)TCHAR_TO_UTF8(*Response), Response.Len(), BytesSent)) {
+	if (!SendMessage(*Client, Response)) {
 		UE_LOG(LogTemp, Error, TEXT("MCPServerRunnable: Failed to send response"));
 	}
 }
+
+auto FMCPServerRunnable::PushEvents(const int32 SessionId) const -> void {
+	TArray<UnrealMCP::FLevelEventBatch> Batches;
+	UnrealMCP::FLevelEventStream::TakeBatches(SessionId, Batches);
+
+	for (const UnrealMCP::FLevelEventBatch& Batch : Batches) {
+		FString Message;
+		const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+			TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Message);
+		FJsonSerializer::Serialize(Batch.ToJson().ToSharedRef(), Writer);
+
+		if (!SendMessage(*ClientSocket, Message)) {
+			UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to push %d event(s)"), Batch.Events.Num());
+			return;
+		}
+	}
+}
+
+auto FMCPServerRunnable::EncodeMessage(const FString& Json) -> TArray<uint8> {
+	// Sized in UTF-8 bytes; the character count is shorter for any non-ASCII text
+	const FTCHARToUTF8 Utf8(*Json);
+	TArray<uint8> Bytes;
+	Bytes.Reserve(Utf8.Length() + 1);
+	Bytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+	Bytes.Add('\n');
+	return Bytes;
+}
+
+auto FMCPServerRunnable::SendMessage(FSocket& Socket, const FString& Json) -> bool {
+	const TArray<uint8> Bytes = EncodeMessage(Json);
+	int32 Offset = 0;
+	while (Offset < Bytes.Num()) {
+		int32 BytesSent = 0;
+		if (!Socket.Send(Bytes.GetData() + Offset, Bytes.Num() - Offset, BytesSent)) {
+			return false;
+		}
+		Offset += BytesSent;
+	}
+	return true;
+}
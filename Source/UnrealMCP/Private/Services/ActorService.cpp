@@ -1,19 +1,41 @@
 ﻿#include "Services/ActorService.h"
+#include "Core/ActorIndex.h"
+#include "Core/ActorTransformBatch.h"
+#include "Core/BlueprintCompileCoordinator.h"
+#include "Core/CommonUtils.h"
 #include "Core/ErrorTypes.h"
+#include "Core/LevelDigest.h"
+#include "Core/LevelEventStream.h"
+#include "Core/PropertyPath.h"
+#include "Core/PropertyReader.h"
+#include "Core/ScatterSampler.h"
+#include "Core/WorldPartitionRegions.h"
 #include "Editor.h"
+#include "EditorAssetLibrary.h"
 #include "ScopedTransaction.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
 #include "Camera/CameraActor.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
 #include "Components/SceneComponent.h"
+#include "Components/SplineComponent.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Engine/DirectionalLight.h"
+#include "Engine/Level.h"
 #include "Engine/PointLight.h"
 #include "Engine/SpotLight.h"
+#include "Engine/StaticMesh.h"
 #include "Engine/StaticMeshActor.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
+#include "GameFramework/Volume.h"
 #include "Kismet/GameplayStatics.h"
+#include "Services/BlueprintService.h"
 #include "Subsystems/EditorActorSubsystem.h"
+#include "WorldPartition/WorldPartition.h"
+#include "WorldPartition/WorldPartitionActorDescInstance.h"
+#include "WorldPartition/WorldPartitionHelpers.h"
 
 namespace UnrealMCP {
 
@@ -36,21 +58,136 @@ namespace UnrealMCP {
 	}
 
 	auto FActorService::FindActorsByName(const FString& NamePattern, TArray<FString>& OutActorNames) -> FVoidResult {
-		const UWorld* World = GetEditorWorld();
+		FActorNameSearchParams Params;
+		Params.Pattern = NamePattern;
+
+		const TResult<TArray<AActor*>> Result = FindActorsByPattern(Params);
+		if (Result.IsFailure()) {
+			return FVoidResult::Failure(Result.GetError());
+		}
+
+		for (const AActor* Actor : Result.GetValue()) {
+			OutActorNames.Add(Actor->GetName());
+		}
+
+		return FVoidResult::Success();
+	}
+
+	auto FActorService::FindActorsByPattern(const FActorNameSearchParams& Params) -> TResult<TArray<AActor*>> {
+		UWorld* World = GetEditorWorld();
 		if (!World) {
-			return FVoidResult::Failure(EErrorCode::WorldNotFound);
+			return TResult<TArray<AActor*>>::Failure(EErrorCode::WorldNotFound);
 		}
 
-		TArray<AActor*> AllActors;
-		UGameplayStatics::GetAllActorsOfClass(World, AActor::StaticClass(), AllActors);
+		const TResult<FNamePattern> Pattern = FNamePattern::Compile(Params.Pattern, Params.Mode, Params.bCaseSensitive);
+		if (Pattern.IsFailure()) {
+			return TResult<TArray<AActor*>>::Failure(Pattern.GetError());
+		}
 
-		for (const AActor* Actor : AllActors) {
-			if (Actor && Actor->GetName().Contains(NamePattern)) {
-				OutActorNames.Add(Actor->GetName());
-			}
+		TArray<AActor*> Actors;
+		FActorIndex::FindByPattern(World, Pattern.GetValue(), Params.bIncludeLabels, Actors);
+
+		return TResult<TArray<AActor*>>::Success(MoveTemp(Actors));
+	}
+
+	auto FActorService::QueryActors(const FActorQueryFilter& Filter) -> TResult<TArray<AActor*>> {
+		UWorld* World = GetEditorWorld();
+		if (!World) {
+			return TResult<TArray<AActor*>>::Failure(EErrorCode::WorldNotFound);
 		}
 
-		return FVoidResult::Success();
+		const TResult<FActorIndexQuery> QueryResult = ResolveFilter(Filter);
+		if (QueryResult.IsFailure()) {
+			return TResult<TArray<AActor*>>::Failure(QueryResult.GetError());
+		}
+
+		TArray<AActor*> Actors;
+		FActorIndex::QueryActors(World, QueryResult.GetValue(), Actors);
+
+		return TResult<TArray<AActor*>>::Success(MoveTemp(Actors));
+	}
+
+	auto FActorService::FindActorsInRadius(
+		const FVector& Center,
+		const double Radius,
+		const FActorQueryFilter& Filter
+	) -> TResult<TArray<AActor*>> {
+		UWorld* World = GetEditorWorld();
+		if (!World) {
+			return TResult<TArray<AActor*>>::Failure(EErrorCode::WorldNotFound);
+		}
+
+		const TResult<FActorIndexQuery> QueryResult = ResolveFilter(Filter);
+		if (QueryResult.IsFailure()) {
+			return TResult<TArray<AActor*>>::Failure(QueryResult.GetError());
+		}
+
+		const FWorldActorIndex* Index = FActorIndex::GetWorldIndex(World);
+		TArray<AActor*> Actors;
+		Index->GetSpatialIndex().QuerySphere(Center, Radius, Actors);
+
+		const FActorIndexQuery& Query = QueryResult.GetValue();
+		Actors.RemoveAllSwap([&Query](const AActor* Actor) {
+			return !Query.Matches(Actor);
+		});
+
+		return TResult<TArray<AActor*>>::Success(MoveTemp(Actors));
+	}
+
+	auto FActorService::FindActorsInBox(const FBox& Box, const FActorQueryFilter& Filter) -> TResult<TArray<AActor*>> {
+		UWorld* World = GetEditorWorld();
+		if (!World) {
+			return TResult<TArray<AActor*>>::Failure(EErrorCode::WorldNotFound);
+		}
+
+		const TResult<FActorIndexQuery> QueryResult = ResolveFilter(Filter);
+		if (QueryResult.IsFailure()) {
+			return TResult<TArray<AActor*>>::Failure(QueryResult.GetError());
+		}
+
+		const FWorldActorIndex* Index = FActorIndex::GetWorldIndex(World);
+		TArray<AActor*> Actors;
+		Index->GetSpatialIndex().QueryBox(Box, Actors);
+
+		const FActorIndexQuery& Query = QueryResult.GetValue();
+		Actors.RemoveAllSwap([&Query](const AActor* Actor) {
+			return !Query.Matches(Actor);
+		});
+
+		return TResult<TArray<AActor*>>::Success(MoveTemp(Actors));
+	}
+
+	auto FActorService::FindNearestActors(
+		const FVector& Location,
+		const int32 Count,
+		const double MaxDistance,
+		const FActorQueryFilter& Filter
+	) -> TResult<TArray<TPair<AActor*, double>>> {
+		UWorld* World = GetEditorWorld();
+		if (!World) {
+			return TResult<TArray<TPair<AActor*, double>>>::Failure(EErrorCode::WorldNotFound);
+		}
+
+		const TResult<FActorIndexQuery> QueryResult = ResolveFilter(Filter);
+		if (QueryResult.IsFailure()) {
+			return TResult<TArray<TPair<AActor*, double>>>::Failure(QueryResult.GetError());
+		}
+
+		const FWorldActorIndex* Index = FActorIndex::GetWorldIndex(World);
+		const FActorIndexQuery& Query = QueryResult.GetValue();
+
+		TArray<TPair<AActor*, double>> Hits;
+		Index->GetSpatialIndex().QueryNearest(
+			Location,
+			MaxDistance,
+			[&Query](const AActor* Actor) {
+				return Query.Matches(Actor);
+			},
+			Count,
+			Hits
+		);
+
+		return TResult<TArray<TPair<AActor*, double>>>::Success(MoveTemp(Hits));
 	}
 
 	auto FActorService::SpawnActor(
@@ -107,11 +244,133 @@ namespace UnrealMCP {
 
 			RootComponent->UpdateComponentToWorld();
 			SpawnedActor->UpdateAllReplicatedComponents();
+			FActorIndex::NotifyActorMoved(SpawnedActor);
 		}
 
 		return TResult<AActor*>::Success(SpawnedActor);
 	}
 
+	auto FActorService::SpawnActors(const FSpawnActorsParams& Params) -> TResult<FSpawnActorsResult> {
+		UWorld* World = GetEditorWorld();
+		if (!World) {
+			return TResult<FSpawnActorsResult>::Failure(EErrorCode::WorldNotFound);
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+
+		// Validate the whole batch before spawning anything, so a bad entry leaves the level untouched
+		TMap<FString, UClass*> ClassCache;
+		TArray<UClass*> Classes;
+		Classes.Reserve(Params.Actors.Num());
+		TSet<FName> BatchNames;
+
+		for (int32 Index = 0; Index < Params.Actors.Num(); ++Index) {
+			const FActorSpawnSpec& Spec = Params.Actors[Index];
+
+			UClass** CachedClass = ClassCache.Find(Spec.ClassName);
+			if (!CachedClass) {
+				UClass* Class = GetActorClassByName(Spec.ClassName);
+				if (!Class) {
+					if (UBlueprint* Blueprint = FCommonUtils::FindBlueprint(Spec.ClassName)) {
+						FBlueprintCompileCoordinator::Flush(Blueprint);
+						Class = Blueprint->GeneratedClass;
+					}
+				}
+				CachedClass = &ClassCache.Add(Spec.ClassName, Class);
+			}
+			if (!*CachedClass || !(*CachedClass)->IsChildOf(AActor::StaticClass())
+				|| (*CachedClass)->HasAnyClassFlags(CLASS_Abstract)) {
+				return TResult<FSpawnActorsResult>::Failure(
+					EErrorCode::InvalidActorClass,
+					Spec.ClassName,
+					FString::Printf(TEXT("actors[%d]: '%s' is not a spawnable actor class"), Index, *Spec.ClassName));
+			}
+			Classes.Add(*CachedClass);
+
+			if (!Spec.Name.IsEmpty()) {
+				const FName Name(*Spec.Name);
+				bool bAlreadyInBatch = false;
+				BatchNames.Add(Name, &bAlreadyInBatch);
+				if (bAlreadyInBatch || FActorIndex::FindByName(World, Name)) {
+					return TResult<FSpawnActorsResult>::Failure(
+						EErrorCode::InvalidInput,
+						FString::Printf(TEXT("actors[%d]: an actor named '%s' already exists"), Index, *Spec.Name));
+				}
+			}
+		}
+
+		ULevel* Level = World->GetCurrentLevel();
+
+		FSpawnActorsResult Result;
+		Result.Actors.Reserve(Params.Actors.Num());
+
+		{
+			FScopedTransaction Transaction(FText::FromString(TEXT("Spawn Actors")));
+			TArray<AActor*> Spawned;
+			Spawned.Reserve(Params.Actors.Num());
+
+			for (int32 Index = 0; Index < Params.Actors.Num(); ++Index) {
+				const FActorSpawnSpec& Spec = Params.Actors[Index];
+
+				// Deferred construction lets the properties reach the construction script
+				FActorSpawnParameters SpawnParams;
+				SpawnParams.Name = Spec.Name.IsEmpty() ? NAME_None : FName(*Spec.Name);
+				SpawnParams.OverrideLevel = Level;
+				SpawnParams.bDeferConstruction = true;
+				SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+				AActor* Actor = World->SpawnActor(Classes[Index], &Spec.Transform, SpawnParams);
+				if (!Actor) {
+					// Roll the batch back so a failed call leaves neither actors nor an undo entry behind
+					for (AActor* SpawnedActor : Spawned) {
+						World->DestroyActor(SpawnedActor);
+					}
+					Transaction.Cancel();
+					return TResult<FSpawnActorsResult>::Failure(
+						EErrorCode::FailedToSpawnActor,
+						Spec.Name,
+						FString::Printf(TEXT("actors[%d] could not be spawned; the %d actors spawned before it were removed"), Index, Index));
+				}
+				Spawned.Add(Actor);
+
+				FSpawnActorsResult::FEntry& Entry = Result.Actors.AddDefaulted_GetRef();
+				Entry.Name = Actor->GetName();
+				Entry.ClassName = Actor->GetClass()->GetName();
+
+				if (Spec.Properties.IsValid()) {
+					for (const TPair<FString, TSharedPtr<FJsonValue>>& Property : Spec.Properties->Values) {
+						if (const FVoidResult Set = FPropertyPath::SetValue(Actor, Property.Key, Property.Value, false); Set.IsFailure()) {
+							Entry.PropertyErrors.Add(FString::Printf(TEXT("%s: %s"), *Property.Key, *Set.GetError().Details));
+						}
+					}
+				}
+
+				Actor->FinishSpawning(Spec.Transform);
+
+				// Actors without a scene component ignore the spawn transform; give them a root that carries it
+				if (!Actor->GetRootComponent() && !Spec.Transform.Equals(FTransform::Identity)) {
+					USceneComponent* NewRoot = NewObject<USceneComponent>(Actor);
+					NewRoot->SetRelativeTransform(Spec.Transform);
+					Actor->SetRootComponent(NewRoot);
+					NewRoot->RegisterComponent();
+				}
+
+				// The index saw the actor before construction, so refresh its attributes and bounds
+				FActorIndex::NotifyActorChanged(Actor);
+				FActorIndex::NotifyActorMoved(Actor);
+			}
+		}
+
+		// Each spawn already announced its actor to the outliner; dirty the level and redraw once for the batch
+		Level->MarkPackageDirty();
+		if (GEditor) {
+			GEditor->RedrawLevelEditingViewports();
+		}
+
+		Result.TotalTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		return TResult<FSpawnActorsResult>::Success(MoveTemp(Result));
+	}
+
 	auto FActorService::DeleteActor(const FString& ActorName) -> FVoidResult {
 		AActor* Actor = FindActorByName(ActorName);
 		if (!Actor) {
@@ -168,10 +427,683 @@ namespace UnrealMCP {
 
 		RootComponent->UpdateComponentToWorld();
 		Actor->UpdateAllReplicatedComponents();
+		FActorIndex::NotifyActorMoved(Actor);
+
+		return FVoidResult::Success();
+	}
+
+	auto FActorService::SetActorTransforms(const FSetActorTransformsParams& Params) -> TResult<FSetActorTransformsResult> {
+		if (!GetEditorWorld()) {
+			return TResult<FSetActorTransformsResult>::Failure(EErrorCode::WorldNotFound);
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+
+		// Resolve every name first so a typo leaves the level untouched
+		TArray<AActor*> Actors;
+		Actors.Reserve(Params.Names.Num());
+		for (const FString& Name : Params.Names) {
+			AActor* Actor = FindActorByName(Name);
+			if (!Actor) {
+				return TResult<FSetActorTransformsResult>::Failure(EErrorCode::ActorNotFound, Name);
+			}
+			Actors.Add(Actor);
+		}
+
+		FSetActorTransformsResult Result;
+
+		// Opened on the first change, so a batch that moves nothing leaves no undo entry
+		TOptional<FScopedTransaction> Transaction;
+
+		for (int32 Index = 0; Index < Actors.Num(); ++Index) {
+			AActor* Actor = Actors[Index];
+			const FTransform& NewTransform = Params.Transforms[Index];
+
+			USceneComponent* RootComponent = Actor->GetRootComponent();
+			if (RootComponent && RootComponent->GetRelativeTransform().Equals(NewTransform)) {
+				++Result.UnchangedCount;
+				continue;
+			}
+
+			if (!Transaction.IsSet()) {
+				Transaction.Emplace(FText::FromString(TEXT("Set Actor Transforms")));
+			}
+
+			if (!RootComponent) {
+				// Create a default scene component as root for actors that don't have one
+				Actor->Modify();
+				RootComponent = NewObject<USceneComponent>(Actor);
+				Actor->SetRootComponent(RootComponent);
+				RootComponent->RegisterComponent();
+			}
+
+			// SetRelativeTransform updates the component and its children; no separate UpdateComponentToWorld
+			RootComponent->Modify();
+			RootComponent->SetRelativeTransform(NewTransform, false, nullptr, ETeleportType::ResetPhysics);
+			NotifyActorTreeMoved(Actor);
+			++Result.UpdatedCount;
+		}
+
+		if (Result.UpdatedCount > 0 && GEditor) {
+			GEditor->RedrawLevelEditingViewports();
+		}
+
+		Result.TotalTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		return TResult<FSetActorTransformsResult>::Success(MoveTemp(Result));
+	}
+
+	auto FActorService::TransformActors(const FTransformActorsParams& Params) -> TResult<FTransformActorsResult> {
+		if (!GetEditorWorld()) {
+			return TResult<FTransformActorsResult>::Failure(EErrorCode::WorldNotFound);
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+
+		TResult<TArray<AActor*>> SelectResult = SelectActors(Params.Selection);
+		if (SelectResult.IsFailure()) {
+			return TResult<FTransformActorsResult>::Failure(SelectResult.GetError());
+		}
+		const TArray<AActor*>& Selected = SelectResult.GetValue();
+
+		FTransformActorsResult Result;
+		Result.MatchedCount = Selected.Num();
+
+		// Actors attached to another selected actor follow their parent; moving them as well would apply the edit twice
+		TSet<const AActor*> SelectedSet(Selected);
+		TArray<USceneComponent*> Roots;
+		Roots.Reserve(Selected.Num());
+
+		FActorTransformBatch Batch;
+		Batch.Reserve(Selected.Num());
+
+		for (AActor* Actor : Selected) {
+			USceneComponent* RootComponent = Actor->GetRootComponent();
+			if (!RootComponent) {
+				continue;
+			}
+
+			bool bFollowsParent = false;
+			for (const AActor* Parent = Actor->GetAttachParentActor(); Parent; Parent = Parent->GetAttachParentActor()) {
+				if (SelectedSet.Contains(Parent)) {
+					bFollowsParent = true;
+					break;
+				}
+			}
+			if (bFollowsParent) {
+				continue;
+			}
+
+			Roots.Add(RootComponent);
+			Batch.Add(RootComponent->GetComponentTransform());
+		}
+
+		switch (Params.Operation) {
+		case EActorTransformOperation::Offset:
+			Batch.Translate(Params.Offset);
+			break;
+		case EActorTransformOperation::Rotate:
+			Result.Pivot = Params.Pivot.IsSet() ? Params.Pivot.GetValue() : Batch.GetCentroid();
+			Batch.RotateAround(Result.Pivot.GetValue(), Params.Rotation);
+			break;
+		case EActorTransformOperation::Scale:
+			Result.Pivot = Params.Pivot.IsSet() ? Params.Pivot.GetValue() : Batch.GetCentroid();
+			Batch.ScaleAround(Result.Pivot.GetValue(), Params.Factor);
+			break;
+		case EActorTransformOperation::Snap:
+			Batch.SnapToGrid(Params.GridSize);
+			break;
+		}
+
+		// Opened on the first change, so an edit that moves nothing leaves no undo entry
+		TOptional<FScopedTransaction> Transaction;
+
+		for (int32 Index = 0; Index < Roots.Num(); ++Index) {
+			USceneComponent* RootComponent = Roots[Index];
+			const FTransform NewTransform = Batch.GetTransform(Index);
+			if (RootComponent->GetComponentTransform().Equals(NewTransform)) {
+				continue;
+			}
+
+			if (Params.bTransact) {
+				if (!Transaction.IsSet()) {
+					Transaction.Emplace(FText::FromString(TEXT("Transform Actors")));
+				}
+				RootComponent->Modify();
+			}
+
+			RootComponent->SetWorldTransform(NewTransform, false, nullptr, ETeleportType::ResetPhysics);
+			NotifyActorTreeMoved(RootComponent->GetOwner());
+			++Result.UpdatedCount;
+		}
+
+		if (Result.UpdatedCount > 0) {
+			if (!Params.bTransact) {
+				// Without Modify nothing else marks the level as changed
+				GetEditorWorld()->GetCurrentLevel()->MarkPackageDirty();
+			}
+			if (GEditor) {
+				GEditor->RedrawLevelEditingViewports();
+			}
+		}
+
+		Result.TotalTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		return TResult<FTransformActorsResult>::Success(MoveTemp(Result));
+	}
+
+	auto FActorService::SetProperties(const FSetPropertiesParams& Params) -> TResult<FSetPropertiesResult> {
+		if (!GetEditorWorld()) {
+			return TResult<FSetPropertiesResult>::Failure(EErrorCode::WorldNotFound);
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+
+		TResult<TArray<AActor*>> SelectResult = SelectActors(Params.Selection);
+		if (SelectResult.IsFailure()) {
+			return TResult<FSetPropertiesResult>::Failure(SelectResult.GetError());
+		}
+		const TArray<AActor*>& Selected = SelectResult.GetValue();
+
+		FSetPropertiesResult Result;
+		Result.MatchedCount = Selected.Num();
+
+		// One PreEditChange when an object is first written and one PostEditChange once every value is in
+		struct FEditedObject {
+			UObject* Object = nullptr;
+			FProperty* Property = nullptr;
+			bool bSeveralProperties = false;
+		};
+		TArray<FEditedObject> Edited;
+		TMap<UObject*, int32> EditedIndex;
+
+		// Opened on the first write, so a batch that fails everywhere leaves no undo entry
+		TOptional<FScopedTransaction> Transaction;
+
+		for (AActor* Actor : Selected) {
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Property : Params.Properties) {
+				const FVoidResult Set = FPropertyPath::SetValue(
+					Actor,
+					Property.Key,
+					Property.Value,
+					[&](UObject* Owner, FProperty* OwnerProperty) {
+						if (const int32* Index = EditedIndex.Find(Owner)) {
+							FEditedObject& Object = Edited[*Index];
+							Object.bSeveralProperties |= Object.Property != OwnerProperty;
+							return;
+						}
+						if (Params.bTransact && !Transaction.IsSet()) {
+							Transaction.Emplace(FText::FromString(TEXT("Set Properties")));
+						}
+						// PreEditChange records the object in the transaction
+						Owner->PreEditChange(OwnerProperty);
+						EditedIndex.Add(Owner, Edited.Num());
+						Edited.Add({Owner, OwnerProperty, false});
+					});
+
+				if (Set.IsSuccess()) {
+					++Result.WrittenCount;
+				}
+				else {
+					++Result.FailedCount;
+					if (Result.Errors.Num() < FSetPropertiesResult::MaxErrors) {
+						Result.Errors.Add({Actor->GetName(), Property.Key, Set.GetError().Details});
+					}
+				}
+			}
+		}
+
+		for (const FEditedObject& Object : Edited) {
+			if (Object.bSeveralProperties) {
+				Object.Object->PostEditChange();
+			}
+			else {
+				FPropertyChangedEvent ChangedEvent(Object.Property, EPropertyChangeType::ValueSet);
+				Object.Object->PostEditChangeProperty(ChangedEvent);
+			}
+		}
+		Result.UpdatedCount = Edited.Num();
+
+		if (Edited.Num() > 0 && GEditor) {
+			GEditor->RedrawLevelEditingViewports();
+		}
+
+		Result.TotalTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		return TResult<FSetPropertiesResult>::Success(MoveTemp(Result));
+	}
+
+	auto FActorService::GetProperties(const FGetPropertiesParams& Params) -> TResult<FGetPropertiesResult> {
+		if (!GetEditorWorld()) {
+			return TResult<FGetPropertiesResult>::Failure(EErrorCode::WorldNotFound);
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+
+		TResult<TArray<AActor*>> SelectResult = SelectActors(Params.Selection);
+		if (SelectResult.IsFailure()) {
+			return TResult<FGetPropertiesResult>::Failure(SelectResult.GetError());
+		}
+
+		FGetPropertiesResult Result;
+		Result.Entries.Reserve(SelectResult.GetValue().Num());
+		for (AActor* Actor : SelectResult.GetValue()) {
+			TResult<TSharedPtr<FJsonObject>> Read = FPropertyReader::Read(Actor, Params.Options);
+			if (Read.IsFailure()) {
+				return TResult<FGetPropertiesResult>::Failure(Read.GetError());
+			}
+			Result.Entries.Add({Actor->GetName(), Actor->GetClass()->GetName(), MoveTemp(Read.GetValue())});
+		}
+
+		Result.TotalTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		return TResult<FGetPropertiesResult>::Success(MoveTemp(Result));
+	}
+
+	auto FActorService::Subscribe(const FSubscribeParams& Params) -> TResult<FSubscribeResult> {
+		TResult<FActorIndexQuery> QueryResult = ResolveFilter(Params.Filter);
+		if (QueryResult.IsFailure()) {
+			return TResult<FSubscribeResult>::Failure(QueryResult.GetError());
+		}
+
+		FLevelEventFilter Filter;
+		Filter.Kinds = Params.Kinds;
+		Filter.Query = MoveTemp(QueryResult.GetValue());
+		Filter.Properties = TSet<FString>(Params.Properties);
 
+		if (Params.Pattern.IsSet()) {
+			TResult<FNamePattern> PatternResult = FNamePattern::Compile(Params.Pattern.GetValue(), Params.Mode, Params.bCaseSensitive);
+			if (PatternResult.IsFailure()) {
+				return TResult<FSubscribeResult>::Failure(PatternResult.GetError());
+			}
+			Filter.NamePattern = MoveTemp(PatternResult.GetValue());
+		}
+
+		FSubscribeResult Result;
+		Result.SubscriptionId = FLevelEventStream::Subscribe(MoveTemp(Filter), Params.MaxQueued);
+		Result.Kinds = Params.Kinds;
+		Result.MaxQueued = Params.MaxQueued;
+		return TResult<FSubscribeResult>::Success(Result);
+	}
+
+	auto FActorService::Unsubscribe(const int32 SubscriptionId) -> FVoidResult {
+		if (!FLevelEventStream::Unsubscribe(SubscriptionId, FLevelEventStream::GetCurrentSession())) {
+			return FVoidResult::Failure(EErrorCode::InvalidInput, FString::Printf(TEXT("No subscription %d"), SubscriptionId));
+		}
 		return FVoidResult::Success();
 	}
 
+	auto FActorService::GetLevelDigest(const FGetLevelDigestParams& Params) -> TResult<FGetLevelDigestResult> {
+		UWorld* World = GetEditorWorld();
+		if (!World) {
+			return TResult<FGetLevelDigestResult>::Failure(EErrorCode::WorldNotFound);
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+
+		FGetLevelDigestResult Result;
+		if (!FLevelDigest::GetDigest(World, Params.Path, Params.Depth, Params.bIncludeActors, Params.bRehash, Result.Node)) {
+			return TResult<FGetLevelDigestResult>::Failure(
+				EErrorCode::InvalidInput,
+				FString::Printf(TEXT("No digest node '%s'"), *Params.Path));
+		}
+
+		Result.TotalTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		return TResult<FGetLevelDigestResult>::Success(MoveTemp(Result));
+	}
+
+	auto FActorService::DiffLevel(const FDiffLevelParams& Params) -> TResult<FDiffLevelResult> {
+		UWorld* World = GetEditorWorld();
+		if (!World) {
+			return TResult<FDiffLevelResult>::Failure(EErrorCode::WorldNotFound);
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+
+		FDiffLevelResult Result;
+		FLevelDigest::GetChanges(World, Params.SinceDigest, Result.Changes);
+
+		Result.TotalTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		return TResult<FDiffLevelResult>::Success(MoveTemp(Result));
+	}
+
+	auto FActorService::QueryActorDescs(const FQueryActorDescsParams& Params) -> TResult<FQueryActorDescsResult> {
+		UWorld* World = GetEditorWorld();
+		if (!World) {
+			return TResult<FQueryActorDescsResult>::Failure(EErrorCode::WorldNotFound);
+		}
+		UWorldPartition* WorldPartition = World->GetWorldPartition();
+		if (!WorldPartition) {
+			return TResult<FQueryActorDescsResult>::Failure(
+				EErrorCode::InvalidOperationInCurrentContext,
+				TEXT("The editor world does not use World Partition"));
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+
+		const UClass* Class = nullptr;
+		TSet<FTopLevelAssetPath> BlueprintClassPaths;
+		if (Params.ClassName.IsSet()) {
+			UClass* ActorClass = GetActorClassByName(Params.ClassName.GetValue());
+			if (!ActorClass || !ActorClass->IsChildOf(AActor::StaticClass())) {
+				return TResult<FQueryActorDescsResult>::Failure(EErrorCode::InvalidActorClass, Params.ClassName.GetValue());
+			}
+			Class = ActorClass;
+
+			// Descriptors only know the native class and the blueprint class the actor was placed from, so a
+			// blueprint filter matches that class and every blueprint class the asset registry derives from it
+			if (!ActorClass->HasAnyClassFlags(CLASS_Native)) {
+				const FTopLevelAssetPath BlueprintClassPath(ActorClass);
+				const IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+				AssetRegistry.GetDerivedClassNames({BlueprintClassPath}, {}, BlueprintClassPaths);
+				BlueprintClassPaths.Add(BlueprintClassPath);
+			}
+		}
+
+		TOptional<FNamePattern> Pattern;
+		if (Params.Pattern.IsSet()) {
+			TResult<FNamePattern> PatternResult = FNamePattern::Compile(Params.Pattern.GetValue(), Params.Mode, Params.bCaseSensitive);
+			if (PatternResult.IsFailure()) {
+				return TResult<FQueryActorDescsResult>::Failure(PatternResult.GetError());
+			}
+			Pattern = MoveTemp(PatternResult.GetValue());
+		}
+
+		const FName DataLayer = Params.DataLayer.IsSet() ? FName(*Params.DataLayer.GetValue()) : NAME_None;
+		const FName RuntimeGrid = Params.RuntimeGrid.IsSet() ? FName(*Params.RuntimeGrid.GetValue()) : NAME_None;
+		const double RadiusSquared = FMath::Square(Params.RegionRadius);
+
+		FQueryActorDescsResult Result;
+		FWorldPartitionHelpers::ForEachActorDescInstance(
+			WorldPartition,
+			AActor::StaticClass(),
+			[&](const FWorldPartitionActorDescInstance* Desc) {
+				++Result.TotalCount;
+
+				if (Class) {
+					const UClass* NativeClass = Desc->GetActorNativeClass();
+					if (BlueprintClassPaths.Num() > 0 ? !BlueprintClassPaths.Contains(Desc->GetBaseClass()) : !NativeClass || !NativeClass->IsChildOf(Class)) {
+						return true;
+					}
+				}
+				if (Params.bLoaded.IsSet() && Desc->IsLoaded() != Params.bLoaded.GetValue()) {
+					return true;
+				}
+				if (Params.bSpatiallyLoaded.IsSet() && Desc->GetIsSpatiallyLoaded() != Params.bSpatiallyLoaded.GetValue()) {
+					return true;
+				}
+				if (Params.RuntimeGrid.IsSet() && Desc->GetRuntimeGrid() != RuntimeGrid) {
+					return true;
+				}
+				if (Params.DataLayer.IsSet() && !Desc->GetDataLayerInstanceNames().ToArray().Contains(DataLayer)) {
+					return true;
+				}
+
+				const FName Name = Desc->GetActorName();
+				const FName Label = Desc->GetActorLabel();
+				if (Pattern.IsSet() && !Pattern->Matches(Name.ToString()) && (Label.IsNone() || !Pattern->Matches(Label.ToString()))) {
+					return true;
+				}
+
+				const FBox Bounds = Desc->GetEditorBounds();
+				if (Params.RegionBox.IsSet() && (!Bounds.IsValid || !Bounds.Intersect(Params.RegionBox.GetValue()))) {
+					return true;
+				}
+				if (Params.RegionRadius > 0.0 && (!Bounds.IsValid || !FMath::SphereAABBIntersection(Params.RegionCenter, RadiusSquared, Bounds))) {
+					return true;
+				}
+
+				++Result.MatchedCount;
+				if (Result.Entries.Num() >= Params.Limit) {
+					return true;
+				}
+
+				FQueryActorDescsResult::FEntry& Entry = Result.Entries.AddDefaulted_GetRef();
+				Entry.Name = Name.ToString();
+				Entry.Label = Label.IsNone() ? Entry.Name : Label.ToString();
+				if (const FTopLevelAssetPath BaseClass = Desc->GetBaseClass(); BaseClass.IsValid()) {
+					Entry.ClassName = BaseClass.GetAssetName().ToString();
+				}
+				else if (const UClass* NativeClass = Desc->GetActorNativeClass()) {
+					Entry.ClassName = NativeClass->GetName();
+				}
+				Entry.Guid = Desc->GetGuid();
+				Entry.Bounds = Bounds;
+				Entry.DataLayers = Desc->GetDataLayerInstanceNames().ToArray();
+				Entry.RuntimeGrid = Desc->GetRuntimeGrid();
+				Entry.bSpatiallyLoaded = Desc->GetIsSpatiallyLoaded();
+				Entry.bLoaded = Desc->IsLoaded();
+				return true;
+			});
+
+		Result.TotalTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		return TResult<FQueryActorDescsResult>::Success(MoveTemp(Result));
+	}
+
+	auto FActorService::LoadRegion(const FLoadRegionParams& Params) -> TResult<FLoadRegionResult> {
+		UWorld* World = GetEditorWorld();
+		if (!World) {
+			return TResult<FLoadRegionResult>::Failure(EErrorCode::WorldNotFound);
+		}
+		UWorldPartition* WorldPartition = World->GetWorldPartition();
+		if (!WorldPartition) {
+			return TResult<FLoadRegionResult>::Failure(
+				EErrorCode::InvalidOperationInCurrentContext,
+				TEXT("The editor world does not use World Partition"));
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+
+		FLoadRegionResult Result;
+		Result.RegionId = FWorldPartitionRegions::Load(World, Params.Bounds);
+		Result.Bounds = Params.Bounds;
+
+		FWorldPartitionHelpers::ForEachIntersectingActorDescInstance(
+			WorldPartition,
+			Params.Bounds,
+			AActor::StaticClass(),
+			[&Result](const FWorldPartitionActorDescInstance* Desc) {
+				++Result.ActorCount;
+				Result.LoadedCount += Desc->IsLoaded() ? 1 : 0;
+				return true;
+			});
+
+		Result.TotalTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		return TResult<FLoadRegionResult>::Success(Result);
+	}
+
+	auto FActorService::UnloadRegion(const int32 RegionId) -> FVoidResult {
+		if (!FWorldPartitionRegions::Unload(RegionId)) {
+			return FVoidResult::Failure(EErrorCode::InvalidInput, FString::Printf(TEXT("No region %d"), RegionId));
+		}
+		return FVoidResult::Success();
+	}
+
+	auto FActorService::ScatterInstances(const FScatterInstancesParams& Params) -> TResult<FScatterInstancesResult> {
+		UWorld* World = GetEditorWorld();
+		if (!World) {
+			return TResult<FScatterInstancesResult>::Failure(EErrorCode::WorldNotFound);
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+
+		UStaticMesh* Mesh = Cast<UStaticMesh>(UEditorAssetLibrary::LoadAsset(Params.MeshPath));
+		if (!Mesh) {
+			return TResult<FScatterInstancesResult>::Failure(EErrorCode::AssetNotFound, Params.MeshPath);
+		}
+
+		// Map the region onto a 2D sampling domain
+		FBox Box = Params.Box;
+		AVolume* Volume = nullptr;
+		const USplineComponent* Spline = nullptr;
+		FVector2D DomainSize;
+
+		if (Params.Region == EScatterRegion::Box) {
+			DomainSize = FVector2D(Box.Max - Box.Min);
+		}
+		else {
+			AActor* RegionActor = FindActorByName(Params.RegionActorName);
+			if (!RegionActor) {
+				return TResult<FScatterInstancesResult>::Failure(EErrorCode::ActorNotFound, Params.RegionActorName);
+			}
+
+			if (Params.Region == EScatterRegion::Volume) {
+				Volume = Cast<AVolume>(RegionActor);
+				if (!Volume) {
+					return TResult<FScatterInstancesResult>::Failure(
+						EErrorCode::InvalidInput,
+						FString::Printf(TEXT("'%s' is not a volume"), *Params.RegionActorName));
+				}
+				Box = Volume->GetComponentsBoundingBox(true);
+				DomainSize = FVector2D(Box.Max - Box.Min);
+			}
+			else {
+				Spline = RegionActor->FindComponentByClass<USplineComponent>();
+				if (!Spline) {
+					return TResult<FScatterInstancesResult>::Failure(
+						EErrorCode::ComponentNotFound,
+						FString::Printf(TEXT("'%s' has no spline component"), *Params.RegionActorName));
+				}
+				DomainSize = FVector2D(Spline->GetSplineLength(), Params.Width * 2.0);
+			}
+		}
+
+		if (DomainSize.X <= 0.0 || DomainSize.Y <= 0.0) {
+			return TResult<FScatterInstancesResult>::Failure(EErrorCode::InvalidInput, TEXT("The scatter region is empty"));
+		}
+
+		const int64 Estimate = Params.Sampling == EScatterSampling::PoissonDisk
+			                       ? FScatterSampler::EstimatePoissonCount(DomainSize, Params.Spacing)
+			                       : FScatterSampler::EstimateGridCount(DomainSize, Params.Spacing);
+		if (Estimate > FScatterInstancesParams::MaxInstances) {
+			return TResult<FScatterInstancesResult>::Failure(
+				EErrorCode::InvalidInput,
+				FString::Printf(
+					TEXT("Up to %lld instances would be created, more than the limit of %lld; increase 'spacing'"),
+					Estimate, FScatterInstancesParams::MaxInstances));
+		}
+
+		TArray<FVector2D> Points;
+		if (Params.Sampling == EScatterSampling::PoissonDisk) {
+			FScatterSampler::PoissonDisk(DomainSize, Params.Spacing, Params.Seed, Points);
+		}
+		else {
+			FScatterSampler::JitteredGrid(DomainSize, Params.Spacing, Params.Jitter, Params.Seed, Points);
+		}
+
+		// Per-instance height, yaw and scale come from a stream keyed by the point index, so the result
+		// does not depend on how ParallelFor splits the work. Spline queries are const and thread-safe.
+		TArray<FTransform> Transforms;
+		Transforms.SetNumUninitialized(Points.Num());
+		ParallelFor(TEXT("UnrealMCP.ScatterTransforms"), Points.Num(), 4096, [&](const int32 Index) {
+			FRandomStream Random(HashCombine(GetTypeHash(~Params.Seed), GetTypeHash(Index)));
+			const FVector2D& Point = Points[Index];
+
+			FVector Location;
+			double Yaw = Random.FRand() * 360.0;
+			if (Spline) {
+				Location = Spline->GetLocationAtDistanceAlongSpline(Point.X, ESplineCoordinateSpace::World)
+					+ Spline->GetRightVectorAtDistanceAlongSpline(Point.X, ESplineCoordinateSpace::World) * (Point.Y - Params.Width);
+				if (!Params.bRandomYaw) {
+					Yaw = Spline->GetRotationAtDistanceAlongSpline(Point.X, ESplineCoordinateSpace::World).Yaw;
+				}
+			}
+			else {
+				Location = FVector(Box.Min.X + Point.X, Box.Min.Y + Point.Y, FMath::Lerp(Box.Min.Z, Box.Max.Z, static_cast<double>(Random.FRand())));
+				if (!Params.bRandomYaw) {
+					Yaw = 0.0;
+				}
+			}
+
+			const double Scale = FMath::Lerp(Params.ScaleRange.X, Params.ScaleRange.Y, static_cast<double>(Random.FRand()));
+			Transforms[Index] = FTransform(FRotator(0.0, Yaw, 0.0), Location, FVector(Scale));
+		});
+
+		if (Volume) {
+			// Volume containment goes through the brush body, so it stays on the game thread
+			Transforms.RemoveAllSwap([Volume](const FTransform& Transform) {
+				return !Volume->EncompassesPoint(Transform.GetLocation());
+			}, EAllowShrinking::No);
+		}
+
+		FScatterInstancesResult Result;
+		Result.SampleTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		TOptional<FScopedTransaction> Transaction;
+		if (Params.bTransact) {
+			Transaction.Emplace(FText::FromString(TEXT("Scatter Instances")));
+		}
+
+		// A plain AActor has no root to carry its spawn transform; the instance component placed here becomes the root
+		FTransform HostTransform(Spline ? Spline->GetComponentLocation() : Box.GetCenter());
+
+		AActor* Host = Params.ActorName.IsEmpty() ? nullptr : FindActorByName(Params.ActorName);
+		if (Host) {
+			HostTransform = Host->GetActorTransform();
+		}
+		else {
+			FActorSpawnParameters SpawnParams;
+			SpawnParams.Name = Params.ActorName.IsEmpty()
+				                   ? MakeUniqueObjectName(World->GetCurrentLevel(), AActor::StaticClass(), *FString::Printf(TEXT("Scatter_%s"), *Mesh->GetName()))
+				                   : FName(*Params.ActorName);
+			SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+			Host = World->SpawnActor(AActor::StaticClass(), &HostTransform, SpawnParams);
+			if (!Host) {
+				return TResult<FScatterInstancesResult>::Failure(EErrorCode::FailedToSpawnActor, SpawnParams.Name.ToString());
+			}
+		}
+
+		// Reuse the host's instance component for this mesh so repeated scatters share one draw batch
+		UHierarchicalInstancedStaticMeshComponent* Component = nullptr;
+		TInlineComponentArray<UHierarchicalInstancedStaticMeshComponent*> Existing(Host);
+		for (UHierarchicalInstancedStaticMeshComponent* Candidate : Existing) {
+			if (Candidate->GetStaticMesh() == Mesh) {
+				Component = Candidate;
+				break;
+			}
+		}
+
+		if (!Component) {
+			Host->Modify();
+			Component = NewObject<UHierarchicalInstancedStaticMeshComponent>(
+				Host,
+				MakeUniqueObjectName(Host, UHierarchicalInstancedStaticMeshComponent::StaticClass(), *FString::Printf(TEXT("%s_Instances"), *Mesh->GetName())),
+				RF_Transactional);
+			Component->SetStaticMesh(Mesh);
+			if (USceneComponent* Root = Host->GetRootComponent()) {
+				Component->SetupAttachment(Root);
+			}
+			else {
+				Component->SetWorldTransform(HostTransform);
+				Host->SetRootComponent(Component);
+			}
+			Host->AddInstanceComponent(Component);
+			Component->RegisterComponent();
+		}
+
+		if (Params.bTransact) {
+			Component->Modify();
+		}
+
+		// One batched add; HISM builds its cluster tree once for the whole batch
+		Result.FirstInstance = Component->GetInstanceCount();
+		Component->AddInstances(Transforms, false, true);
+		Result.InstanceCount = Component->GetInstanceCount() - Result.FirstInstance;
+
+		Result.ActorName = Host->GetName();
+		Result.ComponentName = Component->GetName();
+
+		if (!Params.bTransact) {
+			// Without Modify nothing else marks the level as changed
+			World->GetCurrentLevel()->MarkPackageDirty();
+		}
+		FActorIndex::NotifyActorChanged(Host);
+		FActorIndex::NotifyActorMoved(Host);
+		if (GEditor) {
+			GEditor->RedrawLevelEditingViewports();
+		}
+
+		Result.TotalTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		return TResult<FScatterInstancesResult>::Success(MoveTemp(Result));
+	}
+
 	auto FActorService::GetActorProperties(const FString& ActorName,
 	                                       TMap<FString, FString>& OutProperties) -> FVoidResult {
 		const AActor* Actor = FindActorByName(ActorName);
@@ -209,81 +1141,70 @@ namespace UnrealMCP {
 			return FVoidResult::Failure(EErrorCode::ActorNotFound, ActorName);
 		}
 
-		FProperty* Property = FindFProperty<FProperty>(Actor->GetClass(), *PropertyName);
-		if (!Property) {
-			// Provide helpful information about available properties
-			TArray<FString> AvailableProperties = GetAvailableProperties(Actor->GetClass());
-
-			FString Details = FString::Printf(TEXT("Property '%s' not found on actor '%s'"), *PropertyName, *ActorName);
-			if (AvailableProperties.Num() > 0) {
-				Details += TEXT(". Available properties: ");
-				for (int32 i = 0; i < FMath::Min(5, AvailableProperties.Num()); i++) {
-					Details += AvailableProperties[i];
-					if (i < FMath::Min(5, AvailableProperties.Num()) - 1) {
-						Details += TEXT(", ");
-					}
-				}
-				if (AvailableProperties.Num() > 5) {
-					Details += TEXT("...");
-				}
-			} else {
-				Details += TEXT(". No settable properties found on this actor.");
+		FVoidResult Result = FVoidResult::Success();
+		{
+			FScopedTransaction Transaction(FText::FromString(TEXT("Set Actor Property")));
+			Result = FPropertyPath::SetValue(Actor, PropertyName, PropertyValue, true);
+			if (Result.IsFailure()) {
+				Transaction.Cancel();
 			}
+		}
+		if (Result.IsSuccess() || Result.GetError().Code != EErrorCode::PropertyNotFound) {
+			return Result;
+		}
 
-			return FVoidResult::Failure(EErrorCode::PropertyNotFound, PropertyName, Details);
+		// A missing top-level property; provide helpful information about available properties
+		FString TopLevelName;
+		if (!PropertyName.Split(TEXT("."), &TopLevelName, nullptr)) {
+			TopLevelName = PropertyName;
 		}
+		TopLevelName.Split(TEXT("["), &TopLevelName, nullptr);
+		if (FindFProperty<FProperty>(Actor->GetClass(), *TopLevelName)) {
+			return Result;
+		}
+
+		TArray<FString> AvailableProperties = GetAvailableProperties(Actor->GetClass());
 
-		if (const FBoolProperty* BoolProp = CastField<FBoolProperty>(Property)) {
-			bool BoolValue;
-			if (!PropertyValue->TryGetBool(BoolValue)) {
-				return FVoidResult::Failure(
-					EErrorCode::InvalidPropertyValue,
-					PropertyName,
-					FString::Printf(TEXT("Property '%s' is a boolean. Expected: true/false or 1/0"), *PropertyName));
+		FString Details = FString::Printf(TEXT("Property '%s' not found on actor '%s'"), *PropertyName, *ActorName);
+		if (AvailableProperties.Num() > 0) {
+			Details += TEXT(". Available properties: ");
+			for (int32 i = 0; i < FMath::Min(5, AvailableProperties.Num()); i++) {
+				Details += AvailableProperties[i];
+				if (i < FMath::Min(5, AvailableProperties.Num()) - 1) {
+					Details += TEXT(", ");
+				}
 			}
-			BoolProp->SetPropertyValue_InContainer(Actor, BoolValue);
-		}
-		else if (const FFloatProperty* FloatProp = CastField<FFloatProperty>(Property)) {
-			double NumberValue;
-			if (!PropertyValue->TryGetNumber(NumberValue)) {
-				return FVoidResult::Failure(
-					EErrorCode::InvalidPropertyValue,
-					PropertyName,
-					FString::Printf(TEXT("Property '%s' is a float. Expected: number (e.g., 1.5, 3.14)"), *PropertyName));
+			if (AvailableProperties.Num() > 5) {
+				Details += TEXT("...");
 			}
-			const float Value = static_cast<float>(NumberValue);
-			FloatProp->SetPropertyValue_InContainer(Actor, Value);
+		} else {
+			Details += TEXT(". No editable properties found on this actor.");
 		}
-		else if (const FIntProperty* IntProp = CastField<FIntProperty>(Property)) {
-			double NumberValue;
-			if (!PropertyValue->TryGetNumber(NumberValue)) {
-				return FVoidResult::Failure(
-					EErrorCode::InvalidPropertyValue,
-					PropertyName,
-					FString::Printf(TEXT("Property '%s' is an integer. Expected: whole number (e.g., 1, -5, 42)"), *PropertyName));
+
+		return FVoidResult::Failure(EErrorCode::PropertyNotFound, PropertyName, Details);
+	}
+
+	auto FActorService::SelectActors(const FActorSelection& Selection) -> TResult<TArray<AActor*>> {
+		if (Selection.Names.Num() == 0) {
+			if (Selection.RegionBox.IsSet()) {
+				return FindActorsInBox(Selection.RegionBox.GetValue(), Selection.Filter);
 			}
-			const int32 Value = FMath::RoundToInt(NumberValue);
-			IntProp->SetPropertyValue_InContainer(Actor, Value);
-		}
-		else if (const FStrProperty* StrProp = CastField<FStrProperty>(Property)) {
-			FString StringValue;
-			if (!PropertyValue->TryGetString(StringValue)) {
-				return FVoidResult::Failure(
-					EErrorCode::InvalidPropertyValue,
-					PropertyName,
-					FString::Printf(TEXT("Property '%s' is a string. Expected: text in quotes (e.g., \"MyActor\")"), *PropertyName));
+			if (Selection.RegionRadius > 0.0) {
+				return FindActorsInRadius(Selection.RegionCenter, Selection.RegionRadius, Selection.Filter);
 			}
-			StrProp->SetPropertyValue_InContainer(Actor, StringValue);
-		}
-		else {
-			const FString PropertyType = Property->GetClass()->GetName();
-			const FString Details = FString::Printf(
-				TEXT("Unsupported type: %s. Supported types: boolean, float, integer, string"),
-				*PropertyType);
-			return FVoidResult::Failure(EErrorCode::InvalidPropertyValue, PropertyName, Details);
+			return QueryActors(Selection.Filter);
 		}
 
-		return FVoidResult::Success();
+		TArray<AActor*> Selected;
+		Selected.Reserve(Selection.Names.Num());
+		for (const FString& Name : Selection.Names) {
+			AActor* Actor = FindActorByName(Name);
+			if (!Actor) {
+				return TResult<TArray<AActor*>>::Failure(EErrorCode::ActorNotFound, Name);
+			}
+			Selected.AddUnique(Actor);
+		}
+		return TResult<TArray<AActor*>>::Success(MoveTemp(Selected));
 	}
 
 	auto FActorService::GetEditorWorld() -> UWorld* {
@@ -293,22 +1214,24 @@ namespace UnrealMCP {
 		return nullptr;
 	}
 
+	auto FActorService::NotifyActorTreeMoved(AActor* Actor) -> void {
+		FActorIndex::NotifyActorMoved(Actor);
+
+		// Attached actors follow their parent without an OnActorMoved of their own
+		TArray<AActor*> Attached;
+		Actor->GetAttachedActors(Attached, true, true);
+		for (AActor* Child : Attached) {
+			FActorIndex::NotifyActorMoved(Child);
+		}
+	}
+
 	auto FActorService::FindActorByName(const FString& ActorName) -> AActor* {
-		const UWorld* World = GetEditorWorld();
+		UWorld* World = GetEditorWorld();
 		if (!World) {
 			return nullptr;
 		}
 
-		TArray<AActor*> AllActors;
-		UGameplayStatics::GetAllActorsOfClass(World, AActor::StaticClass(), AllActors);
-
-		for (AActor* Actor : AllActors) {
-			if (Actor && Actor->GetName() == ActorName) {
-				return Actor;
-			}
-		}
-
-		return nullptr;
+		return FActorIndex::FindActor(World, ActorName);
 	}
 
 	auto FActorService::GetAvailableProperties(UClass* ActorClass) -> TArray<FString> {
@@ -320,12 +1243,8 @@ namespace UnrealMCP {
 		while (PropIt) {
 			FProperty* Property = *PropIt;
 			if (Property) {
-				// Only include settable property types
-				if (CastField<FBoolProperty>(Property) ||
-					CastField<FFloatProperty>(Property) ||
-					CastField<FIntProperty>(Property) ||
-					CastField<FStrProperty>(Property)) {
-
+				// Every type can be written; list what the details panel shows
+				if (Property->HasAnyPropertyFlags(CPF_Edit)) {
 					OutProperties.Add(Property->GetName());
 				}
 			}
@@ -367,4 +1286,34 @@ namespace UnrealMCP {
 		return Class;
 	}
 
+	auto FActorService::ResolveFilter(const FActorQueryFilter& Filter) -> TResult<FActorIndexQuery> {
+		FActorIndexQuery Query;
+
+		if (Filter.ClassName.IsSet()) {
+			UClass* Class = GetActorClassByName(Filter.ClassName.GetValue());
+			if (!Class || !Class->IsChildOf(AActor::StaticClass())) {
+				return TResult<FActorIndexQuery>::Failure(EErrorCode::InvalidActorClass, Filter.ClassName.GetValue());
+			}
+			Query.Class = Class;
+		}
+
+		for (const FString& Tag : Filter.Tags) {
+			Query.Tags.Add(FName(*Tag));
+		}
+
+		if (Filter.ComponentClassName.IsSet()) {
+			UClass* ComponentClass = FBlueprintService::ResolveComponentClass(Filter.ComponentClassName.GetValue());
+			if (!ComponentClass) {
+				return TResult<FActorIndexQuery>::Failure(EErrorCode::InvalidComponentType, Filter.ComponentClassName.GetValue());
+			}
+			Query.ComponentClass = ComponentClass;
+		}
+
+		if (Filter.Folder.IsSet()) {
+			Query.Folder = Filter.Folder->IsEmpty() ? NAME_None : FName(*Filter.Folder.GetValue());
+		}
+
+		return TResult<FActorIndexQuery>::Success(MoveTemp(Query));
+	}
+
 }
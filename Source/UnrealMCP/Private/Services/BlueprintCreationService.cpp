@@ -1,6 +1,7 @@
 ﻿#include "Services/BlueprintCreationService.h"
 #include "EditorAssetLibrary.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Core/BlueprintCompileCoordinator.h"
 #include "Core/CommonUtils.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
@@ -8,6 +9,7 @@
 #include "GameFramework/Actor.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/Pawn.h"
+#include "Kismet2/CompilerResultsLog.h"
 #include "Kismet2/KismetEditorUtilities.h"
 
 namespace UnrealMCP {
@@ -75,26 +77,113 @@ namespace UnrealMCP {
 		return TResult<UBlueprint*>::Success(NewBlueprint);
 	}
 
-	auto FBlueprintCreationService::CompileBlueprint(const FString& BlueprintName) -> FVoidResult {
+	auto FBlueprintCreationService::CompileBlueprint(const FString& BlueprintName,
+	                                                 const bool bProfile,
+	                                                 const bool bCollectGarbage) -> TResult<FBlueprintCompileReport> {
 		if (BlueprintName.IsEmpty()) {
-			return FVoidResult::Failure(EErrorCode::InvalidInput, TEXT("Blueprint name cannot be empty"));
+			return TResult<FBlueprintCompileReport>::Failure(EErrorCode::InvalidInput, TEXT("Blueprint name cannot be empty"));
 		}
 
 		UBlueprint* Blueprint = FCommonUtils::FindBlueprint(BlueprintName);
 		if (!Blueprint) {
-			return FVoidResult::Failure(EErrorCode::BlueprintNotFound, FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+			return TResult<FBlueprintCompileReport>::Failure(EErrorCode::BlueprintNotFound, FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
 		}
 
-		FKismetEditorUtilities::CompileBlueprint(Blueprint);
+		FCompilerResultsLog ResultsLog;
+		FBlueprintCompileReport Report;
+		if (bProfile) {
+			TArray<UBlueprint*> Dependents;
+			const FBlueprintCompileCoordinator::FCompilePhaseTimings Timings =
+				FBlueprintCompileCoordinator::CompileProfiled(Blueprint, ResultsLog, bCollectGarbage, Dependents);
+
+			Report = MakeCompileReport(Blueprint, ResultsLog);
+
+			FBlueprintCompileTimings& ReportTimings = Report.Timings.Emplace();
+			ReportTimings.SkeletonMs = Timings.SkeletonSeconds * 1000.0;
+			ReportTimings.CompileMs = Timings.CompileSeconds * 1000.0;
+			if (bCollectGarbage) {
+				ReportTimings.GarbageCollectionMs = Timings.GarbageCollectionSeconds * 1000.0;
+			}
+
+			for (const UBlueprint* Dependent : Dependents) {
+				Report.RecompiledDependents.Add(Dependent->GetName());
+			}
+		}
+		else {
+			// One full compile; profiling pays for a separate skeleton pass to time it
+			FBlueprintCompileCoordinator::CompileNow(Blueprint, EBlueprintCompileMode::Full, &ResultsLog);
+			if (bCollectGarbage) {
+				CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+			}
+
+			Report = MakeCompileReport(Blueprint, ResultsLog);
+		}
+
+		UE_LOG(
+			LogTemp,
+			Display,
+			TEXT("BlueprintCreationService: Compiled blueprint '%s' (%s)"),
+			*BlueprintName,
+			*Report.Status
+		);
+
+		return TResult<FBlueprintCompileReport>::Success(MoveTemp(Report));
+	}
+
+	auto FBlueprintCreationService::CompileBlueprints(const FCompileBlueprintsParams& Params) -> TResult<FCompileBlueprintsResult> {
+		if (Params.BlueprintNames.Num() == 0) {
+			return TResult<FCompileBlueprintsResult>::Failure(EErrorCode::InvalidInput, TEXT("No blueprints to compile"));
+		}
+
+		TArray<UBlueprint*> Blueprints;
+		TArray<FCompilerResultsLog> ResultsLogs;
+		Blueprints.Reserve(Params.BlueprintNames.Num());
+		ResultsLogs.SetNum(Params.BlueprintNames.Num());
+
+		TArray<FCompilerResultsLog*> ResultsLogPtrs;
+		for (int32 Index = 0; Index < Params.BlueprintNames.Num(); ++Index) {
+			UBlueprint* Blueprint = FCommonUtils::FindBlueprint(Params.BlueprintNames[Index]);
+			Blueprints.Add(Blueprint);
+
+			// Keep messages in the log for the report instead of echoing each one to the output log
+			ResultsLogs[Index].bSilentMode = true;
+			ResultsLogPtrs.Add(&ResultsLogs[Index]);
+		}
+
+		const double Seconds = FBlueprintCompileCoordinator::CompileBatch(Blueprints, ResultsLogPtrs);
+
+		FCompileBlueprintsResult Result;
+		Result.TotalTimeMs = Seconds * 1000.0;
+		Result.Reports.Reserve(Blueprints.Num());
+		for (int32 Index = 0; Index < Blueprints.Num(); ++Index) {
+			if (Blueprints[Index]) {
+				Result.Reports.Add(MakeCompileReport(Blueprints[Index], ResultsLogs[Index]));
+			}
+			else {
+				FBlueprintCompileReport& Report = Result.Reports.AddDefaulted_GetRef();
+				Report.BlueprintName = Params.BlueprintNames[Index];
+				Report.Status = TEXT("not_found");
+				Report.Errors.Add(FString::Printf(TEXT("Blueprint not found: %s"), *Params.BlueprintNames[Index]));
+			}
+		}
 
 		UE_LOG(
 			LogTemp,
 			Display,
-			TEXT("BlueprintCreationService: Compiled blueprint '%s'"),
-			*BlueprintName
+			TEXT("BlueprintCreationService: Compiled %d blueprint(s) in %.1f ms"),
+			Blueprints.Num(),
+			Result.TotalTimeMs
 		);
 
-		return FVoidResult::Success();
+		return TResult<FCompileBlueprintsResult>::Success(MoveTemp(Result));
+	}
+
+	auto FBlueprintCreationService::MakeCompileReport(const UBlueprint* Blueprint, const FCompilerResultsLog& ResultsLog) -> FBlueprintCompileReport {
+		FBlueprintCompileReport Report;
+		Report.BlueprintName = Blueprint->GetName();
+		Report.Status = FBlueprintCompileCoordinator::GetStatusName(Blueprint);
+		FBlueprintCompileCoordinator::CollectMessages(ResultsLog, Report.Errors, Report.Warnings);
+		return Report;
 	}
 
 	auto FBlueprintCreationService::ResolveParentClass(const FString& ParentClassName) -> UClass* {
@@ -4,10 +4,14 @@
 #include "K2Node_Event.h"
 #include "K2Node_InputAction.h"
 #include "K2Node_Self.h"
+#include "K2Node_Variable.h"
 #include "K2Node_VariableGet.h"
 #include "K2Node_VariableSet.h"
 #include "Camera/CameraActor.h"
 #include "Core/CommonUtils.h"
+#include "Core/GraphChangeJournal.h"
+#include "Core/GraphNodeIndex.h"
+#include "Core/PinLookupCache.h"
 #include "EdGraph/EdGraph.h"
 #include "EdGraph/EdGraphNode.h"
 #include "EdGraph/EdGraphPin.h"
@@ -15,10 +19,50 @@
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet2/BlueprintEditorUtils.h"
+#include "ScopedTransaction.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogBlueprintGraphService, Log, All);
 
 namespace UnrealMCP {
+	namespace {
+		/** What a node spec resolved to, gathered before the graph is touched */
+		struct FResolvedNodeSpec {
+			const UFunction* Function = nullptr;
+			UClass* EventSourceClass = nullptr;
+			UK2Node_Event* ExistingEvent = nullptr;
+		};
+
+		/** Member variables added since the last full compile only exist on the skeleton class */
+		auto FindMemberProperty(const UBlueprint* Blueprint, const FString& VariableName) -> const FProperty* {
+			const FName VarName(*VariableName);
+			if (Blueprint->SkeletonGeneratedClass) {
+				if (const FProperty* Property = FindFProperty<FProperty>(Blueprint->SkeletonGeneratedClass, VarName)) {
+					return Property;
+				}
+			}
+			return Blueprint->GeneratedClass ? FindFProperty<FProperty>(Blueprint->GeneratedClass, VarName) : nullptr;
+		}
+
+		/** Add a node without AddNode's per-node graph notification; the caller notifies once */
+		auto AddNodeSilently(UEdGraph* Graph, UEdGraphNode* Node, const FVector2D& Position) -> void {
+			Node->NodePosX = Position.X;
+			Node->NodePosY = Position.Y;
+			Node->SetFlags(RF_Transactional);
+			Graph->Nodes.Add(Node);
+			Node->CreateNewGuid();
+			Node->PostPlacedNewNode();
+			Node->AllocateDefaultPins();
+		}
+
+		auto RemoveCreatedNodes(UEdGraph* Graph, const TArray<UEdGraphNode*>& CreatedNodes) -> void {
+			for (UEdGraphNode* Node : CreatedNodes) {
+				Node->BreakAllNodeLinks();
+				Graph->Nodes.Remove(Node);
+				FPinLookupCache::Invalidate(Node);
+				Node->MarkAsGarbage();
+			}
+		}
+	}
 
 	auto FBlueprintGraphService::ConnectNodes(
 		const FString& BlueprintName,
@@ -38,25 +82,35 @@ namespace UnrealMCP {
 			return FVoidResult::Failure(EErrorCode::InvalidInput, TEXT("Target node ID cannot be empty"));
 		}
 
+		// Parse once and compare GUIDs directly instead of formatting every node's GUID
+		FGuid SourceGuid;
+		if (!FGuid::Parse(SourceNodeId, SourceGuid)) {
+			return FVoidResult::Failure(EErrorCode::InvalidInput, FString::Printf(TEXT("Invalid source node ID: %s"), *SourceNodeId));
+		}
+		FGuid TargetGuid;
+		if (!FGuid::Parse(TargetNodeId, TargetGuid)) {
+			return FVoidResult::Failure(EErrorCode::InvalidInput, FString::Printf(TEXT("Invalid target node ID: %s"), *TargetNodeId));
+		}
+
 		FString Error;
 		UBlueprint* Blueprint = FindBlueprint(BlueprintName, Error);
 		if (!Blueprint) {
 			return FVoidResult::Failure(Error);
 		}
 
-		UEdGraph* EventGraph = GetEventGraph(Blueprint, Error);
-		if (!EventGraph) {
-			return FVoidResult::Failure(Error);
-		}
-
-		UEdGraphNode* SourceNode = FindNodeByGuid(EventGraph, SourceNodeId);
-		UEdGraphNode* TargetNode = FindNodeByGuid(EventGraph, TargetNodeId);
+		UEdGraphNode* SourceNode = FGraphNodeIndex::FindNode(Blueprint, SourceGuid);
+		UEdGraphNode* TargetNode = FGraphNodeIndex::FindNode(Blueprint, TargetGuid);
 
 		if (!SourceNode || !TargetNode) {
 			return FVoidResult::Failure(EErrorCode::NodeNotFound, TEXT("Source or target node not found"));
 		}
 
-		if (FCommonUtils::ConnectGraphNodes(EventGraph, SourceNode, SourcePinName, TargetNode, TargetPinName)) {
+		UEdGraph* Graph = SourceNode->GetGraph();
+		if (TargetNode->GetGraph() != Graph) {
+			return FVoidResult::Failure(EErrorCode::NodeConnectionFailed, TEXT("Source and target nodes are in different graphs"));
+		}
+
+		if (FCommonUtils::ConnectGraphNodes(Graph, SourceNode, SourcePinName, TargetNode, TargetPinName)) {
 			FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
 			return FVoidResult::Success();
 		}
@@ -211,64 +265,9 @@ namespace UnrealMCP {
 		}
 
 		// Find the function
-		const UFunction* Function = nullptr;
+		const UFunction* Function = ResolveFunction(Blueprint, FunctionName, TargetClass);
 		UK2Node_CallFunction* FunctionNode = nullptr;
 
-		// Check if we have a target class specified
-		if (TargetClass.IsSet() && !TargetClass.GetValue().IsEmpty()) {
-			// Try to find the target class
-			const UClass* ClassPtr = nullptr;
-
-			// First try without a prefix
-			ClassPtr = FindFirstObject<UClass>(*TargetClass.GetValue(), EFindFirstObjectOptions::NativeFirst);
-
-			// If not found, try with U prefix
-			if (!ClassPtr && !TargetClass.GetValue().StartsWith(TEXT("U"))) {
-				const FString TargetWithPrefix = FString(TEXT("U")) + TargetClass.GetValue();
-				ClassPtr = FindFirstObject<UClass>(*TargetWithPrefix, EFindFirstObjectOptions::NativeFirst);
-			}
-
-			// Special case for UGameplayStatics and GameplayStatics
-			if (!ClassPtr && (TargetClass.GetValue() == TEXT("UGameplayStatics") || TargetClass.GetValue() == TEXT("GameplayStatics"))) {
-				ClassPtr = FindFirstObject<UClass>(TEXT("UGameplayStatics"), EFindFirstObjectOptions::NativeFirst);
-				if (!ClassPtr) {
-					ClassPtr = LoadObject<UClass>(nullptr, TEXT("/Script/Engine.GameplayStatics"));
-				}
-			}
-
-			if (ClassPtr) {
-				Function = ClassPtr->FindFunctionByName(*FunctionName);
-
-				// If PrintString not found, try some common alternatives
-				if (!Function && FunctionName == TEXT("PrintString")) {
-					Function = ClassPtr->FindFunctionByName(FName(TEXT("PrintString")));
-					if (!Function) {
-						// Try to find any function with "Print" in the name but make sure it's the right one
-						for (TFieldIterator<UFunction> It(ClassPtr); It; ++It) {
-							const UFunction* Func = *It;
-							if (Func->GetName().Contains(TEXT("Print")) && Func->GetName().Contains(TEXT("String"))) {
-								Function = Func;
-								break;
-							}
-						}
-					}
-				}
-			}
-		}
-
-		// If we still haven't found the function, try in the blueprint's class
-		if (!Function) {
-			Function = Blueprint->GeneratedClass->FindFunctionByName(*FunctionName);
-		}
-
-		// For PrintString, try to find it in KismetSystemLibrary as a last resort
-		if (!Function && FunctionName == TEXT("PrintString")) {
-			const UClass* KismetSystemLibrary = LoadObject<UClass>(nullptr, TEXT("/Script/Engine.KismetSystemLibrary"));
-			if (KismetSystemLibrary) {
-				Function = KismetSystemLibrary->FindFunctionByName(*FunctionName);
-			}
-		}
-
 		// Create the function call node if we found the function
 		if (Function) {
 			FunctionNode = FCommonUtils::CreateFunctionCallNode(EventGraph, Function, NodePosition);
@@ -333,6 +332,7 @@ namespace UnrealMCP {
 		GetComponentNode->PostPlacedNewNode();
 		GetComponentNode->AllocateDefaultPins();
 		GetComponentNode->ReconstructNode();
+		FPinLookupCache::Invalidate(GetComponentNode);
 
 		FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
 		return TResult<UK2Node_VariableGet*>::Success(GetComponentNode);
@@ -401,101 +401,458 @@ namespace UnrealMCP {
 		return TResult<UK2Node_InputAction*>::Success(InputActionNode);
 	}
 
-	auto FBlueprintGraphService::FindNodes(
-		const FString& BlueprintName,
-		const FString& NodeType,
-		const TOptional<FString>& EventName,
-		TArray<FString>& OutNodeGuids
-	) -> FVoidResult {
-		// Validate input parameters
-		if (BlueprintName.IsEmpty()) {
-			return FVoidResult::Failure(EErrorCode::InvalidInput, TEXT("Blueprint name cannot be empty"));
-		}
-		if (NodeType.IsEmpty()) {
-			return FVoidResult::Failure(EErrorCode::InvalidInput, TEXT("Node type cannot be empty"));
+	auto FBlueprintGraphService::BuildGraph(const FBuildBlueprintGraphParams& Params) -> TResult<FBuildBlueprintGraphResult> {
+		if (Params.BlueprintName.IsEmpty()) {
+			return TResult<FBuildBlueprintGraphResult>::Failure(EErrorCode::InvalidInput, TEXT("Blueprint name cannot be empty"));
 		}
 
 		FString Error;
-		UBlueprint* Blueprint = FindBlueprint(BlueprintName, Error);
+		UBlueprint* Blueprint = FindBlueprint(Params.BlueprintName, Error);
 		if (!Blueprint) {
-			return FVoidResult::Failure(Error);
+			return TResult<FBuildBlueprintGraphResult>::Failure(EErrorCode::BlueprintNotFound, Error);
 		}
 
 		UEdGraph* EventGraph = GetEventGraph(Blueprint, Error);
 		if (!EventGraph) {
-			return FVoidResult::Failure(Error);
+			return TResult<FBuildBlueprintGraphResult>::Failure(Error);
 		}
 
-		// Performance logging
-		const double StartTime = FPlatformTime::Seconds();
-		int32 NodeCount = 0;
-		UE_LOG(LogBlueprintGraphService, Display, TEXT("Starting node search: type='%s', blueprint='%s', total nodes=%d"),
-		       *NodeType, *BlueprintName, EventGraph->Nodes.Num());
-
-		if (NodeType == TEXT("Event")) {
-			if (!EventName.IsSet()) {
-				return FVoidResult::Failure(EErrorCode::InvalidInput, TEXT("Missing 'event_name' parameter for Event node search"));
-			}
+		// Resolve every node spec before creating anything
+		TArray<FResolvedNodeSpec> Resolved;
+		Resolved.SetNum(Params.Nodes.Num());
+		TMap<FName, int32> EventSpecsByFunction;
+		for (int32 Index = 0; Index < Params.Nodes.Num(); ++Index) {
+			const FGraphNodeSpec& Spec = Params.Nodes[Index];
+			FResolvedNodeSpec& Out = Resolved[Index];
+
+			switch (Spec.Kind) {
+				case EGraphNodeKind::Event: {
+					const UFunction* EventFunction = FCommonUtils::ResolveEventFunction(Blueprint, Spec.Name, Out.EventSourceClass);
+					if (!EventFunction) {
+						return TResult<FBuildBlueprintGraphResult>::Failure(EErrorCode::FunctionNotFound, FString::Printf(
+							TEXT("Node '%s': event '%s' not found in blueprint '%s' class hierarchy"), *Spec.LocalId, *Spec.Name, *Params.BlueprintName));
+					}
+					Out.Function = EventFunction;
 
-			const FString EventNameStr = EventName.GetValue();
-			const FName TargetEventName = FName(*EventNameStr);
-			// Also try with "Receive" prefix for common events (BeginPlay -> ReceiveBeginPlay)
-			const FName ReceiveEventName = EventNameStr.StartsWith(TEXT("Receive"))
-				? TargetEventName
-				: FName(*FString::Printf(TEXT("Receive%s"), *EventNameStr));
+					// An event can only appear once per graph
+					if (EventSpecsByFunction.Contains(EventFunction->GetFName())) {
+						return TResult<FBuildBlueprintGraphResult>::Failure(EErrorCode::InvalidInput, FString::Printf(
+							TEXT("Node '%s': event '%s' is already declared by another node"), *Spec.LocalId, *Spec.Name));
+					}
+					EventSpecsByFunction.Add(EventFunction->GetFName(), Index);
 
-			for (UEdGraphNode* Node : EventGraph->Nodes) {
-				NodeCount++;
-				// Early exit for large graphs to prevent timeout
-				if (NodeCount > 10000) {
-					UE_LOG(LogBlueprintGraphService, Warning, TEXT("Node search truncated at 10000 nodes to prevent timeout"));
+					for (UEdGraphNode* Node : EventGraph->Nodes) {
+						if (UK2Node_Event* ExistingEventNode = Cast<UK2Node_Event>(Node);
+							ExistingEventNode && ExistingEventNode->EventReference.GetMemberName() == EventFunction->GetFName()) {
+							Out.ExistingEvent = ExistingEventNode;
+							break;
+						}
+					}
 					break;
 				}
-
-				const UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node);
-				if (EventNode) {
-					const FName NodeEventName = EventNode->EventReference.GetMemberName();
-					if (NodeEventName == TargetEventName || NodeEventName == ReceiveEventName) {
-						OutNodeGuids.Add(EventNode->NodeGuid.ToString());
+				case EGraphNodeKind::FunctionCall:
+					Out.Function = ResolveFunction(Blueprint, Spec.Name, Spec.Target);
+					if (!Out.Function) {
+						return TResult<FBuildBlueprintGraphResult>::Failure(EErrorCode::FunctionNotFound, FString::Printf(
+							TEXT("Node '%s': function not found: %s in target %s"),
+							*Spec.LocalId,
+							*Spec.Name,
+							Spec.Target.IsSet() ? *Spec.Target.GetValue() : TEXT("Blueprint")));
 					}
-				}
+					break;
+				case EGraphNodeKind::VariableGet:
+				case EGraphNodeKind::VariableSet:
+					if (!FindMemberProperty(Blueprint, Spec.Name)) {
+						return TResult<FBuildBlueprintGraphResult>::Failure(EErrorCode::VariableNotFound, FString::Printf(
+							TEXT("Node '%s': variable '%s' not found"), *Spec.LocalId, *Spec.Name));
+					}
+					break;
+				case EGraphNodeKind::Self:
+				case EGraphNodeKind::InputAction:
+				case EGraphNodeKind::ComponentReference:
+					break;
 			}
 		}
-		else if (NodeType == TEXT("Function")) {
-			for (UEdGraphNode* Node : EventGraph->Nodes) {
-				NodeCount++;
-				if (NodeCount > 10000) {
-					UE_LOG(LogBlueprintGraphService, Warning, TEXT("Node search truncated at 10000 nodes to prevent timeout"));
+
+		FScopedTransaction Transaction(FText::FromString(TEXT("Build Blueprint Graph")));
+		Blueprint->Modify();
+		EventGraph->Modify();
+
+		// Create the nodes; events that already exist in the graph are reused
+		TMap<FString, UEdGraphNode*> NodesByLocalId;
+		TArray<UEdGraphNode*> CreatedNodes;
+		CreatedNodes.Reserve(Params.Nodes.Num());
+		for (int32 Index = 0; Index < Params.Nodes.Num(); ++Index) {
+			const FGraphNodeSpec& Spec = Params.Nodes[Index];
+			const FResolvedNodeSpec& Res = Resolved[Index];
+
+			UEdGraphNode* Node = nullptr;
+			switch (Spec.Kind) {
+				case EGraphNodeKind::Event: {
+					if (Res.ExistingEvent) {
+						NodesByLocalId.Add(Spec.LocalId, Res.ExistingEvent);
+						continue;
+					}
+					UK2Node_Event* EventNode = NewObject<UK2Node_Event>(EventGraph);
+					EventNode->EventReference.SetExternalMember(Res.Function->GetFName(), Res.EventSourceClass);
+					Node = EventNode;
+					break;
+				}
+				case EGraphNodeKind::FunctionCall: {
+					UK2Node_CallFunction* FunctionNode = NewObject<UK2Node_CallFunction>(EventGraph);
+					FunctionNode->SetFromFunction(Res.Function);
+					Node = FunctionNode;
+					break;
+				}
+				case EGraphNodeKind::VariableGet:
+				case EGraphNodeKind::ComponentReference: {
+					UK2Node_VariableGet* GetNode = NewObject<UK2Node_VariableGet>(EventGraph);
+					GetNode->VariableReference.SetSelfMember(FName(*Spec.Name));
+					Node = GetNode;
 					break;
 				}
+				case EGraphNodeKind::VariableSet: {
+					UK2Node_VariableSet* SetNode = NewObject<UK2Node_VariableSet>(EventGraph);
+					SetNode->VariableReference.SetSelfMember(FName(*Spec.Name));
+					Node = SetNode;
+					break;
+				}
+				case EGraphNodeKind::Self:
+					Node = NewObject<UK2Node_Self>(EventGraph);
+					break;
+				case EGraphNodeKind::InputAction: {
+					UK2Node_InputAction* InputActionNode = NewObject<UK2Node_InputAction>(EventGraph);
+					InputActionNode->InputActionName = FName(*Spec.Name);
+					Node = InputActionNode;
+					break;
+				}
+			}
 
-				if (const UK2Node_CallFunction* FunctionNode = Cast<UK2Node_CallFunction>(Node)) {
-					OutNodeGuids.Add(FunctionNode->NodeGuid.ToString());
+			AddNodeSilently(EventGraph, Node, Spec.Position);
+			CreatedNodes.Add(Node);
+			NodesByLocalId.Add(Spec.LocalId, Node);
+
+			if (Spec.Kind == EGraphNodeKind::FunctionCall && Spec.Params.IsValid()) {
+				const FVoidResult ParamResult = SetFunctionParameters(CastChecked<UK2Node_CallFunction>(Node), EventGraph, Spec.Params);
+				if (ParamResult.IsFailure()) {
+					RemoveCreatedNodes(EventGraph, CreatedNodes);
+					Transaction.Cancel();
+					return TResult<FBuildBlueprintGraphResult>::Failure(ParamResult.GetError().Code,
+						FString::Printf(TEXT("Node '%s': %s"), *Spec.LocalId, *ParamResult.GetError().Context));
 				}
 			}
 		}
-		else if (NodeType == TEXT("Variable")) {
-			for (UEdGraphNode* Node : EventGraph->Nodes) {
-				NodeCount++;
-				if (NodeCount > 10000) {
-					UE_LOG(LogBlueprintGraphService, Warning, TEXT("Node search truncated at 10000 nodes to prevent timeout"));
-					break;
+
+		// Resolve every link endpoint before making any link, so a bad link leaves no partial wiring
+		const UEdGraphSchema* Schema = EventGraph->GetSchema();
+		TArray<TPair<UEdGraphPin*, UEdGraphPin*>> PinPairs;
+		PinPairs.Reserve(Params.Links.Num());
+		for (int32 Index = 0; Index < Params.Links.Num(); ++Index) {
+			const FGraphLinkSpec& Link = Params.Links[Index];
+
+			auto ResolveEndpoint = [&](const FString& Endpoint) -> UEdGraphNode* {
+				if (UEdGraphNode* const* Local = NodesByLocalId.Find(Endpoint)) {
+					return *Local;
+				}
+				FGuid NodeGuid;
+				return FGuid::Parse(Endpoint, NodeGuid) ? FGraphNodeIndex::FindNode(EventGraph, NodeGuid) : nullptr;
+			};
+
+			UEdGraphNode* SourceNode = ResolveEndpoint(Link.SourceNode);
+			UEdGraphNode* TargetNode = ResolveEndpoint(Link.TargetNode);
+			UEdGraphPin* SourcePin = SourceNode ? FCommonUtils::FindPin(SourceNode, Link.SourcePin, EGPD_Output) : nullptr;
+			UEdGraphPin* TargetPin = TargetNode ? FCommonUtils::FindPin(TargetNode, Link.TargetPin, EGPD_Input) : nullptr;
+
+			if (!SourcePin || !TargetPin) {
+				RemoveCreatedNodes(EventGraph, CreatedNodes);
+				Transaction.Cancel();
+
+				const FString Reason = !SourceNode
+					? FString::Printf(TEXT("unknown source node '%s'"), *Link.SourceNode)
+					: !TargetNode
+					? FString::Printf(TEXT("unknown target node '%s'"), *Link.TargetNode)
+					: !SourcePin
+					? FString::Printf(TEXT("no output pin '%s' on '%s'"), *Link.SourcePin, *Link.SourceNode)
+					: FString::Printf(TEXT("no input pin '%s' on '%s'"), *Link.TargetPin, *Link.TargetNode);
+				return TResult<FBuildBlueprintGraphResult>::Failure(
+					!SourceNode || !TargetNode ? EErrorCode::NodeNotFound : EErrorCode::NodeConnectionFailed,
+					FString::Printf(TEXT("Link %d: %s"), Index, *Reason));
+			}
+
+			if (const FPinConnectionResponse Response = Schema->CanCreateConnection(SourcePin, TargetPin);
+				Response.Response == CONNECT_RESPONSE_DISALLOW) {
+				RemoveCreatedNodes(EventGraph, CreatedNodes);
+				Transaction.Cancel();
+				return TResult<FBuildBlueprintGraphResult>::Failure(
+					EErrorCode::NodeConnectionFailed,
+					FString::Printf(TEXT("Link %d: %s"), Index, *Response.Message.ToString()));
+			}
+
+			PinPairs.Emplace(SourcePin, TargetPin);
+		}
+
+		// The schema breaks existing links only on pins that take a single connection, so several
+		// links into one exec input all survive
+		TArray<bool> Converted;
+		Converted.Init(false, PinPairs.Num());
+		for (int32 Index = 0; Index < PinPairs.Num(); ++Index) {
+			const TPair<UEdGraphPin*, UEdGraphPin*>& Pair = PinPairs[Index];
+			const bool bConversion = Schema->CanCreateConnection(Pair.Key, Pair.Value).Response == CONNECT_RESPONSE_MAKE_WITH_CONVERSION_NODE;
+			Converted[Index] = Schema->TryCreateConnection(Pair.Key, Pair.Value) && bConversion;
+		}
+
+		// A later link into a single-connection pin replaces an earlier one; count what is wired now
+		int32 LinkCount = 0;
+		for (int32 Index = 0; Index < PinPairs.Num(); ++Index) {
+			const TPair<UEdGraphPin*, UEdGraphPin*>& Pair = PinPairs[Index];
+			if (Pair.Key->LinkedTo.Contains(Pair.Value) || (Converted[Index] && Pair.Value->LinkedTo.Num() > 0)) {
+				++LinkCount;
+			}
+		}
+
+		// Reused events move only once the build can no longer fail
+		FBuildBlueprintGraphResult Result;
+		Result.NodeIds.Reserve(Params.Nodes.Num());
+		for (int32 Index = 0; Index < Params.Nodes.Num(); ++Index) {
+			const FGraphNodeSpec& Spec = Params.Nodes[Index];
+			UEdGraphNode* Node = NodesByLocalId.FindChecked(Spec.LocalId);
+			if (Resolved[Index].ExistingEvent) {
+				Node->Modify();
+				Node->NodePosX = Spec.Position.X;
+				Node->NodePosY = Spec.Position.Y;
+			}
+			Result.NodeIds.Emplace(Spec.LocalId, Node->NodeGuid);
+		}
+		Result.LinkCount = LinkCount;
+
+		EventGraph->NotifyGraphChanged();
+		FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+
+		UE_LOG(LogBlueprintGraphService, Display, TEXT("Built graph in '%s': %d node(s) created, %d reused, %d link(s)"),
+		       *Params.BlueprintName, CreatedNodes.Num(), Params.Nodes.Num() - CreatedNodes.Num(), LinkCount);
+
+		return TResult<FBuildBlueprintGraphResult>::Success(MoveTemp(Result));
+	}
+
+	auto FBlueprintGraphService::QueryNodes(const FBlueprintNodeQuery& Query) -> TResult<FBlueprintNodeQueryResult> {
+		if (Query.BlueprintName.IsEmpty()) {
+			return TResult<FBlueprintNodeQueryResult>::Failure(EErrorCode::InvalidInput, TEXT("Blueprint name cannot be empty"));
+		}
+
+		FString Error;
+		UBlueprint* Blueprint = FindBlueprint(Query.BlueprintName, Error);
+		if (!Blueprint) {
+			return TResult<FBlueprintNodeQueryResult>::Failure(Error);
+		}
+
+		TArray<const UClass*> NodeClasses;
+		for (const FString& ClassName : Query.NodeClasses) {
+			const UClass* NodeClass = FindFirstObject<UClass>(*ClassName, EFindFirstObjectOptions::NativeFirst);
+			if (!NodeClass && !ClassName.StartsWith(TEXT("K2Node_"))) {
+				NodeClass = FindFirstObject<UClass>(*(TEXT("K2Node_") + ClassName), EFindFirstObjectOptions::NativeFirst);
+			}
+			if (!NodeClass || !NodeClass->IsChildOf(UEdGraphNode::StaticClass())) {
+				return TResult<FBlueprintNodeQueryResult>::Failure(EErrorCode::InvalidInput,
+					FString::Printf(TEXT("Unknown node class '%s'"), *ClassName));
+			}
+			NodeClasses.Add(NodeClass);
+		}
+
+		int32 StartGraph = 0;
+		int32 StartNode = 0;
+		if (!Query.Cursor.IsEmpty()) {
+			FString GraphPart, NodePart;
+			if (!Query.Cursor.Split(TEXT(":"), &GraphPart, &NodePart) || !GraphPart.IsNumeric() || !NodePart.IsNumeric()) {
+				return TResult<FBlueprintNodeQueryResult>::Failure(EErrorCode::InvalidInput,
+					FString::Printf(TEXT("Invalid cursor '%s'"), *Query.Cursor));
+			}
+			StartGraph = FCString::Atoi(*GraphPart);
+			StartNode = FCString::Atoi(*NodePart);
+		}
+
+		FBlueprintNodeQueryResult Result;
+		Result.bIncludePins = Query.bIncludePins;
+		Result.bIncludeLinks = Query.bIncludeLinks;
+		Result.bIncludeTitle = Query.bIncludeTitle;
+
+		// A name that was never interned cannot be on any node, so the query cannot match
+		const auto FindName = [](const TOptional<FString>& Name, FName& OutName) -> bool {
+			if (!Name.IsSet()) {
+				return true;
+			}
+			OutName = FName(*Name.GetValue(), FNAME_Find);
+			return !OutName.IsNone();
+		};
+
+		FName GraphName, FunctionName, VariableName, PinType;
+		if (!FindName(Query.GraphName, GraphName) || !FindName(Query.FunctionName, FunctionName)
+			|| !FindName(Query.VariableName, VariableName) || !FindName(Query.PinType, PinType)) {
+			return TResult<FBlueprintNodeQueryResult>::Success(MoveTemp(Result));
+		}
+
+		// Also accept the "Receive" prefixed form of native events (BeginPlay -> ReceiveBeginPlay)
+		FName ReceiveFunctionName = FunctionName;
+		if (Query.FunctionName.IsSet() && !Query.FunctionName->StartsWith(TEXT("Receive"))) {
+			const FName ReceiveName(*(TEXT("Receive") + Query.FunctionName.GetValue()), FNAME_Find);
+			if (!ReceiveName.IsNone()) {
+				ReceiveFunctionName = ReceiveName;
+			}
+		}
+
+		const auto MatchesNode = [&](const UEdGraphNode* Node) -> bool {
+			if (NodeClasses.Num() > 0) {
+				const UClass* Class = Node->GetClass();
+				if (!NodeClasses.ContainsByPredicate([Class](const UClass* NodeClass) { return Class->IsChildOf(NodeClass); })) {
+					return false;
+				}
+			}
+
+			if (Query.Bounds.IsSet() && !Query.Bounds->IsInside(FVector2D(Node->NodePosX, Node->NodePosY))) {
+				return false;
+			}
+
+			if (Query.FunctionName.IsSet()) {
+				FName NodeFunction;
+				if (const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node)) {
+					NodeFunction = CallNode->FunctionReference.GetMemberName();
+				}
+				else if (const UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node)) {
+					NodeFunction = EventNode->CustomFunctionName.IsNone()
+						               ? EventNode->EventReference.GetMemberName()
+						               : EventNode->CustomFunctionName;
+				}
+				if (NodeFunction != FunctionName && NodeFunction != ReceiveFunctionName) {
+					return false;
+				}
+			}
+
+			if (Query.VariableName.IsSet()) {
+				const UK2Node_Variable* VariableNode = Cast<UK2Node_Variable>(Node);
+				if (!VariableNode || VariableNode->VariableReference.GetMemberName() != VariableName) {
+					return false;
+				}
+			}
+
+			if (Query.PinType.IsSet() || Query.bConnected.IsSet()) {
+				bool bHasPinType = !Query.PinType.IsSet();
+				bool bHasLink = false;
+				for (const UEdGraphPin* Pin : Node->Pins) {
+					if (!Pin) {
+						continue;
+					}
+					bHasLink |= Pin->LinkedTo.Num() > 0;
+					bHasPinType |= Pin->PinType.PinCategory == PinType
+						|| (Pin->PinType.PinSubCategoryObject.IsValid() && Pin->PinType.PinSubCategoryObject->GetFName() == PinType);
+				}
+				if (!bHasPinType || (Query.bConnected.IsSet() && bHasLink != Query.bConnected.GetValue())) {
+					return false;
+				}
+			}
+
+			return true;
+		};
+
+		// GetAllGraphs walks ubergraph pages, function, delegate and macro graphs (with their subgraphs) in a fixed order
+		TArray<UEdGraph*> Graphs;
+		Blueprint->GetAllGraphs(Graphs);
+
+		for (int32 GraphIndex = StartGraph; GraphIndex < Graphs.Num() && !Result.NextCursor.IsSet(); ++GraphIndex) {
+			const UEdGraph* Graph = Graphs[GraphIndex];
+			if (!Graph || (Query.GraphName.IsSet() && Graph->GetFName() != GraphName)) {
+				continue;
+			}
+
+			const int32 FirstNode = GraphIndex == StartGraph ? StartNode : 0;
+			for (int32 NodeIndex = FirstNode; NodeIndex < Graph->Nodes.Num(); ++NodeIndex) {
+				UEdGraphNode* Node = Graph->Nodes[NodeIndex];
+				if (!Node) {
+					continue;
 				}
+				++Result.ScannedCount;
 
-				if (Cast<UK2Node_VariableGet>(Node) || Cast<UK2Node_VariableSet>(Node)) {
-					OutNodeGuids.Add(Node->NodeGuid.ToString());
+				if (!MatchesNode(Node)) {
+					continue;
+				}
+				if (Result.Nodes.Num() == Query.Limit) {
+					Result.NextCursor = FString::Printf(TEXT("%d:%d"), GraphIndex, NodeIndex);
+					break;
 				}
+				Result.Nodes.Add(Node);
 			}
 		}
-		else {
+
+		UE_LOG(LogBlueprintGraphService, Verbose, TEXT("Node query on '%s': %d match(es), %d node(s) scanned%s"),
+		       *Query.BlueprintName, Result.Nodes.Num(), Result.ScannedCount,
+		       Result.NextCursor.IsSet() ? TEXT(", more available") : TEXT(""));
+
+		return TResult<FBlueprintNodeQueryResult>::Success(MoveTemp(Result));
+	}
+
+	auto FBlueprintGraphService::ExportGraph(const FExportBlueprintGraphParams& Params) -> TResult<FBlueprintGraphExport> {
+		if (Params.BlueprintName.IsEmpty()) {
+			return TResult<FBlueprintGraphExport>::Failure(EErrorCode::InvalidInput, TEXT("Blueprint name cannot be empty"));
+		}
+
+		FString Error;
+		UBlueprint* Blueprint = FindBlueprint(Params.BlueprintName, Error);
+		if (!Blueprint) {
+			return TResult<FBlueprintGraphExport>::Failure(Error);
+		}
+
+		TArray<UEdGraph*> Graphs;
+		Blueprint->GetAllGraphs(Graphs);
+
+		FBlueprintGraphExport Export;
+		for (UEdGraph* Graph : Graphs) {
+			if (!Graph || (Params.GraphName.IsSet() && Graph->GetName() != Params.GraphName.GetValue())) {
+				continue;
+			}
+			FBlueprintGraphExport::FGraph& Entry = Export.Graphs.AddDefaulted_GetRef();
+			Entry.Graph = Graph;
+			FGraphChangeJournal::GetChanges(Graph, Params.Since, Entry.Changes);
+		}
+
+		if (Params.GraphName.IsSet() && Export.Graphs.IsEmpty()) {
+			return TResult<FBlueprintGraphExport>::Failure(EErrorCode::InvalidInput,
+				FString::Printf(TEXT("Graph '%s' not found in blueprint '%s'"), *Params.GraphName.GetValue(), *Params.BlueprintName));
+		}
+
+		return TResult<FBlueprintGraphExport>::Success(MoveTemp(Export));
+	}
+
+	auto FBlueprintGraphService::FindNodes(
+		const FString& BlueprintName,
+		const FString& NodeType,
+		const TOptional<FString>& EventName,
+		TArray<FString>& OutNodeGuids
+	) -> FVoidResult {
+		if (NodeType.IsEmpty()) {
+			return FVoidResult::Failure(EErrorCode::InvalidInput, TEXT("Node type cannot be empty"));
+		}
+
+		FBlueprintNodeQuery Query;
+		Query.BlueprintName = BlueprintName;
+		Query.Limit = MAX_int32;
+		if (!FBlueprintNodeQuery::NodeClassesForType(NodeType, Query.NodeClasses)) {
 			return FVoidResult::Failure(EErrorCode::InvalidInput,
 				FString::Printf(TEXT("Unsupported node type '%s'. Supported types: Event, Function, Variable"), *NodeType));
 		}
 
-		const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
-		UE_LOG(LogBlueprintGraphService, Display, TEXT("Node search completed: found %d nodes, searched %d nodes in %.3f seconds"),
-		       OutNodeGuids.Num(), NodeCount, ElapsedTime);
+		if (NodeType == TEXT("Event")) {
+			if (!EventName.IsSet()) {
+				return FVoidResult::Failure(EErrorCode::InvalidInput, TEXT("Missing 'event_name' parameter for Event node search"));
+			}
+			Query.FunctionName = EventName;
+		}
+
+		const TResult<FBlueprintNodeQueryResult> Result = QueryNodes(Query);
+		if (Result.IsFailure()) {
+			return FVoidResult::Failure(Result.GetError());
+		}
 
+		for (const UEdGraphNode* Node : Result.GetValue().Nodes) {
+			OutNodeGuids.Add(Node->NodeGuid.ToString());
+		}
 		return FVoidResult::Success();
 	}
 
@@ -561,13 +918,69 @@ namespace UnrealMCP {
 		return EventGraph;
 	}
 
-	auto FBlueprintGraphService::FindNodeByGuid(UEdGraph* Graph, const FString& NodeGuid) -> UEdGraphNode* {
-		for (UEdGraphNode* Node : Graph->Nodes) {
-			if (Node->NodeGuid.ToString() == NodeGuid) {
-				return Node;
+	auto FBlueprintGraphService::ResolveFunction(
+		const UBlueprint* Blueprint,
+		const FString& FunctionName,
+		const TOptional<FString>& TargetClass
+	) -> const UFunction* {
+		const UFunction* Function = nullptr;
+
+		// Check if we have a target class specified
+		if (TargetClass.IsSet() && !TargetClass.GetValue().IsEmpty()) {
+			// Try to find the target class
+			const UClass* ClassPtr = nullptr;
+
+			// First try without a prefix
+			ClassPtr = FindFirstObject<UClass>(*TargetClass.GetValue(), EFindFirstObjectOptions::NativeFirst);
+
+			// If not found, try with U prefix
+			if (!ClassPtr && !TargetClass.GetValue().StartsWith(TEXT("U"))) {
+				const FString TargetWithPrefix = FString(TEXT("U")) + TargetClass.GetValue();
+				ClassPtr = FindFirstObject<UClass>(*TargetWithPrefix, EFindFirstObjectOptions::NativeFirst);
+			}
+
+			// Special case for UGameplayStatics and GameplayStatics
+			if (!ClassPtr && (TargetClass.GetValue() == TEXT("UGameplayStatics") || TargetClass.GetValue() == TEXT("GameplayStatics"))) {
+				ClassPtr = FindFirstObject<UClass>(TEXT("UGameplayStatics"), EFindFirstObjectOptions::NativeFirst);
+				if (!ClassPtr) {
+					ClassPtr = LoadObject<UClass>(nullptr, TEXT("/Script/Engine.GameplayStatics"));
+				}
+			}
+
+			if (ClassPtr) {
+				Function = ClassPtr->FindFunctionByName(*FunctionName);
+
+				// If PrintString not found, try some common alternatives
+				if (!Function && FunctionName == TEXT("PrintString")) {
+					Function = ClassPtr->FindFunctionByName(FName(TEXT("PrintString")));
+					if (!Function) {
+						// Try to find any function with "Print" in the name but make sure it's the right one
+						for (TFieldIterator<UFunction> It(ClassPtr); It; ++It) {
+							const UFunction* Func = *It;
+							if (Func->GetName().Contains(TEXT("Print")) && Func->GetName().Contains(TEXT("String"))) {
+								Function = Func;
+								break;
+							}
+						}
+					}
+				}
 			}
 		}
-		return nullptr;
+
+		// If we still haven't found the function, try in the blueprint's class
+		if (!Function && Blueprint->GeneratedClass) {
+			Function = Blueprint->GeneratedClass->FindFunctionByName(*FunctionName);
+		}
+
+		// For PrintString, try to find it in KismetSystemLibrary as a last resort
+		if (!Function && FunctionName == TEXT("PrintString")) {
+			const UClass* KismetSystemLibrary = LoadObject<UClass>(nullptr, TEXT("/Script/Engine.KismetSystemLibrary"));
+			if (KismetSystemLibrary) {
+				Function = KismetSystemLibrary->FindFunctionByName(*FunctionName);
+			}
+		}
+
+		return Function;
 	}
 
 	auto FBlueprintGraphService::SetFunctionParameters(
@@ -1,5 +1,7 @@
 ﻿#include "Services/BlueprintIntrospectionService.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Core/BlueprintCompileCoordinator.h"
+#include "Core/BlueprintSearchIndex.h"
 #include "Components/LightComponent.h"
 #include "Components/PrimitiveComponent.h"
 #include "Components/SceneComponent.h"
@@ -46,6 +48,50 @@ namespace UnrealMCP {
 		return Blueprint != nullptr;
 	}
 
+	auto FBlueprintIntrospectionService::SearchBlueprints(
+		const FSearchBlueprintsParams& Params
+	) -> TResult<FSearchBlueprintsResult> {
+		FSearchBlueprintsResult Result;
+		Result.TotalMatches = FBlueprintSearchIndex::Search(Params.Name, Params.Kind, Params.Path, Params.Limit, Result.Hits);
+		Result.IndexedBlueprints = FBlueprintSearchIndex::Num();
+		return TResult<FSearchBlueprintsResult>::Success(MoveTemp(Result));
+	}
+
+	auto FBlueprintIntrospectionService::IndexBlueprints(
+		const FIndexBlueprintsParams& Params
+	) -> TResult<FIndexBlueprintsResult> {
+		const IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+		FARFilter Filter;
+		Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+		Filter.PackagePaths.Add(FName(*Params.Path));
+		Filter.bRecursivePaths = Params.bRecursive;
+		Filter.bRecursiveClasses = true;
+
+		TArray<FAssetData> AssetDataList;
+		AssetRegistry.GetAssets(Filter, AssetDataList);
+
+		FIndexBlueprintsResult Result;
+		for (const FAssetData& AssetData : AssetDataList) {
+			if (Params.bOnlyMissing && FBlueprintSearchIndex::IsIndexed(AssetData.GetObjectPathString())) {
+				++Result.SkippedCount;
+				continue;
+			}
+
+			const UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.GetAsset());
+			if (!Blueprint) {
+				++Result.SkippedCount;
+				continue;
+			}
+			FBlueprintSearchIndex::IndexBlueprint(
+				Blueprint, FBlueprintSearchIndex::GetPackageTimestamp(AssetData.PackageName.ToString()));
+			++Result.IndexedCount;
+		}
+
+		Result.IndexedBlueprints = FBlueprintSearchIndex::Num();
+		return TResult<FIndexBlueprintsResult>::Success(MoveTemp(Result));
+	}
+
 	auto FBlueprintIntrospectionService::GetBlueprintInfo(
 		const FString& BlueprintName,
 		TMap<FString, FString>& OutInfo
@@ -536,8 +582,8 @@ namespace UnrealMCP {
 		// Mark the blueprint as modified
 		FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
 
-		// Compile the blueprint
-		FKismetEditorUtilities::CompileBlueprint(Blueprint);
+		// Queue a compile; consecutive edits share one
+		FBlueprintCompileCoordinator::RequestCompile(Blueprint);
 
 		// Create result
 		FRemoveComponentResult Result;
@@ -604,8 +650,8 @@ namespace UnrealMCP {
 		// Mark the blueprint as modified
 		FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
 
-		// Compile the blueprint
-		FKismetEditorUtilities::CompileBlueprint(Blueprint);
+		// Queue a compile; consecutive edits share one
+		FBlueprintCompileCoordinator::RequestCompile(Blueprint);
 
 		// Create result
 		FRenameComponentResult Result;
@@ -3,7 +3,9 @@
 #include "EdGraphSchema_K2.h"
 #include "K2Node_FunctionEntry.h"
 #include "K2Node_FunctionResult.h"
+#include "Core/BlueprintCompileCoordinator.h"
 #include "Core/CommonUtils.h"
+#include "Core/PinLookupCache.h"
 #include "EdGraph/EdGraph.h"
 #include "Engine/Blueprint.h"
 #include "Engine/Blueprint.h"
@@ -61,8 +63,8 @@ namespace UnrealMCP {
 		// Mark the blueprint as modified
 		FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
 
-		// Compile the blueprint
-		FKismetEditorUtilities::CompileBlueprint(Blueprint);
+		// Queue a compile; consecutive edits share one
+		FBlueprintCompileCoordinator::RequestCompile(Blueprint);
 
 		return TResult<FString>::Success(FunctionName);
 	}
@@ -100,8 +102,8 @@ namespace UnrealMCP {
 		// Mark the blueprint as modified
 		FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
 
-		// Compile the blueprint
-		FKismetEditorUtilities::CompileBlueprint(Blueprint);
+		// Queue a compile; consecutive edits share one
+		FBlueprintCompileCoordinator::RequestCompile(Blueprint);
 
 		return FVoidResult::Success();
 	}
@@ -173,12 +175,13 @@ namespace UnrealMCP {
 
 		EntryNode->UserDefinedPins.Add(NewParam);
 		EntryNode->ReconstructNode();
+		FPinLookupCache::Invalidate(EntryNode);
 
 		// Mark the blueprint as modified
 		FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
 
-		// Compile the blueprint
-		FKismetEditorUtilities::CompileBlueprint(Blueprint);
+		// Queue a compile; consecutive edits share one
+		FBlueprintCompileCoordinator::RequestCompile(Blueprint);
 
 		return FVoidResult::Success();
 	}
@@ -268,12 +271,13 @@ namespace UnrealMCP {
 
 		// Reconstruct the node to apply changes
 		ResultNode->ReconstructNode();
+		FPinLookupCache::Invalidate(ResultNode);
 
 		// Mark the blueprint as modified
 		FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
 
-		// Compile the blueprint
-		FKismetEditorUtilities::CompileBlueprint(Blueprint);
+		// Queue a compile; consecutive edits share one
+		FBlueprintCompileCoordinator::RequestCompile(Blueprint);
 
 		return FVoidResult::Success();
 	}
@@ -308,92 +312,53 @@ namespace UnrealMCP {
 			);
 		}
 
-		// Compile the blueprint first to ensure the UFunction exists
-		FKismetEditorUtilities::CompileBlueprint(Blueprint);
-
-		// Get the compiled UFunction from the generated class
-		UFunction* CompiledFunction = nullptr;
-		if (Blueprint->GeneratedClass) {
-			CompiledFunction = Blueprint->GeneratedClass->FindFunctionByName(FunctionFName);
-		}
-
-		if (!CompiledFunction) {
-			return FVoidResult::Failure(
-				FString::Printf(TEXT("Compiled function '%s' not found after blueprint compilation"), *FunctionName)
-			);
-		}
-
-		// Also set metadata on the function entry node for persistence
+		// The entry node is the persistent home of function metadata; the compiler copies it onto the UFunction
 		UK2Node_FunctionEntry* EntryNode = nullptr;
 		for (UEdGraphNode* Node : FunctionGraph->Nodes) {
 			if (UK2Node_FunctionEntry* Entry = Cast<UK2Node_FunctionEntry>(Node)) {
 				EntryNode = Entry;
-				UE_LOG(LogTemp, Display, TEXT("Found function entry node for: %s"), *FunctionName);
 				break;
 			}
 		}
 
 		if (!EntryNode) {
-			UE_LOG(LogTemp, Warning, TEXT("Could not find function entry node for: %s"), *FunctionName);
+			return FVoidResult::Failure(
+				FString::Printf(TEXT("Function entry node not found for '%s'"), *FunctionName)
+			);
 		}
 
-#if WITH_EDITORONLY_DATA
-		// Set metadata on the function entry node first (this is the primary storage)
-		if (EntryNode) {
-			if (Category.IsSet()) {
-				EntryNode->MetaData.Category = FText::FromString(Category.GetValue());
-				UE_LOG(LogTemp, Display, TEXT("Set entry node category to: %s"), *Category.GetValue());
-			}
-
-			if (Tooltip.IsSet()) {
-				EntryNode->MetaData.ToolTip = FText::FromString(Tooltip.GetValue());
-				UE_LOG(LogTemp, Display, TEXT("Set entry node tooltip to: %s"), *Tooltip.GetValue());
-			}
-
-			
-			// Mark the entry node as modified to ensure changes are saved
-			EntryNode->Modify();
-		}
+		EntryNode->Modify();
 
-		// Also set metadata on the compiled UFunction (but this might be lost during compilation)
+#if WITH_EDITORONLY_DATA
 		if (Category.IsSet()) {
-			CompiledFunction->SetMetaData(FBlueprintMetadata::MD_FunctionCategory, *Category.GetValue());
+			EntryNode->MetaData.Category = FText::FromString(Category.GetValue());
 		}
 
 		if (Tooltip.IsSet()) {
-			CompiledFunction->SetMetaData(FBlueprintMetadata::MD_Tooltip, *Tooltip.GetValue());
+			EntryNode->MetaData.ToolTip = FText::FromString(Tooltip.GetValue());
 		}
+#endif
 
+		bool bPurityChanged = false;
 		if (bPure.IsSet()) {
-			if (bPure.GetValue()) {
-				CompiledFunction->FunctionFlags |= FUNC_BlueprintPure;
-			}
-			else {
-				CompiledFunction->FunctionFlags &= ~FUNC_BlueprintPure;
-			}
+			const int32 OldFlags = EntryNode->GetExtraFlags();
+			const int32 NewFlags = bPure.GetValue()
+				                       ? (OldFlags | FUNC_BlueprintPure)
+				                       : (OldFlags & ~FUNC_BlueprintPure);
+			bPurityChanged = NewFlags != OldFlags;
+			EntryNode->SetExtraFlags(NewFlags);
 		}
 
-		
-		// Verify the metadata was set on the entry node
-		if (EntryNode) {
-			UE_LOG(LogTemp, Display, TEXT("Entry Node Verification - Category: %s, Tooltip: %s"),
-				*EntryNode->MetaData.Category.ToString(),
-				*EntryNode->MetaData.ToolTip.ToString());
+		// Purity changes the shape of call sites, everything else is plain metadata
+		if (bPurityChanged) {
+			FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+		}
+		else {
+			FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
 		}
 
-		// Verify the metadata was set on the UFunction
-		UE_LOG(LogTemp, Display, TEXT("UFunction Verification - Category: %s, Tooltip: %s, bIsPure: %d"),
-			*CompiledFunction->GetMetaData(FBlueprintMetadata::MD_FunctionCategory),
-			*CompiledFunction->GetMetaData(FBlueprintMetadata::MD_Tooltip),
-			(CompiledFunction->FunctionFlags & FUNC_BlueprintPure) != 0);
-#endif
-
-		// Mark the blueprint as modified to ensure changes are saved
-		FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
-
-		// Recompile the blueprint to ensure metadata is properly saved to UFunction
-		// This is necessary for GetFunctions to retrieve the metadata correctly
-		FKismetEditorUtilities::CompileBlueprint(Blueprint);
+		// Metadata and purity are carried by the skeleton class; bytecode can wait until the class is needed
+		FBlueprintCompileCoordinator::RequestCompile(Blueprint, EBlueprintCompileMode::SkeletonOnly);
 
 		return FVoidResult::Success();
 	}
@@ -481,8 +446,8 @@ namespace UnrealMCP {
 		// Mark the blueprint as modified
 		FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
 
-		// Compile the blueprint
-		FKismetEditorUtilities::CompileBlueprint(Blueprint);
+		// Queue a compile; consecutive edits share one
+		FBlueprintCompileCoordinator::RequestCompile(Blueprint);
 
 		return FVoidResult::Success();
 	}
@@ -513,8 +478,8 @@ namespace UnrealMCP {
 		// Mark the blueprint as modified
 		FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
 
-		// Compile the blueprint
-		FKismetEditorUtilities::CompileBlueprint(Blueprint);
+		// Queue a compile; consecutive edits share one
+		FBlueprintCompileCoordinator::RequestCompile(Blueprint);
 
 		return FVoidResult::Success();
 	}
@@ -560,8 +525,8 @@ namespace UnrealMCP {
 		// Mark the blueprint as modified
 		FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
 
-		// Compile the blueprint
-		FKismetEditorUtilities::CompileBlueprint(Blueprint);
+		// Queue a compile; consecutive edits share one
+		FBlueprintCompileCoordinator::RequestCompile(Blueprint);
 
 		return FVoidResult::Success();
 	}
@@ -660,8 +625,8 @@ namespace UnrealMCP {
 		// Mark the blueprint as modified
 		FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
 
-		// Compile the blueprint
-		FKismetEditorUtilities::CompileBlueprint(Blueprint);
+		// Queue a compile; consecutive edits share one
+		FBlueprintCompileCoordinator::RequestCompile(Blueprint);
 
 		return FVoidResult::Success();
 	}
@@ -735,13 +700,13 @@ namespace UnrealMCP {
 		// Mark the blueprint as modified
 		FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
 
-		// Compile the blueprint
-		FKismetEditorUtilities::CompileBlueprint(Blueprint);
+		// Metadata and property flags only need the skeleton class regenerated
+		FBlueprintCompileCoordinator::RequestCompile(Blueprint, EBlueprintCompileMode::SkeletonOnly);
 
 		return FVoidResult::Success();
 	}
 
-	auto FBlueprintMemberService::GetFunctions(const FString& BlueprintName) -> TResult<FGetBlueprintFunctionsResult> {
+	auto FBlueprintMemberService::GetFunctions(const FString& BlueprintName, const bool bRequireCompiled) -> TResult<FGetBlueprintFunctionsResult> {
 		// Validate input parameters
 		if (BlueprintName.IsEmpty()) {
 			return TResult<FGetBlueprintFunctionsResult>::Failure(EErrorCode::InvalidInput, TEXT("BlueprintName"));
@@ -756,11 +721,12 @@ namespace UnrealMCP {
 		FGetBlueprintFunctionsResult Result;
 		Result.Functions.Reserve(Blueprint->FunctionGraphs.Num());
 
-		// Ensure the blueprint is compiled to have access to UFunction metadata
-		FKismetEditorUtilities::CompileBlueprint(Blueprint);
-
-		// Give the blueprint time to fully process the compilation
-		Blueprint->ConditionalPostLoad();
+		// Signatures and metadata are read from the graphs; only compile when the caller needs the generated class
+		if (bRequireCompiled) {
+			if (!FBlueprintCompileCoordinator::Flush(Blueprint) && Blueprint->Status != BS_UpToDate) {
+				FBlueprintCompileCoordinator::CompileNow(Blueprint);
+			}
+		}
 
 		for (UEdGraph* Graph : Blueprint->FunctionGraphs) {
 			if (!Graph) {
@@ -838,70 +804,33 @@ namespace UnrealMCP {
 				}
 			}
 
-			// Initialize metadata values
 			FunctionInfo.Category = TEXT("Default");
 			FunctionInfo.Tooltip = TEXT("");
 			FunctionInfo.Keywords = TEXT("");
 			FunctionInfo.bIsPure = false;
 
-			// Extract metadata from the compiled UFunction
-			if (Blueprint->GeneratedClass) {
-				const auto FunctionFName = FName(*Graph->GetName());
-				UFunction* CompiledFunction = Blueprint->GeneratedClass->FindFunctionByName(FunctionFName);
-
-				if (CompiledFunction) {
-					// Only override defaults if the metadata is not empty
-					const FString CompiledCategory = CompiledFunction->GetMetaData(FBlueprintMetadata::MD_FunctionCategory);
-					const FString CompiledTooltip = CompiledFunction->GetMetaData(FBlueprintMetadata::MD_Tooltip);
+			// The entry node holds the authored metadata the compiler copies onto the UFunction;
+			// GetFunctionFlags merges its extra flags with the skeleton class signature
+			if (EntryNode) {
+#if WITH_EDITORONLY_DATA
+				if (!EntryNode->MetaData.Category.IsEmpty()) {
+					FunctionInfo.Category = EntryNode->MetaData.Category.ToString();
+				}
+				FunctionInfo.Tooltip = EntryNode->MetaData.ToolTip.ToString();
+				FunctionInfo.Keywords = EntryNode->MetaData.Keywords.ToString();
+#endif
+				FunctionInfo.bIsPure = (EntryNode->GetFunctionFlags() & FUNC_BlueprintPure) != 0;
+			}
 
+			if (bRequireCompiled && Blueprint->GeneratedClass) {
+				if (const UFunction* CompiledFunction = Blueprint->GeneratedClass->FindFunctionByName(Graph->GetFName())) {
+					const FString& CompiledCategory = CompiledFunction->GetMetaData(FBlueprintMetadata::MD_FunctionCategory);
 					if (!CompiledCategory.IsEmpty()) {
 						FunctionInfo.Category = CompiledCategory;
 					}
-					if (!CompiledTooltip.IsEmpty()) {
-						FunctionInfo.Tooltip = CompiledTooltip;
-					}
-
-					FunctionInfo.Keywords = CompiledFunction->GetMetaData(TEXT("Keywords"));
+					FunctionInfo.Tooltip = CompiledFunction->GetMetaData(FBlueprintMetadata::MD_Tooltip);
+					FunctionInfo.Keywords = CompiledFunction->GetMetaData(FBlueprintMetadata::MD_FunctionKeywords);
 					FunctionInfo.bIsPure = (CompiledFunction->FunctionFlags & FUNC_BlueprintPure) != 0;
-
-					UE_LOG(LogTemp, Display, TEXT("GetFunctions - Function: %s, Category: '%s', Tooltip: '%s', bIsPure: %d"),
-						*FunctionInfo.Name,
-						*FunctionInfo.Category,
-						*FunctionInfo.Tooltip,
-						FunctionInfo.bIsPure);
-				}
-				else {
-					UE_LOG(LogTemp, Warning, TEXT("GetFunctions - Compiled function not found for: %s"), *FunctionInfo.Name);
-				}
-			}
-			else {
-				UE_LOG(LogTemp, Warning, TEXT("GetFunctions - No generated class for blueprint when processing: %s"), *FunctionInfo.Name);
-			}
-
-			// If UFunction metadata is empty, try to get it from the function entry node
-			// This handles cases where metadata hasn't been compiled yet or was lost
-			if (FunctionInfo.Category.IsEmpty() || FunctionInfo.Tooltip.IsEmpty()) {
-				if (EntryNode) {
-					UE_LOG(LogTemp, Display, TEXT("GetFunctions - Found entry node for: %s, Entry Category: '%s', Entry Tooltip: '%s'"),
-						*FunctionInfo.Name,
-						*EntryNode->MetaData.Category.ToString(),
-						*EntryNode->MetaData.ToolTip.ToString());
-
-					if (FunctionInfo.Category.IsEmpty() && !EntryNode->MetaData.Category.IsEmpty()) {
-						FunctionInfo.Category = EntryNode->MetaData.Category.ToString();
-					}
-					if (FunctionInfo.Tooltip.IsEmpty() && !EntryNode->MetaData.ToolTip.IsEmpty()) {
-						FunctionInfo.Tooltip = EntryNode->MetaData.ToolTip.ToString();
-					}
-
-					UE_LOG(LogTemp, Display, TEXT("GetFunctions - Using entry node metadata for: %s, Category: '%s', Tooltip: '%s', bIsPure: %d"),
-						*FunctionInfo.Name,
-						*FunctionInfo.Category,
-						*FunctionInfo.Tooltip,
-						FunctionInfo.bIsPure);
-				}
-				else {
-					UE_LOG(LogTemp, Warning, TEXT("GetFunctions - No entry node found for function: %s"), *FunctionInfo.Name);
 				}
 			}
 
@@ -1,4 +1,6 @@
 ﻿#include "Services/BlueprintService.h"
+#include "Core/ActorIndex.h"
+#include "Core/BlueprintCompileCoordinator.h"
 #include "Core/ErrorTypes.h"
 #include "Editor.h"
 #include "EditorAssetLibrary.h"
@@ -17,6 +19,7 @@
 #include "GameFramework/Pawn.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/CompilerResultsLog.h"
 #include "Kismet2/KismetEditorUtilities.h"
 #include "Services/BlueprintIntrospectionService.h"
 
@@ -31,11 +34,14 @@ namespace UnrealMCP {
 		}
 
 		// Find blueprint
-		const UBlueprint* Blueprint = FCommonUtils::FindBlueprint(Params.BlueprintName);
+		UBlueprint* Blueprint = FCommonUtils::FindBlueprint(Params.BlueprintName);
 		if (!Blueprint) {
 			return TResult<AActor*>::Failure(EErrorCode::BlueprintNotFound, Params.BlueprintName);
 		}
 
+		// Spawning needs the generated class, so apply any deferred edits first
+		FBlueprintCompileCoordinator::Flush(Blueprint);
+
 		// Get editor world
 		UWorld* World = GEditor->GetEditorWorldContext().World();
 		if (!World) {
@@ -85,29 +91,28 @@ namespace UnrealMCP {
 						UE_LOG(LogTemp, Warning, TEXT("SpawnActorBlueprint: Failed to save blueprint '%s' before compilation"), *Blueprint->GetName());
 					}
 
-					// Compile the blueprint
-					FKismetEditorUtilities::CompileBlueprint(MutableBlueprint);
+					// Compile the blueprint, keeping the compiler messages for the error report
+					FCompilerResultsLog ResultsLog;
+					FBlueprintCompileCoordinator::CompileNow(MutableBlueprint, EBlueprintCompileMode::Full, &ResultsLog);
 
 					// Check if compilation was successful
 					if (MutableBlueprint->Status == BS_UpToDate && MutableBlueprint->GeneratedClass) {
 						UE_LOG(LogTemp, Log, TEXT("SpawnActorBlueprint: Successfully compiled blueprint '%s'"), *Blueprint->GetName());
 						Blueprint = MutableBlueprint; // Update the pointer to the compiled blueprint
 					} else {
-						// Compilation failed
-						FString ErrorStatus;
-						switch (MutableBlueprint->Status) {
-							case BS_Error:
-								ErrorStatus = TEXT("Compilation errors");
-								break;
-							default:
-								ErrorStatus = FString::Printf(TEXT("Status %d"), static_cast<int32>(MutableBlueprint->Status));
-								break;
-						}
+						// Compilation failed: name the status and the compiler errors instead of a bare status code
+						TArray<FString> Errors;
+						TArray<FString> Warnings;
+						FBlueprintCompileCoordinator::CollectMessages(ResultsLog, Errors, Warnings);
 
 						return TResult<AActor*>::Failure(EErrorCode::BlueprintNotReady, FString::Printf(
-							TEXT("Blueprint '%s' failed to compile after attempt (Status: %s)"),
+							TEXT("Blueprint '%s' failed to compile after attempt (Status: %s, %d error(s), %d warning(s))%s%s"),
 							*Params.BlueprintName,
-							*ErrorStatus
+							FBlueprintCompileCoordinator::GetStatusName(MutableBlueprint),
+							Errors.Num(),
+							Warnings.Num(),
+							Errors.Num() > 0 ? TEXT(": ") : TEXT(""),
+							*FString::Join(Errors, TEXT("; "))
 						));
 					}
 				}
@@ -182,21 +187,15 @@ namespace UnrealMCP {
 
 		// Handle name conflicts
 		FString FinalActorName = Params.ActorName;
-		TArray<AActor*> AllActors;
-		UGameplayStatics::GetAllActorsOfClass(World, AActor::StaticClass(), AllActors);
-
-		for (const AActor* ExistingActor : AllActors) {
-			if (ExistingActor && ExistingActor->GetActorLabel().Equals(FinalActorName)) {
-				UE_LOG(
-					LogTemp,
-					Warning,
-					TEXT("SpawnActorBlueprint: Actor name '%s' already exists, appending timestamp"),
-					*FinalActorName
-				);
-				const FDateTime Now = FDateTime::Now();
-				FinalActorName = FString::Printf(TEXT("%s_%lld"), *FinalActorName, Now.GetTicks());
-				break;
-			}
+		if (FActorIndex::FindByLabel(World, FinalActorName)) {
+			UE_LOG(
+				LogTemp,
+				Warning,
+				TEXT("SpawnActorBlueprint: Actor name '%s' already exists, appending timestamp"),
+				*FinalActorName
+			);
+			const FDateTime Now = FDateTime::Now();
+			FinalActorName = FString::Printf(TEXT("%s_%lld"), *FinalActorName, Now.GetTicks());
 		}
 
 		// Configure spawn parameters
@@ -375,7 +374,7 @@ namespace UnrealMCP {
 			Blueprint->SimpleConstructionScript->AddNode(NewNode);
 		}
 
-		FKismetEditorUtilities::CompileBlueprint(Blueprint);
+		FBlueprintCompileCoordinator::RequestCompile(Blueprint);
 
 		UE_LOG(
 			LogTemp,
@@ -483,7 +482,7 @@ namespace UnrealMCP {
 		PrimComponent->SetEnableGravity(Params.bEnableGravity);
 
 		FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
-	FKismetEditorUtilities::CompileBlueprint(Blueprint);
+	FBlueprintCompileCoordinator::RequestCompile(Blueprint);
 
 	UE_LOG(
 			LogTemp,
@@ -578,6 +577,9 @@ namespace UnrealMCP {
 			return FVoidResult::Failure(EErrorCode::BlueprintNotFound, BlueprintName);
 		}
 
+		// The CDO must reflect deferred edits (e.g. a variable added in this batch)
+		FBlueprintCompileCoordinator::Flush(Blueprint);
+
 		UObject* DefaultObject = Blueprint->GeneratedClass->GetDefaultObject();
 		if (!DefaultObject) {
 			return FVoidResult::Failure(EErrorCode::BlueprintNotFound, TEXT("Failed to get blueprint class default object"));
@@ -622,6 +624,8 @@ namespace UnrealMCP {
 			return FVoidResult::Failure(EErrorCode::BlueprintNotFound, BlueprintName);
 		}
 
+		FBlueprintCompileCoordinator::Flush(Blueprint);
+
 		UObject* DefaultObject = Blueprint->GeneratedClass->GetDefaultObject();
 		if (!DefaultObject) {
 			return FVoidResult::Failure(EErrorCode::OperationFailed, TEXT("Failed to get default object"));
@@ -805,7 +809,7 @@ namespace UnrealMCP {
 
 		// Mark blueprint as modified and compile
 		FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
-		FKismetEditorUtilities::CompileBlueprint(Blueprint);
+		FBlueprintCompileCoordinator::RequestCompile(Blueprint);
 
 		// Return the updated transform
 		FComponentTransformResult Result;
@@ -839,6 +843,9 @@ namespace UnrealMCP {
 			return TResult<FDeleteBlueprintResult>::Failure(EErrorCode::AssetNotFound, TEXT("Failed to get blueprint package"));
 		}
 
+		// A deferred compile must not resurrect the asset being deleted
+		FBlueprintCompileCoordinator::Cancel(Blueprint);
+
 		// Delete the asset
 		TArray<UObject*> ObjectsToDelete;
 		ObjectsToDelete.Add(Blueprint);
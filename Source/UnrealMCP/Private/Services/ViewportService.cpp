@@ -1,4 +1,5 @@
 ﻿#include "Services/ViewportService.h"
+#include "Core/ActorIndex.h"
 #include "Core/ErrorTypes.h"
 #include "Editor.h"
 #include "EditorViewportClient.h"
@@ -6,7 +7,6 @@
 #include "LevelEditorViewport.h"
 #include "Engine/Selection.h"
 #include "GameFramework/Actor.h"
-#include "Kismet/GameplayStatics.h"
 #include "Misc/FileHelper.h"
 
 namespace UnrealMCP {
@@ -21,22 +21,13 @@ namespace UnrealMCP {
 
 		// If actor name is provided, focus on that actor
 		if (ActorName.IsSet()) {
-			const UWorld* World = GEditor->GetEditorWorldContext().World();
+			UWorld* World = GEditor->GetEditorWorldContext().World();
 			if (!World) {
 				return FVoidResult::Failure(EErrorCode::WorldNotFound);
 			}
 
 			// Find the actor
-			AActor* TargetActor = nullptr;
-			TArray<AActor*> AllActors;
-			UGameplayStatics::GetAllActorsOfClass(World, AActor::StaticClass(), AllActors);
-
-			for (AActor* Actor : AllActors) {
-				if (Actor && Actor->GetName() == ActorName.GetValue()) {
-					TargetActor = Actor;
-					break;
-				}
-			}
+			AActor* TargetActor = FActorIndex::FindActor(World, ActorName.GetValue());
 
 			if (!TargetActor) {
 				return FVoidResult::Failure(EErrorCode::ActorNotFound, ActorName.GetValue());
@@ -1,4 +1,5 @@
 ﻿#include "Services/WidgetService.h"
+#include "Core/BlueprintCompileCoordinator.h"
 #include "Core/ErrorTypes.h"
 #include "EdGraphSchema_K2.h"
 #include "Editor.h"
@@ -69,7 +70,7 @@ namespace UnrealMCP {
 		FAssetRegistryModule::AssetCreated(WidgetBlueprint);
 
 		// Compile the blueprint
-		FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
+		FBlueprintCompileCoordinator::CompileNow(WidgetBlueprint);
 
 		return TResult<UWidgetBlueprint*>::Success(WidgetBlueprint);
 	}
@@ -129,7 +130,7 @@ namespace UnrealMCP {
 
 		// Mark the package dirty and compile
 		WidgetBlueprint->MarkPackageDirty();
-		FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
+		FBlueprintCompileCoordinator::RequestCompile(WidgetBlueprint);
 
 		return TResult<UTextBlock*>::Success(TextBlock);
 	}
@@ -176,7 +177,7 @@ namespace UnrealMCP {
 
 		// Mark the package dirty and compile
 		WidgetBlueprint->MarkPackageDirty();
-		FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
+		FBlueprintCompileCoordinator::RequestCompile(WidgetBlueprint);
 
 		return TResult<UButton*>::Success(Button);
 	}
@@ -222,7 +223,7 @@ namespace UnrealMCP {
 
 		// Mark the package dirty and compile
 		WidgetBlueprint->MarkPackageDirty();
-		FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
+		FBlueprintCompileCoordinator::RequestCompile(WidgetBlueprint);
 
 		return FVoidResult::Success();
 	}
@@ -329,7 +330,7 @@ namespace UnrealMCP {
 
 		// Mark the package dirty and compile
 		WidgetBlueprint->MarkPackageDirty();
-		FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
+		FBlueprintCompileCoordinator::RequestCompile(WidgetBlueprint);
 
 		return FVoidResult::Success();
 	}
@@ -342,11 +343,14 @@ namespace UnrealMCP {
 
 		const FString FullPath = ResolveWidgetPath(Params.WidgetName);
 
-		const UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(UEditorAssetLibrary::LoadAsset(FullPath));
+		UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(UEditorAssetLibrary::LoadAsset(FullPath));
 		if (!WidgetBlueprint) {
 			return TResult<UClass*>::Failure(EErrorCode::WidgetNotFound, Params.WidgetName);
 		}
 
+		// The viewport instance is created from the generated class, so apply any deferred edits first
+		FBlueprintCompileCoordinator::Flush(WidgetBlueprint);
+
 		// Get the widget class
 		UClass* WidgetClass = WidgetBlueprint->GeneratedClass;
 		if (!WidgetClass) {
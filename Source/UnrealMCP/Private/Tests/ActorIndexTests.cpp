@@ -0,0 +1,206 @@
+#include "Editor.h"
+#include "Components/PointLightComponent.h"
+#include "Core/ActorIndex.h"
+#include "Engine/Light.h"
+#include "Engine/PointLight.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/AutomationTest.h"
+#include "Services/ActorService.h"
+#include "Tests/TestUtils.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FActorIndexTracksSpawnAndDestroyTest,
+	"UnrealMCP.ActorIndex.TracksSpawnAndDestroy",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FActorIndexTracksSpawnAndDestroyTest::RunTest(const FString& Parameters) -> bool {
+	// Test: Actors spawned after the index was built are found, and destroyed actors are not
+
+	UWorld* World = GEditor->GetEditorWorldContext().World();
+	TestNotNull(TEXT("Editor world should be available"), World);
+	if (!World)
+		return false;
+
+	// Force the index to be built before spawning
+	TestNotNull(TEXT("World index should be available"), UnrealMCP::FActorIndex::GetWorldIndex(World));
+
+	AActor* TestActor = UnrealMCPTest::FTestUtils::SpawnTestActor<AActor>(World, TEXT("IndexSpawnActor"));
+	TestNotNull(TEXT("Test actor should spawn successfully"), TestActor);
+	if (!TestActor)
+		return false;
+
+	const FString ActorName = TestActor->GetName();
+	TestEqual(TEXT("Spawned actor should be found by name"),
+	          UnrealMCP::FActorIndex::FindActor(World, ActorName),
+	          TestActor);
+	TestEqual(TEXT("Actor service lookup should use the index"),
+	          UnrealMCP::FActorService::FindActorByName(ActorName),
+	          TestActor);
+
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, TestActor);
+
+	TestNull(TEXT("Destroyed actor should no longer be found"), UnrealMCP::FActorIndex::FindActor(World, ActorName));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FActorIndexTracksRenameAndLabelTest,
+	"UnrealMCP.ActorIndex.TracksRenameAndLabel",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FActorIndexTracksRenameAndLabelTest::RunTest(const FString& Parameters) -> bool {
+	// Test: Renames and label changes re-key the actor
+
+	UWorld* World = GEditor->GetEditorWorldContext().World();
+	TestNotNull(TEXT("Editor world should be available"), World);
+	if (!World)
+		return false;
+
+	TestNotNull(TEXT("World index should be available"), UnrealMCP::FActorIndex::GetWorldIndex(World));
+
+	AActor* TestActor = UnrealMCPTest::FTestUtils::SpawnTestActor<AActor>(World, TEXT("IndexRenameActor"));
+	TestNotNull(TEXT("Test actor should spawn successfully"), TestActor);
+	if (!TestActor)
+		return false;
+
+	const FString OldName = TestActor->GetName();
+	const FString NewName = UnrealMCPTest::FTestUtils::GenerateUniqueTestActorName(TEXT("IndexRenamedActor"));
+	TestActor->Rename(*NewName);
+
+	TestEqual(TEXT("Renamed actor should be found by its new name"),
+	          UnrealMCP::FActorIndex::FindByName(World, FName(*NewName)),
+	          TestActor);
+	TestNull(TEXT("Renamed actor should not be found by its old name"),
+	         UnrealMCP::FActorIndex::FindByName(World, FName(*OldName)));
+
+	const FString NewLabel = UnrealMCPTest::FTestUtils::GenerateUniqueTestActorName(TEXT("IndexLabel"));
+	TestActor->SetActorLabel(NewLabel);
+
+	TestEqual(TEXT("Relabelled actor should be found by its label"),
+	          UnrealMCP::FActorIndex::FindActor(World, NewLabel, true),
+	          TestActor);
+	TestNull(TEXT("Name lookups should not match the label"),
+	         UnrealMCP::FActorIndex::FindActor(World, NewLabel));
+
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, TestActor);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FActorIndexQueryByAttributesTest,
+	"UnrealMCP.ActorIndex.QueryByAttributes",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FActorIndexQueryByAttributesTest::RunTest(const FString& Parameters) -> bool {
+	// Test: Class, tag, component and folder constraints intersect and follow attribute changes
+
+	UWorld* World = GEditor->GetEditorWorldContext().World();
+	TestNotNull(TEXT("Editor world should be available"), World);
+	if (!World)
+		return false;
+
+	TestNotNull(TEXT("World index should be available"), UnrealMCP::FActorIndex::GetWorldIndex(World));
+
+	APointLight* Light = UnrealMCPTest::FTestUtils::SpawnTestActor<APointLight>(World, TEXT("IndexQueryLight"));
+	AActor* Plain = UnrealMCPTest::FTestUtils::SpawnTestActor<AActor>(World, TEXT("IndexQueryPlain"));
+	TestNotNull(TEXT("Light should spawn successfully"), Light);
+	TestNotNull(TEXT("Plain actor should spawn successfully"), Plain);
+	if (!Light || !Plain)
+		return false;
+
+	const FName Tag(*UnrealMCPTest::FTestUtils::GenerateUniqueTestName(TEXT("IndexQueryTag")));
+	const FName Folder(*UnrealMCPTest::FTestUtils::GenerateUniqueTestName(TEXT("IndexQueryFolder")));
+
+	Light->Tags.Add(Tag);
+	UnrealMCP::FActorIndex::NotifyActorChanged(Light);
+	Plain->Tags.Add(Tag);
+	UnrealMCP::FActorIndex::NotifyActorChanged(Plain);
+	Light->SetFolderPath(FName(*(Folder.ToString() + TEXT("/Sub"))));
+
+	UnrealMCP::FActorIndexQuery TagQuery;
+	TagQuery.Tags.Add(Tag);
+	TArray<AActor*> Actors;
+	UnrealMCP::FActorIndex::QueryActors(World, TagQuery, Actors);
+	TestEqual(TEXT("Tag query should return both tagged actors"), Actors.Num(), 2);
+
+	UnrealMCP::FActorIndexQuery ClassQuery = TagQuery;
+	ClassQuery.Class = ALight::StaticClass();
+	Actors.Reset();
+	UnrealMCP::FActorIndex::QueryActors(World, ClassQuery, Actors);
+	TestEqual(TEXT("Base class constraint should match the subclass only"), Actors.Num(), 1);
+	TestTrue(TEXT("Class query should return the light"), Actors.Contains(Light));
+
+	UnrealMCP::FActorIndexQuery ComponentQuery = TagQuery;
+	ComponentQuery.ComponentClass = UPointLightComponent::StaticClass();
+	Actors.Reset();
+	UnrealMCP::FActorIndex::QueryActors(World, ComponentQuery, Actors);
+	TestEqual(TEXT("Component query should return the light only"), Actors.Num(), 1);
+
+	UnrealMCP::FActorIndexQuery FolderQuery;
+	FolderQuery.Folder = Folder;
+	Actors.Reset();
+	UnrealMCP::FActorIndex::QueryActors(World, FolderQuery, Actors);
+	TestTrue(TEXT("Folder query should include actors in subfolders"), Actors.Contains(Light));
+	TestFalse(TEXT("Folder query should exclude actors outside the folder"), Actors.Contains(Plain));
+
+	Plain->Tags.Remove(Tag);
+	UnrealMCP::FActorIndex::NotifyActorChanged(Plain);
+	Actors.Reset();
+	UnrealMCP::FActorIndex::QueryActors(World, TagQuery, Actors);
+	TestFalse(TEXT("Untagged actor should no longer match"), Actors.Contains(Plain));
+
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, Light);
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, Plain);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FActorIndexReconcilesListChangeTest,
+	"UnrealMCP.ActorIndex.ReconcilesListChange",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FActorIndexReconcilesListChangeTest::RunTest(const FString& Parameters) -> bool {
+	// Test: A bulk list change reconciles the existing index instead of dropping it
+
+	UWorld* World = GEditor->GetEditorWorldContext().World();
+	TestNotNull(TEXT("Editor world should be available"), World);
+	if (!World)
+		return false;
+
+	UnrealMCP::FWorldActorIndex* Index = UnrealMCP::FActorIndex::GetWorldIndex(World);
+	TestNotNull(TEXT("World index should be available"), Index);
+	if (!Index)
+		return false;
+
+	AActor* Kept = UnrealMCPTest::FTestUtils::SpawnTestActor<AActor>(World, TEXT("IndexReconcileKept"));
+	AActor* Missed = UnrealMCPTest::FTestUtils::SpawnTestActor<AActor>(World, TEXT("IndexReconcileMissed"));
+	TestNotNull(TEXT("Test actors should spawn"), Kept);
+	TestNotNull(TEXT("Test actors should spawn"), Missed);
+	if (!Kept || !Missed)
+		return false;
+
+	// Simulate changes the editor only reports as a list change (undo/redo, paste)
+	Index->RemoveActor(Missed);
+	TestNull(TEXT("Removed entry should not be found"), UnrealMCP::FActorIndex::FindByName(World, Missed->GetFName()));
+
+	GEngine->BroadcastLevelActorListChanged();
+	TestTrue(TEXT("Index should be flagged stale"), Index->IsStale());
+
+	TestEqual(TEXT("Lookup should reconcile the same index"), UnrealMCP::FActorIndex::GetWorldIndex(World), Index);
+	TestFalse(TEXT("Index should no longer be stale"), Index->IsStale());
+	TestEqual(TEXT("Missing actor should be added back"), UnrealMCP::FActorIndex::FindByName(World, Missed->GetFName()), Missed);
+	TestEqual(TEXT("Indexed actor should still be found"), UnrealMCP::FActorIndex::FindByName(World, Kept->GetFName()), Kept);
+
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, Kept);
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, Missed);
+
+	return true;
+}
@@ -1,10 +1,13 @@
 ﻿#include "Editor.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Components/PointLightComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "Dom/JsonObject.h"
 #include "Engine/PointLight.h"
 #include "Engine/StaticMeshActor.h"
 #include "GameFramework/Actor.h"
 #include "Kismet/GameplayStatics.h"
+#include "Misc/Base64.h"
 #include "Misc/AutomationTest.h"
 #include "Services/ActorService.h"
 #include "Tests/TestUtils.h"
@@ -470,6 +473,16 @@ auto FActorServiceSetActorPropertyTest::RunTest(const FString& Parameters) -> bo
 	TestTrue(TEXT("SetActorProperty should succeed for setting InitialLifeSpan to 0"), Result.IsSuccess());
 	TestEqual(TEXT("InitialLifeSpan should be set to 0"), TestActor->InitialLifeSpan, 0.0f);
 
+	// Each write is its own undo step
+	Result = UnrealMCP::FActorService::SetActorProperty(
+		TestActorName,
+		TEXT("InitialLifeSpan"),
+		MakeShared<FJsonValueNumber>(7.0)
+	);
+	TestTrue(TEXT("SetActorProperty should succeed for InitialLifeSpan 7"), Result.IsSuccess());
+	TestTrue(TEXT("The write should be undoable"), GEditor->UndoTransaction());
+	TestEqual(TEXT("Undo should restore InitialLifeSpan"), TestActor->InitialLifeSpan, 0.0f);
+
 	// Test setting boolean property using SetActorParameter instead of private bHidden
 	// We'll test a different boolean property that is accessible - let's try bCanBeDamaged
 	const bool bCanBeDamaged = TestActor->CanBeDamaged();
@@ -727,3 +740,435 @@ auto FActorServiceGetActorAvailablePropertiesWithDetailsTest::RunTest(const FStr
 
 	return true;
 }
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FActorServiceSpawnActorsTest,
+	"UnrealMCP.Actor.SpawnActors",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FActorServiceSpawnActorsTest::RunTest(const FString& Parameters) -> bool {
+	// Test: Spawn a batch of actors with transforms and properties applied before construction
+
+	UWorld* World = GEditor->GetEditorWorldContext().World();
+	TestNotNull(TEXT("Editor world should be available"), World);
+	if (!World)
+		return false;
+
+	const FString FirstName = UnrealMCPTest::FTestUtils::GenerateUniqueTestActorName(TEXT("SpawnActorsFirst"));
+	const FString SecondName = UnrealMCPTest::FTestUtils::GenerateUniqueTestActorName(TEXT("SpawnActorsSecond"));
+
+	UnrealMCP::FSpawnActorsParams Params;
+
+	UnrealMCP::FActorSpawnSpec& First = Params.Actors.AddDefaulted_GetRef();
+	First.ClassName = TEXT("StaticMeshActor");
+	First.Name = FirstName;
+	First.Transform = FTransform(FRotator(0.0, 90.0, 0.0), FVector(100.0, 200.0, 300.0), FVector(2.0));
+	First.Properties = MakeShared<FJsonObject>();
+	First.Properties->SetBoolField(TEXT("bHidden"), true);
+
+	UnrealMCP::FActorSpawnSpec& Second = Params.Actors.AddDefaulted_GetRef();
+	Second.ClassName = TEXT("PointLight");
+	Second.Name = SecondName;
+	Second.Properties = MakeShared<FJsonObject>();
+	Second.Properties->SetBoolField(TEXT("DefinitelyNonExistentProperty123"), true);
+
+	const UnrealMCP::TResult<UnrealMCP::FSpawnActorsResult> Result = UnrealMCP::FActorService::SpawnActors(Params);
+	TestTrue(TEXT("SpawnActors should succeed"), Result.IsSuccess());
+	if (Result.IsFailure())
+		return false;
+
+	const UnrealMCP::FSpawnActorsResult& Spawned = Result.GetValue();
+	TestEqual(TEXT("Both actors should be reported"), Spawned.Actors.Num(), 2);
+	if (Spawned.Actors.Num() != 2)
+		return false;
+	TestEqual(TEXT("Entries should keep request order"), Spawned.Actors[0].Name, FirstName);
+	TestEqual(TEXT("Valid properties should not report errors"), Spawned.Actors[0].PropertyErrors.Num(), 0);
+	TestEqual(TEXT("Unknown property should be reported"), Spawned.Actors[1].PropertyErrors.Num(), 1);
+
+	AActor* FirstActor = UnrealMCP::FActorService::FindActorByName(FirstName);
+	AActor* SecondActor = UnrealMCP::FActorService::FindActorByName(SecondName);
+	TestNotNull(TEXT("First actor should be indexed"), FirstActor);
+	TestNotNull(TEXT("Second actor should be indexed"), SecondActor);
+
+	if (FirstActor) {
+		TestTrue(TEXT("Location should be applied"), FirstActor->GetActorLocation().Equals(FVector(100.0, 200.0, 300.0)));
+		TestTrue(TEXT("Scale should be applied"), FirstActor->GetActorScale3D().Equals(FVector(2.0)));
+		TestTrue(TEXT("Property should be applied"), FirstActor->IsHidden());
+	}
+
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, FirstActor);
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, SecondActor);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FActorServiceSpawnActorsValidationTest,
+	"UnrealMCP.Actor.SpawnActorsValidation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FActorServiceSpawnActorsValidationTest::RunTest(const FString& Parameters) -> bool {
+	// Test: An invalid entry rejects the whole batch before anything is spawned
+
+	const FString ActorName = UnrealMCPTest::FTestUtils::GenerateUniqueTestActorName(TEXT("SpawnActorsValidation"));
+
+	UnrealMCP::FSpawnActorsParams Params;
+	UnrealMCP::FActorSpawnSpec& Valid = Params.Actors.AddDefaulted_GetRef();
+	Valid.ClassName = TEXT("StaticMeshActor");
+	Valid.Name = ActorName;
+	UnrealMCP::FActorSpawnSpec& Invalid = Params.Actors.AddDefaulted_GetRef();
+	Invalid.ClassName = TEXT("NonExistentActorClass_XYZ123");
+
+	const UnrealMCP::TResult<UnrealMCP::FSpawnActorsResult> Result = UnrealMCP::FActorService::SpawnActors(Params);
+	UnrealMCPTest::FTestUtils::ValidateErrorCode(
+		Result,
+		UnrealMCP::EErrorCode::InvalidActorClass,
+		TEXT("NonExistentActorClass_XYZ123"),
+		this
+	);
+	TestNull(TEXT("Valid entry should not be spawned"), UnrealMCP::FActorService::FindActorByName(ActorName));
+
+	// Duplicate names within the batch are rejected too
+	Invalid.ClassName = TEXT("StaticMeshActor");
+	Invalid.Name = ActorName;
+	const UnrealMCP::TResult<UnrealMCP::FSpawnActorsResult> DuplicateResult = UnrealMCP::FActorService::SpawnActors(Params);
+	TestTrue(TEXT("Duplicate names should fail"), DuplicateResult.IsFailure());
+	TestNull(TEXT("Nothing should be spawned"), UnrealMCP::FActorService::FindActorByName(ActorName));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FActorServiceSetActorTransformsTest,
+	"UnrealMCP.Actor.SetActorTransforms",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FActorServiceSetActorTransformsTest::RunTest(const FString& Parameters) -> bool {
+	// Test: Move actors from a base64-packed float32 array and skip actors already in place
+
+	UWorld* World = GEditor->GetEditorWorldContext().World();
+	TestNotNull(TEXT("Editor world should be available"), World);
+	if (!World)
+		return false;
+
+	AActor* FirstActor = UnrealMCPTest::FTestUtils::SpawnTestActor<AStaticMeshActor>(World, TEXT("TransformsFirst"));
+	AActor* SecondActor = UnrealMCPTest::FTestUtils::SpawnTestActor<AStaticMeshActor>(World, TEXT("TransformsSecond"));
+	TestNotNull(TEXT("First actor should spawn"), FirstActor);
+	TestNotNull(TEXT("Second actor should spawn"), SecondActor);
+	if (!FirstActor || !SecondActor)
+		return false;
+	const FString FirstName = FirstActor->GetName();
+	const FString SecondName = SecondActor->GetName();
+
+	// A child rides along with the first actor and must be found at its new place
+	AActor* ChildActor = UnrealMCPTest::FTestUtils::SpawnTestActor<AStaticMeshActor>(World, TEXT("TransformsChild"));
+	TestNotNull(TEXT("Child actor should spawn"), ChildActor);
+	if (!ChildActor)
+		return false;
+	ChildActor->AttachToActor(FirstActor, FAttachmentTransformRules::KeepRelativeTransform);
+
+	const FQuat Yaw90 = FRotator(0.0, 90.0, 0.0).Quaternion();
+	const float Packed[] = {
+		100.0f, 200.0f, 300.0f, static_cast<float>(Yaw90.X), static_cast<float>(Yaw90.Y), static_cast<float>(Yaw90.Z), static_cast<float>(Yaw90.W), 1.0f, 1.0f, 1.0f,
+		-50.0f, 0.0f, 25.0f, 0.0f, 0.0f, 0.0f, 1.0f, 2.0f, 2.0f, 2.0f
+	};
+
+	const TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+	Json->SetArrayField(TEXT("names"), {MakeShared<FJsonValueString>(FirstName), MakeShared<FJsonValueString>(SecondName)});
+	Json->SetStringField(TEXT("transforms"), FBase64::Encode(reinterpret_cast<const uint8*>(Packed), sizeof(Packed)));
+
+	const auto Params = UnrealMCP::FSetActorTransformsParams::FromJson(Json);
+	TestTrue(TEXT("Packed transforms should parse"), Params.IsSuccess());
+	if (Params.IsFailure())
+		return false;
+
+	const auto Result = UnrealMCP::FActorService::SetActorTransforms(Params.GetValue());
+	TestTrue(TEXT("SetActorTransforms should succeed"), Result.IsSuccess());
+	if (Result.IsFailure())
+		return false;
+	TestEqual(TEXT("Both actors should move"), Result.GetValue().UpdatedCount, 2);
+
+	TestTrue(TEXT("First location should be applied"), FirstActor->GetActorLocation().Equals(FVector(100.0, 200.0, 300.0)));
+	TestTrue(TEXT("First rotation should be applied"), FirstActor->GetActorQuat().Equals(Yaw90, 1.e-4));
+	TestTrue(TEXT("Second scale should be applied"), SecondActor->GetActorScale3D().Equals(FVector(2.0)));
+
+	TestTrue(TEXT("Child should follow its parent"), ChildActor->GetActorLocation().Equals(FVector(100.0, 200.0, 300.0)));
+	const UnrealMCP::FActorQueryFilter NoFilter;
+	const auto ChildQuery = UnrealMCP::FActorService::FindActorsInBox(FBox(FVector(50.0, 150.0, 250.0), FVector(150.0, 250.0, 350.0)), NoFilter);
+	TestTrue(TEXT("Moved child should be indexed at its new location"),
+	         ChildQuery.IsSuccess() && ChildQuery.GetValue().Contains(ChildActor));
+
+	// Applying the same batch again changes nothing
+	const auto Repeat = UnrealMCP::FActorService::SetActorTransforms(Params.GetValue());
+	TestTrue(TEXT("Repeated batch should succeed"), Repeat.IsSuccess());
+	if (Repeat.IsSuccess()) {
+		TestEqual(TEXT("Nothing should be updated"), Repeat.GetValue().UpdatedCount, 0);
+		TestEqual(TEXT("Both actors should be unchanged"), Repeat.GetValue().UnchangedCount, 2);
+	}
+
+	// A value count that does not match the names is rejected
+	Json->SetStringField(TEXT("transforms"), FBase64::Encode(reinterpret_cast<const uint8*>(Packed), sizeof(float) * 10));
+	TestTrue(TEXT("Short array should be rejected"), UnrealMCP::FSetActorTransformsParams::FromJson(Json).IsFailure());
+
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, ChildActor);
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, FirstActor);
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, SecondActor);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FActorServiceTransformActorsTest,
+	"UnrealMCP.Actor.TransformActors",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FActorServiceTransformActorsTest::RunTest(const FString& Parameters) -> bool {
+	// Test: Offset and rotate a named group of actors around its centroid
+
+	UWorld* World = GEditor->GetEditorWorldContext().World();
+	TestNotNull(TEXT("Editor world should be available"), World);
+	if (!World)
+		return false;
+
+	AActor* LeftActor = UnrealMCPTest::FTestUtils::SpawnTestActor<AStaticMeshActor>(World, TEXT("TransformLeft"), FVector(-100.0, 0.0, 0.0));
+	AActor* RightActor = UnrealMCPTest::FTestUtils::SpawnTestActor<AStaticMeshActor>(World, TEXT("TransformRight"), FVector(100.0, 0.0, 0.0));
+	TestNotNull(TEXT("Left actor should spawn"), LeftActor);
+	TestNotNull(TEXT("Right actor should spawn"), RightActor);
+	if (!LeftActor || !RightActor)
+		return false;
+
+	// An unselected child follows the left actor and must be reindexed with it
+	AActor* ChildActor = UnrealMCPTest::FTestUtils::SpawnTestActor<AStaticMeshActor>(World, TEXT("TransformChild"), FVector(-100.0, 0.0, 0.0));
+	TestNotNull(TEXT("Child actor should spawn"), ChildActor);
+	if (!ChildActor)
+		return false;
+	ChildActor->AttachToActor(LeftActor, FAttachmentTransformRules::KeepWorldTransform);
+
+	UnrealMCP::FTransformActorsParams Params;
+	Params.Selection.Names = {LeftActor->GetName(), RightActor->GetName()};
+	Params.Operation = UnrealMCP::EActorTransformOperation::Offset;
+	Params.Offset = FVector(0.0, 0.0, 50.0);
+
+	const auto OffsetResult = UnrealMCP::FActorService::TransformActors(Params);
+	TestTrue(TEXT("Offset should succeed"), OffsetResult.IsSuccess());
+	if (OffsetResult.IsFailure())
+		return false;
+	TestEqual(TEXT("Both actors should move"), OffsetResult.GetValue().UpdatedCount, 2);
+	TestTrue(TEXT("Offset should be applied"), LeftActor->GetActorLocation().Equals(FVector(-100.0, 0.0, 50.0)));
+
+	const UnrealMCP::FActorQueryFilter NoFilter;
+	const auto ChildQuery = UnrealMCP::FActorService::FindActorsInBox(FBox(FVector(-110.0, -10.0, 40.0), FVector(-90.0, 10.0, 60.0)), NoFilter);
+	TestTrue(TEXT("Moved child should be indexed at its new location"),
+	         ChildQuery.IsSuccess() && ChildQuery.GetValue().Contains(ChildActor));
+
+	Params.Operation = UnrealMCP::EActorTransformOperation::Rotate;
+	Params.Rotation = FRotator(0.0, 90.0, 0.0).Quaternion();
+
+	const auto RotateResult = UnrealMCP::FActorService::TransformActors(Params);
+	TestTrue(TEXT("Rotate should succeed"), RotateResult.IsSuccess());
+	if (RotateResult.IsFailure())
+		return false;
+	TestTrue(TEXT("Pivot should default to the centroid"),
+	         RotateResult.GetValue().Pivot.Get(FVector::OneVector).Equals(FVector(0.0, 0.0, 50.0)));
+	TestTrue(TEXT("Left actor should orbit the pivot"), LeftActor->GetActorLocation().Equals(FVector(0.0, -100.0, 50.0), 1.e-3));
+	TestTrue(TEXT("Right actor should face the new direction"),
+	         RightActor->GetActorRotation().Equals(FRotator(0.0, 90.0, 0.0), 1.e-3));
+
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, ChildActor);
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, LeftActor);
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, RightActor);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FActorServiceScatterInstancesTest,
+	"UnrealMCP.Actor.ScatterInstances",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FActorServiceScatterInstancesTest::RunTest(const FString& Parameters) -> bool {
+	// Test: Scatter into a new host actor, then append to the same component
+
+	UWorld* World = GEditor->GetEditorWorldContext().World();
+	TestNotNull(TEXT("Editor world should be available"), World);
+	if (!World)
+		return false;
+
+	UnrealMCP::FScatterInstancesParams Params;
+	Params.MeshPath = TEXT("/Engine/BasicShapes/Cube.Cube");
+	Params.ActorName = UnrealMCPTest::FTestUtils::GenerateUniqueTestActorName(TEXT("ScatterHost"));
+	Params.Box = FBox(FVector(0.0, 0.0, 0.0), FVector(1000.0, 1000.0, 0.0));
+	Params.Sampling = UnrealMCP::EScatterSampling::JitteredGrid;
+	Params.Spacing = 100.0;
+
+	const auto Result = UnrealMCP::FActorService::ScatterInstances(Params);
+	TestTrue(TEXT("ScatterInstances should succeed"), Result.IsSuccess());
+	if (Result.IsFailure())
+		return false;
+	TestEqual(TEXT("Host should use the requested name"), Result.GetValue().ActorName, Params.ActorName);
+	TestEqual(TEXT("First range starts at 0"), Result.GetValue().FirstInstance, 0);
+	TestEqual(TEXT("One instance per grid cell"), Result.GetValue().InstanceCount, 100);
+
+	Params.Sampling = UnrealMCP::EScatterSampling::PoissonDisk;
+	const auto Appended = UnrealMCP::FActorService::ScatterInstances(Params);
+	TestTrue(TEXT("Second scatter should succeed"), Appended.IsSuccess());
+	if (Appended.IsSuccess()) {
+		TestEqual(TEXT("Second scatter should reuse the component"), Appended.GetValue().ComponentName, Result.GetValue().ComponentName);
+		TestEqual(TEXT("Second range follows the first"), Appended.GetValue().FirstInstance, 100);
+	}
+
+	AActor* Host = UnrealMCP::FActorService::FindActorByName(Params.ActorName);
+	TestNotNull(TEXT("Host actor should exist"), Host);
+	if (Host) {
+		TInlineComponentArray<UHierarchicalInstancedStaticMeshComponent*> Components(Host);
+		TestEqual(TEXT("Host should have one instance component"), Components.Num(), 1);
+		TestTrue(TEXT("New host should sit at the region center"), Host->GetActorLocation().Equals(FVector(500.0, 500.0, 0.0)));
+	}
+
+	// Regions that would exceed the instance cap are rejected before sampling
+	Params.Box = FBox(FVector(0.0), FVector(1000000.0, 1000000.0, 0.0));
+	Params.Spacing = 10.0;
+	UnrealMCPTest::FTestUtils::ValidateErrorCode(
+		UnrealMCP::FActorService::ScatterInstances(Params),
+		UnrealMCP::EErrorCode::InvalidInput,
+		FString(),
+		this
+	);
+
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, Host);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FActorServiceSetPropertiesTest,
+	"UnrealMCP.Actor.SetProperties",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FActorServiceSetPropertiesTest::RunTest(const FString& Parameters) -> bool {
+	// Test: Several paths written on several actors, with failures reported per actor and path
+
+	UWorld* World = GEditor->GetEditorWorldContext().World();
+	TestNotNull(TEXT("Editor world should be available"), World);
+	if (!World)
+		return false;
+
+	TArray<APointLight*> Lights;
+	UnrealMCP::FSetPropertiesParams Params;
+	for (int32 Index = 0; Index < 3; ++Index) {
+		APointLight* Light = UnrealMCPTest::FTestUtils::SpawnTestActor<APointLight>(World, TEXT("SetPropertiesLight"));
+		TestNotNull(TEXT("Light should spawn"), Light);
+		if (!Light)
+			return false;
+		Lights.Add(Light);
+		Params.Selection.Names.Add(Light->GetName());
+	}
+
+	Params.Properties.Emplace(TEXT("LightComponent.Intensity"), MakeShared<FJsonValueNumber>(42.0));
+	Params.Properties.Emplace(TEXT("LightComponent.AttenuationRadius"), MakeShared<FJsonValueNumber>(300.0));
+	Params.Properties.Emplace(TEXT("Tags"), MakeShared<FJsonValueArray>(TArray<TSharedPtr<FJsonValue>>{MakeShared<FJsonValueString>(TEXT("Swept"))}));
+	Params.Properties.Emplace(TEXT("LightComponent.NoSuchMember"), MakeShared<FJsonValueNumber>(1.0));
+
+	const auto Result = UnrealMCP::FActorService::SetProperties(Params);
+	TestTrue(TEXT("SetProperties should succeed"), Result.IsSuccess());
+	if (Result.IsFailure())
+		return false;
+
+	TestEqual(TEXT("Every actor should match"), Result.GetValue().MatchedCount, 3);
+	TestEqual(TEXT("Three values per actor should be written"), Result.GetValue().WrittenCount, 9);
+	TestEqual(TEXT("The unknown path should fail on every actor"), Result.GetValue().FailedCount, 3);
+	TestEqual(TEXT("Each actor and its light component should be notified once"), Result.GetValue().UpdatedCount, 6);
+	TestEqual(TEXT("Failures should be listed"), Result.GetValue().Errors.Num(), 3);
+
+	for (const APointLight* Light : Lights) {
+		TestEqual(TEXT("Intensity should be written"), Light->PointLightComponent->Intensity, 42.0f);
+		TestEqual(TEXT("AttenuationRadius should be written"), Light->PointLightComponent->AttenuationRadius, 300.0f);
+		TestTrue(TEXT("Tags should be written"), Light->Tags.Num() == 1 && Light->Tags[0] == FName(TEXT("Swept")));
+	}
+
+	UnrealMCP::FSetPropertiesParams Missing;
+	Missing.Selection.Names = {TEXT("NoSuchActorForSetProperties")};
+	Missing.Properties.Emplace(TEXT("InitialLifeSpan"), MakeShared<FJsonValueNumber>(1.0));
+	UnrealMCPTest::FTestUtils::ValidateErrorCode(
+		UnrealMCP::FActorService::SetProperties(Missing),
+		UnrealMCP::EErrorCode::ActorNotFound,
+		TEXT("NoSuchActorForSetProperties"),
+		this);
+
+	for (APointLight* Light : Lights) {
+		UnrealMCPTest::FTestUtils::DestroyTestActor(World, Light);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FActorServiceQueryActorDescsTest,
+	"UnrealMCP.Actor.QueryActorDescs",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FActorServiceQueryActorDescsTest::RunTest(const FString& Parameters) -> bool {
+	// Test: Descriptor queries and region loads on the editor world, partitioned or not
+
+	UWorld* World = GEditor->GetEditorWorldContext().World();
+	TestNotNull(TEXT("Editor world should be available"), World);
+	if (!World)
+		return false;
+
+	UnrealMCP::FQueryActorDescsParams Params;
+	Params.Limit = 1;
+
+	UnrealMCP::FLoadRegionParams RegionParams;
+	RegionParams.Bounds = FBox(FVector(-100.0), FVector(100.0));
+
+	if (!World->GetWorldPartition()) {
+		UnrealMCPTest::FTestUtils::ValidateErrorCode(
+			UnrealMCP::FActorService::QueryActorDescs(Params),
+			UnrealMCP::EErrorCode::InvalidOperationInCurrentContext,
+			TEXT(""),
+			this);
+		UnrealMCPTest::FTestUtils::ValidateErrorCode(
+			UnrealMCP::FActorService::LoadRegion(RegionParams),
+			UnrealMCP::EErrorCode::InvalidOperationInCurrentContext,
+			TEXT(""),
+			this);
+	}
+	else {
+		const auto Result = UnrealMCP::FActorService::QueryActorDescs(Params);
+		TestTrue(TEXT("QueryActorDescs should succeed"), Result.IsSuccess());
+		if (Result.IsSuccess()) {
+			TestTrue(TEXT("Results should respect the limit"), Result.GetValue().Entries.Num() <= 1);
+			TestTrue(TEXT("Matches should not exceed the descriptors"), Result.GetValue().MatchedCount <= Result.GetValue().TotalCount);
+		}
+
+		const auto Region = UnrealMCP::FActorService::LoadRegion(RegionParams);
+		TestTrue(TEXT("LoadRegion should succeed"), Region.IsSuccess());
+		if (Region.IsSuccess()) {
+			TestEqual(TEXT("Every actor in the region should be loaded"), Region.GetValue().LoadedCount, Region.GetValue().ActorCount);
+			TestTrue(TEXT("UnloadRegion should succeed"), UnrealMCP::FActorService::UnloadRegion(Region.GetValue().RegionId).IsSuccess());
+		}
+	}
+
+	UnrealMCPTest::FTestUtils::ValidateErrorCode(
+		UnrealMCP::FActorService::UnloadRegion(-1),
+		UnrealMCP::EErrorCode::InvalidInput,
+		TEXT("-1"),
+		this);
+
+	auto BadRegion = MakeShared<FJsonObject>();
+	BadRegion->SetObjectField(TEXT("region"), MakeShared<FJsonObject>());
+	UnrealMCPTest::FTestUtils::ValidateErrorCode(
+		UnrealMCP::FLoadRegionParams::FromJson(BadRegion),
+		UnrealMCP::EErrorCode::InvalidInput,
+		TEXT("region"),
+		this);
+
+	return true;
+}
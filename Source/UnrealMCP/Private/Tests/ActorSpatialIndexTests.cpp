@@ -0,0 +1,135 @@
+#include "Editor.h"
+#include "Core/ActorIndex.h"
+#include "Engine/PointLight.h"
+#include "Engine/World.h"
+#include "Misc/AutomationTest.h"
+#include "Services/ActorService.h"
+#include "Tests/TestUtils.h"
+
+namespace {
+	/** Far from the origin so actors already in the editor level do not interfere */
+	const FVector SpatialTestOrigin(2000000.0, 2000000.0, 0.0);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FActorSpatialIndexRegionQueriesTest,
+	"UnrealMCP.ActorIndex.SpatialRegionQueries",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FActorSpatialIndexRegionQueriesTest::RunTest(const FString& Parameters) -> bool {
+	// Test: Radius and box queries return intersecting actors and follow moves
+
+	UWorld* World = GEditor->GetEditorWorldContext().World();
+	TestNotNull(TEXT("Editor world should be available"), World);
+	if (!World)
+		return false;
+
+	TestNotNull(TEXT("World index should be available"), UnrealMCP::FActorIndex::GetWorldIndex(World));
+
+	APointLight* NearActor = UnrealMCPTest::FTestUtils::SpawnTestActor<APointLight>(
+		World, TEXT("SpatialNearActor"), SpatialTestOrigin);
+	APointLight* FarActor = UnrealMCPTest::FTestUtils::SpawnTestActor<APointLight>(
+		World, TEXT("SpatialFarActor"), SpatialTestOrigin + FVector(30000.0, 0.0, 0.0));
+	TestNotNull(TEXT("Near actor should spawn successfully"), NearActor);
+	TestNotNull(TEXT("Far actor should spawn successfully"), FarActor);
+	if (!NearActor || !FarActor)
+		return false;
+
+	const UnrealMCP::FActorQueryFilter NoFilter;
+
+	auto RadiusResult = UnrealMCP::FActorService::FindActorsInRadius(SpatialTestOrigin, 500.0, NoFilter);
+	TestTrue(TEXT("Radius query should succeed"), RadiusResult.IsSuccess());
+	TestTrue(TEXT("Radius query should contain the near actor"), RadiusResult.GetValue().Contains(NearActor));
+	TestFalse(TEXT("Radius query should not contain the far actor"), RadiusResult.GetValue().Contains(FarActor));
+
+	const FBox Box(SpatialTestOrigin - FVector(100.0), SpatialTestOrigin + FVector(31000.0, 100.0, 100.0));
+	auto BoxResult = UnrealMCP::FActorService::FindActorsInBox(Box, NoFilter);
+	TestTrue(TEXT("Box query should succeed"), BoxResult.IsSuccess());
+	TestTrue(TEXT("Box query should contain the near actor"), BoxResult.GetValue().Contains(NearActor));
+	TestTrue(TEXT("Box query should contain the far actor"), BoxResult.GetValue().Contains(FarActor));
+
+	// Moving through the service must refresh the spatial index
+	const UnrealMCP::FVoidResult MoveResult = UnrealMCP::FActorService::SetActorTransform(
+		FarActor->GetName(), SpatialTestOrigin + FVector(100.0, 0.0, 0.0), {}, {});
+	TestTrue(TEXT("Moving the far actor should succeed"), MoveResult.IsSuccess());
+
+	RadiusResult = UnrealMCP::FActorService::FindActorsInRadius(SpatialTestOrigin, 500.0, NoFilter);
+	TestTrue(TEXT("Radius query should contain the moved actor"), RadiusResult.GetValue().Contains(FarActor));
+
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, FarActor);
+
+	RadiusResult = UnrealMCP::FActorService::FindActorsInRadius(SpatialTestOrigin, 500.0, NoFilter);
+	TestFalse(TEXT("Destroyed actor should not be returned"), RadiusResult.GetValue().Contains(FarActor));
+
+	// A change notification refreshes the bounds too, for edits that moved the actor without a move event
+	const FVector ShiftedLocation = SpatialTestOrigin + FVector(0.0, 20000.0, 0.0);
+	NearActor->SetActorLocation(ShiftedLocation);
+	UnrealMCP::FActorIndex::NotifyActorChanged(NearActor);
+	RadiusResult = UnrealMCP::FActorService::FindActorsInRadius(ShiftedLocation, 500.0, NoFilter);
+	TestTrue(TEXT("Changed actor should be found at its new bounds"), RadiusResult.GetValue().Contains(NearActor));
+
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, NearActor);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FActorSpatialIndexNearestTest,
+	"UnrealMCP.ActorIndex.SpatialNearest",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FActorSpatialIndexNearestTest::RunTest(const FString& Parameters) -> bool {
+	// Test: Nearest query orders by distance and applies the tag and class filters
+
+	UWorld* World = GEditor->GetEditorWorldContext().World();
+	TestNotNull(TEXT("Editor world should be available"), World);
+	if (!World)
+		return false;
+
+	TestNotNull(TEXT("World index should be available"), UnrealMCP::FActorIndex::GetWorldIndex(World));
+
+	APointLight* First = UnrealMCPTest::FTestUtils::SpawnTestActor<APointLight>(
+		World, TEXT("SpatialNearestFirst"), SpatialTestOrigin + FVector(200.0, 0.0, 0.0));
+	APointLight* Second = UnrealMCPTest::FTestUtils::SpawnTestActor<APointLight>(
+		World, TEXT("SpatialNearestSecond"), SpatialTestOrigin + FVector(400.0, 0.0, 0.0));
+	TestNotNull(TEXT("First actor should spawn successfully"), First);
+	TestNotNull(TEXT("Second actor should spawn successfully"), Second);
+	if (!First || !Second)
+		return false;
+
+	const UnrealMCP::FActorQueryFilter NoFilter;
+	const auto Result = UnrealMCP::FActorService::FindNearestActors(SpatialTestOrigin, 2, 1000.0, NoFilter);
+	TestTrue(TEXT("Nearest query should succeed"), Result.IsSuccess());
+	TestEqual(TEXT("Nearest query should return two actors"), Result.GetValue().Num(), 2);
+	if (Result.GetValue().Num() == 2) {
+		TestEqual(TEXT("Closest actor should come first"), Result.GetValue()[0].Key, static_cast<AActor*>(First));
+		TestEqual(TEXT("Farther actor should come second"), Result.GetValue()[1].Key, static_cast<AActor*>(Second));
+		TestTrue(TEXT("Distances should be ascending"), Result.GetValue()[0].Value <= Result.GetValue()[1].Value);
+	}
+
+	const FString Tag = UnrealMCPTest::FTestUtils::GenerateUniqueTestName(TEXT("SpatialTag"));
+	Second->Tags.Add(FName(*Tag));
+
+	UnrealMCP::FActorQueryFilter TagFilter;
+	TagFilter.Tags.Add(Tag);
+	const auto TaggedResult = UnrealMCP::FActorService::FindNearestActors(SpatialTestOrigin, 5, 0.0, TagFilter);
+	TestEqual(TEXT("Tag filter should leave one actor"), TaggedResult.GetValue().Num(), 1);
+	if (TaggedResult.GetValue().Num() == 1) {
+		TestEqual(TEXT("Tag filter should keep the tagged actor"), TaggedResult.GetValue()[0].Key, static_cast<AActor*>(Second));
+	}
+
+	UnrealMCP::FActorQueryFilter BadClassFilter;
+	BadClassFilter.ClassName = TEXT("NoSuchActorClassForSpatialTest");
+	const auto BadClassResult = UnrealMCP::FActorService::FindNearestActors(SpatialTestOrigin, 5, 0.0, BadClassFilter);
+	UnrealMCPTest::FTestUtils::ValidateErrorCode(BadClassResult,
+	                                             UnrealMCP::EErrorCode::InvalidActorClass,
+	                                             BadClassFilter.ClassName.GetValue(),
+	                                             this);
+
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, First);
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, Second);
+
+	return true;
+}
@@ -0,0 +1,64 @@
+#include "Core/ActorTransformBatch.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FActorTransformBatchOperationsTest,
+	"UnrealMCP.Actor.TransformBatchOperations",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FActorTransformBatchOperationsTest::RunTest(const FString& Parameters) -> bool {
+	// Test: SIMD batch edits match the scalar transform math, including a partial last quad
+
+	TArray<FTransform> Transforms;
+	for (int32 Index = 0; Index < 7; ++Index) {
+		Transforms.Emplace(
+			FRotator(0.0, 15.0 * Index, 0.0),
+			FVector(100.0 * Index, -37.0 * Index, 12.5 * Index),
+			FVector(1.0 + 0.1 * Index)
+		);
+	}
+
+	UnrealMCP::FActorTransformBatch Batch;
+	for (const FTransform& Transform : Transforms) {
+		Batch.Add(Transform);
+	}
+	TestEqual(TEXT("Batch should hold every transform"), Batch.Num(), Transforms.Num());
+
+	FVector ExpectedCentroid = FVector::ZeroVector;
+	for (const FTransform& Transform : Transforms) {
+		ExpectedCentroid += Transform.GetLocation();
+	}
+	ExpectedCentroid /= Transforms.Num();
+	TestTrue(TEXT("Centroid should ignore padding lanes"), Batch.GetCentroid().Equals(ExpectedCentroid, 1.e-6));
+
+	const FVector Offset(10.0, 20.0, -30.0);
+	const FVector Pivot(50.0, 50.0, 0.0);
+	const FQuat Rotation = FRotator(10.0, 90.0, 0.0).Quaternion();
+	const double Factor = 2.0;
+
+	Batch.Translate(Offset);
+	Batch.RotateAround(Pivot, Rotation);
+	Batch.ScaleAround(Pivot, Factor);
+
+	for (int32 Index = 0; Index < Transforms.Num(); ++Index) {
+		const FTransform& Original = Transforms[Index];
+		const FVector Moved = Original.GetLocation() + Offset;
+		const FVector ExpectedLocation = Pivot + Rotation.RotateVector(Moved - Pivot) * Factor;
+		const FQuat ExpectedRotation = Rotation * Original.GetRotation();
+		const FVector ExpectedScale = Original.GetScale3D() * Factor;
+
+		const FTransform Actual = Batch.GetTransform(Index);
+		TestTrue(FString::Printf(TEXT("Location %d"), Index), Actual.GetLocation().Equals(ExpectedLocation, 1.e-6));
+		TestTrue(FString::Printf(TEXT("Rotation %d"), Index), Actual.GetRotation().Equals(ExpectedRotation, 1.e-6));
+		TestTrue(FString::Printf(TEXT("Scale %d"), Index), Actual.GetScale3D().Equals(ExpectedScale, 1.e-9));
+	}
+
+	// Snapping rounds per axis and leaves axes with a zero grid alone
+	UnrealMCP::FActorTransformBatch SnapBatch;
+	SnapBatch.Add(FTransform(FVector(149.0, -151.0, 7.3)));
+	SnapBatch.SnapToGrid(FVector(100.0, 100.0, 0.0));
+	TestTrue(TEXT("Snapped location"), SnapBatch.GetTransform(0).GetLocation().Equals(FVector(100.0, -200.0, 7.3), 1.e-9));
+
+	return true;
+}
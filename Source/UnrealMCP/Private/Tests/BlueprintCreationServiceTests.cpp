@@ -236,6 +236,70 @@ auto FBlueprintCompilationTest::RunTest(const FString& Parameters) -> bool {
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBlueprintCompileReportTest,
+	"UnrealMCP.Blueprint.CompileReport",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FBlueprintCompileReportTest::RunTest(const FString& Parameters) -> bool {
+	// Test: The compile report carries diagnostics, and phase timings only when profiling was requested
+
+	const FString BlueprintName = TEXT("TestCompileReportBP");
+	UnrealMCPTest::FTestUtils::CleanupTestBlueprintByName(BlueprintName);
+
+	UnrealMCP::FBlueprintCreationParams CreateParams;
+	CreateParams.Name = BlueprintName;
+	CreateParams.ParentClass = TEXT("Actor");
+	CreateParams.PackagePath = TEXT("/Game/Tests/");
+
+	const auto CreateResult = UnrealMCP::FBlueprintCreationService::CreateBlueprint(CreateParams);
+	TestTrue(TEXT("Blueprint should be created for compile report test"), CreateResult.IsSuccess());
+	if (CreateResult.IsFailure()) {
+		return false;
+	}
+
+	// Plain compile: diagnostics only
+	const auto PlainResult = UnrealMCP::FBlueprintCreationService::CompileBlueprint(BlueprintName);
+	TestTrue(TEXT("Plain compile should succeed"), PlainResult.IsSuccess());
+	if (PlainResult.IsSuccess()) {
+		const UnrealMCP::FBlueprintCompileReport& Report = PlainResult.GetValue();
+		TestEqual(TEXT("Report should carry the up-to-date status"), Report.Status, FString(TEXT("up_to_date")));
+		TestEqual(TEXT("Clean blueprint should report no errors"), Report.Errors.Num(), 0);
+		TestEqual(TEXT("Clean blueprint should report no warnings"), Report.Warnings.Num(), 0);
+		TestFalse(TEXT("Plain compile should not report timings"), Report.Timings.IsSet());
+
+		const TSharedPtr<FJsonObject> Json = Report.ToJson();
+		TestFalse(TEXT("Plain compile JSON should have no timings"), Json->HasField(TEXT("timings")));
+	}
+
+	// Profiled compile: phase timings, GC untimed unless requested
+	const auto ProfiledResult = UnrealMCP::FBlueprintCreationService::CompileBlueprint(BlueprintName, true);
+	TestTrue(TEXT("Profiled compile should succeed"), ProfiledResult.IsSuccess());
+	if (ProfiledResult.IsSuccess()) {
+		const UnrealMCP::FBlueprintCompileReport& Report = ProfiledResult.GetValue();
+		TestEqual(TEXT("Profiled report should carry the up-to-date status"), Report.Status, FString(TEXT("up_to_date")));
+		TestTrue(TEXT("Profiled compile should report timings"), Report.Timings.IsSet());
+		if (Report.Timings.IsSet()) {
+			TestTrue(TEXT("Skeleton time should not be negative"), Report.Timings->SkeletonMs >= 0.0);
+			TestTrue(TEXT("Compile time should not be negative"), Report.Timings->CompileMs >= 0.0);
+			TestFalse(TEXT("GC should not be timed unless requested"), Report.Timings->GarbageCollectionMs.IsSet());
+		}
+
+		const TSharedPtr<FJsonObject> Json = Report.ToJson();
+		TestTrue(TEXT("Profiled compile JSON should have timings"), Json->HasField(TEXT("timings")));
+	}
+
+	const auto GarbageResult = UnrealMCP::FBlueprintCreationService::CompileBlueprint(BlueprintName, true, true);
+	TestTrue(TEXT("Profiled compile with GC should succeed"), GarbageResult.IsSuccess());
+	if (GarbageResult.IsSuccess() && GarbageResult.GetValue().Timings.IsSet()) {
+		TestTrue(TEXT("GC should be timed when requested"), GarbageResult.GetValue().Timings->GarbageCollectionMs.IsSet());
+	}
+
+	UnrealMCPTest::FTestUtils::CleanupTestBlueprintByName(BlueprintName);
+	return true;
+}
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
 	FBlueprintCompileNonExistentTest,
 	"UnrealMCP.Blueprint.CompileNonExistent",
@@ -421,3 +485,48 @@ auto FBlueprintCompilationEmptyNameTest::RunTest(const FString& Parameters) -> b
 
 	return true;
 }
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBlueprintCompileBatchTest,
+	"UnrealMCP.Blueprint.CompileBlueprints",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FBlueprintCompileBatchTest::RunTest(const FString& Parameters) -> bool {
+	// Test: Several blueprints compile in one batch; missing names get their own report
+
+	const TArray<FString> BlueprintNames = {TEXT("TestCompileBatchA_BP"), TEXT("TestCompileBatchB_BP")};
+	for (const FString& BlueprintName : BlueprintNames) {
+		UnrealMCPTest::FTestUtils::CleanupTestBlueprintByName(BlueprintName);
+
+		UnrealMCP::FBlueprintCreationParams Params;
+		Params.Name = BlueprintName;
+		Params.ParentClass = TEXT("Actor");
+		Params.PackagePath = TEXT("/Game/Tests/");
+		TestTrue(TEXT("Batch blueprint should be created"), UnrealMCP::FBlueprintCreationService::CreateBlueprint(Params).IsSuccess());
+	}
+
+	UnrealMCP::FCompileBlueprintsParams CompileParams;
+	CompileParams.BlueprintNames = BlueprintNames;
+	CompileParams.BlueprintNames.Add(TEXT("NonExistentCompileBatch_BP"));
+
+	const auto Result = UnrealMCP::FBlueprintCreationService::CompileBlueprints(CompileParams);
+	TestTrue(TEXT("Batch compile should succeed"), Result.IsSuccess());
+
+	if (Result.IsSuccess()) {
+		const TArray<UnrealMCP::FBlueprintCompileReport>& Reports = Result.GetValue().Reports;
+		TestEqual(TEXT("Every requested blueprint should be reported"), Reports.Num(), 3);
+
+		if (Reports.Num() == 3) {
+			TestTrue(TEXT("First blueprint should compile"), Reports[0].IsSuccess());
+			TestTrue(TEXT("Second blueprint should compile"), Reports[1].IsSuccess());
+			TestEqual(TEXT("Missing blueprint should be reported as not found"), Reports[2].Status, FString(TEXT("not_found")));
+			TestFalse(TEXT("Missing blueprint should not count as compiled"), Reports[2].IsSuccess());
+		}
+	}
+
+	for (const FString& BlueprintName : BlueprintNames) {
+		UnrealMCPTest::FTestUtils::CleanupTestBlueprintByName(BlueprintName);
+	}
+	return true;
+}
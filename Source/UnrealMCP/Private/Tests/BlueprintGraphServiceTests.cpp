@@ -7,6 +7,8 @@
 #include "K2Node_VariableGet.h"
 #include "Blueprint/UserWidget.h"
 #include "Core/CommonUtils.h"
+#include "Core/GraphChangeJournal.h"
+#include "Core/GraphNodeIndex.h"
 #include "Dom/JsonObject.h"
 #include "EdGraph/EdGraph.h"
 #include "Engine/Blueprint.h"
@@ -796,3 +798,451 @@ auto FBlueprintGraphServiceComplexGraphTest::RunTest(const FString& Parameters)
 
 	return true;
 }
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGraphNodeIndexFindsNodesInAllGraphsTest,
+	"UnrealMCP.BlueprintGraph.NodeIndexAllGraphs",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FGraphNodeIndexFindsNodesInAllGraphsTest::RunTest(const FString& Parameters) -> bool {
+	// Test: GUID lookups cover function graphs and follow node removal
+
+	UnrealMCP::FBlueprintCreationParams CreationParams = UnrealMCPTest::FTestUtils::CreateTestBlueprintParams(
+		TEXT("NodeIndexTestBlueprint"));
+
+	auto CreationResult = UnrealMCP::FBlueprintCreationService::CreateBlueprint(CreationParams);
+	TestTrue(TEXT("Blueprint creation should succeed"), CreationResult.IsSuccess());
+	UBlueprint* TestBlueprint = CreationResult.GetValue();
+	if (!TestBlueprint)
+		return false;
+
+	UnrealMCP::TResult<UK2Node_Event*> EventResult = UnrealMCP::FBlueprintGraphService::AddEventNode(
+		CreationParams.Name,
+		TEXT("ReceiveBeginPlay"),
+		FVector2D(100.0f, 100.0f)
+	);
+	TestTrue(TEXT("Event node should be created"), EventResult.IsSuccess());
+	UK2Node_Event* EventNode = EventResult.GetValue();
+	if (!EventNode)
+		return false;
+
+	TestEqual(TEXT("Event node should be found by GUID"),
+	          UnrealMCP::FGraphNodeIndex::FindNode(TestBlueprint, EventNode->NodeGuid),
+	          static_cast<UEdGraphNode*>(EventNode));
+
+	// Nodes of function graphs are found through the same blueprint-wide lookup
+	UEdGraph* FunctionGraph = FBlueprintEditorUtils::CreateNewGraph(
+		TestBlueprint,
+		FName(TEXT("NodeIndexTestFunction")),
+		UEdGraph::StaticClass(),
+		UEdGraphSchema_K2::StaticClass());
+	FBlueprintEditorUtils::AddFunctionGraph<UClass>(TestBlueprint, FunctionGraph, true, nullptr);
+	TestTrue(TEXT("Function graph should have an entry node"), FunctionGraph->Nodes.Num() > 0);
+	if (FunctionGraph->Nodes.Num() > 0) {
+		UEdGraphNode* EntryNode = FunctionGraph->Nodes[0];
+		TestEqual(TEXT("Function entry node should be found by GUID"),
+		          UnrealMCP::FGraphNodeIndex::FindNode(TestBlueprint, EntryNode->NodeGuid),
+		          EntryNode);
+	}
+
+	const FGuid EventGuid = EventNode->NodeGuid;
+	EventNode->GetGraph()->RemoveNode(EventNode);
+	TestNull(TEXT("Removed node should no longer be found"),
+	         UnrealMCP::FGraphNodeIndex::FindNode(TestBlueprint, EventGuid));
+
+	const UnrealMCP::FVoidResult ConnectResult = UnrealMCP::FBlueprintGraphService::ConnectNodes(
+		CreationParams.Name,
+		TEXT("not-a-guid"),
+		EventGuid.ToString(),
+		TEXT(""),
+		TEXT("")
+	);
+	UnrealMCPTest::FTestUtils::ValidateErrorCode(ConnectResult, UnrealMCP::EErrorCode::InvalidInput, TEXT(""), this);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FFindPinLookupTableTest,
+	"UnrealMCP.BlueprintGraph.FindPinLookup",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FFindPinLookupTableTest::RunTest(const FString& Parameters) -> bool {
+	// Test: FindPin resolves case-folded names and default exec pins, and follows node reconstruction
+
+	UnrealMCP::FBlueprintCreationParams CreationParams = UnrealMCPTest::FTestUtils::CreateTestBlueprintParams(
+		TEXT("PinLookupTestBlueprint"));
+
+	auto CreationResult = UnrealMCP::FBlueprintCreationService::CreateBlueprint(CreationParams);
+	TestTrue(TEXT("Blueprint creation should succeed"), CreationResult.IsSuccess());
+	if (CreationResult.IsFailure())
+		return false;
+
+	UnrealMCP::TResult<UK2Node_CallFunction*> FunctionResult = UnrealMCP::FBlueprintGraphService::AddFunctionCallNode(
+		CreationParams.Name,
+		TEXT("PrintString"),
+		TOptional<FString>(TEXT("KismetSystemLibrary")),
+		FVector2D(300.0f, 100.0f),
+		MakeShared<FJsonObject>()
+	);
+	TestTrue(TEXT("Function node should be created"), FunctionResult.IsSuccess());
+	UK2Node_CallFunction* FunctionNode = FunctionResult.GetValue();
+	if (!FunctionNode)
+		return false;
+
+	const UEdGraphPin* ExactPin = FCommonUtils::FindPin(FunctionNode, TEXT("InString"), EGPD_Input);
+	TestNotNull(TEXT("InString pin should be found"), ExactPin);
+	TestEqual(TEXT("Case-folded name should resolve to the same pin"),
+	          FCommonUtils::FindPin(FunctionNode, TEXT("instring"), EGPD_Input),
+	          const_cast<UEdGraphPin*>(ExactPin));
+	TestNull(TEXT("Direction filter should reject the input pin"),
+	         FCommonUtils::FindPin(FunctionNode, TEXT("InString"), EGPD_Output));
+	TestNull(TEXT("Unknown pin name should not resolve"),
+	         FCommonUtils::FindPin(FunctionNode, TEXT("NoSuchPinName"), EGPD_Input));
+
+	const UEdGraphPin* DefaultExec = FCommonUtils::FindPin(FunctionNode, TEXT(""), EGPD_Output);
+	TestNotNull(TEXT("Empty name should resolve the default output exec pin"), DefaultExec);
+	if (DefaultExec) {
+		TestEqual(TEXT("Default exec pin should be an exec pin"), DefaultExec->PinType.PinCategory, UEdGraphSchema_K2::PC_Exec);
+	}
+
+	// Reconstruction replaces every pin; lookups must return the live ones
+	FunctionNode->ReconstructNode();
+	const UEdGraphPin* RebuiltPin = FCommonUtils::FindPin(FunctionNode, TEXT("InString"), EGPD_Input);
+	TestNotNull(TEXT("InString pin should be found after reconstruction"), RebuiltPin);
+	TestTrue(TEXT("Returned pin should belong to the node's current pins"),
+	         FunctionNode->Pins.Contains(const_cast<UEdGraphPin*>(RebuiltPin)));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBuildBlueprintGraphTest,
+	"UnrealMCP.BlueprintGraph.BuildGraph",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FBuildBlueprintGraphTest::RunTest(const FString& Parameters) -> bool {
+	// Test: Nodes and links are created in one call, and a failing link leaves the graph untouched
+
+	UnrealMCP::FBlueprintCreationParams CreationParams = UnrealMCPTest::FTestUtils::CreateTestBlueprintParams(
+		TEXT("BuildGraphTestBlueprint"));
+
+	auto CreationResult = UnrealMCP::FBlueprintCreationService::CreateBlueprint(CreationParams);
+	TestTrue(TEXT("Blueprint creation should succeed"), CreationResult.IsSuccess());
+	UBlueprint* TestBlueprint = CreationResult.GetValue();
+	if (!TestBlueprint)
+		return false;
+
+	UEdGraph* EventGraph = FCommonUtils::FindOrCreateEventGraph(TestBlueprint);
+	if (!EventGraph)
+		return false;
+
+	UnrealMCP::FBuildBlueprintGraphParams BuildParams;
+	BuildParams.BlueprintName = CreationParams.Name;
+
+	UnrealMCP::FGraphNodeSpec BeginPlay;
+	BeginPlay.LocalId = TEXT("begin");
+	BeginPlay.Kind = UnrealMCP::EGraphNodeKind::Event;
+	BeginPlay.Name = TEXT("ReceiveBeginPlay");
+	BuildParams.Nodes.Add(BeginPlay);
+
+	UnrealMCP::FGraphNodeSpec Print;
+	Print.LocalId = TEXT("print");
+	Print.Kind = UnrealMCP::EGraphNodeKind::FunctionCall;
+	Print.Name = TEXT("PrintString");
+	Print.Target = FString(TEXT("KismetSystemLibrary"));
+	Print.Position = FVector2D(300.0f, 0.0f);
+	BuildParams.Nodes.Add(Print);
+
+	UnrealMCP::FGraphNodeSpec Self;
+	Self.LocalId = TEXT("self");
+	Self.Kind = UnrealMCP::EGraphNodeKind::Self;
+	BuildParams.Nodes.Add(Self);
+
+	UnrealMCP::FGraphLinkSpec ExecLink;
+	ExecLink.SourceNode = TEXT("begin");
+	ExecLink.TargetNode = TEXT("print");
+	BuildParams.Links.Add(ExecLink);
+
+	const int32 NodeCountBefore = EventGraph->Nodes.Num();
+	auto BuildResult = UnrealMCP::FBlueprintGraphService::BuildGraph(BuildParams);
+	TestTrue(TEXT("Graph build should succeed"), BuildResult.IsSuccess());
+	if (BuildResult.IsFailure())
+		return false;
+
+	const UnrealMCP::FBuildBlueprintGraphResult& Built = BuildResult.GetValue();
+	TestEqual(TEXT("Every node should get a GUID"), Built.NodeIds.Num(), 3);
+	TestEqual(TEXT("One link should be made"), Built.LinkCount, 1);
+
+	UEdGraphNode* PrintNode = nullptr;
+	for (const TPair<FString, FGuid>& NodeId : Built.NodeIds) {
+		UEdGraphNode* Node = UnrealMCP::FGraphNodeIndex::FindNode(EventGraph, NodeId.Value);
+		TestNotNull(FString::Printf(TEXT("Node '%s' should be found by its GUID"), *NodeId.Key), Node);
+		if (NodeId.Key == TEXT("print")) {
+			PrintNode = Node;
+		}
+	}
+	if (PrintNode) {
+		const UEdGraphPin* ExecPin = FCommonUtils::FindPin(PrintNode, TEXT(""), EGPD_Input);
+		TestTrue(TEXT("Print node should be wired to the event"), ExecPin && ExecPin->LinkedTo.Num() == 1);
+	}
+
+	// Two branches merging into one exec input keep both links
+	UnrealMCP::FBuildBlueprintGraphParams MergeParams;
+	MergeParams.BlueprintName = CreationParams.Name;
+	UnrealMCP::FGraphNodeSpec Tick;
+	Tick.LocalId = TEXT("tick");
+	Tick.Kind = UnrealMCP::EGraphNodeKind::Event;
+	Tick.Name = TEXT("ReceiveTick");
+	Tick.Position = FVector2D(0.0f, 300.0f);
+	MergeParams.Nodes.Add(Tick);
+	UnrealMCP::FGraphNodeSpec Branch = Print;
+	Branch.LocalId = TEXT("branch");
+	Branch.Position = FVector2D(300.0f, 300.0f);
+	MergeParams.Nodes.Add(Branch);
+	UnrealMCP::FGraphNodeSpec Merge = Print;
+	Merge.LocalId = TEXT("merge");
+	Merge.Position = FVector2D(600.0f, 150.0f);
+	MergeParams.Nodes.Add(Merge);
+
+	UnrealMCP::FGraphLinkSpec TickLink;
+	TickLink.SourceNode = TEXT("tick");
+	TickLink.TargetNode = TEXT("branch");
+	MergeParams.Links.Add(TickLink);
+	UnrealMCP::FGraphLinkSpec BranchLink;
+	BranchLink.SourceNode = TEXT("branch");
+	BranchLink.TargetNode = TEXT("merge");
+	MergeParams.Links.Add(BranchLink);
+	UnrealMCP::FGraphLinkSpec PrintLink;
+	PrintLink.SourceNode = Built.NodeIds[1].Value.ToString();
+	PrintLink.TargetNode = TEXT("merge");
+	MergeParams.Links.Add(PrintLink);
+
+	auto MergeResult = UnrealMCP::FBlueprintGraphService::BuildGraph(MergeParams);
+	TestTrue(TEXT("Merging build should succeed"), MergeResult.IsSuccess());
+	if (MergeResult.IsSuccess()) {
+		TestEqual(TEXT("Every merging link should be made"), MergeResult.GetValue().LinkCount, 3);
+		UEdGraphNode* MergeNode = UnrealMCP::FGraphNodeIndex::FindNode(EventGraph, MergeResult.GetValue().NodeIds[2].Value);
+		const UEdGraphPin* MergeExec = MergeNode ? FCommonUtils::FindPin(MergeNode, TEXT(""), EGPD_Input) : nullptr;
+		TestTrue(TEXT("Merge exec input should keep both links"), MergeExec && MergeExec->LinkedTo.Num() == 2);
+	}
+
+	// A link to an unknown pin fails the whole build and removes the nodes it created
+	const int32 NodeCountAfterBuild = EventGraph->Nodes.Num();
+	TestTrue(TEXT("Build should have added nodes"), NodeCountAfterBuild > NodeCountBefore);
+
+	UnrealMCP::FBuildBlueprintGraphParams BadParams;
+	BadParams.BlueprintName = CreationParams.Name;
+	UnrealMCP::FGraphNodeSpec SecondPrint = Print;
+	SecondPrint.LocalId = TEXT("print2");
+	BadParams.Nodes.Add(SecondPrint);
+	UnrealMCP::FGraphLinkSpec BadLink;
+	BadLink.SourceNode = TEXT("print2");
+	BadLink.SourcePin = TEXT("NoSuchPin");
+	BadLink.TargetNode = Built.NodeIds[1].Value.ToString();
+	BadParams.Links.Add(BadLink);
+
+	auto BadResult = UnrealMCP::FBlueprintGraphService::BuildGraph(BadParams);
+	UnrealMCPTest::FTestUtils::ValidateErrorCode(BadResult, UnrealMCP::EErrorCode::NodeConnectionFailed, TEXT("NoSuchPin"), this);
+	TestEqual(TEXT("Failed build should leave the node count unchanged"), EventGraph->Nodes.Num(), NodeCountAfterBuild);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBlueprintGraphServiceQueryNodesTest,
+	"UnrealMCP.BlueprintGraph.QueryNodes",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FBlueprintGraphServiceQueryNodesTest::RunTest(const FString& Parameters) -> bool {
+	// Test: Predicates narrow the match set and pages resume from the returned cursor
+
+	UnrealMCP::FBlueprintCreationParams CreationParams = UnrealMCPTest::FTestUtils::CreateTestBlueprintParams(
+		TEXT("QueryNodesTestBlueprint"));
+
+	auto CreationResult = UnrealMCP::FBlueprintCreationService::CreateBlueprint(CreationParams);
+	TestTrue(TEXT("Blueprint creation should succeed"), CreationResult.IsSuccess());
+	if (CreationResult.IsFailure())
+		return false;
+
+	UnrealMCP::FBuildBlueprintGraphParams BuildParams;
+	BuildParams.BlueprintName = CreationParams.Name;
+
+	UnrealMCP::FGraphNodeSpec BeginPlay;
+	BeginPlay.LocalId = TEXT("begin");
+	BeginPlay.Kind = UnrealMCP::EGraphNodeKind::Event;
+	BeginPlay.Name = TEXT("ReceiveBeginPlay");
+	BuildParams.Nodes.Add(BeginPlay);
+
+	UnrealMCP::FGraphNodeSpec Print;
+	Print.Kind = UnrealMCP::EGraphNodeKind::FunctionCall;
+	Print.Name = TEXT("PrintString");
+	Print.Target = FString(TEXT("KismetSystemLibrary"));
+	Print.LocalId = TEXT("print_linked");
+	Print.Position = FVector2D(300.0f, 0.0f);
+	BuildParams.Nodes.Add(Print);
+	Print.LocalId = TEXT("print_loose");
+	Print.Position = FVector2D(300.0f, 400.0f);
+	BuildParams.Nodes.Add(Print);
+
+	UnrealMCP::FGraphLinkSpec ExecLink;
+	ExecLink.SourceNode = TEXT("begin");
+	ExecLink.TargetNode = TEXT("print_linked");
+	BuildParams.Links.Add(ExecLink);
+
+	auto BuildResult = UnrealMCP::FBlueprintGraphService::BuildGraph(BuildParams);
+	TestTrue(TEXT("Graph build should succeed"), BuildResult.IsSuccess());
+	if (BuildResult.IsFailure())
+		return false;
+
+	UnrealMCP::FBlueprintNodeQuery Query;
+	Query.BlueprintName = CreationParams.Name;
+	Query.FunctionName = FString(TEXT("PrintString"));
+	Query.Limit = 1;
+
+	auto FirstPage = UnrealMCP::FBlueprintGraphService::QueryNodes(Query);
+	TestTrue(TEXT("First page should succeed"), FirstPage.IsSuccess());
+	if (FirstPage.IsFailure())
+		return false;
+	TestEqual(TEXT("First page should hold one node"), FirstPage.GetValue().Nodes.Num(), 1);
+	TestTrue(TEXT("First page should return a cursor"), FirstPage.GetValue().NextCursor.IsSet());
+
+	Query.Cursor = FirstPage.GetValue().NextCursor.Get(FString());
+	auto SecondPage = UnrealMCP::FBlueprintGraphService::QueryNodes(Query);
+	TestTrue(TEXT("Second page should succeed"), SecondPage.IsSuccess());
+	if (SecondPage.IsFailure())
+		return false;
+	TestEqual(TEXT("Second page should hold the other node"), SecondPage.GetValue().Nodes.Num(), 1);
+	TestFalse(TEXT("Second page should be the last"), SecondPage.GetValue().NextCursor.IsSet());
+	TestTrue(TEXT("Pages should not overlap"), FirstPage.GetValue().Nodes[0] != SecondPage.GetValue().Nodes[0]);
+
+	// Connectivity and position each single out one of the calls
+	Query.Cursor.Empty();
+	Query.Limit = 100;
+	Query.bConnected = true;
+	auto ConnectedResult = UnrealMCP::FBlueprintGraphService::QueryNodes(Query);
+	TestTrue(TEXT("Connected query should match only the linked call"),
+	         ConnectedResult.IsSuccess() && ConnectedResult.GetValue().Nodes.Num() == 1);
+
+	Query.bConnected.Reset();
+	Query.Bounds = FBox2D(FVector2D(200.0f, 300.0f), FVector2D(400.0f, 500.0f));
+	auto BoundsResult = UnrealMCP::FBlueprintGraphService::QueryNodes(Query);
+	TestTrue(TEXT("Position query should match only the loose call"),
+	         BoundsResult.IsSuccess() && BoundsResult.GetValue().Nodes.Num() == 1);
+
+	// A name that was never interned matches nothing without scanning
+	Query.Bounds.Reset();
+	Query.FunctionName = FString(TEXT("NoSuchFunction_QueryNodesTest"));
+	auto MissingResult = UnrealMCP::FBlueprintGraphService::QueryNodes(Query);
+	TestTrue(TEXT("Unknown function should match nothing"),
+	         MissingResult.IsSuccess() && MissingResult.GetValue().Nodes.Num() == 0);
+
+	Query.FunctionName.Reset();
+	Query.Cursor = TEXT("not-a-cursor");
+	auto BadCursorResult = UnrealMCP::FBlueprintGraphService::QueryNodes(Query);
+	UnrealMCPTest::FTestUtils::ValidateErrorCode(BadCursorResult, UnrealMCP::EErrorCode::InvalidInput, TEXT("cursor"), this);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBlueprintGraphServiceExportGraphTest,
+	"UnrealMCP.BlueprintGraph.ExportGraph",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FBlueprintGraphServiceExportGraphTest::RunTest(const FString& Parameters) -> bool {
+	// Test: A full export is followed by empty deltas until a node is moved or removed
+
+	UnrealMCP::FBlueprintCreationParams CreationParams = UnrealMCPTest::FTestUtils::CreateTestBlueprintParams(
+		TEXT("ExportGraphTestBlueprint"));
+
+	auto CreationResult = UnrealMCP::FBlueprintCreationService::CreateBlueprint(CreationParams);
+	TestTrue(TEXT("Blueprint creation should succeed"), CreationResult.IsSuccess());
+	if (CreationResult.IsFailure())
+		return false;
+
+	UEdGraph* EventGraph = FCommonUtils::FindOrCreateEventGraph(CreationResult.GetValue());
+	if (!EventGraph)
+		return false;
+
+	auto PrintResult = UnrealMCP::FBlueprintGraphService::AddFunctionCallNode(
+		CreationParams.Name, TEXT("PrintString"), TOptional<FString>(TEXT("KismetSystemLibrary")),
+		FVector2D(300.0f, 0.0f), nullptr);
+	TestTrue(TEXT("Function call node should be created"), PrintResult.IsSuccess());
+	if (PrintResult.IsFailure())
+		return false;
+	UK2Node_CallFunction* PrintNode = PrintResult.GetValue();
+
+	const auto FindEventGraph = [EventGraph](const UnrealMCP::FBlueprintGraphExport& Export) {
+		return Export.Graphs.FindByPredicate([EventGraph](const UnrealMCP::FBlueprintGraphExport::FGraph& Entry) {
+			return Entry.Graph == EventGraph;
+		});
+	};
+
+	UnrealMCP::FExportBlueprintGraphParams Params;
+	Params.BlueprintName = CreationParams.Name;
+
+	auto FullExport = UnrealMCP::FBlueprintGraphService::ExportGraph(Params);
+	TestTrue(TEXT("Full export should succeed"), FullExport.IsSuccess());
+	if (FullExport.IsFailure() || !FindEventGraph(FullExport.GetValue()))
+		return false;
+	const UnrealMCP::FBlueprintGraphExport::FGraph* FullGraph = FindEventGraph(FullExport.GetValue());
+	TestTrue(TEXT("Full export should be marked full"), FullGraph->Changes.bFull);
+	TestTrue(TEXT("Full export should contain the call"), FullGraph->Changes.ChangedNodes.Contains(PrintNode));
+	const int64 Version = FullGraph->Changes.Version;
+
+	Params.Since = Version;
+	auto NoChanges = UnrealMCP::FBlueprintGraphService::ExportGraph(Params);
+	TestTrue(TEXT("Unchanged graph should export no nodes"),
+	         NoChanges.IsSuccess() && FindEventGraph(NoChanges.GetValue())->Changes.ChangedNodes.Num() == 0);
+
+	PrintNode->NodePosX += 100;
+	auto MovedExport = UnrealMCP::FBlueprintGraphService::ExportGraph(Params);
+	TestTrue(TEXT("Moved export should succeed"), MovedExport.IsSuccess());
+	if (MovedExport.IsFailure())
+		return false;
+	const UnrealMCP::FBlueprintGraphExport::FGraph* MovedGraph = FindEventGraph(MovedExport.GetValue());
+	TestFalse(TEXT("Delta export should not be full"), MovedGraph->Changes.bFull);
+	TestEqual(TEXT("Only the moved node should be exported"), MovedGraph->Changes.ChangedNodes.Num(), 1);
+	TestTrue(TEXT("Graph version should advance"), MovedGraph->Changes.Version > Version);
+
+	const FGuid PrintGuid = PrintNode->NodeGuid;
+	EventGraph->RemoveNode(PrintNode);
+	auto RemovedExport = UnrealMCP::FBlueprintGraphService::ExportGraph(Params);
+	TestTrue(TEXT("Removed node should be reported"),
+	         RemovedExport.IsSuccess() && FindEventGraph(RemovedExport.GetValue())->Changes.RemovedNodes.Contains(PrintGuid));
+	if (RemovedExport.IsFailure())
+		return false;
+	const int64 RemovedVersion = FindEventGraph(RemovedExport.GetValue())->Changes.Version;
+
+	// Once the removal leaves the retained window its tombstone is pruned and older versions get a full export
+	auto MovingResult = UnrealMCP::FBlueprintGraphService::AddFunctionCallNode(
+		CreationParams.Name, TEXT("PrintString"), TOptional<FString>(TEXT("KismetSystemLibrary")),
+		FVector2D(600.0f, 0.0f), nullptr);
+	TestTrue(TEXT("Second function call node should be created"), MovingResult.IsSuccess());
+	if (MovingResult.IsFailure())
+		return false;
+
+	using UnrealMCP::FGraphChangeJournal;
+	FGraphChangeJournal::FGraphChanges Changes;
+	for (int32 Step = 0; Step < FGraphChangeJournal::MaxRetainedVersions; ++Step) {
+		MovingResult.GetValue()->NodePosY += 10;
+		Changes = {};
+		FGraphChangeJournal::GetChanges(EventGraph, RemovedVersion, Changes);
+	}
+	TestTrue(TEXT("A version before the window should get a full export"), Changes.bFull);
+
+	const int64 LatestVersion = Changes.Version;
+	MovingResult.GetValue()->NodePosY += 10;
+	Changes = {};
+	FGraphChangeJournal::GetChanges(EventGraph, LatestVersion, Changes);
+	TestFalse(TEXT("A recent version should still get a delta"), Changes.bFull);
+	TestEqual(TEXT("Delta should list only the moved node"), Changes.ChangedNodes.Num(), 1);
+
+	return true;
+}
@@ -6,6 +6,7 @@
 #include "Components/PointLightComponent.h"
 #include "Components/SceneComponent.h"
 #include "Components/StaticMeshComponent.h"
+#include "Core/BlueprintSearchIndex.h"
 #include "Core/CommonUtils.h"
 #include "Core/MCPTypes.h"
 #include "Engine/Blueprint.h"
@@ -15,8 +16,10 @@
 #include "Misc/AutomationTest.h"
 #include "Misc/Paths.h"
 #include "Services/BlueprintCreationService.h"
+#include "Services/BlueprintGraphService.h"
 #include "Services/BlueprintIntrospectionService.h"
 #include "Services/BlueprintService.h"
+#include "Tests/TestUtils.h"
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
 	FBlueprintIntrospectionServiceCreateTestBlueprintsTest,
@@ -979,3 +982,52 @@ auto FBlueprintIntrospectionServiceComplexScenarioTest::RunTest(const FString& P
 
 	return true;
 }
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBlueprintIntrospectionServiceSearchBlueprintsTest,
+	"UnrealMCP.BlueprintIntrospection.SearchBlueprints",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FBlueprintIntrospectionServiceSearchBlueprintsTest::RunTest(const FString& Parameters) -> bool {
+	// Test: An indexed blueprint is found by the names its nodes reference, and drops out when removed
+
+	const UnrealMCP::FBlueprintCreationParams CreationParams = UnrealMCPTest::FTestUtils::CreateTestBlueprintParams(
+		TEXT("SearchIndexTestBlueprint"));
+
+	auto CreationResult = UnrealMCP::FBlueprintCreationService::CreateBlueprint(CreationParams);
+	TestTrue(TEXT("Blueprint creation should succeed"), CreationResult.IsSuccess());
+	if (CreationResult.IsFailure())
+		return false;
+	const UBlueprint* Blueprint = CreationResult.GetValue();
+	const FString BlueprintPath = Blueprint->GetPathName();
+
+	auto NodeResult = UnrealMCP::FBlueprintGraphService::AddFunctionCallNode(
+		CreationParams.Name, TEXT("PrintString"), TOptional<FString>(TEXT("KismetSystemLibrary")),
+		FVector2D(0.0f, 0.0f), nullptr);
+	TestTrue(TEXT("Function call node should be created"), NodeResult.IsSuccess());
+
+	UnrealMCP::FBlueprintSearchIndex::IndexBlueprint(Blueprint, FDateTime::UtcNow());
+	TestTrue(TEXT("Blueprint should be indexed"), UnrealMCP::FBlueprintSearchIndex::IsIndexed(BlueprintPath));
+
+	UnrealMCP::FSearchBlueprintsParams Params;
+	Params.Name = TEXT("printstring");
+	Params.Kind = UnrealMCP::EBlueprintReferenceKind::FunctionCall;
+	Params.Path = BlueprintPath;
+
+	auto SearchResult = UnrealMCP::FBlueprintIntrospectionService::SearchBlueprints(Params);
+	TestTrue(TEXT("Search should succeed"), SearchResult.IsSuccess());
+	TestEqual(TEXT("Search should find the call, case-insensitively"), SearchResult.GetValue().Hits.Num(), 1);
+
+	Params.Kind = UnrealMCP::EBlueprintReferenceKind::VariableRead;
+	SearchResult = UnrealMCP::FBlueprintIntrospectionService::SearchBlueprints(Params);
+	TestEqual(TEXT("Kind filter should exclude the call"), SearchResult.GetValue().TotalMatches, 0);
+
+	UnrealMCP::FBlueprintSearchIndex::RemoveBlueprint(BlueprintPath);
+	Params.Kind.Reset();
+	SearchResult = UnrealMCP::FBlueprintIntrospectionService::SearchBlueprints(Params);
+	TestEqual(TEXT("Removed blueprint should no longer match"), SearchResult.GetValue().TotalMatches, 0);
+
+	UnrealMCPTest::FTestUtils::CleanupTestBlueprintByName(CreationParams.Name);
+	return true;
+}
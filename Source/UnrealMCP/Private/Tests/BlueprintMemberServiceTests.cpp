@@ -2,6 +2,7 @@
 #include "EditorAssetLibrary.h"
 #include "K2Node_FunctionEntry.h"
 #include "K2Node_FunctionResult.h"
+#include "Core/BlueprintCompileCoordinator.h"
 #include "Core/MCPTypes.h"
 #include "EdGraph/EdGraph.h"
 #include "Engine/Blueprint.h"
@@ -1104,3 +1105,136 @@ auto FBlueprintMemberServiceRemoveVariableEdgeCasesTest::RunTest(const FString&
 
 	return true;
 }
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBlueprintMemberServiceDeferredCompileTest,
+	"UnrealMCP.BlueprintMember.DeferredCompile",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FBlueprintMemberServiceDeferredCompileTest::RunTest(const FString& Parameters) -> bool {
+	// Test: consecutive member edits are compiled once, and idle-time compiles are reported afterwards
+
+	const FString BlueprintName = UnrealMCPTest::FTestUtils::GenerateUniqueTestName(TEXT("TestBP_DeferredCompile"));
+
+	UnrealMCP::FBlueprintCreationParams CreateParams;
+	CreateParams.Name = BlueprintName;
+	CreateParams.ParentClass = TEXT("Actor");
+	CreateParams.PackagePath = UnrealMCPTest::FTestUtils::GetTestPackagePath();
+
+	const auto CreateResult = UnrealMCP::FBlueprintCreationService::CreateBlueprint(CreateParams);
+	TestTrue(TEXT("Blueprint creation should succeed"), CreateResult.IsSuccess());
+	if (CreateResult.IsFailure())
+		return false;
+	UBlueprint* Blueprint = CreateResult.GetValue();
+
+	UnrealMCP::FBlueprintCompileCoordinator::TakeCompletedCompiles();
+	TestTrue(TEXT("First AddVariable should succeed"),
+	         UnrealMCP::FBlueprintMemberService::AddVariable(BlueprintName, TEXT("BatchVarA"), TEXT("Float"), false).IsSuccess());
+	TestTrue(TEXT("Second AddVariable should succeed"),
+	         UnrealMCP::FBlueprintMemberService::AddVariable(BlueprintName, TEXT("BatchVarB"), TEXT("Integer"), false).IsSuccess());
+	TestTrue(TEXT("Compile should be pending after the edits"),
+	         UnrealMCP::FBlueprintCompileCoordinator::IsPending(Blueprint));
+
+	// FlushAll is what the idle flush runs; its records wait for the next response
+	UnrealMCP::FBlueprintCompileCoordinator::FlushAll();
+	TestFalse(TEXT("Compile should no longer be pending after the flush"),
+	          UnrealMCP::FBlueprintCompileCoordinator::IsPending(Blueprint));
+	int32 NumCompiles = 0;
+	for (const auto& Record : UnrealMCP::FBlueprintCompileCoordinator::TakeCompletedCompiles()) {
+		NumCompiles += Record.BlueprintName == BlueprintName ? 1 : 0;
+	}
+	TestEqual(TEXT("Both edits should share one compile record"), NumCompiles, 1);
+	TestNotNull(TEXT("Generated class should have the first variable"),
+	            Blueprint->GeneratedClass->FindPropertyByName(TEXT("BatchVarA")));
+	TestNotNull(TEXT("Generated class should have the second variable"),
+	            Blueprint->GeneratedClass->FindPropertyByName(TEXT("BatchVarB")));
+
+	// Outside a batch the request stays pending until something needs the generated class
+	TestTrue(TEXT("AddFunction should succeed"),
+	         UnrealMCP::FBlueprintMemberService::AddFunction(BlueprintName, TEXT("DeferredFunction")).IsSuccess());
+	TestTrue(TEXT("Compile should be pending after a single edit"),
+	         UnrealMCP::FBlueprintCompileCoordinator::IsPending(Blueprint));
+	TestTrue(TEXT("Flush should compile the pending blueprint"),
+	         UnrealMCP::FBlueprintCompileCoordinator::Flush(Blueprint));
+	TestNotNull(TEXT("Generated class should have the new function"),
+	            Blueprint->GeneratedClass->FindFunctionByName(TEXT("DeferredFunction")));
+
+	const FString BlueprintPath = UnrealMCPTest::FTestUtils::GetTestAssetPath(BlueprintName);
+	UnrealMCPTest::FTestUtils::CleanupTestAsset(BlueprintPath);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBlueprintMemberServiceSkeletonCompileTest,
+	"UnrealMCP.BlueprintMember.SkeletonOnlyCompile",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FBlueprintMemberServiceSkeletonCompileTest::RunTest(const FString& Parameters) -> bool {
+	// Test: metadata edits request a skeleton-only compile, and Flush upgrades it to a full compile
+
+	using UnrealMCP::FBlueprintCompileCoordinator;
+
+	const FString BlueprintName = UnrealMCPTest::FTestUtils::GenerateUniqueTestName(TEXT("TestBP_SkeletonCompile"));
+
+	UnrealMCP::FBlueprintCreationParams CreateParams;
+	CreateParams.Name = BlueprintName;
+	CreateParams.ParentClass = TEXT("Actor");
+	CreateParams.PackagePath = UnrealMCPTest::FTestUtils::GetTestPackagePath();
+
+	const auto CreateResult = UnrealMCP::FBlueprintCreationService::CreateBlueprint(CreateParams);
+	TestTrue(TEXT("Blueprint creation should succeed"), CreateResult.IsSuccess());
+	if (CreateResult.IsFailure())
+		return false;
+	UBlueprint* Blueprint = CreateResult.GetValue();
+
+	TestTrue(TEXT("AddVariable should succeed"),
+	         UnrealMCP::FBlueprintMemberService::AddVariable(BlueprintName, TEXT("MetaVar"), TEXT("Float"), false).IsSuccess());
+	FBlueprintCompileCoordinator::Flush(Blueprint);
+	FBlueprintCompileCoordinator::TakeCompletedCompiles();
+
+	TestTrue(TEXT("SetVariableMetadata should succeed"),
+	         UnrealMCP::FBlueprintMemberService::SetVariableMetadata(
+		         BlueprintName,
+		         TEXT("MetaVar"),
+		         TOptional<FString>(TEXT("Tooltip text")),
+		         TOptional<FString>(TEXT("Tuning")),
+		         TOptional<bool>(),
+		         TOptional<bool>(),
+		         TOptional<bool>()).IsSuccess());
+
+	const TArray<TPair<FString, UnrealMCP::EBlueprintCompileMode>> Pending = FBlueprintCompileCoordinator::GetPending();
+	const TPair<FString, UnrealMCP::EBlueprintCompileMode>* PendingEntry = Pending.FindByPredicate(
+		[&BlueprintName](const TPair<FString, UnrealMCP::EBlueprintCompileMode>& Entry) {
+			return Entry.Key == BlueprintName;
+		});
+	TestNotNull(TEXT("Metadata edit should leave a pending compile"), PendingEntry);
+	if (PendingEntry) {
+		TestTrue(TEXT("Pending compile should be skeleton-only"), PendingEntry->Value == UnrealMCP::EBlueprintCompileMode::SkeletonOnly);
+	}
+
+	FBlueprintCompileCoordinator::FlushAll();
+	TArray<FBlueprintCompileCoordinator::FCompileRecord> Completed = FBlueprintCompileCoordinator::TakeCompletedCompiles();
+	const FBlueprintCompileCoordinator::FCompileRecord* SkeletonRecord = Completed.FindByPredicate(
+		[&BlueprintName](const FBlueprintCompileCoordinator::FCompileRecord& Record) {
+			return Record.BlueprintName == BlueprintName;
+		});
+	TestNotNull(TEXT("FlushAll should compile the blueprint"), SkeletonRecord);
+	if (SkeletonRecord) {
+		TestTrue(TEXT("FlushAll should use the requested skeleton-only mode"), SkeletonRecord->Mode == UnrealMCP::EBlueprintCompileMode::SkeletonOnly);
+	}
+
+	// The generated class is stale after a skeleton-only compile, so Flush must run a full compile
+	TestTrue(TEXT("Flush should full-compile after a skeleton-only compile"), FBlueprintCompileCoordinator::Flush(Blueprint));
+	Completed = FBlueprintCompileCoordinator::TakeCompletedCompiles();
+	TestTrue(TEXT("Flush should record a full compile"),
+	         Completed.Num() == 1 && Completed[0].Mode == UnrealMCP::EBlueprintCompileMode::Full);
+	TestFalse(TEXT("A second Flush should be a no-op"), FBlueprintCompileCoordinator::Flush(Blueprint));
+
+	const FString BlueprintPath = UnrealMCPTest::FTestUtils::GetTestAssetPath(BlueprintName);
+	UnrealMCPTest::FTestUtils::CleanupTestAsset(BlueprintPath);
+
+	return true;
+}
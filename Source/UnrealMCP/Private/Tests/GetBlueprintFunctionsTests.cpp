@@ -1,4 +1,5 @@
-﻿#include "Engine/Blueprint.h"
+﻿#include "Core/BlueprintCompileCoordinator.h"
+#include "Engine/Blueprint.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/KismetEditorUtilities.h"
 #include "K2Node_FunctionEntry.h"
@@ -7,6 +8,7 @@
 #include "EdGraph/EdGraphNode.h"
 #include "EdGraph/EdGraphPin.h"
 #include "Misc/AutomationTest.h"
+#include "Services/BlueprintCreationService.h"
 #include "Services/BlueprintMemberService.h"
 #include "Tests/TestUtils.h"
 #include "Types/BlueprintIntrospectionTypes.h"
@@ -453,3 +455,55 @@ auto FBlueprintMemberServiceGetFunctionsParameterAndReturnTypes::RunTest(const F
 
 	return true;
 }
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBlueprintMemberServiceGetFunctionsWithoutCompile,
+                                 "UnrealMCP.BlueprintMemberService.GetFunctions.WithoutCompile",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+auto FBlueprintMemberServiceGetFunctionsWithoutCompile::RunTest(const FString& Parameters) -> bool {
+	// Test: reads are served from the graphs and leave deferred compiles alone unless require_compiled is set
+
+	const FString BlueprintName = UnrealMCPTest::FTestUtils::GenerateUniqueTestName(TEXT("TestBP_FunctionsNoCompile"));
+	const FString FunctionName = TEXT("UncompiledFunction");
+
+	UnrealMCP::FBlueprintCreationParams CreateParams;
+	CreateParams.Name = BlueprintName;
+	CreateParams.ParentClass = TEXT("Actor");
+	CreateParams.PackagePath = UnrealMCPTest::FTestUtils::GetTestPackagePath();
+
+	const auto CreateResult = UnrealMCP::FBlueprintCreationService::CreateBlueprint(CreateParams);
+	TestTrue(TEXT("Blueprint creation should succeed"), CreateResult.IsSuccess());
+	if (CreateResult.IsFailure())
+		return false;
+	UBlueprint* Blueprint = CreateResult.GetValue();
+
+	TestTrue(TEXT("AddFunction should succeed"),
+	         UnrealMCP::FBlueprintMemberService::AddFunction(BlueprintName, FunctionName).IsSuccess());
+	TestTrue(TEXT("SetFunctionMetadata should succeed"),
+	         UnrealMCP::FBlueprintMemberService::SetFunctionMetadata(
+		         BlueprintName, FunctionName, TOptional<FString>(TEXT("Uncompiled")), TOptional<FString>(), TOptional<bool>()).IsSuccess());
+
+	auto ReadResult = UnrealMCP::FBlueprintMemberService::GetFunctions(BlueprintName);
+	TestTrue(TEXT("GetFunctions should succeed"), ReadResult.IsSuccess());
+	TestTrue(TEXT("A plain read should not compile"), UnrealMCP::FBlueprintCompileCoordinator::IsPending(Blueprint));
+
+	if (ReadResult.IsSuccess()) {
+		const UnrealMCP::FBlueprintFunctionInfo* Info = ReadResult.GetValue().Functions.FindByPredicate(
+			[&FunctionName](const UnrealMCP::FBlueprintFunctionInfo& Function) {
+				return Function.Name == FunctionName;
+			});
+		TestNotNull(TEXT("Uncompiled function should be listed"), Info);
+		if (Info) {
+			TestEqual(TEXT("Category should come from the entry node"), Info->Category, FString(TEXT("Uncompiled")));
+		}
+	}
+
+	auto CompiledResult = UnrealMCP::FBlueprintMemberService::GetFunctions(BlueprintName, true);
+	TestTrue(TEXT("GetFunctions with require_compiled should succeed"), CompiledResult.IsSuccess());
+	TestFalse(TEXT("require_compiled should flush the deferred compile"), UnrealMCP::FBlueprintCompileCoordinator::IsPending(Blueprint));
+
+	const FString BlueprintPath = UnrealMCPTest::FTestUtils::GetTestAssetPath(BlueprintName);
+	UnrealMCPTest::FTestUtils::CleanupTestAsset(BlueprintPath);
+
+	return true;
+}
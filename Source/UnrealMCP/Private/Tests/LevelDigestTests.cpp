@@ -0,0 +1,77 @@
+#include "Core/LevelDigest.h"
+#include "Engine/PointLight.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/TestUtils.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FLevelDigestIncrementalTest,
+	"UnrealMCP.LevelDigest.Incremental",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FLevelDigestIncrementalTest::RunTest(const FString& Parameters) -> bool {
+	// Test: Actor changes move the root digest, diffs name them, and undoing them restores the digest
+
+	UWorld* World = GEditor->GetEditorWorldContext().World();
+	TestNotNull(TEXT("Editor world should be available"), World);
+	if (!World)
+		return false;
+
+	using UnrealMCP::FLevelDigest;
+
+	FLevelDigest::FNodeDigest Before;
+	TestTrue(TEXT("World node should exist"), FLevelDigest::GetDigest(World, FString(), 1, false, true, Before));
+
+	APointLight* Light = UnrealMCPTest::FTestUtils::SpawnTestActor<APointLight>(World, TEXT("DigestLight"));
+	TestNotNull(TEXT("Test light should spawn"), Light);
+	if (!Light)
+		return false;
+	const FString LightName = Light->GetName();
+
+	FLevelDigest::FNodeDigest Added;
+	FLevelDigest::GetDigest(World, FString(), 1, false, false, Added);
+	TestNotEqual(TEXT("Spawning should change the root digest"), Added.Digest, Before.Digest);
+	TestEqual(TEXT("Spawning should count one more actor"), Added.ActorCount, Before.ActorCount + 1);
+
+	FLevelDigest::FChanges Changes;
+	FLevelDigest::GetChanges(World, Before.Digest, Changes);
+	TestFalse(TEXT("A digest handed out earlier should be diffable"), Changes.bFull);
+	TestEqual(TEXT("Diff should list only the new actor"), Changes.ChangedActors.Num(), 1);
+	TestTrue(TEXT("Diff should name the new actor"), Changes.ChangedActors.Num() == 1 && Changes.ChangedActors[0].Key == LightName);
+
+	// Moving changes the digest; moving back restores it
+	Light->SetActorLocation(FVector(500.0, 0.0, 0.0));
+	GEngine->BroadcastOnActorMoved(Light);
+	FLevelDigest::FNodeDigest Moved;
+	FLevelDigest::GetDigest(World, FString(), 0, false, false, Moved);
+	TestNotEqual(TEXT("Moving should change the root digest"), Moved.Digest, Added.Digest);
+
+	Light->SetActorLocation(FVector::ZeroVector);
+	GEngine->BroadcastOnActorMoved(Light);
+	FLevelDigest::FNodeDigest MovedBack;
+	FLevelDigest::GetDigest(World, FString(), 0, false, false, MovedBack);
+	TestEqual(TEXT("Moving back should restore the root digest"), MovedBack.Digest, Added.Digest);
+
+	// An untouched subtree keeps its digest
+	FLevelDigest::FNodeDigest Rehashed;
+	FLevelDigest::GetDigest(World, FString(), 0, false, true, Rehashed);
+	TestEqual(TEXT("Rehashing without changes should keep the digest"), Rehashed.Digest, MovedBack.Digest);
+
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, Light);
+	FLevelDigest::FNodeDigest Removed;
+	FLevelDigest::GetDigest(World, FString(), 0, false, false, Removed);
+	TestEqual(TEXT("Removing the actor should restore the original digest"), Removed.Digest, Before.Digest);
+
+	FLevelDigest::FChanges RemovedChanges;
+	FLevelDigest::GetChanges(World, Added.Digest, RemovedChanges);
+	TestTrue(TEXT("Diff should list the removed actor"), RemovedChanges.RemovedActors.Contains(LightName));
+
+	FLevelDigest::FChanges Unknown;
+	FLevelDigest::GetChanges(World, Before.Digest ^ 0x5A5A5A5A5A5A5A5Aull, Unknown);
+	TestTrue(TEXT("An unknown digest should ask for a full walk"), Unknown.bFull);
+
+	uint64 Parsed = 0;
+	TestTrue(TEXT("Hex digests should round trip"), FLevelDigest::ParseHex(FLevelDigest::ToHex(Added.Digest), Parsed) && Parsed == Added.Digest);
+	TestFalse(TEXT("Non-hex digests should be rejected"), FLevelDigest::ParseHex(TEXT("xyz"), Parsed));
+	return true;
+}
@@ -0,0 +1,187 @@
+#include "Editor.h"
+#include "MCPServerRunnable.h"
+#include "UnrealMCPBridge.h"
+#include "Core/LevelEventStream.h"
+#include "Core/PropertyPath.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Engine/PointLight.h"
+#include "Misc/AutomationTest.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Tests/TestUtils.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FLevelEventStreamCoalesceTest,
+	"UnrealMCP.LevelEvents.CoalescePerFrame",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FLevelEventStreamCoalesceTest::RunTest(const FString& Parameters) -> bool {
+	// Test: Changes within a frame collapse to one event per kind, and queues are bounded
+
+	UWorld* World = GEditor->GetEditorWorldContext().World();
+	TestNotNull(TEXT("Editor world should be available"), World);
+	if (!World)
+		return false;
+
+	using UnrealMCP::ELevelEventKind;
+	using UnrealMCP::FLevelEventBatch;
+	using UnrealMCP::FLevelEventStream;
+
+	UnrealMCP::FLevelEventFilter Filter;
+	Filter.NamePattern = UnrealMCP::FNamePattern::Compile(TEXT("LevelEventLight"), UnrealMCP::FNamePattern::EMode::Contains, true).GetValue();
+	const int32 SubscriptionId = FLevelEventStream::Subscribe(Filter, 64);
+	FLevelEventStream::Flush();
+
+	APointLight* Light = UnrealMCPTest::FTestUtils::SpawnTestActor<APointLight>(World, TEXT("LevelEventLight"));
+	TestNotNull(TEXT("Test light should spawn"), Light);
+	if (!Light) {
+		FLevelEventStream::Unsubscribe(SubscriptionId, FLevelEventStream::GetCurrentSession());
+		return false;
+	}
+
+	// A new actor is reported once, with the transform it ends the frame with
+	Light->SetActorLocation(FVector(100.0, 0.0, 0.0));
+	GEngine->BroadcastOnActorMoved(Light);
+	Light->SetActorLocation(FVector(200.0, 0.0, 0.0));
+	GEngine->BroadcastOnActorMoved(Light);
+	FLevelEventStream::Flush();
+
+	FLevelEventBatch Batch;
+	TestTrue(TEXT("Subscription should exist"), FLevelEventStream::TakeBatch(SubscriptionId, Batch));
+	TestEqual(TEXT("Spawn and moves should coalesce"), Batch.Events.Num(), 1);
+	if (Batch.Events.Num() == 1) {
+		TestTrue(TEXT("Event should be an add"), Batch.Events[0].Kind == ELevelEventKind::ActorAdded);
+		TestEqual(TEXT("Event should carry the final location"), Batch.Events[0].Transform->GetLocation(), FVector(200.0, 0.0, 0.0));
+	}
+
+	Light->SetActorLocation(FVector(300.0, 0.0, 0.0));
+	GEngine->BroadcastOnActorMoved(Light);
+	Light->SetActorLocation(FVector(400.0, 0.0, 0.0));
+	GEngine->BroadcastOnActorMoved(Light);
+	FLevelEventStream::Flush();
+	FLevelEventStream::TakeBatch(SubscriptionId, Batch);
+	TestEqual(TEXT("Moves should coalesce"), Batch.Events.Num(), 1);
+	if (Batch.Events.Num() == 1) {
+		TestTrue(TEXT("Event should be a move"), Batch.Events[0].Kind == ELevelEventKind::TransformChanged);
+		TestEqual(TEXT("Move should carry the final location"), Batch.Events[0].Transform->GetLocation(), FVector(400.0, 0.0, 0.0));
+	}
+
+	// Component edits are reported on the owning actor
+	UnrealMCP::FPropertyPath::SetValue(Light, TEXT("LightComponent.Intensity"), MakeShared<FJsonValueNumber>(50.0), true);
+	UnrealMCP::FPropertyPath::SetValue(Light, TEXT("LightComponent.Intensity"), MakeShared<FJsonValueNumber>(60.0), true);
+	FLevelEventStream::Flush();
+	FLevelEventStream::TakeBatch(SubscriptionId, Batch);
+	TestEqual(TEXT("Property edits should coalesce"), Batch.Events.Num(), 1);
+	if (Batch.Events.Num() == 1) {
+		TestTrue(TEXT("Event should be a property change"), Batch.Events[0].Kind == ELevelEventKind::PropertyChanged);
+		TestEqual(TEXT("Property should be listed once"), Batch.Events[0].Properties.Num(), 1);
+		TestTrue(TEXT("Property should name Intensity"), Batch.Events[0].Properties.Num() == 1 && Batch.Events[0].Properties[0].EndsWith(TEXT(".Intensity")));
+	}
+
+	const FString LightName = Light->GetName();
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, Light);
+	FLevelEventStream::Flush();
+	FLevelEventStream::TakeBatch(SubscriptionId, Batch);
+	TestEqual(TEXT("Delete should produce one event"), Batch.Events.Num(), 1);
+	if (Batch.Events.Num() == 1) {
+		TestTrue(TEXT("Event should be a removal"), Batch.Events[0].Kind == ELevelEventKind::ActorRemoved);
+		TestEqual(TEXT("Removal should name the actor"), Batch.Events[0].Name, LightName);
+	}
+
+	// An actor that lives within one frame is never reported
+	Light = UnrealMCPTest::FTestUtils::SpawnTestActor<APointLight>(World, TEXT("LevelEventLight"));
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, Light);
+	FLevelEventStream::Flush();
+	FLevelEventStream::TakeBatch(SubscriptionId, Batch);
+	TestEqual(TEXT("Add and delete in one frame should cancel out"), Batch.Events.Num(), 0);
+
+	// A full queue counts what it drops
+	Filter.Kinds = 1u << static_cast<uint32>(ELevelEventKind::ActorAdded);
+	const int32 BoundedId = FLevelEventStream::Subscribe(Filter, 1);
+	APointLight* First = UnrealMCPTest::FTestUtils::SpawnTestActor<APointLight>(World, TEXT("LevelEventLight"));
+	APointLight* Second = UnrealMCPTest::FTestUtils::SpawnTestActor<APointLight>(World, TEXT("LevelEventLight"));
+	FLevelEventStream::Flush();
+	FLevelEventStream::TakeBatch(BoundedId, Batch);
+	TestEqual(TEXT("Bounded queue should hold one event"), Batch.Events.Num(), 1);
+	TestEqual(TEXT("Bounded queue should count the dropped event"), Batch.Dropped, 1);
+
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, First);
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, Second);
+	FLevelEventStream::Flush();
+	FLevelEventStream::TakeBatch(BoundedId, Batch);
+	TestEqual(TEXT("Kind filter should leave out removals"), Batch.Events.Num(), 0);
+
+	const int32 Session = FLevelEventStream::GetCurrentSession();
+	TestFalse(TEXT("Another session should not unsubscribe"), FLevelEventStream::Unsubscribe(SubscriptionId, Session + 1));
+	TestTrue(TEXT("Unsubscribe should succeed"), FLevelEventStream::Unsubscribe(SubscriptionId, Session));
+	TestTrue(TEXT("Unsubscribe should succeed"), FLevelEventStream::Unsubscribe(BoundedId, Session));
+	TestFalse(TEXT("Unsubscribing twice should fail"), FLevelEventStream::Unsubscribe(SubscriptionId, Session));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FLevelEventStreamFramingTest,
+	"UnrealMCP.LevelEvents.FramingWithResponses",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FLevelEventStreamFramingTest::RunTest(const FString& Parameters) -> bool {
+	// Test: Pushed events and command responses interleave on one stream as newline-terminated UTF-8 lines
+
+	UUnrealMCPBridge* Bridge = GEditor->GetEditorSubsystem<UUnrealMCPBridge>();
+	TestNotNull(TEXT("Bridge should be available"), Bridge);
+	if (!Bridge)
+		return false;
+
+	// A non-ASCII label makes the UTF-8 byte length differ from the character count
+	UnrealMCP::FLevelEventBatch Batch;
+	Batch.SubscriptionId = 7;
+	UnrealMCP::FLevelEvent& Event = Batch.Events.AddDefaulted_GetRef();
+	Event.Name = TEXT("PointLight_0");
+	Event.ClassName = TEXT("PointLight");
+	Event.Label = TEXT("Lumi\u00E8re \u5149");
+
+	FString EventJson;
+	const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+		TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&EventJson);
+	FJsonSerializer::Serialize(Batch.ToJson().ToSharedRef(), Writer);
+
+	// search_blueprints answers on the calling thread
+	const FString Response = Bridge->ExecuteCommand(TEXT("search_blueprints"), MakeShared<FJsonObject>());
+
+	TArray<uint8> Stream = FMCPServerRunnable::EncodeMessage(EventJson);
+	Stream.Append(FMCPServerRunnable::EncodeMessage(Response));
+	Stream.Append(FMCPServerRunnable::EncodeMessage(EventJson));
+
+	TArray<TSharedPtr<FJsonObject>> Messages;
+	int32 LineStart = 0;
+	for (int32 Index = 0; Index < Stream.Num(); ++Index) {
+		if (Stream[Index] != '\n') {
+			continue;
+		}
+		const FUTF8ToTCHAR Line(reinterpret_cast<const ANSICHAR*>(Stream.GetData() + LineStart), Index - LineStart);
+		TSharedPtr<FJsonObject> Message;
+		TestTrue(
+			TEXT("Every line should be one JSON message"),
+			FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(FString(Line.Length(), Line.Get())), Message));
+		Messages.Add(Message);
+		LineStart = Index + 1;
+	}
+
+	TestEqual(TEXT("Stream should end with a newline"), LineStart, Stream.Num());
+	TestEqual(TEXT("Stream should hold three messages"), Messages.Num(), 3);
+	if (Messages.Num() != 3 || !Messages[0] || !Messages[1] || !Messages[2])
+		return false;
+
+	TestEqual(TEXT("First message should be the event"), Messages[0]->GetStringField(TEXT("type")), FString(TEXT("event")));
+	const TArray<TSharedPtr<FJsonValue>>& Events = Messages[0]->GetArrayField(TEXT("events"));
+	TestTrue(
+		TEXT("Label should survive the framing"),
+		Events.Num() == 1 && Events[0]->AsObject()->GetStringField(TEXT("label")) == Event.Label);
+	TestTrue(TEXT("Second message should be the response"), Messages[1]->HasField(TEXT("status")));
+	TestEqual(TEXT("Event after the response should be intact"), Messages[2]->GetIntegerField(TEXT("subscription_id")), 7);
+	return true;
+}
@@ -0,0 +1,120 @@
+#include "Editor.h"
+#include "Core/NamePattern.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/AutomationTest.h"
+#include "Services/ActorService.h"
+#include "Tests/TestUtils.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNamePatternGlobTest,
+	"UnrealMCP.NamePattern.Glob",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FNamePatternGlobTest::RunTest(const FString& Parameters) -> bool {
+	// Test: Glob patterns match whole names with wildcards, sets and escapes
+
+	using UnrealMCP::FNamePattern;
+
+	const auto Pattern = FNamePattern::Compile(TEXT("Light_[0-9]?*"), FNamePattern::EMode::Glob, true);
+	TestTrue(TEXT("Glob should compile"), Pattern.IsSuccess());
+	TestTrue(TEXT("Should match digit, one char and a tail"), Pattern.GetValue().Matches(TEXT("Light_12_Main")));
+	TestTrue(TEXT("Star may match nothing"), Pattern.GetValue().Matches(TEXT("Light_1a")));
+	TestFalse(TEXT("Set should reject a letter"), Pattern.GetValue().Matches(TEXT("Light_x1")));
+	TestFalse(TEXT("Glob is anchored at the start"), Pattern.GetValue().Matches(TEXT("PointLight_12")));
+	TestFalse(TEXT("Glob is case-sensitive by default"), Pattern.GetValue().Matches(TEXT("light_12")));
+
+	const auto Insensitive = FNamePattern::Compile(TEXT("*light*"), FNamePattern::EMode::Glob, false);
+	TestTrue(TEXT("Case-insensitive glob should match"), Insensitive.GetValue().Matches(TEXT("PointLight_3")));
+
+	const auto Negated = FNamePattern::Compile(TEXT("[!A]*"), FNamePattern::EMode::Glob, true);
+	TestFalse(TEXT("Negated set should reject"), Negated.GetValue().Matches(TEXT("Actor")));
+	TestTrue(TEXT("Negated set should accept"), Negated.GetValue().Matches(TEXT("Brush")));
+
+	const auto Escaped = FNamePattern::Compile(TEXT("A\\*B"), FNamePattern::EMode::Glob, true);
+	TestTrue(TEXT("Escaped star should be literal"), Escaped.GetValue().Matches(TEXT("A*B")));
+	TestFalse(TEXT("Escaped star should not be a wildcard"), Escaped.GetValue().Matches(TEXT("AxB")));
+
+	const auto Unterminated = FNamePattern::Compile(TEXT("Light_[0-9"), FNamePattern::EMode::Glob, true);
+	UnrealMCPTest::FTestUtils::ValidateErrorCode(Unterminated, UnrealMCP::EErrorCode::InvalidInput, TEXT(""), this);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNamePatternRegexAndContainsTest,
+	"UnrealMCP.NamePattern.RegexAndContains",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FNamePatternRegexAndContainsTest::RunTest(const FString& Parameters) -> bool {
+	// Test: Regex searches anywhere unless anchored; contains keeps substring semantics
+
+	using UnrealMCP::FNamePattern;
+
+	const auto Regex = FNamePattern::Compile(TEXT("^Wall_\\d+$"), FNamePattern::EMode::Regex, true);
+	TestTrue(TEXT("Regex should compile"), Regex.IsSuccess());
+	TestTrue(TEXT("Anchored regex should match"), Regex.GetValue().Matches(TEXT("Wall_42")));
+	TestFalse(TEXT("Anchored regex should reject a suffix"), Regex.GetValue().Matches(TEXT("Wall_42b")));
+
+	// A malformed regex cannot be detected up front; it compiles and matches nothing
+	const auto Malformed = FNamePattern::Compile(TEXT("Wall_(\\d+"), FNamePattern::EMode::Regex, true);
+	TestTrue(TEXT("Malformed regex should still compile"), Malformed.IsSuccess());
+	TestFalse(TEXT("Malformed regex should match nothing"), Malformed.GetValue().Matches(TEXT("Wall_42")));
+
+	const auto Contains = FNamePattern::Compile(TEXT("mesh"), FNamePattern::EMode::Contains, false);
+	TestTrue(TEXT("Case-insensitive contains should match"), Contains.GetValue().Matches(TEXT("StaticMeshActor_0")));
+
+	FNamePattern::EMode Mode;
+	TestTrue(TEXT("Mode names should parse case-insensitively"), FNamePattern::ParseMode(TEXT("Glob"), Mode));
+	TestTrue(TEXT("Parsed mode should be glob"), Mode == FNamePattern::EMode::Glob);
+	TestFalse(TEXT("Unknown mode should be rejected"), FNamePattern::ParseMode(TEXT("fuzzy"), Mode));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FActorServiceFindActorsByPatternTest,
+	"UnrealMCP.Actor.FindActorsByPattern",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FActorServiceFindActorsByPatternTest::RunTest(const FString& Parameters) -> bool {
+	// Test: Glob search over names and labels through the actor index
+
+	UWorld* World = GEditor->GetEditorWorldContext().World();
+	TestNotNull(TEXT("Editor world should be available"), World);
+	if (!World)
+		return false;
+
+	AActor* TestActor = UnrealMCPTest::FTestUtils::SpawnTestActor<AActor>(World, TEXT("PatternTestActor"));
+	TestNotNull(TEXT("Test actor should spawn successfully"), TestActor);
+	if (!TestActor)
+		return false;
+
+	const FString Label = UnrealMCPTest::FTestUtils::GenerateUniqueTestName(TEXT("PatternLabel"));
+	TestActor->SetActorLabel(Label);
+
+	UnrealMCP::FActorNameSearchParams Params;
+	Params.Pattern = TEXT("patterntestactor*");
+	Params.Mode = UnrealMCP::FNamePattern::EMode::Glob;
+	Params.bCaseSensitive = false;
+
+	auto Result = UnrealMCP::FActorService::FindActorsByPattern(Params);
+	TestTrue(TEXT("Pattern search should succeed"), Result.IsSuccess());
+	TestTrue(TEXT("Glob should match the actor name"), Result.GetValue().Contains(TestActor));
+
+	Params.Pattern = Label;
+	Params.Mode = UnrealMCP::FNamePattern::EMode::Contains;
+	Result = UnrealMCP::FActorService::FindActorsByPattern(Params);
+	TestFalse(TEXT("Labels are ignored unless requested"), Result.GetValue().Contains(TestActor));
+
+	Params.bIncludeLabels = true;
+	Result = UnrealMCP::FActorService::FindActorsByPattern(Params);
+	TestTrue(TEXT("Label should match when requested"), Result.GetValue().Contains(TestActor));
+
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, TestActor);
+
+	return true;
+}
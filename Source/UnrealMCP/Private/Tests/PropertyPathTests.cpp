@@ -0,0 +1,224 @@
+#include "Core/PropertyPath.h"
+#include "Core/PropertyReader.h"
+#include "Components/PointLightComponent.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "EditorAssetLibrary.h"
+#include "Engine/PointLight.h"
+#include "GameFramework/GameModeBase.h"
+#include "Misc/AutomationTest.h"
+#include "PackageTools.h"
+#include "Services/BlueprintCreationService.h"
+#include "Tests/TestUtils.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPropertyPathSetValueTest,
+	"UnrealMCP.Properties.SetValuePaths",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FPropertyPathSetValueTest::RunTest(const FString& Parameters) -> bool {
+	// Test: Paths reach component members, container elements and struct/enum leaves
+
+	UWorld* World = GEditor->GetEditorWorldContext().World();
+	TestNotNull(TEXT("Editor world should be available"), World);
+	if (!World)
+		return false;
+
+	APointLight* Light = UnrealMCPTest::FTestUtils::SpawnTestActor<APointLight>(World, TEXT("PropertyPathLight"));
+	TestNotNull(TEXT("Test light should spawn"), Light);
+	if (!Light)
+		return false;
+
+	using UnrealMCP::FPropertyPath;
+
+	UnrealMCP::FVoidResult Result = FPropertyPath::SetValue(Light, TEXT("LightComponent.Intensity"), MakeShared<FJsonValueNumber>(1234.0), true);
+	TestTrue(TEXT("Component member should be written"), Result.IsSuccess());
+	TestEqual(TEXT("Intensity should be set"), Light->PointLightComponent->Intensity, 1234.0f);
+
+	// Numeric strings convert; FColor arrays are RGBA
+	Result = FPropertyPath::SetValue(Light, TEXT("PointLightComponent.AttenuationRadius"), MakeShared<FJsonValueString>(TEXT("512")), true);
+	TestTrue(TEXT("Numeric string should convert"), Result.IsSuccess());
+	TestEqual(TEXT("AttenuationRadius should be set"), Light->PointLightComponent->AttenuationRadius, 512.0f);
+
+	TArray<TSharedPtr<FJsonValue>> Color;
+	Color.Add(MakeShared<FJsonValueNumber>(255.0));
+	Color.Add(MakeShared<FJsonValueNumber>(128.0));
+	Color.Add(MakeShared<FJsonValueNumber>(0.0));
+	Result = FPropertyPath::SetValue(Light, TEXT("LightComponent.LightColor"), MakeShared<FJsonValueArray>(Color), true);
+	TestTrue(TEXT("Color array should convert"), Result.IsSuccess());
+	TestEqual(TEXT("LightColor should be RGBA"), Light->PointLightComponent->LightColor, FColor(255, 128, 0, 255));
+
+	// Enums by name
+	Result = FPropertyPath::SetValue(Light, TEXT("RootComponent.Mobility"), MakeShared<FJsonValueString>(TEXT("Movable")), true);
+	TestTrue(TEXT("Enum name should convert"), Result.IsSuccess());
+	TestEqual(TEXT("Mobility should be Movable"), Light->GetRootComponent()->Mobility.GetValue(), EComponentMobility::Movable);
+
+	// Whole arrays, then single elements; one past the end appends
+	TArray<TSharedPtr<FJsonValue>> Tags;
+	Tags.Add(MakeShared<FJsonValueString>(TEXT("First")));
+	Result = FPropertyPath::SetValue(Light, TEXT("Tags"), MakeShared<FJsonValueArray>(Tags), true);
+	TestTrue(TEXT("Array should be written"), Result.IsSuccess());
+	Result = FPropertyPath::SetValue(Light, TEXT("Tags[1]"), MakeShared<FJsonValueString>(TEXT("Second")), true);
+	TestTrue(TEXT("Element one past the end should append"), Result.IsSuccess());
+	Result = FPropertyPath::SetValue(Light, TEXT("Tags[0]"), MakeShared<FJsonValueString>(TEXT("Renamed")), true);
+	TestTrue(TEXT("Existing element should be written"), Result.IsSuccess());
+	TestEqual(TEXT("Tags should hold both elements"), Light->Tags.Num(), 2);
+	if (Light->Tags.Num() == 2) {
+		TestEqual(TEXT("First tag"), Light->Tags[0], FName(TEXT("Renamed")));
+		TestEqual(TEXT("Second tag"), Light->Tags[1], FName(TEXT("Second")));
+	}
+
+	Result = FPropertyPath::SetValue(Light, TEXT("Tags[5]"), MakeShared<FJsonValueString>(TEXT("Far")), true);
+	UnrealMCPTest::FTestUtils::ValidateErrorCode(Result, UnrealMCP::EErrorCode::PropertyNotFound, TEXT("Tags[5]"), this);
+
+	// A value that does not convert appends nothing
+	Result = FPropertyPath::SetValue(Light, TEXT("Tags[2]"), MakeShared<FJsonValueArray>(TArray<TSharedPtr<FJsonValue>>()), true);
+	UnrealMCPTest::FTestUtils::ValidateErrorCode(Result, UnrealMCP::EErrorCode::InvalidPropertyValue, TEXT("Tags[2]"), this);
+	TestEqual(TEXT("A failed append should leave the array"), Light->Tags.Num(), 2);
+
+	// Replaying a plan does not add another
+	const int32 PlansBefore = FPropertyPath::Num();
+	Result = FPropertyPath::SetValue(Light, TEXT("LightComponent.Intensity"), MakeShared<FJsonValueNumber>(10.0), false);
+	TestTrue(TEXT("Repeated write should succeed"), Result.IsSuccess());
+	TestEqual(TEXT("Repeated write should reuse its plan"), FPropertyPath::Num(), PlansBefore);
+	TestEqual(TEXT("Intensity should be rewritten"), Light->PointLightComponent->Intensity, 10.0f);
+
+	// Failures
+	Result = FPropertyPath::SetValue(Light, TEXT("LightComponent.NoSuchMember"), MakeShared<FJsonValueNumber>(1.0), true);
+	UnrealMCPTest::FTestUtils::ValidateErrorCode(Result, UnrealMCP::EErrorCode::PropertyNotFound, TEXT("LightComponent.NoSuchMember"), this);
+
+	Result = FPropertyPath::SetValue(Light, TEXT("LightComponent.Intensity"), MakeShared<FJsonValueString>(TEXT("bright")), true);
+	UnrealMCPTest::FTestUtils::ValidateErrorCode(Result, UnrealMCP::EErrorCode::InvalidPropertyValue, TEXT("LightComponent.Intensity"), this);
+	TestEqual(TEXT("A failed write should leave the value"), Light->PointLightComponent->Intensity, 10.0f);
+
+	Result = FPropertyPath::SetValue(Light, TEXT("RootComponent.Mobility"), MakeShared<FJsonValueString>(TEXT("Sideways")), true);
+	UnrealMCPTest::FTestUtils::ValidateErrorCode(Result, UnrealMCP::EErrorCode::InvalidPropertyValue, TEXT("RootComponent.Mobility"), this);
+
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, Light);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPropertyPathLoadClassTest,
+	"UnrealMCP.Properties.SetValueLoadsClass",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FPropertyPathLoadClassTest::RunTest(const FString& Parameters) -> bool {
+	// Test: Writing a blueprint class that is not loaded yet survives the cache reset its load triggers
+
+	UWorld* World = GEditor->GetEditorWorldContext().World();
+	TestNotNull(TEXT("Editor world should be available"), World);
+	if (!World)
+		return false;
+
+	const FString BlueprintName = UnrealMCPTest::FTestUtils::GenerateUniqueTestName(TEXT("TestBP_PropertyPathPawn"));
+	const FString BlueprintPath = UnrealMCPTest::FTestUtils::GetTestAssetPath(BlueprintName);
+
+	UnrealMCP::FBlueprintCreationParams CreateParams;
+	CreateParams.Name = BlueprintName;
+	CreateParams.ParentClass = TEXT("Pawn");
+	CreateParams.PackagePath = UnrealMCPTest::FTestUtils::GetTestPackagePath();
+	const auto CreateResult = UnrealMCP::FBlueprintCreationService::CreateBlueprint(CreateParams);
+	TestTrue(TEXT("Blueprint creation should succeed"), CreateResult.IsSuccess());
+	if (CreateResult.IsFailure())
+		return false;
+
+	// Save and unload the blueprint so the write below has to load (and compile) it
+	TestTrue(TEXT("Blueprint should save"), UEditorAssetLibrary::SaveAsset(BlueprintPath, false));
+	if (UPackage* Package = FindPackage(nullptr, *BlueprintPath)) {
+		TestTrue(TEXT("Blueprint should unload"), UPackageTools::UnloadPackages({Package}));
+	}
+
+	AGameModeBase* GameMode = UnrealMCPTest::FTestUtils::SpawnTestActor<AGameModeBase>(World, TEXT("PropertyPathGameMode"));
+	TestNotNull(TEXT("Test game mode should spawn"), GameMode);
+	if (!GameMode) {
+		UnrealMCPTest::FTestUtils::CleanupTestAsset(BlueprintPath);
+		return false;
+	}
+
+	using UnrealMCP::FPropertyPath;
+
+	// Cache the plan first so the write runs on a cached one
+	UnrealMCP::FVoidResult Result = FPropertyPath::SetValue(GameMode, TEXT("DefaultPawnClass"), MakeShared<FJsonValueNull>(), true);
+	TestTrue(TEXT("Clearing the class should succeed"), Result.IsSuccess());
+
+	const FString ClassPath = FString::Printf(TEXT("%s.%s_C"), *BlueprintPath, *BlueprintName);
+	Result = FPropertyPath::SetValue(GameMode, TEXT("DefaultPawnClass"), MakeShared<FJsonValueString>(ClassPath), true);
+	TestTrue(TEXT("Loading class path should be written"), Result.IsSuccess());
+	TestTrue(
+		TEXT("DefaultPawnClass should be the blueprint class"),
+		GameMode->DefaultPawnClass && GameMode->DefaultPawnClass->GetPathName() == ClassPath);
+
+	// The cache keeps working after the reset
+	Result = FPropertyPath::SetValue(GameMode, TEXT("DefaultPawnClass"), MakeShared<FJsonValueString>(TEXT("Pawn")), true);
+	TestTrue(TEXT("Native class name should be written"), Result.IsSuccess());
+	TestTrue(TEXT("DefaultPawnClass should be Pawn"), GameMode->DefaultPawnClass == APawn::StaticClass());
+
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, GameMode);
+	UnrealMCPTest::FTestUtils::CleanupTestAsset(BlueprintPath);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPropertyReaderChangedOnlyTest,
+	"UnrealMCP.Properties.ReadChangedOnly",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FPropertyReaderChangedOnlyTest::RunTest(const FString& Parameters) -> bool {
+	// Test: Changed-only reads return overrides of the actor and its components, and paths project
+
+	UWorld* World = GEditor->GetEditorWorldContext().World();
+	TestNotNull(TEXT("Editor world should be available"), World);
+	if (!World)
+		return false;
+
+	APointLight* Light = UnrealMCPTest::FTestUtils::SpawnTestActor<APointLight>(World, TEXT("PropertyReaderLight"));
+	TestNotNull(TEXT("Test light should spawn"), Light);
+	if (!Light)
+		return false;
+
+	Light->PointLightComponent->Intensity = 4321.0f;
+
+	UnrealMCP::FPropertyReadOptions Options;
+	Options.bChangedOnly = true;
+	UnrealMCP::TResult<TSharedPtr<FJsonObject>> Result = UnrealMCP::FPropertyReader::Read(Light, Options);
+	TestTrue(TEXT("Changed-only read should succeed"), Result.IsSuccess());
+	if (Result.IsFailure())
+		return false;
+
+	// The component is reachable through two properties and is expanded under the first one only
+	const TSharedPtr<FJsonObject>* Component = nullptr;
+	if (!Result.GetValue()->TryGetObjectField(TEXT("PointLightComponent"), Component)) {
+		Result.GetValue()->TryGetObjectField(TEXT("LightComponent"), Component);
+	}
+	TestNotNull(TEXT("The changed component should be listed"), Component);
+	if (Component) {
+		TestEqual(TEXT("Intensity override should be read"), (*Component)->GetNumberField(TEXT("Intensity")), 4321.0);
+		TestFalse(TEXT("Unchanged AttenuationRadius should be left out"), (*Component)->HasField(TEXT("AttenuationRadius")));
+	}
+	TestFalse(TEXT("Unchanged Tags should be left out"), Result.GetValue()->HasField(TEXT("Tags")));
+
+	// Projections read exactly the requested paths
+	Light->Tags.Add(TEXT("Marked"));
+	Options.bChangedOnly = false;
+	Options.Paths = {TEXT("LightComponent.Intensity"), TEXT("Tags[0]"), TEXT("LightComponent.LightColor")};
+	Result = UnrealMCP::FPropertyReader::Read(Light, Options);
+	TestTrue(TEXT("Path read should succeed"), Result.IsSuccess());
+	if (Result.IsSuccess()) {
+		TestEqual(TEXT("Only the requested paths should be read"), Result.GetValue()->Values.Num(), 3);
+		TestEqual(TEXT("Intensity path"), Result.GetValue()->GetNumberField(TEXT("LightComponent.Intensity")), 4321.0);
+		TestEqual(TEXT("Element path"), Result.GetValue()->GetStringField(TEXT("Tags[0]")), FString(TEXT("Marked")));
+		const TSharedPtr<FJsonObject>* Color = nullptr;
+		TestTrue(TEXT("Structs should expand to objects"), Result.GetValue()->TryGetObjectField(TEXT("LightComponent.LightColor"), Color));
+	}
+
+	Options.Paths = {TEXT("LightComponent.NoSuchMember")};
+	Result = UnrealMCP::FPropertyReader::Read(Light, Options);
+	UnrealMCPTest::FTestUtils::ValidateErrorCode(Result, UnrealMCP::EErrorCode::PropertyNotFound, TEXT("LightComponent.NoSuchMember"), this);
+
+	UnrealMCPTest::FTestUtils::DestroyTestActor(World, Light);
+	return true;
+}
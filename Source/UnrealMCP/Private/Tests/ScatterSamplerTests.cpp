@@ -0,0 +1,73 @@
+#include "Core/ScatterSampler.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FScatterSamplerPoissonDiskTest,
+	"UnrealMCP.Scatter.PoissonDisk",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FScatterSamplerPoissonDiskTest::RunTest(const FString& Parameters) -> bool {
+	// Test: Poisson-disk points keep their minimum distance, stay in the domain and are deterministic
+
+	const FVector2D Size(2000.0, 1000.0);
+	const double MinDistance = 50.0;
+
+	TArray<FVector2D> Points;
+	UnrealMCP::FScatterSampler::PoissonDisk(Size, MinDistance, 7, Points);
+
+	TestTrue(TEXT("Should produce points"), Points.Num() > 0);
+	TestTrue(TEXT("Should not exceed the estimate"),
+	         Points.Num() <= UnrealMCP::FScatterSampler::EstimatePoissonCount(Size, MinDistance));
+	// A saturated packing has about 0.7 points per MinDistance^2; leave room for unfilled gaps
+	TestTrue(TEXT("Should cover the domain"), Points.Num() > Size.X * Size.Y / (MinDistance * MinDistance) * 0.3);
+
+	bool bInside = true;
+	for (const FVector2D& Point : Points) {
+		bInside &= Point.X >= 0.0 && Point.X <= Size.X && Point.Y >= 0.0 && Point.Y <= Size.Y;
+	}
+	TestTrue(TEXT("Points should stay in the domain"), bInside);
+
+	double ClosestSquared = TNumericLimits<double>::Max();
+	for (int32 A = 0; A < Points.Num(); ++A) {
+		for (int32 B = A + 1; B < Points.Num(); ++B) {
+			ClosestSquared = FMath::Min(ClosestSquared, FVector2D::DistSquared(Points[A], Points[B]));
+		}
+	}
+	TestTrue(TEXT("No two points should be closer than the minimum distance"), ClosestSquared >= MinDistance * MinDistance);
+
+	TArray<FVector2D> Repeat;
+	UnrealMCP::FScatterSampler::PoissonDisk(Size, MinDistance, 7, Repeat);
+	TestTrue(TEXT("Same seed should give the same points"), Repeat == Points);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FScatterSamplerJitteredGridTest,
+	"UnrealMCP.Scatter.JitteredGrid",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+auto FScatterSamplerJitteredGridTest::RunTest(const FString& Parameters) -> bool {
+	// Test: A jittered grid has one point per cell, and no jitter gives cell centers
+
+	TArray<FVector2D> Regular;
+	UnrealMCP::FScatterSampler::JitteredGrid(FVector2D(1000.0, 500.0), 100.0, 0.0, 1, Regular);
+	TestEqual(TEXT("One point per cell"), Regular.Num(), 50);
+	TestTrue(TEXT("First point at the first cell center"), Regular[0].Equals(FVector2D(50.0, 50.0)));
+
+	TArray<FVector2D> Jittered;
+	UnrealMCP::FScatterSampler::JitteredGrid(FVector2D(1000.0, 500.0), 100.0, 1.0, 1, Jittered);
+	TestEqual(TEXT("Jitter keeps the count"), Jittered.Num(), 50);
+
+	bool bInCell = true;
+	for (int32 Index = 0; Index < Jittered.Num(); ++Index) {
+		const FVector2D Cell((Index % 10) * 100.0, (Index / 10) * 100.0);
+		bInCell &= Jittered[Index].X >= Cell.X && Jittered[Index].X <= Cell.X + 100.0
+			&& Jittered[Index].Y >= Cell.Y && Jittered[Index].Y <= Cell.Y + 100.0;
+	}
+	TestTrue(TEXT("Jittered points should stay in their cell"), bInCell);
+
+	return true;
+}
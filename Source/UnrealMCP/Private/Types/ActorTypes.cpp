@@ -0,0 +1,995 @@
+#include "Types/ActorTypes.h"
+#include "Core/CommonUtils.h"
+#include "Core/ErrorTypes.h"
+#include "Misc/Base64.h"
+
+namespace UnrealMCP {
+	auto FActorQueryFilter::FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FActorQueryFilter> {
+		if (!Json.IsValid()) {
+			return TResult<FActorQueryFilter>::Failure(EErrorCode::InvalidInput, TEXT("Invalid JSON object"));
+		}
+
+		FActorQueryFilter Filter;
+
+		FString ClassName;
+		if (Json->TryGetStringField(TEXT("class"), ClassName) && !ClassName.IsEmpty()) {
+			Filter.ClassName = ClassName;
+		}
+
+		FString Tag;
+		if (Json->TryGetStringField(TEXT("tag"), Tag) && !Tag.IsEmpty()) {
+			Filter.Tags.Add(Tag);
+		}
+
+		if (const TArray<TSharedPtr<FJsonValue>>* TagArray; Json->TryGetArrayField(TEXT("tags"), TagArray)) {
+			for (const TSharedPtr<FJsonValue>& TagValue : *TagArray) {
+				FString TagString;
+				if (!TagValue.IsValid() || !TagValue->TryGetString(TagString)) {
+					return TResult<FActorQueryFilter>::Failure(EErrorCode::InvalidInput, TEXT("'tags' must be an array of strings"));
+				}
+				if (!TagString.IsEmpty()) {
+					Filter.Tags.AddUnique(TagString);
+				}
+			}
+		}
+
+		FString ComponentClassName;
+		if (Json->TryGetStringField(TEXT("component"), ComponentClassName) && !ComponentClassName.IsEmpty()) {
+			Filter.ComponentClassName = ComponentClassName;
+		}
+
+		// An empty folder string selects actors at the outliner root
+		FString Folder;
+		if (Json->TryGetStringField(TEXT("folder"), Folder)) {
+			Folder.RemoveFromEnd(TEXT("/"));
+			Filter.Folder = Folder;
+		}
+
+		return TResult<FActorQueryFilter>::Success(MoveTemp(Filter));
+	}
+
+	auto FActorNameSearchParams::FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FActorNameSearchParams> {
+		if (!Json.IsValid()) {
+			return TResult<FActorNameSearchParams>::Failure(EErrorCode::InvalidInput, TEXT("Invalid JSON object"));
+		}
+
+		FActorNameSearchParams Params;
+
+		if (!Json->TryGetStringField(TEXT("pattern"), Params.Pattern)) {
+			return TResult<FActorNameSearchParams>::Failure(EErrorCode::InvalidInput, TEXT("Missing 'pattern' parameter"));
+		}
+
+		if (FString ModeName; Json->TryGetStringField(TEXT("mode"), ModeName) && !FNamePattern::ParseMode(ModeName, Params.Mode)) {
+			return TResult<FActorNameSearchParams>::Failure(
+				EErrorCode::InvalidInput,
+				FString::Printf(TEXT("Invalid 'mode' '%s' (expected contains, glob or regex)"), *ModeName));
+		}
+
+		Json->TryGetBoolField(TEXT("case_sensitive"), Params.bCaseSensitive);
+		Json->TryGetBoolField(TEXT("include_labels"), Params.bIncludeLabels);
+
+		return TResult<FActorNameSearchParams>::Success(MoveTemp(Params));
+	}
+
+	auto FActorRadiusQueryParams::FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FActorRadiusQueryParams> {
+		if (!Json.IsValid()) {
+			return TResult<FActorRadiusQueryParams>::Failure(EErrorCode::InvalidInput, TEXT("Invalid JSON object"));
+		}
+
+		FActorRadiusQueryParams Params;
+
+		if (!Json->HasField(TEXT("center"))) {
+			return TResult<FActorRadiusQueryParams>::Failure(EErrorCode::InvalidInput, TEXT("Missing 'center' parameter"));
+		}
+		Params.Center = FCommonUtils::GetVectorFromJson(Json, TEXT("center"));
+
+		if (!Json->TryGetNumberField(TEXT("radius"), Params.Radius)) {
+			return TResult<FActorRadiusQueryParams>::Failure(EErrorCode::InvalidInput, TEXT("Missing 'radius' parameter"));
+		}
+		if (Params.Radius <= 0.0) {
+			return TResult<FActorRadiusQueryParams>::Failure(EErrorCode::InvalidInput, TEXT("'radius' must be greater than 0"));
+		}
+
+		TResult<FActorQueryFilter> FilterResult = FActorQueryFilter::FromJson(Json);
+		if (FilterResult.IsFailure()) {
+			return TResult<FActorRadiusQueryParams>::Failure(FilterResult.GetError());
+		}
+		Params.Filter = MoveTemp(FilterResult.GetValue());
+
+		return TResult<FActorRadiusQueryParams>::Success(MoveTemp(Params));
+	}
+
+	auto FActorBoxQueryParams::FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FActorBoxQueryParams> {
+		if (!Json.IsValid()) {
+			return TResult<FActorBoxQueryParams>::Failure(EErrorCode::InvalidInput, TEXT("Invalid JSON object"));
+		}
+
+		FActorBoxQueryParams Params;
+
+		if (!Json->HasField(TEXT("min"))) {
+			return TResult<FActorBoxQueryParams>::Failure(EErrorCode::InvalidInput, TEXT("Missing 'min' parameter"));
+		}
+		if (!Json->HasField(TEXT("max"))) {
+			return TResult<FActorBoxQueryParams>::Failure(EErrorCode::InvalidInput, TEXT("Missing 'max' parameter"));
+		}
+
+		// Accept corners in any order
+		const FVector A = FCommonUtils::GetVectorFromJson(Json, TEXT("min"));
+		const FVector B = FCommonUtils::GetVectorFromJson(Json, TEXT("max"));
+		Params.Box = FBox(A.ComponentMin(B), A.ComponentMax(B));
+
+		TResult<FActorQueryFilter> FilterResult = FActorQueryFilter::FromJson(Json);
+		if (FilterResult.IsFailure()) {
+			return TResult<FActorBoxQueryParams>::Failure(FilterResult.GetError());
+		}
+		Params.Filter = MoveTemp(FilterResult.GetValue());
+
+		return TResult<FActorBoxQueryParams>::Success(MoveTemp(Params));
+	}
+
+	auto FNearestActorsParams::FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FNearestActorsParams> {
+		if (!Json.IsValid()) {
+			return TResult<FNearestActorsParams>::Failure(EErrorCode::InvalidInput, TEXT("Invalid JSON object"));
+		}
+
+		FNearestActorsParams Params;
+
+		if (!Json->HasField(TEXT("location"))) {
+			return TResult<FNearestActorsParams>::Failure(EErrorCode::InvalidInput, TEXT("Missing 'location' parameter"));
+		}
+		Params.Location = FCommonUtils::GetVectorFromJson(Json, TEXT("location"));
+
+		if (Json->TryGetNumberField(TEXT("count"), Params.Count) && Params.Count <= 0) {
+			return TResult<FNearestActorsParams>::Failure(EErrorCode::InvalidInput, TEXT("'count' must be greater than 0"));
+		}
+
+		Json->TryGetNumberField(TEXT("max_distance"), Params.MaxDistance);
+
+		TResult<FActorQueryFilter> FilterResult = FActorQueryFilter::FromJson(Json);
+		if (FilterResult.IsFailure()) {
+			return TResult<FNearestActorsParams>::Failure(FilterResult.GetError());
+		}
+		Params.Filter = MoveTemp(FilterResult.GetValue());
+
+		return TResult<FNearestActorsParams>::Success(MoveTemp(Params));
+	}
+
+	auto FSpawnActorsParams::FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FSpawnActorsParams> {
+		if (!Json.IsValid()) {
+			return TResult<FSpawnActorsParams>::Failure(EErrorCode::InvalidInput, TEXT("Invalid JSON object"));
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* ActorArray;
+		if (!Json->TryGetArrayField(TEXT("actors"), ActorArray) || ActorArray->Num() == 0) {
+			return TResult<FSpawnActorsParams>::Failure(EErrorCode::InvalidInput, TEXT("'actors' must be a non-empty array"));
+		}
+
+		FSpawnActorsParams Params;
+		Params.Actors.Reserve(ActorArray->Num());
+
+		for (int32 Index = 0; Index < ActorArray->Num(); ++Index) {
+			const TSharedPtr<FJsonObject>* EntryObject;
+			if (!(*ActorArray)[Index].IsValid() || !(*ActorArray)[Index]->TryGetObject(EntryObject)) {
+				return TResult<FSpawnActorsParams>::Failure(
+					EErrorCode::InvalidInput,
+					FString::Printf(TEXT("actors[%d] must be an object"), Index));
+			}
+			const TSharedPtr<FJsonObject>& Entry = *EntryObject;
+
+			FActorSpawnSpec Spec;
+			if (!Entry->TryGetStringField(TEXT("class"), Spec.ClassName) || Spec.ClassName.IsEmpty()) {
+				return TResult<FSpawnActorsParams>::Failure(
+					EErrorCode::InvalidInput,
+					FString::Printf(TEXT("actors[%d] is missing 'class'"), Index));
+			}
+			Entry->TryGetStringField(TEXT("name"), Spec.Name);
+
+			// The transform may be nested or given directly on the entry
+			const TSharedPtr<FJsonObject>* TransformObject;
+			const TSharedPtr<FJsonObject>& TransformSource =
+				Entry->TryGetObjectField(TEXT("transform"), TransformObject) ? *TransformObject : Entry;
+
+			if (TransformSource->HasField(TEXT("location"))) {
+				Spec.Transform.SetLocation(FCommonUtils::GetVectorFromJson(TransformSource, TEXT("location")));
+			}
+			if (TransformSource->HasField(TEXT("rotation"))) {
+				Spec.Transform.SetRotation(FCommonUtils::GetRotatorFromJson(TransformSource, TEXT("rotation")).Quaternion());
+			}
+			if (TransformSource->HasField(TEXT("scale"))) {
+				Spec.Transform.SetScale3D(FCommonUtils::GetVectorFromJson(TransformSource, TEXT("scale")));
+			}
+
+			if (const TSharedPtr<FJsonObject>* PropertiesObject; Entry->TryGetObjectField(TEXT("properties"), PropertiesObject)) {
+				Spec.Properties = *PropertiesObject;
+			}
+
+			Params.Actors.Add(MoveTemp(Spec));
+		}
+
+		return TResult<FSpawnActorsParams>::Success(MoveTemp(Params));
+	}
+
+	auto FSpawnActorsResult::ToJson() const -> TSharedPtr<FJsonObject> {
+		auto Result = MakeShared<FJsonObject>();
+
+		int32 NumWithErrors = 0;
+		TArray<TSharedPtr<FJsonValue>> ActorValues;
+		ActorValues.Reserve(Actors.Num());
+		for (const FEntry& Entry : Actors) {
+			auto ActorObject = MakeShared<FJsonObject>();
+			ActorObject->SetStringField(TEXT("name"), Entry.Name);
+			ActorObject->SetStringField(TEXT("class"), Entry.ClassName);
+			if (Entry.PropertyErrors.Num() > 0) {
+				TArray<TSharedPtr<FJsonValue>> ErrorValues;
+				for (const FString& Error : Entry.PropertyErrors) {
+					ErrorValues.Add(MakeShared<FJsonValueString>(Error));
+				}
+				ActorObject->SetArrayField(TEXT("property_errors"), ErrorValues);
+				++NumWithErrors;
+			}
+			ActorValues.Add(MakeShared<FJsonValueObject>(ActorObject));
+		}
+
+		Result->SetArrayField(TEXT("actors"), ActorValues);
+		Result->SetNumberField(TEXT("spawned_count"), Actors.Num());
+		Result->SetNumberField(TEXT("property_error_count"), NumWithErrors);
+		Result->SetNumberField(TEXT("total_time_ms"), TotalTimeMs);
+		return Result;
+	}
+
+	namespace {
+		/** Decode packed little-endian floats; returns false if the byte count is not a whole number of values */
+		template <typename FloatType>
+		auto DecodePackedFloats(const TArray<uint8>& Bytes, TArray<double>& OutValues) -> bool {
+			if (Bytes.Num() % sizeof(FloatType) != 0) {
+				return false;
+			}
+			const int32 NumValues = Bytes.Num() / sizeof(FloatType);
+			OutValues.SetNumUninitialized(NumValues);
+			for (int32 Index = 0; Index < NumValues; ++Index) {
+				// Copy out of the byte buffer, which carries no alignment guarantee
+				FloatType Value;
+				FMemory::Memcpy(&Value, Bytes.GetData() + Index * sizeof(FloatType), sizeof(FloatType));
+				OutValues[Index] = static_cast<double>(Value);
+			}
+			return true;
+		}
+	}
+
+	auto FSetActorTransformsParams::FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FSetActorTransformsParams> {
+		if (!Json.IsValid()) {
+			return TResult<FSetActorTransformsParams>::Failure(EErrorCode::InvalidInput, TEXT("Invalid JSON object"));
+		}
+
+		FSetActorTransformsParams Params;
+
+		if (!Json->TryGetStringArrayField(TEXT("names"), Params.Names) || Params.Names.Num() == 0) {
+			return TResult<FSetActorTransformsParams>::Failure(EErrorCode::InvalidInput, TEXT("'names' must be a non-empty array of strings"));
+		}
+
+		TArray<double> Values;
+		if (const TArray<TSharedPtr<FJsonValue>>* ValueArray; Json->TryGetArrayField(TEXT("transforms"), ValueArray)) {
+			Values.Reserve(ValueArray->Num());
+			for (const TSharedPtr<FJsonValue>& Value : *ValueArray) {
+				double Number;
+				if (!Value.IsValid() || !Value->TryGetNumber(Number)) {
+					return TResult<FSetActorTransformsParams>::Failure(EErrorCode::InvalidInput, TEXT("'transforms' must be an array of numbers"));
+				}
+				Values.Add(Number);
+			}
+		}
+		else if (FString Encoded; Json->TryGetStringField(TEXT("transforms"), Encoded)) {
+			FString Format = TEXT("float32");
+			Json->TryGetStringField(TEXT("format"), Format);
+
+			TArray<uint8> Bytes;
+			if (!FBase64::Decode(Encoded, Bytes)) {
+				return TResult<FSetActorTransformsParams>::Failure(EErrorCode::InvalidInput, TEXT("'transforms' is not valid base64"));
+			}
+
+			bool bDecoded;
+			if (Format == TEXT("float32")) {
+				bDecoded = DecodePackedFloats<float>(Bytes, Values);
+			}
+			else if (Format == TEXT("float64")) {
+				bDecoded = DecodePackedFloats<double>(Bytes, Values);
+			}
+			else {
+				return TResult<FSetActorTransformsParams>::Failure(
+					EErrorCode::InvalidInput,
+					FString::Printf(TEXT("Invalid 'format' '%s' (expected float32 or float64)"), *Format));
+			}
+			if (!bDecoded) {
+				return TResult<FSetActorTransformsParams>::Failure(
+					EErrorCode::InvalidInput,
+					FString::Printf(TEXT("'transforms' byte length %d is not a multiple of the %s size"), Bytes.Num(), *Format));
+			}
+		}
+		else {
+			return TResult<FSetActorTransformsParams>::Failure(EErrorCode::InvalidInput, TEXT("Missing 'transforms' parameter"));
+		}
+
+		if (Values.Num() != Params.Names.Num() * FloatsPerTransform) {
+			return TResult<FSetActorTransformsParams>::Failure(
+				EErrorCode::InvalidInput,
+				FString::Printf(
+					TEXT("'transforms' has %d values, expected %d (%d per actor)"),
+					Values.Num(), Params.Names.Num() * FloatsPerTransform, FloatsPerTransform));
+		}
+
+		Params.Transforms.Reserve(Params.Names.Num());
+		for (int32 Index = 0; Index < Params.Names.Num(); ++Index) {
+			const double* V = Values.GetData() + Index * FloatsPerTransform;
+			for (int32 Offset = 0; Offset < FloatsPerTransform; ++Offset) {
+				if (!FMath::IsFinite(V[Offset])) {
+					return TResult<FSetActorTransformsParams>::Failure(
+						EErrorCode::InvalidInput,
+						FString::Printf(TEXT("Transform %d ('%s') contains a non-finite value"), Index, *Params.Names[Index]));
+				}
+			}
+
+			FQuat Rotation(V[3], V[4], V[5], V[6]);
+			if (Rotation.SizeSquared() < UE_SMALL_NUMBER) {
+				return TResult<FSetActorTransformsParams>::Failure(
+					EErrorCode::InvalidInput,
+					FString::Printf(TEXT("Transform %d ('%s') has a zero rotation quaternion"), Index, *Params.Names[Index]));
+			}
+			Rotation.Normalize();
+
+			Params.Transforms.Emplace(Rotation, FVector(V[0], V[1], V[2]), FVector(V[7], V[8], V[9]));
+		}
+
+		return TResult<FSetActorTransformsParams>::Success(MoveTemp(Params));
+	}
+
+	auto FSetActorTransformsResult::ToJson() const -> TSharedPtr<FJsonObject> {
+		auto Result = MakeShared<FJsonObject>();
+		Result->SetNumberField(TEXT("updated_count"), UpdatedCount);
+		Result->SetNumberField(TEXT("unchanged_count"), UnchangedCount);
+		Result->SetNumberField(TEXT("total_time_ms"), TotalTimeMs);
+		return Result;
+	}
+
+	auto FActorSelection::FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FActorSelection> {
+		if (!Json.IsValid()) {
+			return TResult<FActorSelection>::Failure(EErrorCode::InvalidInput, TEXT("Invalid JSON object"));
+		}
+
+		FActorSelection Selection;
+
+		if (Json->HasField(TEXT("names")) && !Json->TryGetStringArrayField(TEXT("names"), Selection.Names)) {
+			return TResult<FActorSelection>::Failure(EErrorCode::InvalidInput, TEXT("'names' must be an array of strings"));
+		}
+
+		TResult<FActorQueryFilter> FilterResult = FActorQueryFilter::FromJson(Json);
+		if (FilterResult.IsFailure()) {
+			return TResult<FActorSelection>::Failure(FilterResult.GetError());
+		}
+		Selection.Filter = MoveTemp(FilterResult.GetValue());
+
+		if (const TSharedPtr<FJsonObject>* Region; Json->TryGetObjectField(TEXT("region"), Region)) {
+			if ((*Region)->HasField(TEXT("min")) && (*Region)->HasField(TEXT("max"))) {
+				// Accept corners in any order
+				const FVector A = FCommonUtils::GetVectorFromJson(*Region, TEXT("min"));
+				const FVector B = FCommonUtils::GetVectorFromJson(*Region, TEXT("max"));
+				Selection.RegionBox = FBox(A.ComponentMin(B), A.ComponentMax(B));
+			}
+			else if ((*Region)->HasField(TEXT("center")) && (*Region)->TryGetNumberField(TEXT("radius"), Selection.RegionRadius)
+				&& Selection.RegionRadius > 0.0) {
+				Selection.RegionCenter = FCommonUtils::GetVectorFromJson(*Region, TEXT("center"));
+			}
+			else {
+				return TResult<FActorSelection>::Failure(
+					EErrorCode::InvalidInput,
+					TEXT("'region' must have 'min' and 'max', or 'center' and a positive 'radius'"));
+			}
+		}
+
+		const bool bHasQuery = Selection.Filter.ClassName.IsSet() || Selection.Filter.Tags.Num() > 0
+			|| Selection.Filter.ComponentClassName.IsSet() || Selection.Filter.Folder.IsSet()
+			|| Selection.RegionBox.IsSet() || Selection.RegionRadius > 0.0;
+		if (Selection.Names.Num() > 0 && bHasQuery) {
+			return TResult<FActorSelection>::Failure(
+				EErrorCode::InvalidInput,
+				TEXT("'names' cannot be combined with class, tag, component, folder or region constraints"));
+		}
+		if (Selection.Names.Num() == 0 && !bHasQuery) {
+			return TResult<FActorSelection>::Failure(
+				EErrorCode::InvalidInput,
+				TEXT("Select actors with 'names' or at least one of class, tag, tags, component, folder or region"));
+		}
+
+		return TResult<FActorSelection>::Success(MoveTemp(Selection));
+	}
+
+	auto FTransformActorsParams::FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FTransformActorsParams> {
+		TResult<FActorSelection> SelectionResult = FActorSelection::FromJson(Json);
+		if (SelectionResult.IsFailure()) {
+			return TResult<FTransformActorsParams>::Failure(SelectionResult.GetError());
+		}
+
+		FTransformActorsParams Params;
+		Params.Selection = MoveTemp(SelectionResult.GetValue());
+
+		FString Operation;
+		if (!Json->TryGetStringField(TEXT("operation"), Operation)) {
+			return TResult<FTransformActorsParams>::Failure(EErrorCode::InvalidInput, TEXT("Missing 'operation' parameter"));
+		}
+
+		if (Operation == TEXT("offset")) {
+			Params.Operation = EActorTransformOperation::Offset;
+			if (!Json->HasField(TEXT("offset"))) {
+				return TResult<FTransformActorsParams>::Failure(EErrorCode::InvalidInput, TEXT("Missing 'offset' parameter"));
+			}
+			Params.Offset = FCommonUtils::GetVectorFromJson(Json, TEXT("offset"));
+		}
+		else if (Operation == TEXT("rotate")) {
+			Params.Operation = EActorTransformOperation::Rotate;
+			if (!Json->HasField(TEXT("rotation"))) {
+				return TResult<FTransformActorsParams>::Failure(EErrorCode::InvalidInput, TEXT("Missing 'rotation' parameter"));
+			}
+			Params.Rotation = FCommonUtils::GetRotatorFromJson(Json, TEXT("rotation")).Quaternion();
+		}
+		else if (Operation == TEXT("scale")) {
+			Params.Operation = EActorTransformOperation::Scale;
+			if (!Json->TryGetNumberField(TEXT("factor"), Params.Factor) || Params.Factor <= 0.0) {
+				return TResult<FTransformActorsParams>::Failure(EErrorCode::InvalidInput, TEXT("'factor' must be a number greater than 0"));
+			}
+		}
+		else if (Operation == TEXT("snap")) {
+			Params.Operation = EActorTransformOperation::Snap;
+			if (double Grid; Json->TryGetNumberField(TEXT("grid"), Grid)) {
+				Params.GridSize = FVector(Grid);
+			}
+			else if (Json->HasField(TEXT("grid"))) {
+				Params.GridSize = FCommonUtils::GetVectorFromJson(Json, TEXT("grid"));
+			}
+			if (Params.GridSize.GetMax() <= 0.0) {
+				return TResult<FTransformActorsParams>::Failure(
+					EErrorCode::InvalidInput,
+					TEXT("'grid' must be a positive number or a vector with at least one positive component"));
+			}
+		}
+		else {
+			return TResult<FTransformActorsParams>::Failure(
+				EErrorCode::InvalidInput,
+				FString::Printf(TEXT("Invalid 'operation' '%s' (expected offset, rotate, scale or snap)"), *Operation));
+		}
+
+		if (Json->HasField(TEXT("pivot"))) {
+			Params.Pivot = FCommonUtils::GetVectorFromJson(Json, TEXT("pivot"));
+		}
+		Json->TryGetBoolField(TEXT("transact"), Params.bTransact);
+
+		return TResult<FTransformActorsParams>::Success(MoveTemp(Params));
+	}
+
+	auto FTransformActorsResult::ToJson() const -> TSharedPtr<FJsonObject> {
+		auto Result = MakeShared<FJsonObject>();
+		Result->SetNumberField(TEXT("matched_count"), MatchedCount);
+		Result->SetNumberField(TEXT("updated_count"), UpdatedCount);
+		if (Pivot.IsSet()) {
+			Result->SetArrayField(TEXT("pivot"), {
+				MakeShared<FJsonValueNumber>(Pivot->X),
+				MakeShared<FJsonValueNumber>(Pivot->Y),
+				MakeShared<FJsonValueNumber>(Pivot->Z)
+			});
+		}
+		Result->SetNumberField(TEXT("total_time_ms"), TotalTimeMs);
+		return Result;
+	}
+
+	auto FScatterInstancesParams::FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FScatterInstancesParams> {
+		if (!Json.IsValid()) {
+			return TResult<FScatterInstancesParams>::Failure(EErrorCode::InvalidInput, TEXT("Invalid JSON object"));
+		}
+
+		FScatterInstancesParams Params;
+
+		if (!Json->TryGetStringField(TEXT("mesh"), Params.MeshPath) || Params.MeshPath.IsEmpty()) {
+			return TResult<FScatterInstancesParams>::Failure(EErrorCode::InvalidInput, TEXT("Missing 'mesh' parameter"));
+		}
+		Json->TryGetStringField(TEXT("actor_name"), Params.ActorName);
+
+		if (const TSharedPtr<FJsonObject>* BoxObject; Json->TryGetObjectField(TEXT("box"), BoxObject)) {
+			if (!(*BoxObject)->HasField(TEXT("min")) || !(*BoxObject)->HasField(TEXT("max"))) {
+				return TResult<FScatterInstancesParams>::Failure(EErrorCode::InvalidInput, TEXT("'box' must have 'min' and 'max'"));
+			}
+			// Accept corners in any order
+			const FVector A = FCommonUtils::GetVectorFromJson(*BoxObject, TEXT("min"));
+			const FVector B = FCommonUtils::GetVectorFromJson(*BoxObject, TEXT("max"));
+			Params.Region = EScatterRegion::Box;
+			Params.Box = FBox(A.ComponentMin(B), A.ComponentMax(B));
+		}
+		else if (Json->TryGetStringField(TEXT("volume"), Params.RegionActorName)) {
+			Params.Region = EScatterRegion::Volume;
+		}
+		else if (Json->TryGetStringField(TEXT("spline"), Params.RegionActorName)) {
+			Params.Region = EScatterRegion::Spline;
+			if (Json->TryGetNumberField(TEXT("width"), Params.Width) && Params.Width <= 0.0) {
+				return TResult<FScatterInstancesParams>::Failure(EErrorCode::InvalidInput, TEXT("'width' must be greater than 0"));
+			}
+		}
+		else {
+			return TResult<FScatterInstancesParams>::Failure(
+				EErrorCode::InvalidInput,
+				TEXT("Specify the region with 'box', 'volume' or 'spline'"));
+		}
+
+		if (FString Sampling; Json->TryGetStringField(TEXT("sampling"), Sampling)) {
+			if (Sampling == TEXT("poisson")) {
+				Params.Sampling = EScatterSampling::PoissonDisk;
+			}
+			else if (Sampling == TEXT("grid")) {
+				Params.Sampling = EScatterSampling::JitteredGrid;
+			}
+			else {
+				return TResult<FScatterInstancesParams>::Failure(
+					EErrorCode::InvalidInput,
+					FString::Printf(TEXT("Invalid 'sampling' '%s' (expected poisson or grid)"), *Sampling));
+			}
+		}
+
+		if (Json->TryGetNumberField(TEXT("spacing"), Params.Spacing) && Params.Spacing <= 0.0) {
+			return TResult<FScatterInstancesParams>::Failure(EErrorCode::InvalidInput, TEXT("'spacing' must be greater than 0"));
+		}
+		if (Json->TryGetNumberField(TEXT("jitter"), Params.Jitter)) {
+			Params.Jitter = FMath::Clamp(Params.Jitter, 0.0, 1.0);
+		}
+		Json->TryGetNumberField(TEXT("seed"), Params.Seed);
+		Json->TryGetBoolField(TEXT("random_yaw"), Params.bRandomYaw);
+		Json->TryGetBoolField(TEXT("transact"), Params.bTransact);
+
+		if (const TArray<TSharedPtr<FJsonValue>>* ScaleArray; Json->TryGetArrayField(TEXT("scale"), ScaleArray)) {
+			if (ScaleArray->Num() != 2 || !(*ScaleArray)[0]->TryGetNumber(Params.ScaleRange.X)
+				|| !(*ScaleArray)[1]->TryGetNumber(Params.ScaleRange.Y)
+				|| Params.ScaleRange.X <= 0.0 || Params.ScaleRange.Y < Params.ScaleRange.X) {
+				return TResult<FScatterInstancesParams>::Failure(
+					EErrorCode::InvalidInput,
+					TEXT("'scale' must be [min, max] with 0 < min <= max"));
+			}
+		}
+		else if (double Scale; Json->TryGetNumberField(TEXT("scale"), Scale)) {
+			if (Scale <= 0.0) {
+				return TResult<FScatterInstancesParams>::Failure(EErrorCode::InvalidInput, TEXT("'scale' must be greater than 0"));
+			}
+			Params.ScaleRange = FVector2D(Scale, Scale);
+		}
+
+		return TResult<FScatterInstancesParams>::Success(MoveTemp(Params));
+	}
+
+	auto FScatterInstancesResult::ToJson() const -> TSharedPtr<FJsonObject> {
+		auto Result = MakeShared<FJsonObject>();
+		Result->SetStringField(TEXT("actor_name"), ActorName);
+		Result->SetStringField(TEXT("component"), ComponentName);
+
+		auto Range = MakeShared<FJsonObject>();
+		Range->SetStringField(TEXT("component"), ComponentName);
+		Range->SetNumberField(TEXT("first"), FirstInstance);
+		Range->SetNumberField(TEXT("count"), InstanceCount);
+		Result->SetArrayField(TEXT("ranges"), {MakeShared<FJsonValueObject>(Range)});
+
+		Result->SetNumberField(TEXT("instance_count"), InstanceCount);
+		Result->SetNumberField(TEXT("sample_time_ms"), SampleTimeMs);
+		Result->SetNumberField(TEXT("total_time_ms"), TotalTimeMs);
+		return Result;
+	}
+
+	auto FSetPropertiesParams::FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FSetPropertiesParams> {
+		TResult<FActorSelection> SelectionResult = FActorSelection::FromJson(Json);
+		if (SelectionResult.IsFailure()) {
+			return TResult<FSetPropertiesParams>::Failure(SelectionResult.GetError());
+		}
+
+		FSetPropertiesParams Params;
+		Params.Selection = MoveTemp(SelectionResult.GetValue());
+
+		const TSharedPtr<FJsonObject>* Properties = nullptr;
+		if (!Json->TryGetObjectField(TEXT("properties"), Properties) || (*Properties)->Values.Num() == 0) {
+			return TResult<FSetPropertiesParams>::Failure(
+				EErrorCode::InvalidInput,
+				TEXT("'properties' must be a non-empty object of property path -> value"));
+		}
+		Params.Properties.Reserve((*Properties)->Values.Num());
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Property : (*Properties)->Values) {
+			Params.Properties.Emplace(Property.Key, Property.Value);
+		}
+
+		Json->TryGetBoolField(TEXT("transact"), Params.bTransact);
+
+		return TResult<FSetPropertiesParams>::Success(MoveTemp(Params));
+	}
+
+	auto FSetPropertiesResult::ToJson() const -> TSharedPtr<FJsonObject> {
+		auto Result = MakeShared<FJsonObject>();
+		Result->SetNumberField(TEXT("matched_count"), MatchedCount);
+		Result->SetNumberField(TEXT("updated_count"), UpdatedCount);
+		Result->SetNumberField(TEXT("written_count"), WrittenCount);
+		Result->SetNumberField(TEXT("failed_count"), FailedCount);
+
+		TArray<TSharedPtr<FJsonValue>> ErrorArray;
+		ErrorArray.Reserve(Errors.Num());
+		for (const FFailure& Failure : Errors) {
+			auto Entry = MakeShared<FJsonObject>();
+			Entry->SetStringField(TEXT("actor"), Failure.ActorName);
+			Entry->SetStringField(TEXT("property"), Failure.Path);
+			Entry->SetStringField(TEXT("error"), Failure.Error);
+			ErrorArray.Add(MakeShared<FJsonValueObject>(Entry));
+		}
+		Result->SetArrayField(TEXT("errors"), ErrorArray);
+
+		Result->SetNumberField(TEXT("total_time_ms"), TotalTimeMs);
+		return Result;
+	}
+
+	auto FGetPropertiesParams::FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FGetPropertiesParams> {
+		TResult<FActorSelection> SelectionResult = FActorSelection::FromJson(Json);
+		if (SelectionResult.IsFailure()) {
+			return TResult<FGetPropertiesParams>::Failure(SelectionResult.GetError());
+		}
+
+		FGetPropertiesParams Params;
+		Params.Selection = MoveTemp(SelectionResult.GetValue());
+
+		if (Json->HasField(TEXT("paths"))) {
+			const TArray<TSharedPtr<FJsonValue>>* Paths = nullptr;
+			if (!Json->TryGetArrayField(TEXT("paths"), Paths)) {
+				return TResult<FGetPropertiesParams>::Failure(EErrorCode::InvalidInput, TEXT("'paths' must be an array of property paths"));
+			}
+			for (const TSharedPtr<FJsonValue>& Path : *Paths) {
+				FString PathString;
+				if (!Path->TryGetString(PathString) || PathString.IsEmpty()) {
+					return TResult<FGetPropertiesParams>::Failure(EErrorCode::InvalidInput, TEXT("'paths' must be an array of property paths"));
+				}
+				Params.Options.Paths.Add(MoveTemp(PathString));
+			}
+		}
+
+		int32 Depth = Params.Options.Depth;
+		if (Json->TryGetNumberField(TEXT("depth"), Depth)) {
+			Params.Options.Depth = FMath::Clamp(Depth, 0, 8);
+		}
+		Json->TryGetBoolField(TEXT("changed_only"), Params.Options.bChangedOnly);
+
+		return TResult<FGetPropertiesParams>::Success(MoveTemp(Params));
+	}
+
+	auto FGetPropertiesResult::ToJson() const -> TSharedPtr<FJsonObject> {
+		auto Result = MakeShared<FJsonObject>();
+
+		TArray<TSharedPtr<FJsonValue>> ActorArray;
+		ActorArray.Reserve(Entries.Num());
+		for (const FEntry& Entry : Entries) {
+			auto Actor = MakeShared<FJsonObject>();
+			Actor->SetStringField(TEXT("name"), Entry.Name);
+			Actor->SetStringField(TEXT("class"), Entry.ClassName);
+			Actor->SetObjectField(TEXT("properties"), Entry.Properties);
+			ActorArray.Add(MakeShared<FJsonValueObject>(Actor));
+		}
+		Result->SetArrayField(TEXT("actors"), ActorArray);
+		Result->SetNumberField(TEXT("count"), Entries.Num());
+
+		Result->SetNumberField(TEXT("total_time_ms"), TotalTimeMs);
+		return Result;
+	}
+
+	auto FSubscribeParams::FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FSubscribeParams> {
+		if (!Json.IsValid()) {
+			return TResult<FSubscribeParams>::Failure(EErrorCode::InvalidInput, TEXT("Invalid JSON object"));
+		}
+
+		TResult<FActorQueryFilter> FilterResult = FActorQueryFilter::FromJson(Json);
+		if (FilterResult.IsFailure()) {
+			return TResult<FSubscribeParams>::Failure(FilterResult.GetError());
+		}
+
+		FSubscribeParams Params;
+		Params.Filter = MoveTemp(FilterResult.GetValue());
+
+		if (const TArray<TSharedPtr<FJsonValue>>* Events = nullptr; Json->TryGetArrayField(TEXT("events"), Events)) {
+			Params.Kinds = 0;
+			for (const TSharedPtr<FJsonValue>& Event : *Events) {
+				ELevelEventKind Kind;
+				if (FString KindName; !Event->TryGetString(KindName) || !FLevelEvent::ParseKind(KindName, Kind)) {
+					return TResult<FSubscribeParams>::Failure(
+						EErrorCode::InvalidInput,
+						FString::Printf(TEXT("Invalid event '%s' (expected actor_added, actor_removed, actor_renamed, transform_changed, property_changed or blueprint_compiled)"), *KindName));
+				}
+				Params.Kinds |= 1u << static_cast<uint32>(Kind);
+			}
+			if (Params.Kinds == 0) {
+				return TResult<FSubscribeParams>::Failure(EErrorCode::InvalidInput, TEXT("'events' must name at least one event"));
+			}
+		}
+
+		if (FString Pattern; Json->TryGetStringField(TEXT("pattern"), Pattern)) {
+			Params.Pattern = MoveTemp(Pattern);
+		}
+		if (FString ModeName; Json->TryGetStringField(TEXT("mode"), ModeName) && !FNamePattern::ParseMode(ModeName, Params.Mode)) {
+			return TResult<FSubscribeParams>::Failure(
+				EErrorCode::InvalidInput,
+				FString::Printf(TEXT("Invalid 'mode' '%s' (expected contains, glob or regex)"), *ModeName));
+		}
+		Json->TryGetBoolField(TEXT("case_sensitive"), Params.bCaseSensitive);
+
+		Json->TryGetStringArrayField(TEXT("properties"), Params.Properties);
+
+		if (Json->TryGetNumberField(TEXT("max_queued"), Params.MaxQueued)
+			&& (Params.MaxQueued < 1 || Params.MaxQueued > FLevelEventStream::MaxMaxQueued)) {
+			return TResult<FSubscribeParams>::Failure(
+				EErrorCode::InvalidInput,
+				FString::Printf(TEXT("'max_queued' must be between 1 and %d"), FLevelEventStream::MaxMaxQueued));
+		}
+
+		return TResult<FSubscribeParams>::Success(MoveTemp(Params));
+	}
+
+	auto FSubscribeResult::ToJson() const -> TSharedPtr<FJsonObject> {
+		auto Result = MakeShared<FJsonObject>();
+		Result->SetNumberField(TEXT("subscription_id"), SubscriptionId);
+
+		TArray<TSharedPtr<FJsonValue>> EventArray;
+		for (uint32 Kind = 0; Kind <= static_cast<uint32>(ELevelEventKind::BlueprintCompiled); ++Kind) {
+			if (Kinds & (1u << Kind)) {
+				EventArray.Add(MakeShared<FJsonValueString>(FLevelEvent::GetKindName(static_cast<ELevelEventKind>(Kind))));
+			}
+		}
+		Result->SetArrayField(TEXT("events"), EventArray);
+		Result->SetNumberField(TEXT("max_queued"), MaxQueued);
+		return Result;
+	}
+
+	namespace {
+		auto NodeDigestToJson(const FLevelDigest::FNodeDigest& Node) -> TSharedPtr<FJsonObject> {
+			auto Json = MakeShared<FJsonObject>();
+			Json->SetStringField(TEXT("path"), Node.Path);
+			Json->SetStringField(TEXT("digest"), FLevelDigest::ToHex(Node.Digest));
+			Json->SetNumberField(TEXT("actor_count"), Node.ActorCount);
+
+			if (Node.Children.Num() > 0) {
+				TArray<TSharedPtr<FJsonValue>> ChildArray;
+				ChildArray.Reserve(Node.Children.Num());
+				for (const FLevelDigest::FNodeDigest& Child : Node.Children) {
+					ChildArray.Add(MakeShared<FJsonValueObject>(NodeDigestToJson(Child)));
+				}
+				Json->SetArrayField(TEXT("children"), ChildArray);
+			}
+
+			if (Node.Actors.Num() > 0) {
+				TArray<TSharedPtr<FJsonValue>> ActorArray;
+				ActorArray.Reserve(Node.Actors.Num());
+				for (const FLevelDigest::FActorDigest& Actor : Node.Actors) {
+					auto ActorJson = MakeShared<FJsonObject>();
+					ActorJson->SetStringField(TEXT("name"), Actor.Name);
+					ActorJson->SetStringField(TEXT("digest"), FLevelDigest::ToHex(Actor.Digest));
+					ActorArray.Add(MakeShared<FJsonValueObject>(ActorJson));
+				}
+				Json->SetArrayField(TEXT("actors"), ActorArray);
+			}
+			return Json;
+		}
+	}
+
+	auto FGetLevelDigestParams::FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FGetLevelDigestParams> {
+		if (!Json.IsValid()) {
+			return TResult<FGetLevelDigestParams>::Failure(EErrorCode::InvalidInput, TEXT("Invalid JSON object"));
+		}
+
+		FGetLevelDigestParams Params;
+		Json->TryGetStringField(TEXT("path"), Params.Path);
+		if (Json->TryGetNumberField(TEXT("depth"), Params.Depth) && (Params.Depth < 0 || Params.Depth > MaxDepth)) {
+			return TResult<FGetLevelDigestParams>::Failure(
+				EErrorCode::InvalidInput,
+				FString::Printf(TEXT("'depth' must be between 0 and %d"), MaxDepth));
+		}
+		Json->TryGetBoolField(TEXT("actors"), Params.bIncludeActors);
+		Json->TryGetBoolField(TEXT("rehash"), Params.bRehash);
+
+		return TResult<FGetLevelDigestParams>::Success(MoveTemp(Params));
+	}
+
+	auto FGetLevelDigestResult::ToJson() const -> TSharedPtr<FJsonObject> {
+		TSharedPtr<FJsonObject> Result = NodeDigestToJson(Node);
+		Result->SetNumberField(TEXT("total_time_ms"), TotalTimeMs);
+		return Result;
+	}
+
+	auto FDiffLevelParams::FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FDiffLevelParams> {
+		if (!Json.IsValid()) {
+			return TResult<FDiffLevelParams>::Failure(EErrorCode::InvalidInput, TEXT("Invalid JSON object"));
+		}
+
+		FString DigestText;
+		if (!Json->TryGetStringField(TEXT("since_digest"), DigestText)) {
+			return TResult<FDiffLevelParams>::Failure(EErrorCode::InvalidInput, TEXT("Missing 'since_digest' parameter"));
+		}
+
+		FDiffLevelParams Params;
+		if (!FLevelDigest::ParseHex(DigestText, Params.SinceDigest)) {
+			return TResult<FDiffLevelParams>::Failure(
+				EErrorCode::InvalidInput,
+				FString::Printf(TEXT("Invalid 'since_digest' '%s' (expected up to 16 hex digits)"), *DigestText));
+		}
+		return TResult<FDiffLevelParams>::Success(MoveTemp(Params));
+	}
+
+	auto FDiffLevelResult::ToJson() const -> TSharedPtr<FJsonObject> {
+		auto Result = MakeShared<FJsonObject>();
+		Result->SetStringField(TEXT("digest"), FLevelDigest::ToHex(Changes.Digest));
+		Result->SetBoolField(TEXT("full"), Changes.bFull);
+
+		TArray<TSharedPtr<FJsonValue>> ChangedArray;
+		ChangedArray.Reserve(Changes.ChangedActors.Num());
+		for (const TPair<FString, FString>& Changed : Changes.ChangedActors) {
+			auto Actor = MakeShared<FJsonObject>();
+			Actor->SetStringField(TEXT("actor"), Changed.Key);
+			Actor->SetStringField(TEXT("node"), Changed.Value);
+			ChangedArray.Add(MakeShared<FJsonValueObject>(Actor));
+		}
+		Result->SetArrayField(TEXT("changed"), ChangedArray);
+		Result->SetNumberField(TEXT("changed_count"), Changes.ChangedActors.Num());
+
+		TArray<TSharedPtr<FJsonValue>> RemovedArray;
+		RemovedArray.Reserve(Changes.RemovedActors.Num());
+		for (const FString& Name : Changes.RemovedActors) {
+			RemovedArray.Add(MakeShared<FJsonValueString>(Name));
+		}
+		Result->SetArrayField(TEXT("removed"), RemovedArray);
+		Result->SetNumberField(TEXT("removed_count"), Changes.RemovedActors.Num());
+
+		Result->SetNumberField(TEXT("total_time_ms"), TotalTimeMs);
+		return Result;
+	}
+
+	namespace {
+		auto MakeVectorArray(const FVector& Vector) -> TArray<TSharedPtr<FJsonValue>> {
+			return {MakeShared<FJsonValueNumber>(Vector.X), MakeShared<FJsonValueNumber>(Vector.Y), MakeShared<FJsonValueNumber>(Vector.Z)};
+		}
+
+		auto BoxToJson(const FBox& Box) -> TSharedPtr<FJsonObject> {
+			auto Json = MakeShared<FJsonObject>();
+			Json->SetArrayField(TEXT("min"), MakeVectorArray(Box.Min));
+			Json->SetArrayField(TEXT("max"), MakeVectorArray(Box.Max));
+			return Json;
+		}
+	}
+
+	auto FQueryActorDescsParams::FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FQueryActorDescsParams> {
+		if (!Json.IsValid()) {
+			return TResult<FQueryActorDescsParams>::Failure(EErrorCode::InvalidInput, TEXT("Invalid JSON object"));
+		}
+
+		FQueryActorDescsParams Params;
+
+		if (FString ClassName; Json->TryGetStringField(TEXT("class"), ClassName)) {
+			Params.ClassName = MoveTemp(ClassName);
+		}
+
+		if (FString Pattern; Json->TryGetStringField(TEXT("pattern"), Pattern)) {
+			Params.Pattern = MoveTemp(Pattern);
+		}
+		if (FString ModeName; Json->TryGetStringField(TEXT("mode"), ModeName) && !FNamePattern::ParseMode(ModeName, Params.Mode)) {
+			return TResult<FQueryActorDescsParams>::Failure(
+				EErrorCode::InvalidInput,
+				FString::Printf(TEXT("Invalid 'mode' '%s' (expected contains, glob or regex)"), *ModeName));
+		}
+		Json->TryGetBoolField(TEXT("case_sensitive"), Params.bCaseSensitive);
+
+		if (FString DataLayer; Json->TryGetStringField(TEXT("data_layer"), DataLayer)) {
+			Params.DataLayer = MoveTemp(DataLayer);
+		}
+		if (FString RuntimeGrid; Json->TryGetStringField(TEXT("runtime_grid"), RuntimeGrid)) {
+			Params.RuntimeGrid = MoveTemp(RuntimeGrid);
+		}
+
+		if (const TSharedPtr<FJsonObject>* Region; Json->TryGetObjectField(TEXT("region"), Region)) {
+			if ((*Region)->HasField(TEXT("min")) && (*Region)->HasField(TEXT("max"))) {
+				const FVector A = FCommonUtils::GetVectorFromJson(*Region, TEXT("min"));
+				const FVector B = FCommonUtils::GetVectorFromJson(*Region, TEXT("max"));
+				Params.RegionBox = FBox(A.ComponentMin(B), A.ComponentMax(B));
+			}
+			else if ((*Region)->HasField(TEXT("center")) && (*Region)->TryGetNumberField(TEXT("radius"), Params.RegionRadius)
+				&& Params.RegionRadius > 0.0) {
+				Params.RegionCenter = FCommonUtils::GetVectorFromJson(*Region, TEXT("center"));
+			}
+			else {
+				return TResult<FQueryActorDescsParams>::Failure(
+					EErrorCode::InvalidInput,
+					TEXT("'region' must have 'min' and 'max', or 'center' and a positive 'radius'"));
+			}
+		}
+
+		if (bool bLoaded; Json->TryGetBoolField(TEXT("loaded"), bLoaded)) {
+			Params.bLoaded = bLoaded;
+		}
+		if (bool bSpatiallyLoaded; Json->TryGetBoolField(TEXT("spatially_loaded"), bSpatiallyLoaded)) {
+			Params.bSpatiallyLoaded = bSpatiallyLoaded;
+		}
+
+		if (Json->TryGetNumberField(TEXT("limit"), Params.Limit) && (Params.Limit < 1 || Params.Limit > MaxLimit)) {
+			return TResult<FQueryActorDescsParams>::Failure(
+				EErrorCode::InvalidInput,
+				FString::Printf(TEXT("'limit' must be between 1 and %d"), MaxLimit));
+		}
+
+		return TResult<FQueryActorDescsParams>::Success(MoveTemp(Params));
+	}
+
+	auto FQueryActorDescsResult::ToJson() const -> TSharedPtr<FJsonObject> {
+		auto Result = MakeShared<FJsonObject>();
+
+		TArray<TSharedPtr<FJsonValue>> ActorArray;
+		ActorArray.Reserve(Entries.Num());
+		for (const FEntry& Entry : Entries) {
+			auto Actor = MakeShared<FJsonObject>();
+			Actor->SetStringField(TEXT("name"), Entry.Name);
+			Actor->SetStringField(TEXT("label"), Entry.Label);
+			Actor->SetStringField(TEXT("class"), Entry.ClassName);
+			Actor->SetStringField(TEXT("guid"), Entry.Guid.ToString(EGuidFormats::DigitsWithHyphens));
+			if (Entry.Bounds.IsValid) {
+				Actor->SetObjectField(TEXT("bounds"), BoxToJson(Entry.Bounds));
+			}
+
+			TArray<TSharedPtr<FJsonValue>> DataLayerArray;
+			DataLayerArray.Reserve(Entry.DataLayers.Num());
+			for (const FName DataLayer : Entry.DataLayers) {
+				DataLayerArray.Add(MakeShared<FJsonValueString>(DataLayer.ToString()));
+			}
+			Actor->SetArrayField(TEXT("data_layers"), DataLayerArray);
+
+			Actor->SetStringField(TEXT("runtime_grid"), Entry.RuntimeGrid.IsNone() ? FString() : Entry.RuntimeGrid.ToString());
+			Actor->SetBoolField(TEXT("spatially_loaded"), Entry.bSpatiallyLoaded);
+			Actor->SetBoolField(TEXT("loaded"), Entry.bLoaded);
+			ActorArray.Add(MakeShared<FJsonValueObject>(Actor));
+		}
+		Result->SetArrayField(TEXT("actors"), ActorArray);
+		Result->SetNumberField(TEXT("count"), Entries.Num());
+		Result->SetNumberField(TEXT("matched_count"), MatchedCount);
+		Result->SetNumberField(TEXT("total_count"), TotalCount);
+		Result->SetBoolField(TEXT("truncated"), MatchedCount > Entries.Num());
+
+		Result->SetNumberField(TEXT("total_time_ms"), TotalTimeMs);
+		return Result;
+	}
+
+	auto FLoadRegionParams::FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FLoadRegionParams> {
+		if (!Json.IsValid()) {
+			return TResult<FLoadRegionParams>::Failure(EErrorCode::InvalidInput, TEXT("Invalid JSON object"));
+		}
+
+		const TSharedPtr<FJsonObject>* Region;
+		if (!Json->TryGetObjectField(TEXT("region"), Region)) {
+			return TResult<FLoadRegionParams>::Failure(EErrorCode::InvalidInput, TEXT("Missing 'region' parameter"));
+		}
+
+		FLoadRegionParams Params;
+		if (double Radius; (*Region)->HasField(TEXT("min")) && (*Region)->HasField(TEXT("max"))) {
+			const FVector A = FCommonUtils::GetVectorFromJson(*Region, TEXT("min"));
+			const FVector B = FCommonUtils::GetVectorFromJson(*Region, TEXT("max"));
+			Params.Bounds = FBox(A.ComponentMin(B), A.ComponentMax(B));
+		}
+		else if ((*Region)->HasField(TEXT("center")) && (*Region)->TryGetNumberField(TEXT("radius"), Radius) && Radius > 0.0) {
+			// Cells are loaded by box; a sphere loads its bounding box
+			Params.Bounds = FBox::BuildAABB(FCommonUtils::GetVectorFromJson(*Region, TEXT("center")), FVector(Radius));
+		}
+		else {
+			return TResult<FLoadRegionParams>::Failure(
+				EErrorCode::InvalidInput,
+				TEXT("'region' must have 'min' and 'max', or 'center' and a positive 'radius'"));
+		}
+
+		return TResult<FLoadRegionParams>::Success(MoveTemp(Params));
+	}
+
+	auto FLoadRegionResult::ToJson() const -> TSharedPtr<FJsonObject> {
+		auto Result = MakeShared<FJsonObject>();
+		Result->SetNumberField(TEXT("region_id"), RegionId);
+		Result->SetObjectField(TEXT("bounds"), BoxToJson(Bounds));
+		Result->SetNumberField(TEXT("actor_count"), ActorCount);
+		Result->SetNumberField(TEXT("loaded_count"), LoadedCount);
+
+		Result->SetNumberField(TEXT("total_time_ms"), TotalTimeMs);
+		return Result;
+	}
+}
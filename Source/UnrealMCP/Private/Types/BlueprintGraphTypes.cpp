@@ -0,0 +1,564 @@
+﻿#include "Types/BlueprintGraphTypes.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Event.h"
+#include "K2Node_Variable.h"
+#include "Core/CommonUtils.h"
+#include "Core/ErrorTypes.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "EdGraphSchema_K2.h"
+
+namespace UnrealMCP {
+	namespace {
+		auto ParseNodeKind(const FString& Type, EGraphNodeKind& OutKind) -> bool {
+			static const TMap<FString, EGraphNodeKind> Kinds = {
+				{TEXT("event"), EGraphNodeKind::Event},
+				{TEXT("function_call"), EGraphNodeKind::FunctionCall},
+				{TEXT("variable_get"), EGraphNodeKind::VariableGet},
+				{TEXT("variable_set"), EGraphNodeKind::VariableSet},
+				{TEXT("self"), EGraphNodeKind::Self},
+				{TEXT("input_action"), EGraphNodeKind::InputAction},
+				{TEXT("component_reference"), EGraphNodeKind::ComponentReference}
+			};
+
+			if (const EGraphNodeKind* Kind = Kinds.Find(Type.ToLower())) {
+				OutKind = *Kind;
+				return true;
+			}
+			return false;
+		}
+	}
+
+	auto FGraphNodeSpec::FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FGraphNodeSpec> {
+		if (!Json.IsValid()) {
+			return TResult<FGraphNodeSpec>::Failure(EErrorCode::InvalidInput, TEXT("Invalid node object"));
+		}
+
+		FGraphNodeSpec Spec;
+
+		if (!Json->TryGetStringField(TEXT("id"), Spec.LocalId) || Spec.LocalId.IsEmpty()) {
+			return TResult<FGraphNodeSpec>::Failure(EErrorCode::InvalidInput, TEXT("Node is missing 'id'"));
+		}
+
+		FString Type;
+		if (!Json->TryGetStringField(TEXT("type"), Type)) {
+			return TResult<FGraphNodeSpec>::Failure(EErrorCode::InvalidInput,
+				FString::Printf(TEXT("Node '%s' is missing 'type'"), *Spec.LocalId));
+		}
+		if (!ParseNodeKind(Type, Spec.Kind)) {
+			return TResult<FGraphNodeSpec>::Failure(EErrorCode::InvalidInput, FString::Printf(
+				TEXT("Node '%s' has unsupported type '%s'. Supported types: event, function_call, variable_get, variable_set, self, input_action, component_reference"),
+				*Spec.LocalId,
+				*Type));
+		}
+
+		Json->TryGetStringField(TEXT("name"), Spec.Name);
+		if (Spec.Kind != EGraphNodeKind::Self && Spec.Name.IsEmpty()) {
+			return TResult<FGraphNodeSpec>::Failure(EErrorCode::InvalidInput,
+				FString::Printf(TEXT("Node '%s' is missing 'name'"), *Spec.LocalId));
+		}
+
+		FString Target;
+		if (Json->TryGetStringField(TEXT("target"), Target)) {
+			Spec.Target = Target;
+		}
+
+		if (Json->HasField(TEXT("position"))) {
+			Spec.Position = FCommonUtils::GetVector2DFromJson(Json, TEXT("position"));
+		}
+
+		if (const TSharedPtr<FJsonObject>* ParamsObj; Json->TryGetObjectField(TEXT("params"), ParamsObj)) {
+			Spec.Params = *ParamsObj;
+		}
+
+		return TResult<FGraphNodeSpec>::Success(MoveTemp(Spec));
+	}
+
+	auto FGraphLinkSpec::FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FGraphLinkSpec> {
+		if (!Json.IsValid()) {
+			return TResult<FGraphLinkSpec>::Failure(EErrorCode::InvalidInput, TEXT("Invalid link object"));
+		}
+
+		FGraphLinkSpec Spec;
+
+		if (!Json->TryGetStringField(TEXT("source"), Spec.SourceNode)) {
+			return TResult<FGraphLinkSpec>::Failure(EErrorCode::InvalidInput, TEXT("Link is missing 'source'"));
+		}
+		if (!Json->TryGetStringField(TEXT("target"), Spec.TargetNode)) {
+			return TResult<FGraphLinkSpec>::Failure(EErrorCode::InvalidInput, TEXT("Link is missing 'target'"));
+		}
+
+		// Empty pin names select the node's default exec pin
+		Json->TryGetStringField(TEXT("source_pin"), Spec.SourcePin);
+		Json->TryGetStringField(TEXT("target_pin"), Spec.TargetPin);
+
+		return TResult<FGraphLinkSpec>::Success(MoveTemp(Spec));
+	}
+
+	auto FBuildBlueprintGraphParams::FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FBuildBlueprintGraphParams> {
+		if (!Json.IsValid()) {
+			return TResult<FBuildBlueprintGraphParams>::Failure(EErrorCode::InvalidInput, TEXT("Invalid JSON object"));
+		}
+
+		FBuildBlueprintGraphParams Params;
+
+		if (!Json->TryGetStringField(TEXT("blueprint_name"), Params.BlueprintName)) {
+			return TResult<FBuildBlueprintGraphParams>::Failure(EErrorCode::InvalidInput, TEXT("Missing 'blueprint_name' parameter"));
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* NodesArray = nullptr;
+		if (Json->TryGetArrayField(TEXT("nodes"), NodesArray)) {
+			TSet<FString> LocalIds;
+			Params.Nodes.Reserve(NodesArray->Num());
+			for (const TSharedPtr<FJsonValue>& Value : *NodesArray) {
+				TResult<FGraphNodeSpec> NodeResult = FGraphNodeSpec::FromJson(Value.IsValid() ? Value->AsObject() : nullptr);
+				if (NodeResult.IsFailure()) {
+					return TResult<FBuildBlueprintGraphParams>::Failure(NodeResult.GetError());
+				}
+
+				bool bAlreadyUsed = false;
+				LocalIds.Add(NodeResult.GetValue().LocalId, &bAlreadyUsed);
+				if (bAlreadyUsed) {
+					return TResult<FBuildBlueprintGraphParams>::Failure(EErrorCode::InvalidInput,
+						FString::Printf(TEXT("Duplicate node id '%s'"), *NodeResult.GetValue().LocalId));
+				}
+
+				Params.Nodes.Add(NodeResult.GetValue());
+			}
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* LinksArray = nullptr;
+		if (Json->TryGetArrayField(TEXT("links"), LinksArray)) {
+			Params.Links.Reserve(LinksArray->Num());
+			for (const TSharedPtr<FJsonValue>& Value : *LinksArray) {
+				TResult<FGraphLinkSpec> LinkResult = FGraphLinkSpec::FromJson(Value.IsValid() ? Value->AsObject() : nullptr);
+				if (LinkResult.IsFailure()) {
+					return TResult<FBuildBlueprintGraphParams>::Failure(LinkResult.GetError());
+				}
+				Params.Links.Add(LinkResult.GetValue());
+			}
+		}
+
+		if (Params.Nodes.Num() == 0 && Params.Links.Num() == 0) {
+			return TResult<FBuildBlueprintGraphParams>::Failure(EErrorCode::InvalidInput, TEXT("Nothing to build: 'nodes' and 'links' are both empty"));
+		}
+
+		return TResult<FBuildBlueprintGraphParams>::Success(MoveTemp(Params));
+	}
+
+	auto FBuildBlueprintGraphResult::ToJson() const -> TSharedPtr<FJsonObject> {
+		auto Result = MakeShared<FJsonObject>();
+
+		auto NodeIdsJson = MakeShared<FJsonObject>();
+		for (const TPair<FString, FGuid>& NodeId : NodeIds) {
+			NodeIdsJson->SetStringField(NodeId.Key, NodeId.Value.ToString());
+		}
+
+		Result->SetObjectField(TEXT("node_ids"), NodeIdsJson);
+		Result->SetNumberField(TEXT("node_count"), NodeIds.Num());
+		Result->SetNumberField(TEXT("link_count"), LinkCount);
+		return Result;
+	}
+
+	auto FBlueprintNodeQuery::NodeClassesForType(const FString& NodeType, TArray<FString>& OutNodeClasses) -> bool {
+		if (NodeType == TEXT("Event")) {
+			OutNodeClasses.Add(TEXT("K2Node_Event"));
+		}
+		else if (NodeType == TEXT("Function")) {
+			OutNodeClasses.Add(TEXT("K2Node_CallFunction"));
+		}
+		else if (NodeType == TEXT("Variable")) {
+			OutNodeClasses.Add(TEXT("K2Node_VariableGet"));
+			OutNodeClasses.Add(TEXT("K2Node_VariableSet"));
+		}
+		else {
+			return false;
+		}
+		return true;
+	}
+
+	auto FBlueprintNodeQuery::FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FBlueprintNodeQuery> {
+		if (!Json.IsValid()) {
+			return TResult<FBlueprintNodeQuery>::Failure(EErrorCode::InvalidInput, TEXT("Invalid JSON object"));
+		}
+
+		FBlueprintNodeQuery Query;
+
+		if (!Json->TryGetStringField(TEXT("blueprint_name"), Query.BlueprintName)) {
+			return TResult<FBlueprintNodeQuery>::Failure(EErrorCode::InvalidInput, TEXT("Missing 'blueprint_name' parameter"));
+		}
+
+		// Legacy coarse node types
+		FString NodeType;
+		if (Json->TryGetStringField(TEXT("node_type"), NodeType)) {
+			if (!NodeClassesForType(NodeType, Query.NodeClasses)) {
+				return TResult<FBlueprintNodeQuery>::Failure(EErrorCode::InvalidInput, FString::Printf(
+					TEXT("Unsupported node type '%s'. Supported types: Event, Function, Variable (or use 'node_class')"), *NodeType));
+			}
+		}
+
+		FString NodeClass;
+		if (Json->TryGetStringField(TEXT("node_class"), NodeClass)) {
+			Query.NodeClasses.Add(NodeClass);
+		}
+
+		FString StringValue;
+		if (Json->TryGetStringField(TEXT("graph_name"), StringValue)) {
+			Query.GraphName = StringValue;
+		}
+		if (Json->TryGetStringField(TEXT("function_name"), StringValue) || Json->TryGetStringField(TEXT("event_name"), StringValue)) {
+			Query.FunctionName = StringValue;
+		}
+		if (Json->TryGetStringField(TEXT("variable_name"), StringValue)) {
+			Query.VariableName = StringValue;
+		}
+		if (Json->TryGetStringField(TEXT("pin_type"), StringValue)) {
+			Query.PinType = StringValue;
+		}
+
+		bool bConnected = false;
+		if (Json->TryGetBoolField(TEXT("connected"), bConnected)) {
+			Query.bConnected = bConnected;
+		}
+
+		if (const TSharedPtr<FJsonObject>* BoundsObj; Json->TryGetObjectField(TEXT("position"), BoundsObj)) {
+			if (!(*BoundsObj)->HasField(TEXT("min")) || !(*BoundsObj)->HasField(TEXT("max"))) {
+				return TResult<FBlueprintNodeQuery>::Failure(EErrorCode::InvalidInput, TEXT("'position' needs 'min' and 'max' [x, y] corners"));
+			}
+			const FVector2D Min = FCommonUtils::GetVector2DFromJson(*BoundsObj, TEXT("min"));
+			const FVector2D Max = FCommonUtils::GetVector2DFromJson(*BoundsObj, TEXT("max"));
+			Query.Bounds = FBox2D(Min.ComponentMin(Max), Min.ComponentMax(Max));
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* IncludeArray = nullptr;
+		if (Json->TryGetArrayField(TEXT("include"), IncludeArray)) {
+			for (const TSharedPtr<FJsonValue>& Value : *IncludeArray) {
+				const FString Projection = Value.IsValid() ? Value->AsString() : FString();
+				if (Projection == TEXT("pins")) {
+					Query.bIncludePins = true;
+				}
+				else if (Projection == TEXT("links")) {
+					Query.bIncludeLinks = true;
+				}
+				else if (Projection == TEXT("title")) {
+					Query.bIncludeTitle = true;
+				}
+				else {
+					return TResult<FBlueprintNodeQuery>::Failure(EErrorCode::InvalidInput, FString::Printf(
+						TEXT("Unsupported projection '%s'. Supported: pins, links, title"), *Projection));
+				}
+			}
+		}
+
+		int32 Limit = 0;
+		if (Json->TryGetNumberField(TEXT("limit"), Limit)) {
+			if (Limit <= 0) {
+				return TResult<FBlueprintNodeQuery>::Failure(EErrorCode::InvalidInput, TEXT("'limit' must be positive"));
+			}
+			Query.Limit = FMath::Min(Limit, MaxLimit);
+		}
+
+		Json->TryGetStringField(TEXT("cursor"), Query.Cursor);
+
+		return TResult<FBlueprintNodeQuery>::Success(MoveTemp(Query));
+	}
+
+	auto FBlueprintNodeQueryResult::ToJson() const -> TSharedPtr<FJsonObject> {
+		auto Result = MakeShared<FJsonObject>();
+
+		TArray<TSharedPtr<FJsonValue>> NodeValues;
+		TArray<TSharedPtr<FJsonValue>> GuidValues;
+		NodeValues.Reserve(Nodes.Num());
+		GuidValues.Reserve(Nodes.Num());
+
+		for (const UEdGraphNode* Node : Nodes) {
+			auto NodeJson = MakeShared<FJsonObject>();
+			NodeJson->SetStringField(TEXT("id"), Node->NodeGuid.ToString());
+			NodeJson->SetStringField(TEXT("class"), Node->GetClass()->GetName());
+			NodeJson->SetStringField(TEXT("graph"), Node->GetGraph() ? Node->GetGraph()->GetName() : FString());
+
+			TArray<TSharedPtr<FJsonValue>> Position;
+			Position.Add(MakeShared<FJsonValueNumber>(Node->NodePosX));
+			Position.Add(MakeShared<FJsonValueNumber>(Node->NodePosY));
+			NodeJson->SetArrayField(TEXT("position"), Position);
+
+			if (const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node)) {
+				NodeJson->SetStringField(TEXT("function"), CallNode->FunctionReference.GetMemberName().ToString());
+			}
+			else if (const UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node)) {
+				NodeJson->SetStringField(TEXT("function"), EventNode->CustomFunctionName.IsNone()
+					                                           ? EventNode->EventReference.GetMemberName().ToString()
+					                                           : EventNode->CustomFunctionName.ToString());
+			}
+			else if (const UK2Node_Variable* VariableNode = Cast<UK2Node_Variable>(Node)) {
+				NodeJson->SetStringField(TEXT("variable"), VariableNode->VariableReference.GetMemberName().ToString());
+			}
+
+			if (bIncludeTitle) {
+				NodeJson->SetStringField(TEXT("title"), Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
+			}
+
+			if (bIncludePins) {
+				TArray<TSharedPtr<FJsonValue>> PinValues;
+				for (const UEdGraphPin* Pin : Node->Pins) {
+					if (!Pin || Pin->bHidden) {
+						continue;
+					}
+					auto PinJson = MakeShared<FJsonObject>();
+					PinJson->SetStringField(TEXT("name"), Pin->PinName.ToString());
+					PinJson->SetStringField(TEXT("direction"), Pin->Direction == EGPD_Input ? TEXT("input") : TEXT("output"));
+					PinJson->SetStringField(TEXT("type"), FCommonUtils::PinTypeToString(Pin->PinType));
+					if (!Pin->DefaultValue.IsEmpty()) {
+						PinJson->SetStringField(TEXT("default_value"), Pin->DefaultValue);
+					}
+					PinJson->SetNumberField(TEXT("link_count"), Pin->LinkedTo.Num());
+					PinValues.Add(MakeShared<FJsonValueObject>(PinJson));
+				}
+				NodeJson->SetArrayField(TEXT("pins"), PinValues);
+			}
+
+			if (bIncludeLinks) {
+				// Outgoing links only, so each edge is reported once across a full result set
+				TArray<TSharedPtr<FJsonValue>> LinkValues;
+				for (const UEdGraphPin* Pin : Node->Pins) {
+					if (!Pin || Pin->Direction != EGPD_Output) {
+						continue;
+					}
+					for (const UEdGraphPin* Linked : Pin->LinkedTo) {
+						if (!Linked || !Linked->GetOwningNodeUnchecked()) {
+							continue;
+						}
+						auto LinkJson = MakeShared<FJsonObject>();
+						LinkJson->SetStringField(TEXT("source_pin"), Pin->PinName.ToString());
+						LinkJson->SetStringField(TEXT("target"), Linked->GetOwningNode()->NodeGuid.ToString());
+						LinkJson->SetStringField(TEXT("target_pin"), Linked->PinName.ToString());
+						LinkValues.Add(MakeShared<FJsonValueObject>(LinkJson));
+					}
+				}
+				NodeJson->SetArrayField(TEXT("links"), LinkValues);
+			}
+
+			NodeValues.Add(MakeShared<FJsonValueObject>(NodeJson));
+			GuidValues.Add(MakeShared<FJsonValueString>(Node->NodeGuid.ToString()));
+		}
+
+		Result->SetArrayField(TEXT("nodes"), NodeValues);
+		Result->SetArrayField(TEXT("node_guids"), GuidValues);
+		Result->SetNumberField(TEXT("count"), Nodes.Num());
+		Result->SetNumberField(TEXT("scanned"), ScannedCount);
+		if (NextCursor.IsSet()) {
+			Result->SetStringField(TEXT("next_cursor"), NextCursor.GetValue());
+		}
+		return Result;
+	}
+
+	auto FExportBlueprintGraphParams::FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FExportBlueprintGraphParams> {
+		if (!Json.IsValid()) {
+			return TResult<FExportBlueprintGraphParams>::Failure(EErrorCode::InvalidInput, TEXT("Invalid JSON object"));
+		}
+
+		FExportBlueprintGraphParams Params;
+		if (!Json->TryGetStringField(TEXT("blueprint_name"), Params.BlueprintName)) {
+			return TResult<FExportBlueprintGraphParams>::Failure(EErrorCode::InvalidInput, TEXT("Missing 'blueprint_name' parameter"));
+		}
+
+		FString GraphName;
+		if (Json->TryGetStringField(TEXT("graph_name"), GraphName)) {
+			Params.GraphName = GraphName;
+		}
+
+		int64 Since = 0;
+		if (Json->TryGetNumberField(TEXT("since"), Since)) {
+			Params.Since = Since;
+		}
+
+		return TResult<FExportBlueprintGraphParams>::Success(MoveTemp(Params));
+	}
+
+	namespace {
+		/** Compact pin type key, e.g. "exec", "real:double", "struct:Vector", "object:Actor[]" */
+		auto MakePinTypeKey(const FEdGraphPinType& PinType) -> FString {
+			FString Key = PinType.PinCategory.ToString();
+			if (PinType.PinSubCategoryObject.IsValid()) {
+				Key += TEXT(":") + PinType.PinSubCategoryObject->GetName();
+			}
+			else if (!PinType.PinSubCategory.IsNone()) {
+				Key += TEXT(":") + PinType.PinSubCategory.ToString();
+			}
+
+			switch (PinType.ContainerType) {
+				case EPinContainerType::Array:
+					Key += TEXT("[]");
+					break;
+				case EPinContainerType::Set:
+					Key += TEXT("{}");
+					break;
+				case EPinContainerType::Map:
+					Key += TEXT("{:}");
+					break;
+				default:
+					break;
+			}
+			if (PinType.bIsReference) {
+				Key += TEXT("&");
+			}
+			return Key;
+		}
+
+		/** Index of a string in an interning table, appending it on first use */
+		auto Intern(const FString& Value, TMap<FString, int32>& Indices, TArray<TSharedPtr<FJsonValue>>& Table) -> int32 {
+			if (const int32* Existing = Indices.Find(Value)) {
+				return *Existing;
+			}
+			const int32 Index = Table.Add(MakeShared<FJsonValueString>(Value));
+			Indices.Add(Value, Index);
+			return Index;
+		}
+
+		auto MakeIndexArray(std::initializer_list<int32> Values) -> TSharedPtr<FJsonValue> {
+			TArray<TSharedPtr<FJsonValue>> Items;
+			for (const int32 Value : Values) {
+				Items.Add(MakeShared<FJsonValueNumber>(Value));
+			}
+			return MakeShared<FJsonValueArray>(Items);
+		}
+	}
+
+	auto FBlueprintGraphExport::ToJson() const -> TSharedPtr<FJsonObject> {
+		auto Result = MakeShared<FJsonObject>();
+
+		TMap<FString, int32> PinTypeIndices;
+		TMap<FString, int32> ClassIndices;
+		TArray<TSharedPtr<FJsonValue>> PinTypeTable;
+		TArray<TSharedPtr<FJsonValue>> ClassTable;
+		TArray<TSharedPtr<FJsonValue>> GraphValues;
+		int64 Version = 0;
+		int32 NodeCount = 0;
+		int32 LinkCount = 0;
+
+		for (const FGraph& Entry : Graphs) {
+			const TArray<UEdGraphNode*>& Nodes = Entry.Changes.ChangedNodes;
+			Version = FMath::Max(Version, Entry.Changes.Version);
+
+			TMap<const UEdGraphNode*, int32> NodeIndices;
+			NodeIndices.Reserve(Nodes.Num());
+			for (int32 Index = 0; Index < Nodes.Num(); ++Index) {
+				NodeIndices.Add(Nodes[Index], Index);
+			}
+
+			TArray<TSharedPtr<FJsonValue>> RefValues;
+			const auto GetNodeIndex = [&](const UEdGraphNode* Node) -> int32 {
+				if (const int32* Existing = NodeIndices.Find(Node)) {
+					return *Existing;
+				}
+				const int32 Index = Nodes.Num() + RefValues.Add(MakeShared<FJsonValueString>(Node->NodeGuid.ToString()));
+				NodeIndices.Add(Node, Index);
+				return Index;
+			};
+
+			TArray<TSharedPtr<FJsonValue>> NodeValues;
+			TArray<TSharedPtr<FJsonValue>> LinkValues;
+			NodeValues.Reserve(Nodes.Num());
+
+			for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex) {
+				const UEdGraphNode* Node = Nodes[NodeIndex];
+
+				auto NodeJson = MakeShared<FJsonObject>();
+				NodeJson->SetStringField(TEXT("id"), Node->NodeGuid.ToString());
+				NodeJson->SetNumberField(TEXT("class"), Intern(Node->GetClass()->GetName(), ClassIndices, ClassTable));
+
+				TArray<TSharedPtr<FJsonValue>> Position;
+				Position.Add(MakeShared<FJsonValueNumber>(Node->NodePosX));
+				Position.Add(MakeShared<FJsonValueNumber>(Node->NodePosY));
+				NodeJson->SetArrayField(TEXT("pos"), Position);
+
+				if (const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node)) {
+					NodeJson->SetStringField(TEXT("member"), CallNode->FunctionReference.GetMemberName().ToString());
+				}
+				else if (const UK2Node_Variable* VariableNode = Cast<UK2Node_Variable>(Node)) {
+					NodeJson->SetStringField(TEXT("member"), VariableNode->VariableReference.GetMemberName().ToString());
+				}
+				else if (const UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node)) {
+					NodeJson->SetStringField(TEXT("member"), EventNode->CustomFunctionName.IsNone()
+						                                         ? EventNode->EventReference.GetMemberName().ToString()
+						                                         : EventNode->CustomFunctionName.ToString());
+				}
+				if (!Node->NodeComment.IsEmpty()) {
+					NodeJson->SetStringField(TEXT("comment"), Node->NodeComment);
+				}
+
+				// [name, direction (0 in, 1 out), pin type index, default value if any]
+				TArray<TSharedPtr<FJsonValue>> PinValues;
+				PinValues.Reserve(Node->Pins.Num());
+				for (int32 PinIndex = 0; PinIndex < Node->Pins.Num(); ++PinIndex) {
+					const UEdGraphPin* Pin = Node->Pins[PinIndex];
+					if (!Pin) {
+						PinValues.Add(MakeShared<FJsonValueNull>());
+						continue;
+					}
+
+					TArray<TSharedPtr<FJsonValue>> PinFields;
+					PinFields.Add(MakeShared<FJsonValueString>(Pin->PinName.ToString()));
+					PinFields.Add(MakeShared<FJsonValueNumber>(Pin->Direction == EGPD_Output ? 1 : 0));
+					PinFields.Add(MakeShared<FJsonValueNumber>(Intern(MakePinTypeKey(Pin->PinType), PinTypeIndices, PinTypeTable)));
+					const FString DefaultValue = Pin->DefaultObject ? Pin->DefaultObject->GetPathName()
+						                             : !Pin->DefaultTextValue.IsEmpty() ? Pin->DefaultTextValue.ToString()
+						                             : Pin->DefaultValue;
+					if (!DefaultValue.IsEmpty()) {
+						PinFields.Add(MakeShared<FJsonValueString>(DefaultValue));
+					}
+					PinValues.Add(MakeShared<FJsonValueArray>(PinFields));
+
+					for (const UEdGraphPin* Linked : Pin->LinkedTo) {
+						const UEdGraphNode* LinkedNode = Linked ? Linked->GetOwningNodeUnchecked() : nullptr;
+						if (!LinkedNode) {
+							continue;
+						}
+						const int32 LinkedPinIndex = LinkedNode->Pins.IndexOfByKey(Linked);
+
+						if (Pin->Direction == EGPD_Output) {
+							LinkValues.Add(MakeIndexArray({NodeIndex, PinIndex, GetNodeIndex(LinkedNode), LinkedPinIndex}));
+						}
+						else if (const int32* LinkedIndex = NodeIndices.Find(LinkedNode); !LinkedIndex || *LinkedIndex >= Nodes.Num()) {
+							// Links from exported nodes are emitted with their source; only unchanged sources are added here
+							LinkValues.Add(MakeIndexArray({GetNodeIndex(LinkedNode), LinkedPinIndex, NodeIndex, PinIndex}));
+						}
+					}
+				}
+				NodeJson->SetArrayField(TEXT("pins"), PinValues);
+				NodeValues.Add(MakeShared<FJsonValueObject>(NodeJson));
+			}
+
+			auto GraphJson = MakeShared<FJsonObject>();
+			GraphJson->SetStringField(TEXT("name"), Entry.Graph->GetName());
+			GraphJson->SetNumberField(TEXT("version"), static_cast<double>(Entry.Changes.Version));
+			GraphJson->SetBoolField(TEXT("full"), Entry.Changes.bFull);
+			GraphJson->SetArrayField(TEXT("nodes"), NodeValues);
+			if (RefValues.Num() > 0) {
+				GraphJson->SetArrayField(TEXT("refs"), RefValues);
+			}
+			GraphJson->SetArrayField(TEXT("links"), LinkValues);
+			if (Entry.Changes.RemovedNodes.Num() > 0) {
+				TArray<TSharedPtr<FJsonValue>> RemovedValues;
+				for (const FGuid& Removed : Entry.Changes.RemovedNodes) {
+					RemovedValues.Add(MakeShared<FJsonValueString>(Removed.ToString()));
+				}
+				GraphJson->SetArrayField(TEXT("removed"), RemovedValues);
+			}
+			GraphValues.Add(MakeShared<FJsonValueObject>(GraphJson));
+
+			NodeCount += Nodes.Num();
+			LinkCount += LinkValues.Num();
+		}
+
+		// Pass 'version' back as 'since' to receive only later changes
+		Result->SetNumberField(TEXT("version"), static_cast<double>(Version));
+		Result->SetArrayField(TEXT("pin_types"), PinTypeTable);
+		Result->SetArrayField(TEXT("classes"), ClassTable);
+		Result->SetArrayField(TEXT("graphs"), GraphValues);
+		Result->SetNumberField(TEXT("node_count"), NodeCount);
+		Result->SetNumberField(TEXT("link_count"), LinkCount);
+		return Result;
+	}
+}
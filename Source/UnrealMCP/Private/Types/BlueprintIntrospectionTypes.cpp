@@ -1,4 +1,5 @@
 ﻿#include "Types/BlueprintIntrospectionTypes.h"
+#include "Core/ErrorTypes.h"
 
 namespace UnrealMCP {
 	auto FBlueprintFunctionParam::ToJson() const -> TSharedPtr<FJsonObject> {
@@ -77,4 +78,82 @@ namespace UnrealMCP {
 
 		return Result;
 	}
+
+	auto FSearchBlueprintsParams::FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FSearchBlueprintsParams> {
+		if (!Json.IsValid()) {
+			return TResult<FSearchBlueprintsParams>::Failure(EErrorCode::InvalidInput, TEXT("Invalid JSON object"));
+		}
+
+		FSearchBlueprintsParams Params;
+		if (!Json->TryGetStringField(TEXT("name"), Params.Name) || Params.Name.IsEmpty()) {
+			return TResult<FSearchBlueprintsParams>::Failure(EErrorCode::InvalidInput, TEXT("Missing 'name' parameter"));
+		}
+
+		FString KindName;
+		if (Json->TryGetStringField(TEXT("kind"), KindName)) {
+			EBlueprintReferenceKind Kind;
+			if (!FBlueprintSearchIndex::ParseKindName(KindName, Kind)) {
+				return TResult<FSearchBlueprintsParams>::Failure(EErrorCode::InvalidInput, FString::Printf(
+					TEXT("Unsupported kind '%s'. Supported kinds: function_call, variable_read, variable_write, event, input_action"),
+					*KindName));
+			}
+			Params.Kind = Kind;
+		}
+
+		Json->TryGetStringField(TEXT("path"), Params.Path);
+
+		int32 Limit = 0;
+		if (Json->TryGetNumberField(TEXT("limit"), Limit)) {
+			if (Limit <= 0) {
+				return TResult<FSearchBlueprintsParams>::Failure(EErrorCode::InvalidInput, TEXT("'limit' must be positive"));
+			}
+			Params.Limit = Limit;
+		}
+
+		return TResult<FSearchBlueprintsParams>::Success(MoveTemp(Params));
+	}
+
+	auto FSearchBlueprintsResult::ToJson() const -> TSharedPtr<FJsonObject> {
+		auto Result = MakeShared<FJsonObject>();
+
+		TArray<TSharedPtr<FJsonValue>> HitValues;
+		TSet<FString> Blueprints;
+		for (const FBlueprintSearchHit& Hit : Hits) {
+			auto HitJson = MakeShared<FJsonObject>();
+			HitJson->SetStringField(TEXT("blueprint"), Hit.BlueprintPath);
+			HitJson->SetStringField(TEXT("graph"), Hit.Graph);
+			HitJson->SetStringField(TEXT("node_id"), Hit.NodeGuid.ToString());
+			HitJson->SetStringField(TEXT("kind"), FBlueprintSearchIndex::GetKindName(Hit.Kind));
+			HitJson->SetStringField(TEXT("name"), Hit.Name.ToString());
+			HitValues.Add(MakeShared<FJsonValueObject>(HitJson));
+			Blueprints.Add(Hit.BlueprintPath);
+		}
+
+		Result->SetArrayField(TEXT("hits"), HitValues);
+		Result->SetNumberField(TEXT("count"), Hits.Num());
+		Result->SetNumberField(TEXT("total_matches"), TotalMatches);
+		Result->SetNumberField(TEXT("blueprint_count"), Blueprints.Num());
+		Result->SetNumberField(TEXT("indexed_blueprints"), IndexedBlueprints);
+		return Result;
+	}
+
+	auto FIndexBlueprintsParams::FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FIndexBlueprintsParams> {
+		if (!Json.IsValid()) {
+			return TResult<FIndexBlueprintsParams>::Failure(EErrorCode::InvalidInput, TEXT("Invalid JSON object"));
+		}
+
+		FIndexBlueprintsParams Params;
+		Json->TryGetStringField(TEXT("path"), Params.Path);
+		Json->TryGetBoolField(TEXT("recursive"), Params.bRecursive);
+		Json->TryGetBoolField(TEXT("only_missing"), Params.bOnlyMissing);
+		return TResult<FIndexBlueprintsParams>::Success(MoveTemp(Params));
+	}
+
+	auto FIndexBlueprintsResult::ToJson() const -> TSharedPtr<FJsonObject> {
+		auto Result = MakeShared<FJsonObject>();
+		Result->SetNumberField(TEXT("indexed"), IndexedCount);
+		Result->SetNumberField(TEXT("skipped"), SkippedCount);
+		Result->SetNumberField(TEXT("indexed_blueprints"), IndexedBlueprints);
+		return Result;
+	}
 }
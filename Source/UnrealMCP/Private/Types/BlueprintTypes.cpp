@@ -73,4 +73,90 @@ namespace UnrealMCP {
 		Result->SetStringField(TEXT("deleted_path"), DeletedPath);
 		return Result;
 	}
+
+	auto FCompileBlueprintsParams::FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FCompileBlueprintsParams> {
+		if (!Json.IsValid()) {
+			return TResult<FCompileBlueprintsParams>::Failure(EErrorCode::InvalidInput, TEXT("Invalid JSON object"));
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* NamesArray = nullptr;
+		if (!Json->TryGetArrayField(TEXT("blueprint_names"), NamesArray) || NamesArray->Num() == 0) {
+			return TResult<FCompileBlueprintsParams>::Failure(EErrorCode::InvalidInput, TEXT("Missing or empty 'blueprint_names' parameter"));
+		}
+
+		FCompileBlueprintsParams Params;
+		for (const TSharedPtr<FJsonValue>& Value : *NamesArray) {
+			FString Name;
+			if (!Value.IsValid() || !Value->TryGetString(Name) || Name.IsEmpty()) {
+				return TResult<FCompileBlueprintsParams>::Failure(EErrorCode::InvalidInput, TEXT("'blueprint_names' must contain non-empty strings"));
+			}
+			Params.BlueprintNames.AddUnique(Name);
+		}
+
+		return TResult<FCompileBlueprintsParams>::Success(MoveTemp(Params));
+	}
+
+	auto FBlueprintCompileTimings::ToJson() const -> TSharedPtr<FJsonObject> {
+		auto Result = MakeShared<FJsonObject>();
+		Result->SetNumberField(TEXT("skeleton_ms"), SkeletonMs);
+		Result->SetNumberField(TEXT("bytecode_and_reinstancing_ms"), CompileMs);
+		if (GarbageCollectionMs.IsSet()) {
+			Result->SetNumberField(TEXT("gc_ms"), GarbageCollectionMs.GetValue());
+		}
+		Result->SetNumberField(TEXT("total_ms"), SkeletonMs + CompileMs + GarbageCollectionMs.Get(0.0));
+		return Result;
+	}
+
+	auto FBlueprintCompileReport::IsSuccess() const -> bool {
+		return Status == TEXT("up_to_date") || Status == TEXT("up_to_date_with_warnings");
+	}
+
+	auto FBlueprintCompileReport::ToJson() const -> TSharedPtr<FJsonObject> {
+		auto Result = MakeShared<FJsonObject>();
+		Result->SetStringField(TEXT("blueprint_name"), BlueprintName);
+		Result->SetStringField(TEXT("status"), Status);
+
+		TArray<TSharedPtr<FJsonValue>> ErrorValues;
+		for (const FString& Error : Errors) {
+			ErrorValues.Add(MakeShared<FJsonValueString>(Error));
+		}
+		Result->SetArrayField(TEXT("errors"), ErrorValues);
+
+		TArray<TSharedPtr<FJsonValue>> WarningValues;
+		for (const FString& Warning : Warnings) {
+			WarningValues.Add(MakeShared<FJsonValueString>(Warning));
+		}
+		Result->SetArrayField(TEXT("warnings"), WarningValues);
+
+		if (Timings.IsSet()) {
+			Result->SetObjectField(TEXT("timings"), Timings->ToJson());
+
+			TArray<TSharedPtr<FJsonValue>> DependentValues;
+			for (const FString& Dependent : RecompiledDependents) {
+				DependentValues.Add(MakeShared<FJsonValueString>(Dependent));
+			}
+			Result->SetArrayField(TEXT("recompiled_dependents"), DependentValues);
+		}
+
+		return Result;
+	}
+
+	auto FCompileBlueprintsResult::ToJson() const -> TSharedPtr<FJsonObject> {
+		auto Result = MakeShared<FJsonObject>();
+
+		int32 NumFailed = 0;
+		TArray<TSharedPtr<FJsonValue>> ReportValues;
+		for (const FBlueprintCompileReport& Report : Reports) {
+			ReportValues.Add(MakeShared<FJsonValueObject>(Report.ToJson()));
+			if (!Report.IsSuccess()) {
+				++NumFailed;
+			}
+		}
+
+		Result->SetArrayField(TEXT("blueprints"), ReportValues);
+		Result->SetNumberField(TEXT("compiled_count"), Reports.Num() - NumFailed);
+		Result->SetNumberField(TEXT("failed_count"), NumFailed);
+		Result->SetNumberField(TEXT("total_time_ms"), TotalTimeMs);
+		return Result;
+	}
 }
@@ -19,6 +19,7 @@
 #include "Interfaces/IPv4/IPv4Address.h"
 #include "Interfaces/IPv4/IPv4Endpoint.h"
 #include "Kismet/GameplayStatics.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
@@ -57,6 +58,16 @@
 #include "Commands/UnrealMCPInputCommands.h"
 #include "Commands/UnrealMCPRegistryCommands.h"
 #include "Commands/UnrealMCPWidgetCommands.h"
+#include "Core/ActorIndex.h"
+#include "Core/BlueprintCompileCoordinator.h"
+#include "Core/BlueprintSearchIndex.h"
+#include "Core/GraphChangeJournal.h"
+#include "Core/GraphNodeIndex.h"
+#include "Core/LevelDigest.h"
+#include "Core/LevelEventStream.h"
+#include "Core/PinLookupCache.h"
+#include "Core/PropertyPath.h"
+#include "Core/WorldPartitionRegions.h"
 #include "Core/CommonUtils.h"
 #include "Core/MCPRegistry.h"
 
@@ -90,6 +101,24 @@ auto UUnrealMCPBridge::Initialize(FSubsystemCollectionBase& Collection) -> void
 	// Initialize the MCP Registry
 	UnrealMCP::FMCPRegistry::Initialize();
 
+	// Keep actor lookups current from level events
+	UnrealMCP::FActorIndex::Initialize();
+
+	// Coalesce blueprint compiles requested by consecutive commands
+	UnrealMCP::FBlueprintCompileCoordinator::Initialize();
+
+	// Keep the project-wide blueprint search index current from asset saves
+	UnrealMCP::FBlueprintSearchIndex::Initialize();
+
+	// Drop cached property paths when classes are recompiled
+	UnrealMCP::FPropertyPath::Initialize();
+
+	// Record level changes for subscribe and push them once per frame
+	UnrealMCP::FLevelEventStream::Initialize();
+
+	// Mark actors dirty for the level digest as they change
+	UnrealMCP::FLevelDigest::Initialize();
+
 	bIsRunning = false;
 	ListenerSocket = nullptr;
 	ConnectionSocket = nullptr;
@@ -105,6 +134,16 @@ auto UUnrealMCPBridge::Initialize(FSubsystemCollectionBase& Collection) -> void
 auto UUnrealMCPBridge::Deinitialize() -> void {
 	UE_LOG(LogTemp, Display, TEXT("UnrealMCPBridge: Shutting down"));
 	StopServer();
+	UnrealMCP::FActorIndex::Shutdown();
+	UnrealMCP::FBlueprintCompileCoordinator::Shutdown();
+	UnrealMCP::FBlueprintSearchIndex::Shutdown();
+	UnrealMCP::FPropertyPath::Shutdown();
+	UnrealMCP::FLevelEventStream::Shutdown();
+	UnrealMCP::FLevelDigest::Shutdown();
+	UnrealMCP::FGraphNodeIndex::Reset();
+	UnrealMCP::FGraphChangeJournal::Reset();
+	UnrealMCP::FPinLookupCache::Reset();
+	UnrealMCP::FWorldPartitionRegions::Reset();
 }
 
 // Start the MCP server
@@ -204,10 +243,27 @@ auto UUnrealMCPBridge::InitializeCommandRouting() -> void {
 	// Editor commands
 	CommandRoutingMap.Add(TEXT("get_actors_in_level"), ECommandHandlerType::Editor);
 	CommandRoutingMap.Add(TEXT("find_actors_by_name"), ECommandHandlerType::Editor);
+	CommandRoutingMap.Add(TEXT("find_actors_in_radius"), ECommandHandlerType::Editor);
+	CommandRoutingMap.Add(TEXT("find_actors_in_box"), ECommandHandlerType::Editor);
+	CommandRoutingMap.Add(TEXT("find_nearest_actors"), ECommandHandlerType::Editor);
+	CommandRoutingMap.Add(TEXT("query_actors"), ECommandHandlerType::Editor);
 	CommandRoutingMap.Add(TEXT("spawn_actor"), ECommandHandlerType::Editor);
+	CommandRoutingMap.Add(TEXT("spawn_actors"), ECommandHandlerType::Editor);
 	CommandRoutingMap.Add(TEXT("create_actor"), ECommandHandlerType::Editor);
 	CommandRoutingMap.Add(TEXT("delete_actor"), ECommandHandlerType::Editor);
 	CommandRoutingMap.Add(TEXT("set_actor_transform"), ECommandHandlerType::Editor);
+	CommandRoutingMap.Add(TEXT("set_actor_transforms"), ECommandHandlerType::Editor);
+	CommandRoutingMap.Add(TEXT("transform_actors"), ECommandHandlerType::Editor);
+	CommandRoutingMap.Add(TEXT("scatter_instances"), ECommandHandlerType::Editor);
+	CommandRoutingMap.Add(TEXT("set_properties"), ECommandHandlerType::Editor);
+	CommandRoutingMap.Add(TEXT("get_properties"), ECommandHandlerType::Editor);
+	CommandRoutingMap.Add(TEXT("subscribe"), ECommandHandlerType::Editor);
+	CommandRoutingMap.Add(TEXT("unsubscribe"), ECommandHandlerType::Editor);
+	CommandRoutingMap.Add(TEXT("get_level_digest"), ECommandHandlerType::Editor);
+	CommandRoutingMap.Add(TEXT("diff_level"), ECommandHandlerType::Editor);
+	CommandRoutingMap.Add(TEXT("query_actor_descs"), ECommandHandlerType::Editor);
+	CommandRoutingMap.Add(TEXT("load_region"), ECommandHandlerType::Editor);
+	CommandRoutingMap.Add(TEXT("unload_region"), ECommandHandlerType::Editor);
 	CommandRoutingMap.Add(TEXT("get_actor_properties"), ECommandHandlerType::Editor);
 	CommandRoutingMap.Add(TEXT("set_actor_property"), ECommandHandlerType::Editor);
 	CommandRoutingMap.Add(TEXT("spawn_blueprint_actor"), ECommandHandlerType::Editor);
@@ -220,6 +276,7 @@ auto UUnrealMCPBridge::InitializeCommandRouting() -> void {
 	CommandRoutingMap.Add(TEXT("set_component_property"), ECommandHandlerType::Blueprint);
 	CommandRoutingMap.Add(TEXT("set_physics_properties"), ECommandHandlerType::Blueprint);
 	CommandRoutingMap.Add(TEXT("compile_blueprint"), ECommandHandlerType::Blueprint);
+	CommandRoutingMap.Add(TEXT("compile_blueprints"), ECommandHandlerType::Blueprint);
 	CommandRoutingMap.Add(TEXT("set_blueprint_property"), ECommandHandlerType::Blueprint);
 	CommandRoutingMap.Add(TEXT("set_static_mesh_properties"), ECommandHandlerType::Blueprint);
 	CommandRoutingMap.Add(TEXT("set_pawn_properties"), ECommandHandlerType::Blueprint);
@@ -246,6 +303,11 @@ auto UUnrealMCPBridge::InitializeCommandRouting() -> void {
 	CommandRoutingMap.Add(TEXT("add_function_parameter"), ECommandHandlerType::Blueprint);
 	CommandRoutingMap.Add(TEXT("set_function_return_type"), ECommandHandlerType::Blueprint);
 	CommandRoutingMap.Add(TEXT("set_function_metadata"), ECommandHandlerType::Blueprint);
+	CommandRoutingMap.Add(TEXT("search_blueprints"), ECommandHandlerType::Blueprint);
+	CommandRoutingMap.Add(TEXT("index_blueprints"), ECommandHandlerType::Blueprint);
+
+	// Served from the blueprint search index without a game thread round trip
+	AnyThreadCommands.Add(TEXT("search_blueprints"));
 
 	// Blueprint node commands
 	CommandRoutingMap.Add(TEXT("connect_blueprint_nodes"), ECommandHandlerType::BlueprintNode);
@@ -257,6 +319,8 @@ auto UUnrealMCPBridge::InitializeCommandRouting() -> void {
 	CommandRoutingMap.Add(TEXT("add_blueprint_function_node"), ECommandHandlerType::BlueprintNode);
 	CommandRoutingMap.Add(TEXT("add_blueprint_get_component_node"), ECommandHandlerType::BlueprintNode);
 	CommandRoutingMap.Add(TEXT("add_blueprint_variable"), ECommandHandlerType::BlueprintNode);
+	CommandRoutingMap.Add(TEXT("build_blueprint_graph"), ECommandHandlerType::BlueprintNode);
+	CommandRoutingMap.Add(TEXT("export_blueprint_graph"), ECommandHandlerType::BlueprintNode);
 
 	// Input commands
 	CommandRoutingMap.Add(TEXT("create_input_mapping"), ECommandHandlerType::Input);
@@ -283,10 +347,95 @@ auto UUnrealMCPBridge::InitializeCommandRouting() -> void {
 	CommandRoutingMap.Add(TEXT("get_available_api_methods"), ECommandHandlerType::Registry);
 }
 
+auto UUnrealMCPBridge::AddCompileStatus(const TSharedPtr<FJsonObject>& ResponseJson) -> void {
+	using UnrealMCP::FBlueprintCompileCoordinator;
+
+	const TArray<FBlueprintCompileCoordinator::FCompileRecord> Completed = FBlueprintCompileCoordinator::TakeCompletedCompiles();
+	if (Completed.Num() > 0) {
+		TArray<TSharedPtr<FJsonValue>> CompiledArray;
+		for (const FBlueprintCompileCoordinator::FCompileRecord& Record : Completed) {
+			const TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+			Entry->SetStringField(TEXT("blueprint"), Record.BlueprintName);
+			Entry->SetStringField(TEXT("mode"), FBlueprintCompileCoordinator::GetModeName(Record.Mode));
+			Entry->SetNumberField(TEXT("time_ms"), Record.Seconds * 1000.0);
+			if (Record.BatchSize > 1) {
+				Entry->SetNumberField(TEXT("batch_size"), Record.BatchSize);
+			}
+			Entry->SetStringField(TEXT("status"), Record.Status);
+			if (Record.Errors.Num() > 0) {
+				TArray<TSharedPtr<FJsonValue>> ErrorValues;
+				for (const FString& Error : Record.Errors) {
+					ErrorValues.Add(MakeShared<FJsonValueString>(Error));
+				}
+				Entry->SetArrayField(TEXT("errors"), ErrorValues);
+			}
+			if (Record.Warnings.Num() > 0) {
+				TArray<TSharedPtr<FJsonValue>> WarningValues;
+				for (const FString& Warning : Record.Warnings) {
+					WarningValues.Add(MakeShared<FJsonValueString>(Warning));
+				}
+				Entry->SetArrayField(TEXT("warnings"), WarningValues);
+			}
+			CompiledArray.Add(MakeShared<FJsonValueObject>(Entry));
+		}
+		ResponseJson->SetArrayField(TEXT("compiled"), CompiledArray);
+	}
+
+	if (FBlueprintCompileCoordinator::HasPending()) {
+		TArray<TSharedPtr<FJsonValue>> PendingArray;
+		for (const TPair<FString, UnrealMCP::EBlueprintCompileMode>& Pending : FBlueprintCompileCoordinator::GetPending()) {
+			const TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+			Entry->SetStringField(TEXT("blueprint"), Pending.Key);
+			Entry->SetStringField(TEXT("mode"), FBlueprintCompileCoordinator::GetModeName(Pending.Value));
+			PendingArray.Add(MakeShared<FJsonValueObject>(Entry));
+		}
+		ResponseJson->SetArrayField(TEXT("compile_pending"), PendingArray);
+	}
+}
+
+auto UUnrealMCPBridge::SetResponseResult(
+	const TSharedPtr<FJsonObject>& ResponseJson,
+	const TSharedPtr<FJsonObject>& ResultJson
+) -> void {
+	// Check if the result contains an error
+	bool bSuccess = true;
+	FString ErrorMessage;
+
+	if (ResultJson->HasField(TEXT("success"))) {
+		bSuccess = ResultJson->GetBoolField(TEXT("success"));
+		if (!bSuccess && ResultJson->HasField(TEXT("error"))) {
+			ErrorMessage = ResultJson->GetStringField(TEXT("error"));
+		}
+	}
+
+	if (bSuccess) {
+		// Set success status and include the result
+		ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
+		ResponseJson->SetObjectField(TEXT("result"), ResultJson);
+	}
+	else {
+		// Set error status and include the error message
+		ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+		ResponseJson->SetStringField(TEXT("error"), ErrorMessage);
+	}
+}
+
 // Execute a command received from a client
 auto UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params) -> FString {
 	UE_LOG(LogTemp, Display, TEXT("UnrealMCPBridge: Executing command: %s"), *CommandType);
 
+	// Index-backed reads answer from the calling thread, so they never wait behind a busy game thread
+	if (AnyThreadCommands.Contains(CommandType)) {
+		const TSharedPtr<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
+		SetResponseResult(ResponseJson, BlueprintCommands->HandleCommand(CommandType, Params));
+
+		FString ResultString;
+		const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+			TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&ResultString);
+		FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
+		return ResultString;
+	}
+
 	// Create a promise to wait for the result
 	TPromise<FString> Promise;
 	const TFuture<FString> Future = Promise.GetFuture();
@@ -333,33 +482,17 @@ auto UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TSharedP
 				                                       FString::Printf(TEXT("Unknown command: %s"), *CommandType));
 
 				          FString ResultString;
-				          const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
+				          const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+				          	TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&ResultString);
 				          FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
 				          Promise.SetValue(ResultString);
 				          return;
 			          }
 
-			          // Check if the result contains an error
-			          bool bSuccess = true;
-			          FString ErrorMessage;
+			          SetResponseResult(ResponseJson, ResultJson);
 
-			          if (ResultJson->HasField(TEXT("success"))) {
-				          bSuccess = ResultJson->GetBoolField(TEXT("success"));
-				          if (!bSuccess && ResultJson->HasField(TEXT("error"))) {
-					          ErrorMessage = ResultJson->GetStringField(TEXT("error"));
-				          }
-			          }
-
-			          if (bSuccess) {
-				          // Set success status and include the result
-				          ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
-				          ResponseJson->SetObjectField(TEXT("result"), ResultJson);
-			          }
-			          else {
-				          // Set error status and include the error message
-				          ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-				          ResponseJson->SetStringField(TEXT("error"), ErrorMessage);
-			          }
+			          // Report compiles run since the previous response and which blueprints still await their deferred compile
+			          AddCompileStatus(ResponseJson);
 		          }
 		          catch (const std::exception& e) {
 			          ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
@@ -367,7 +500,8 @@ auto UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TSharedP
 		          }
 
 		          FString ResultString;
-		          const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
+		          const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+		          	TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&ResultString);
 		          FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
 		          Promise.SetValue(ResultString);
 	          });
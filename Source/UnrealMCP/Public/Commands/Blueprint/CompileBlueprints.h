@@ -0,0 +1,20 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+namespace UnrealMCP {
+
+	/**
+	 * Handles compiling several blueprints with one compilation queue flush.
+	 */
+	class UNREALMCP_API FCompileBlueprints {
+	public:
+		FCompileBlueprints() = default;
+
+		~FCompileBlueprints() = default;
+
+		static auto Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject>;
+	};
+
+}
@@ -0,0 +1,20 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+namespace UnrealMCP {
+
+	/**
+	 * Handles adding blueprints that were not saved since the search index existed to the index.
+	 */
+	class UNREALMCP_API FIndexBlueprints {
+	public:
+		FIndexBlueprints() = default;
+
+		~FIndexBlueprints() = default;
+
+		static auto Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject>;
+	};
+
+}
@@ -0,0 +1,21 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+namespace UnrealMCP {
+
+	/**
+	 * Handles project-wide searches for blueprint nodes referencing a function, variable, event or input action.
+	 * Thread-safe: the bridge runs it on the server thread, without a game thread round trip.
+	 */
+	class UNREALMCP_API FSearchBlueprints {
+	public:
+		FSearchBlueprints() = default;
+
+		~FSearchBlueprints() = default;
+
+		static auto Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject>;
+	};
+
+}
@@ -0,0 +1,23 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UnrealMCP {
+	/**
+	 * Handles building a set of nodes and links in a blueprint graph with a single command
+	 */
+	class UNREALMCP_API FBuildBlueprintGraph {
+	public:
+		FBuildBlueprintGraph() = default;
+
+		~FBuildBlueprintGraph() = default;
+
+		/**
+		 * Processes the provided JSON parameters to create nodes and links and returns a JSON response.
+		 *
+		 * @param Params The JSON object containing parameters (blueprint_name, nodes, links)
+		 * @return A JSON object mapping each local node id to its GUID or an error response
+		 */
+		static auto Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject>;
+	};
+}
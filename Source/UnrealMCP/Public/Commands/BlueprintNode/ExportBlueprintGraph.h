@@ -0,0 +1,23 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UnrealMCP {
+	/**
+	 * Handles exporting the graphs of a blueprint, whole or incrementally
+	 */
+	class UNREALMCP_API FExportBlueprintGraph {
+	public:
+		FExportBlueprintGraph() = default;
+
+		~FExportBlueprintGraph() = default;
+
+		/**
+		 * Processes the provided JSON parameters to export graph structure and returns a JSON response.
+		 *
+		 * @param Params The JSON object containing parameters (blueprint_name, graph_name, since)
+		 * @return A JSON object with interned tables, per-graph nodes, links and removals, or an error response
+		 */
+		static auto Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject>;
+	};
+}
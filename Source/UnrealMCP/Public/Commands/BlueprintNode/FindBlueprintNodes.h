@@ -4,7 +4,7 @@
 
 namespace UnrealMCP {
 	/**
-	 * Handles finding nodes in a blueprint graph by type and criteria
+	 * Handles querying nodes across all graphs of a blueprint
 	 */
 	class UNREALMCP_API FFindBlueprintNodes {
 	public:
@@ -15,8 +15,8 @@ namespace UnrealMCP {
 		/**
 		 * Processes the provided JSON parameters to find blueprint nodes and returns a JSON response.
 		 *
-		 * @param Params The JSON object containing parameters (blueprint_name, node_type, event_name)
-		 * @return A JSON object containing an array of node GUIDs or an error response
+		 * @param Params The JSON object containing parameters (blueprint_name, predicates, include, limit, cursor)
+		 * @return A JSON object containing one page of matching nodes and the next cursor, or an error response
 		 */
 		static auto Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject>;
 	};
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UnrealMCP {
+	/**
+	 * Handles listing level changes since an earlier digest
+	 */
+	class UNREALMCP_API FDiffLevel {
+	public:
+		FDiffLevel() = default;
+
+		~FDiffLevel() = default;
+
+		/**
+		 * Lists the actors changed or removed since a root digest the client holds
+		 *
+		 * @param Params The JSON object containing the since_digest
+		 * @return A JSON object containing the changes or an error response
+		 */
+		static auto Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject>;
+	};
+}
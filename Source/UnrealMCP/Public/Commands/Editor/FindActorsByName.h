@@ -5,7 +5,7 @@
 namespace UnrealMCP {
 	/**
 	 * Handles finding actors by name pattern
-	 * Returns actors whose names contain the specified pattern
+	 * Returns actors whose names (and optionally labels) match a substring, glob or regex pattern
 	 */
 	class UNREALMCP_API FFindActorsByName {
 	public:
@@ -16,7 +16,7 @@ namespace UnrealMCP {
 		/**
 		 * Returns a JSON array containing actors matching the name pattern
 		 *
-		 * @param Params The JSON object containing parameters (pattern)
+		 * @param Params The JSON object containing parameters (pattern, mode, case_sensitive, include_labels)
 		 * @return A JSON object containing the matching actors array or an error response
 		 */
 		static auto Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject>;
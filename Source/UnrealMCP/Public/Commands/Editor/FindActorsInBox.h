@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UnrealMCP {
+	/**
+	 * Handles finding actors within an axis-aligned box
+	 * Returns actors whose bounds intersect the box, optionally filtered by class and tag
+	 */
+	class UNREALMCP_API FFindActorsInBox {
+	public:
+		FFindActorsInBox() = default;
+
+		~FFindActorsInBox() = default;
+
+		/**
+		 * Returns a JSON array containing the actors in the region
+		 *
+		 * @param Params The JSON object containing parameters (min, max, class, tag)
+		 * @return A JSON object containing the matching actors array or an error response
+		 */
+		static auto Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject>;
+	};
+}
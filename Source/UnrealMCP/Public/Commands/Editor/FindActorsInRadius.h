@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UnrealMCP {
+	/**
+	 * Handles finding actors within a radius
+	 * Returns actors whose bounds intersect the sphere, optionally filtered by class and tag
+	 */
+	class UNREALMCP_API FFindActorsInRadius {
+	public:
+		FFindActorsInRadius() = default;
+
+		~FFindActorsInRadius() = default;
+
+		/**
+		 * Returns a JSON array containing the actors in the region
+		 *
+		 * @param Params The JSON object containing parameters (center, radius, class, tag)
+		 * @return A JSON object containing the matching actors array or an error response
+		 */
+		static auto Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject>;
+	};
+}
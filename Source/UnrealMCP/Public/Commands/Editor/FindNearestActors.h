@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UnrealMCP {
+	/**
+	 * Handles finding the actors nearest to a location
+	 * Returns up to 'count' actors sorted by distance, optionally filtered by class and tag
+	 */
+	class UNREALMCP_API FFindNearestActors {
+	public:
+		FFindNearestActors() = default;
+
+		~FFindNearestActors() = default;
+
+		/**
+		 * Returns a JSON array of the nearest actors with their distances
+		 *
+		 * @param Params The JSON object containing parameters (location, count, max_distance, class, tag)
+		 * @return A JSON object containing the nearest actors array or an error response
+		 */
+		static auto Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject>;
+	};
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UnrealMCP {
+	/**
+	 * Handles reading the hierarchical digest of the level
+	 */
+	class UNREALMCP_API FGetLevelDigest {
+	public:
+		FGetLevelDigest() = default;
+
+		~FGetLevelDigest() = default;
+
+		/**
+		 * Returns the digest of a world, level or folder node with its children down to a depth
+		 *
+		 * @param Params The JSON object containing the node path, depth and options
+		 * @return A JSON object containing the node digests or an error response
+		 */
+		static auto Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject>;
+	};
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UnrealMCP {
+	/**
+	 * Handles reading reflected properties of a set of actors
+	 */
+	class UNREALMCP_API FGetProperties {
+	public:
+		FGetProperties() = default;
+
+		~FGetProperties() = default;
+
+		/**
+		 * Selects actors by name or query and reads all editable properties or the requested paths
+		 *
+		 * @param Params The JSON object containing the selection, paths, depth and changed_only flag
+		 * @return A JSON object containing the properties per actor or an error response
+		 */
+		static auto Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject>;
+	};
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UnrealMCP {
+	/**
+	 * Handles loading a World Partition region in the editor
+	 */
+	class UNREALMCP_API FLoadRegion {
+	public:
+		FLoadRegion() = default;
+
+		~FLoadRegion() = default;
+
+		/**
+		 * Loads the actors whose bounds intersect a region and keeps them loaded until the region is unloaded
+		 *
+		 * @param Params The JSON object containing the region
+		 * @return A JSON object containing the region id and actor counts or an error response
+		 */
+		static auto Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject>;
+	};
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UnrealMCP {
+	/**
+	 * Handles querying World Partition actor descriptors
+	 */
+	class UNREALMCP_API FQueryActorDescs {
+	public:
+		FQueryActorDescs() = default;
+
+		~FQueryActorDescs() = default;
+
+		/**
+		 * Lists actor descriptors matching the filters without loading their cells
+		 *
+		 * @param Params The JSON object containing the class, pattern, data layer, runtime grid and region filters
+		 * @return A JSON object containing the matching descriptors or an error response
+		 */
+		static auto Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject>;
+	};
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UnrealMCP {
+	/**
+	 * Handles querying actors by class, tags, component class and outliner folder
+	 * All given constraints must match; answered from the actor index without scanning the level
+	 */
+	class UNREALMCP_API FQueryActors {
+	public:
+		FQueryActors() = default;
+
+		~FQueryActors() = default;
+
+		/**
+		 * Returns a JSON array containing the actors matching every constraint
+		 *
+		 * @param Params The JSON object containing parameters (class, tag, tags, component, folder)
+		 * @return A JSON object containing the matching actors array or an error response
+		 */
+		static auto Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject>;
+	};
+}
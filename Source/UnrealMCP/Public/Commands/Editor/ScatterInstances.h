@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UnrealMCP {
+	/**
+	 * Handles scattering static mesh instances into a hierarchical instanced static mesh component
+	 */
+	class UNREALMCP_API FScatterInstances {
+	public:
+		FScatterInstances() = default;
+
+		~FScatterInstances() = default;
+
+		/**
+		 * Samples placements over the region and adds them as instances in one batch
+		 *
+		 * @param Params The JSON object containing the mesh, region, sampling and randomization parameters
+		 * @return A JSON object containing the host actor, component and instance range or an error response
+		 */
+		static auto Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject>;
+	};
+}
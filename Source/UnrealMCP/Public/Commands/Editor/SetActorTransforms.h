@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UnrealMCP {
+	/**
+	 * Handles moving many actors from one packed transform array
+	 */
+	class UNREALMCP_API FSetActorTransforms {
+	public:
+		FSetActorTransforms() = default;
+
+		~FSetActorTransforms() = default;
+
+		/**
+		 * Applies one transform per named actor in a single undo transaction
+		 *
+		 * @param Params The JSON object containing parameters (names, transforms, format)
+		 * @return A JSON object containing the updated and unchanged counts or an error response
+		 */
+		static auto Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject>;
+	};
+}
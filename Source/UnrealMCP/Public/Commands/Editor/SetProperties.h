@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UnrealMCP {
+	/**
+	 * Handles writing several property paths on a set of actors
+	 */
+	class UNREALMCP_API FSetProperties {
+	public:
+		FSetProperties() = default;
+
+		~FSetProperties() = default;
+
+		/**
+		 * Selects actors by name or query and writes every property in one transaction
+		 *
+		 * @param Params The JSON object containing the selection and the property path -> value map
+		 * @return A JSON object containing the written and failed counts or an error response
+		 */
+		static auto Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject>;
+	};
+}
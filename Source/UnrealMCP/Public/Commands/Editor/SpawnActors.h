@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UnrealMCP {
+	/**
+	 * Handles spawning many actors in a single call and a single undo transaction
+	 */
+	class UNREALMCP_API FSpawnActors {
+	public:
+		FSpawnActors() = default;
+
+		~FSpawnActors() = default;
+
+		/**
+		 * Spawns every actor of the batch, applying properties before construction
+		 *
+		 * @param Params The JSON object containing the actors array (class, name, transform, properties)
+		 * @return A JSON object containing the spawned actors or an error response
+		 */
+		static auto Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject>;
+	};
+}
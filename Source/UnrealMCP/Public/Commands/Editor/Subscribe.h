@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UnrealMCP {
+	/**
+	 * Handles subscribing the connection to level change events
+	 */
+	class UNREALMCP_API FSubscribe {
+	public:
+		FSubscribe() = default;
+
+		~FSubscribe() = default;
+
+		/**
+		 * Adds a filtered subscription whose coalesced events are pushed on the connection
+		 *
+		 * @param Params The JSON object containing the event kinds and filters
+		 * @return A JSON object containing the subscription id or an error response
+		 */
+		static auto Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject>;
+	};
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UnrealMCP {
+	/**
+	 * Handles relative transform edits (offset, rotate, scale, snap) over a set of actors
+	 */
+	class UNREALMCP_API FTransformActors {
+	public:
+		FTransformActors() = default;
+
+		~FTransformActors() = default;
+
+		/**
+		 * Selects actors by name or query and applies the edit in one batch
+		 *
+		 * @param Params The JSON object containing the selection, operation and its arguments
+		 * @return A JSON object containing the matched and updated counts or an error response
+		 */
+		static auto Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject>;
+	};
+}
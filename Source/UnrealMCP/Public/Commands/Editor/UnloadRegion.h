@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UnrealMCP {
+	/**
+	 * Handles unloading a World Partition region
+	 */
+	class UNREALMCP_API FUnloadRegion {
+	public:
+		FUnloadRegion() = default;
+
+		~FUnloadRegion() = default;
+
+		/**
+		 * Releases a region loaded by load_region
+		 *
+		 * @param Params The JSON object containing the region id
+		 * @return A JSON object confirming the unload or an error response
+		 */
+		static auto Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject>;
+	};
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UnrealMCP {
+	/**
+	 * Handles ending a level change subscription
+	 */
+	class UNREALMCP_API FUnsubscribe {
+	public:
+		FUnsubscribe() = default;
+
+		~FUnsubscribe() = default;
+
+		/**
+		 * Removes a subscription and its queued events
+		 *
+		 * @param Params The JSON object containing the subscription id
+		 * @return A JSON object confirming the removal or an error response
+		 */
+		static auto Handle(const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject>;
+	};
+}
@@ -0,0 +1,279 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/ActorSpatialIndex.h"
+#include "UObject/ObjectKey.h"
+
+class AActor;
+class ULevel;
+class UClass;
+class UWorld;
+struct FPropertyChangedEvent;
+
+namespace UnrealMCP {
+	class FNamePattern;
+
+	/**
+	 * Resolved attribute filter for actor queries. Unset members match every actor.
+	 */
+	struct UNREALMCP_API FActorIndexQuery {
+		/** Actor class; subclasses match too */
+		const UClass* Class = nullptr;
+
+		/** Tags the actor must all carry */
+		TArray<FName> Tags;
+
+		/** Component class the actor must own at least one instance of; subclasses match too */
+		const UClass* ComponentClass = nullptr;
+
+		/** Outliner folder; actors in subfolders match too */
+		TOptional<FName> Folder;
+
+		auto IsEmpty() const -> bool {
+			return !Class && Tags.Num() == 0 && !ComponentClass && !Folder.IsSet();
+		}
+
+		/** Test an actor directly, without consulting any index */
+		auto Matches(const AActor* Actor) const -> bool;
+	};
+
+	/**
+	 * Lookup tables for the actors of a single world.
+	 * Entries are weak so a missed delete event can never hand out a dangling actor;
+	 * stale entries are dropped when they are encountered.
+	 */
+	class UNREALMCP_API FWorldActorIndex {
+	public:
+		auto AddActor(AActor* Actor) -> void;
+
+		auto RemoveActor(const AActor* Actor) -> void;
+
+		/** Re-key an actor whose object name changed from OldName */
+		auto RenameActor(AActor* Actor, FName OldName) -> void;
+
+		/** Re-key an actor whose editor label changed */
+		auto RelabelActor(AActor* Actor) -> void;
+
+		/** Refresh the spatial bounds of an actor that moved */
+		auto MoveActor(AActor* Actor) -> void;
+
+		/** Re-key an actor whose class, tags, components or folder may have changed, and refresh its bounds */
+		auto RefreshActorAttributes(AActor* Actor) -> void;
+
+		auto FindByName(FName ActorName) -> AActor*;
+
+		auto FindByLabel(const FString& ActorLabel) -> AActor*;
+
+		/**
+		 * Collect actors matching every constraint of the query.
+		 * Only the smallest candidate set is walked; the other constraints are tested per candidate,
+		 * so the cost follows the most selective constraint rather than the level size.
+		 */
+		auto QueryActors(const FActorIndexQuery& Query, TArray<AActor*>& OutActors) const -> void;
+
+		/**
+		 * Collect actors whose object name (and optionally editor label) matches a pattern.
+		 * Only the snapshot of names is taken serially; matching runs on worker threads.
+		 */
+		auto FindByPattern(const FNamePattern& Pattern, bool bIncludeLabels, TArray<AActor*>& OutActors) const -> void;
+
+		/** Indexed actors; the name map can briefly hold an extra entry per actor renamed by undo */
+		auto Num() const -> int32 {
+			return IndexedKeys.Num();
+		}
+
+		auto GetSpatialIndex() const -> const FActorSpatialIndex& {
+			return Spatial;
+		}
+
+		auto Reset() -> void;
+
+		/** Flag the index as possibly out of date after a change that carried no per-actor detail */
+		auto MarkStale() -> void {
+			bStale = true;
+		}
+
+		auto IsStale() const -> bool {
+			return bStale;
+		}
+
+		/**
+		 * Bring a stale index back in line with the world: actors the index is missing are added,
+		 * actors no longer in the world are removed and restored names and labels re-keyed.
+		 * Actors already indexed keep their entries, so this costs one pass over the level
+		 * rather than a rebuild of every table.
+		 */
+		auto Reconcile(UWorld* World) -> void;
+
+	private:
+		using FActorSet = TSet<TWeakObjectPtr<AActor>>;
+
+		/** Keys an actor was indexed under, needed to unlink it after the actor changed */
+		struct FIndexedKeys {
+			FString Label;
+			TWeakObjectPtr<UClass> Class;
+			TArray<FName> Tags;
+			TArray<TWeakObjectPtr<UClass>> ComponentClasses;
+			FName Folder;
+		};
+
+		TMap<FName, TWeakObjectPtr<AActor>> ActorsByName;
+
+		/** Labels are not unique, so one label may map to several actors */
+		TMultiMap<FString, TWeakObjectPtr<AActor>> ActorsByLabel;
+
+		/** Exact class -> actors; subclass queries visit every bucket whose class is a child */
+		TMap<TWeakObjectPtr<UClass>, FActorSet> ActorsByClass;
+
+		TMap<FName, FActorSet> ActorsByTag;
+
+		/** Exact component class -> actors owning at least one such component */
+		TMap<TWeakObjectPtr<UClass>, FActorSet> ActorsByComponentClass;
+
+		TMap<FName, FActorSet> ActorsByFolder;
+
+		TMap<FObjectKey, FIndexedKeys> IndexedKeys;
+
+		FActorSpatialIndex Spatial;
+
+		bool bStale = false;
+
+		auto LinkAttributes(AActor* Actor, FIndexedKeys& Keys) -> void;
+
+		auto UnlinkAttributes(const AActor* Actor, const FIndexedKeys& Keys) -> void;
+
+		/** Append the buckets a query constraint draws candidates from and return their total size */
+		static auto CollectClassBuckets(
+			const TMap<TWeakObjectPtr<UClass>, FActorSet>& Buckets,
+			const UClass* BaseClass,
+			TArray<const FActorSet*>& OutSets
+		) -> int32;
+	};
+
+	/**
+	 * Per-world actor index kept current from engine level-actor events
+	 * (actor added/deleted/renamed/moved, folder and property changes, level added/removed, map change).
+	 *
+	 * A world is indexed lazily on the first lookup, after which every lookup is O(1)
+	 * instead of gathering all actors of the level.
+	 * All methods must be called on the game thread.
+	 */
+	class UNREALMCP_API FActorIndex {
+	public:
+		/**
+		 * Subscribe to engine events. Safe to call more than once.
+		 */
+		static auto Initialize() -> void;
+
+		/**
+		 * Unsubscribe from engine events and drop all indexed worlds.
+		 */
+		static auto Shutdown() -> void;
+
+		/**
+		 * Find an actor by exact object name.
+		 *
+		 * @param World World to search
+		 * @param ActorName Object name of the actor, or its label when bIncludeLabels is set
+		 * @param bIncludeLabels Fall back to the editor label when no object has the name. Labels are
+		 *                       not unique, so leave this off for commands that modify the actor.
+		 * @return The actor, or nullptr if no live actor matches
+		 */
+		static auto FindActor(UWorld* World, const FString& ActorName, bool bIncludeLabels = false) -> AActor*;
+
+		/**
+		 * Find an actor by object name only.
+		 */
+		static auto FindByName(UWorld* World, FName ActorName) -> AActor*;
+
+		/**
+		 * Find an actor by editor label only.
+		 */
+		static auto FindByLabel(UWorld* World, const FString& ActorLabel) -> AActor*;
+
+		/**
+		 * Get the index for a world, building it if needed.
+		 */
+		static auto GetWorldIndex(UWorld* World) -> FWorldActorIndex*;
+
+		/**
+		 * Drop the index of a world so it is rebuilt on next use.
+		 */
+		static auto Invalidate(const UWorld* World) -> void;
+
+		/**
+		 * Refresh the bounds of an actor after its transform changed.
+		 * Editor moves are tracked automatically; call this after moving an actor from code.
+		 */
+		static auto NotifyActorMoved(AActor* Actor) -> void;
+
+		/**
+		 * Re-key an actor after its tags, components or folder changed.
+		 * Editor property edits are tracked automatically; call this after changing an actor from code.
+		 */
+		static auto NotifyActorChanged(AActor* Actor) -> void;
+
+		/**
+		 * Collect the actors of a world matching an attribute query.
+		 */
+		static auto QueryActors(UWorld* World, const FActorIndexQuery& Query, TArray<AActor*>& OutActors) -> void;
+
+		/**
+		 * Collect the actors of a world whose name (and optionally label) matches a pattern.
+		 */
+		static auto FindByPattern(
+			UWorld* World,
+			const FNamePattern& Pattern,
+			bool bIncludeLabels,
+			TArray<AActor*>& OutActors
+		) -> void;
+
+	private:
+		static TMap<FObjectKey, FWorldActorIndex> WorldIndices;
+		static bool bInitialized;
+
+		static FDelegateHandle ActorAddedHandle;
+		static FDelegateHandle ActorDeletedHandle;
+		static FDelegateHandle ActorListChangedHandle;
+		static FDelegateHandle ActorMovedHandle;
+		static FDelegateHandle ActorLabelChangedHandle;
+		static FDelegateHandle ActorFolderChangedHandle;
+		static FDelegateHandle ObjectPropertyChangedHandle;
+		static FDelegateHandle ObjectRenamedHandle;
+		static FDelegateHandle LevelAddedHandle;
+		static FDelegateHandle LevelRemovedHandle;
+		static FDelegateHandle WorldCleanupHandle;
+		static FDelegateHandle MapChangeHandle;
+
+		static auto BuildWorldIndex(UWorld* World, FWorldActorIndex& Index) -> void;
+
+		static auto ReconcileWorldIndex(UWorld* World, FWorldActorIndex& Index) -> void;
+
+		static auto FindBuiltIndex(const UWorld* World) -> FWorldActorIndex*;
+
+		static auto HandleActorAdded(AActor* Actor) -> void;
+
+		static auto HandleActorDeleted(AActor* Actor) -> void;
+
+		static auto HandleActorListChanged() -> void;
+
+		static auto HandleActorMoved(AActor* Actor) -> void;
+
+		static auto HandleActorLabelChanged(AActor* Actor) -> void;
+
+		static auto HandleActorFolderChanged(const AActor* Actor, FName OldPath) -> void;
+
+		static auto HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event) -> void;
+
+		static auto HandleObjectRenamed(UObject* Object, UObject* OldOuter, FName OldName) -> void;
+
+		static auto HandleLevelAdded(ULevel* Level, UWorld* World) -> void;
+
+		static auto HandleLevelRemoved(ULevel* Level, UWorld* World) -> void;
+
+		static auto HandleWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources) -> void;
+
+		static auto HandleMapChange(uint32 MapChangeFlags) -> void;
+	};
+
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class AActor;
+
+namespace UnrealMCP {
+
+	/**
+	 * Spatial index over actor bounds for one world.
+	 *
+	 * Bounds live in a struct-of-arrays store (one float array per box plane) so region
+	 * tests run four actors per SIMD instruction. A uniform grid hash narrows small queries
+	 * to nearby slots; actors spanning too many cells are kept in a separate list that every
+	 * query tests. Slots are recycled through a free list so indices stay dense.
+	 */
+	class UNREALMCP_API FActorSpatialIndex {
+	public:
+		/** Edge length of one grid cell in world units */
+		static constexpr float CellSize = 5000.0f;
+
+		/** Actors covering more cells than this on any axis are treated as oversized */
+		static constexpr int32 MaxCellsPerAxis = 4;
+
+		/** Insert an actor or refresh its bounds if it is already indexed */
+		auto UpdateActor(AActor* Actor) -> void;
+
+		auto RemoveActor(const AActor* Actor) -> void;
+
+		auto Reset() -> void;
+
+		auto Num() const -> int32 {
+			return SlotByActor.Num();
+		}
+
+		/** Collect actors whose bounds intersect the axis-aligned box */
+		auto QueryBox(const FBox& Box, TArray<AActor*>& OutActors) const -> void;
+
+		/** Collect actors whose bounds intersect the sphere */
+		auto QuerySphere(const FVector& Center, double Radius, TArray<AActor*>& OutActors) const -> void;
+
+		/**
+		 * Collect the actors whose bounds centers are nearest to a point, closest first
+		 *
+		 * @param Point Query location
+		 * @param MaxDistance Ignore actors farther than this (<= 0 for unlimited)
+		 * @param Accept Filter applied before an actor counts toward MaxCount
+		 * @param MaxCount Maximum number of actors to return
+		 * @param OutHits Actors with their distance to Point
+		 */
+		auto QueryNearest(
+			const FVector& Point,
+			double MaxDistance,
+			const TFunctionRef<bool(const AActor*)>& Accept,
+			int32 MaxCount,
+			TArray<TPair<AActor*, double>>& OutHits
+		) const -> void;
+
+	private:
+		// Struct-of-arrays bounds store, indexed by slot. Lengths are padded to a multiple of 4.
+		TArray<float> MinX;
+		TArray<float> MinY;
+		TArray<float> MinZ;
+		TArray<float> MaxX;
+		TArray<float> MaxY;
+		TArray<float> MaxZ;
+
+		TArray<TWeakObjectPtr<AActor>> SlotActors;
+		TArray<int32> FreeSlots;
+		TMap<FObjectKey, int32> SlotByActor;
+
+		/** Grid cell -> slots whose bounds overlap the cell */
+		TMap<FIntVector, TArray<int32>> Cells;
+
+		/** Slots too large for the grid; tested by every query */
+		TSet<int32> OversizedSlots;
+
+		auto AllocateSlot() -> int32;
+
+		auto WriteBounds(int32 Slot, const FBox& Bounds) -> void;
+
+		auto ReadBounds(int32 Slot) const -> FBox;
+
+		auto LinkCells(int32 Slot, const FBox& Bounds) -> void;
+
+		auto UnlinkCells(int32 Slot, const FBox& Bounds) -> void;
+
+		static auto GetActorBounds(const AActor* Actor) -> FBox;
+
+		static auto CellRange(const FBox& Bounds, FIntVector& OutMin, FIntVector& OutMax) -> void;
+
+		/** Gather candidate slots for a query box, or return false if a full scan is cheaper */
+		auto GatherCandidates(const FBox& Box, TArray<int32>& OutSlots) const -> bool;
+
+		/** Test a slot list against a box (sphere if Radius > 0) four slots at a time */
+		auto TestSlots(
+			const TArray<int32>* Slots,
+			const FBox& Box,
+			const FVector& SphereCenter,
+			double Radius,
+			TArray<AActor*>& OutActors
+		) const -> void;
+	};
+
+}
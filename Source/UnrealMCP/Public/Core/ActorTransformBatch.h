@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UnrealMCP {
+
+	/**
+	 * World transforms of a set of actors, laid out for bulk relative edits.
+	 *
+	 * Locations and scales live in a struct-of-arrays store (one double array per axis) so
+	 * offsets, pivot rotations, pivot scales and grid snapping run four transforms per SIMD
+	 * instruction. Rotations are kept as quaternions, one SIMD register each. Array lengths
+	 * are padded to a multiple of 4; padding lanes are transformed too and never read back.
+	 */
+	class UNREALMCP_API FActorTransformBatch {
+	public:
+		auto Reserve(int32 Num) -> void;
+
+		/** Append a transform; returns its index */
+		auto Add(const FTransform& Transform) -> int32;
+
+		auto Num() const -> int32 {
+			return Rotations.Num();
+		}
+
+		auto GetTransform(int32 Index) const -> FTransform;
+
+		/** Mean location of the transforms, or zero when empty */
+		auto GetCentroid() const -> FVector;
+
+		auto Translate(const FVector& Offset) -> void;
+
+		/** Rotate locations around a pivot and compose the rotation onto each transform's rotation */
+		auto RotateAround(const FVector& Pivot, const FQuat& Rotation) -> void;
+
+		/** Scale distances to a pivot and each transform's scale by a uniform factor */
+		auto ScaleAround(const FVector& Pivot, double Factor) -> void;
+
+		/** Round locations to the nearest multiple of the grid size per axis; axes with a size <= 0 are left alone */
+		auto SnapToGrid(const FVector& GridSize) -> void;
+
+	private:
+		// Struct-of-arrays store, indexed like Rotations. Lengths are padded to a multiple of 4.
+		TArray<double> LocationX;
+		TArray<double> LocationY;
+		TArray<double> LocationZ;
+		TArray<double> ScaleX;
+		TArray<double> ScaleY;
+		TArray<double> ScaleZ;
+
+		TArray<FQuat> Rotations;
+
+		auto PaddedNum() const -> int32 {
+			return LocationX.Num();
+		}
+	};
+
+}
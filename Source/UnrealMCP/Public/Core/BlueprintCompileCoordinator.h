@@ -0,0 +1,173 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+class UBlueprint;
+class FCompilerResultsLog;
+
+namespace UnrealMCP {
+
+	/**
+	 * How much of a blueprint a compile regenerates, ordered by cost.
+	 */
+	enum class EBlueprintCompileMode : uint8 {
+		/** Regenerate the skeleton class only: enough for metadata, tooltips, categories and purity */
+		SkeletonOnly,
+
+		/** Full compile: skeleton, bytecode, generated class and reinstancing */
+		Full
+	};
+
+	/**
+	 * Defers and coalesces blueprint compilation.
+	 *
+	 * Mutations call RequestCompile instead of compiling directly; the blueprint is then compiled once:
+	 *  - when a caller needs the generated class and calls Flush (spawning, CDO writes, metadata reads),
+	 *  - or after no compile was requested for IdleFlushDelaySeconds.
+	 * Each request names the cheapest sufficient mode; a blueprint is compiled with the strongest mode
+	 * requested since its last compile. Flush always produces an up-to-date generated class, so it
+	 * upgrades pending or previously skeleton-only compiles to Full.
+	 * All methods must be called on the game thread.
+	 */
+	class UNREALMCP_API FBlueprintCompileCoordinator {
+	public:
+		/** Idle time after the last request before pending blueprints are compiled */
+		static constexpr double IdleFlushDelaySeconds = 0.5;
+
+		/** A compile that ran, reported back to clients */
+		struct FCompileRecord {
+			FString BlueprintName;
+			EBlueprintCompileMode Mode = EBlueprintCompileMode::Full;
+			double Seconds = 0.0;
+
+			/** Blueprints compiled by the same queue flush; Seconds covers all of them */
+			int32 BatchSize = 1;
+
+			/** Blueprint status after the compile, see GetStatusName */
+			FString Status;
+			TArray<FString> Errors;
+			TArray<FString> Warnings;
+		};
+
+		/**
+		 * Wall time of each pass of a profiled compile. The compilation manager generates bytecode and
+		 * reinstances in a single pass, so CompileSeconds covers both.
+		 */
+		struct FCompilePhaseTimings {
+			double SkeletonSeconds = 0.0;
+			double CompileSeconds = 0.0;
+
+			/** Zero unless garbage collection was requested */
+			double GarbageCollectionSeconds = 0.0;
+		};
+
+		static auto Initialize() -> void;
+
+		/** Stop the idle flush; pending requests are dropped (the blueprints stay marked dirty) */
+		static auto Shutdown() -> void;
+
+		/**
+		 * Mark a blueprint as needing compilation.
+		 *
+		 * @param Blueprint Blueprint that was edited
+		 * @param Mode Cheapest mode that makes the edit visible
+		 */
+		static auto RequestCompile(UBlueprint* Blueprint, EBlueprintCompileMode Mode = EBlueprintCompileMode::Full) -> void;
+
+		/**
+		 * Make a blueprint's generated class current: full-compile it if it has a pending request
+		 * or was last compiled skeleton-only.
+		 *
+		 * @return true if a compile ran
+		 */
+		static auto Flush(UBlueprint* Blueprint) -> bool;
+
+		/**
+		 * Compile every pending blueprint.
+		 *
+		 * @return Number of blueprints compiled
+		 */
+		static auto FlushAll() -> int32;
+
+		/**
+		 * Compile a blueprint now, whether or not it has a pending request, and clear its request.
+		 * Garbage collection and save-on-compile are skipped in every mode.
+		 *
+		 * @param ResultsLog Receives the compiler messages when the caller needs them
+		 */
+		static auto CompileNow(UBlueprint* Blueprint,
+		                       EBlueprintCompileMode Mode = EBlueprintCompileMode::Full,
+		                       FCompilerResultsLog* ResultsLog = nullptr) -> void;
+
+		/**
+		 * Full-compile a blueprint in separately timed passes: skeleton, then bytecode and reinstancing
+		 * against the fresh skeleton, then optionally garbage collection.
+		 *
+		 * @param ResultsLog Receives the compiler messages of both compile passes
+		 * @param bCollectGarbage Run and time a garbage collection after compiling
+		 * @param OutRecompiledDependents Other blueprints the compilation manager recompiled along the way
+		 */
+		static auto CompileProfiled(UBlueprint* Blueprint,
+		                            FCompilerResultsLog& ResultsLog,
+		                            bool bCollectGarbage,
+		                            TArray<UBlueprint*>& OutRecompiledDependents) -> FCompilePhaseTimings;
+
+		/**
+		 * Full-compile several blueprints through one compilation manager queue flush, so shared
+		 * dependents are relinked and reinstanced once instead of once per blueprint.
+		 *
+		 * @param Blueprints Blueprints to compile; their pending requests are cleared
+		 * @param ResultsLogs Per-blueprint message logs, parallel to Blueprints (entries may be null)
+		 * @return Wall time of the whole flush in seconds
+		 */
+		static auto CompileBatch(const TArray<UBlueprint*>& Blueprints, const TArray<FCompilerResultsLog*>& ResultsLogs) -> double;
+
+		/**
+		 * Forget a pending request without compiling (e.g. the blueprint is being deleted).
+		 */
+		static auto Cancel(const UBlueprint* Blueprint) -> void;
+
+		static auto IsPending(const UBlueprint* Blueprint) -> bool;
+
+		static auto HasPending() -> bool;
+
+		/** Blueprints with a pending compile and the mode they will be compiled with, in request order */
+		static auto GetPending() -> TArray<TPair<FString, EBlueprintCompileMode>>;
+
+		/** Compiles that ran since the previous call */
+		static auto TakeCompletedCompiles() -> TArray<FCompileRecord>;
+
+		static auto GetModeName(EBlueprintCompileMode Mode) -> const TCHAR*;
+
+		/** "up_to_date", "up_to_date_with_warnings", "error" or "dirty" */
+		static auto GetStatusName(const UBlueprint* Blueprint) -> const TCHAR*;
+
+		/** Split compiler messages into errors and warnings (performance warnings included) */
+		static auto CollectMessages(const FCompilerResultsLog& ResultsLog, TArray<FString>& OutErrors, TArray<FString>& OutWarnings) -> void;
+
+	private:
+		struct FPendingCompile {
+			TWeakObjectPtr<UBlueprint> Blueprint;
+			EBlueprintCompileMode Mode = EBlueprintCompileMode::Full;
+		};
+
+		static TArray<FPendingCompile> Pending;
+
+		/** Blueprints whose last compile here was skeleton-only, so their generated class is stale */
+		static TSet<TWeakObjectPtr<UBlueprint>> SkeletonOnlyCompiled;
+
+		static TArray<FCompileRecord> CompletedCompiles;
+		static double LastRequestTime;
+		static FTSTicker::FDelegateHandle TickerHandle;
+
+		static auto AddCompletedCompile(UBlueprint* Blueprint,
+		                                EBlueprintCompileMode Mode,
+		                                double Seconds,
+		                                int32 BatchSize,
+		                                const FCompilerResultsLog* ResultsLog) -> void;
+
+		static auto Tick(float DeltaTime) -> bool;
+	};
+
+}
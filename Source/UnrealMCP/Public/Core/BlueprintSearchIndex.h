@@ -0,0 +1,167 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Misc/DateTime.h"
+#include <atomic>
+
+class UBlueprint;
+class UPackage;
+class FObjectPostSaveContext;
+struct FAssetData;
+
+namespace UnrealMCP {
+
+	/**
+	 * What a graph node does with the name it is indexed under.
+	 */
+	enum class EBlueprintReferenceKind : uint8 {
+		FunctionCall,
+		VariableRead,
+		VariableWrite,
+		Event,
+		InputAction
+	};
+
+	/**
+	 * A node of some blueprint that references a searched name
+	 */
+	struct FBlueprintSearchHit {
+		/** Object path of the blueprint asset */
+		FString BlueprintPath;
+		FString Graph;
+		FGuid NodeGuid;
+		EBlueprintReferenceKind Kind = EBlueprintReferenceKind::FunctionCall;
+		FName Name;
+	};
+
+	/**
+	 * Project-wide index of the functions, variables, events and input actions referenced by blueprint graphs.
+	 *
+	 * Each blueprint is indexed from its graphs when its package is saved (or when IndexBlueprint is called),
+	 * and the references are kept in a name -> posting map, so a search is a single hash lookup and never
+	 * loads a package. The index is persisted to Saved/UnrealMCP and reloaded on startup on a worker thread;
+	 * entries whose package changed on disk since they were indexed are dropped.
+	 *
+	 * Indexing and event handling run on the game thread. Search and Num may be called from any thread.
+	 */
+	class UNREALMCP_API FBlueprintSearchIndex {
+	public:
+		/**
+		 * Subscribe to package save and asset registry events and start loading the persisted index.
+		 * Safe to call more than once.
+		 */
+		static auto Initialize() -> void;
+
+		/**
+		 * Unsubscribe, wait for background work and write any unsaved changes.
+		 */
+		static auto Shutdown() -> void;
+
+		/**
+		 * (Re)index a blueprint from its current graphs.
+		 *
+		 * @param Blueprint Blueprint to index
+		 * @param PackageTimestamp Modification time of the package file the graphs correspond to
+		 */
+		static auto IndexBlueprint(const UBlueprint* Blueprint, const FDateTime& PackageTimestamp) -> void;
+
+		/**
+		 * Drop a blueprint from the index.
+		 */
+		static auto RemoveBlueprint(const FString& BlueprintPath) -> void;
+
+		static auto IsIndexed(const FString& BlueprintPath) -> bool;
+
+		/**
+		 * Find the nodes referencing a name. Thread-safe.
+		 *
+		 * @param Name Function, variable, event or input action name (case-insensitive)
+		 * @param Kind Reference kind to restrict to, or unset for all kinds
+		 * @param PathPrefix Only blueprints whose object path starts with this prefix
+		 * @param Limit Maximum number of hits to return
+		 * @param OutHits Receives up to Limit hits
+		 * @return Total number of matching references, including those beyond Limit
+		 */
+		static auto Search(
+			const FString& Name,
+			const TOptional<EBlueprintReferenceKind>& Kind,
+			const FString& PathPrefix,
+			int32 Limit,
+			TArray<FBlueprintSearchHit>& OutHits
+		) -> int32;
+
+		/** Number of indexed blueprints. Thread-safe. */
+		static auto Num() -> int32;
+
+		/** Modification time of a package file on disk, or FDateTime::MinValue() if it has not been saved */
+		static auto GetPackageTimestamp(const FString& PackageName) -> FDateTime;
+
+		static auto GetKindName(EBlueprintReferenceKind Kind) -> const TCHAR*;
+
+		static auto ParseKindName(const FString& KindName, EBlueprintReferenceKind& OutKind) -> bool;
+
+	private:
+		struct FReference {
+			EBlueprintReferenceKind Kind;
+			FName Name;
+			FString Graph;
+			FGuid NodeGuid;
+		};
+
+		struct FRecord {
+			FDateTime PackageTimestamp;
+			TArray<FReference> References;
+		};
+
+		/** One reference of a record, addressed by its index in FRecord::References */
+		struct FPosting {
+			FString BlueprintPath;
+			int32 ReferenceIndex;
+		};
+
+		static constexpr int32 FileVersion = 1;
+
+		static TMap<FString, FRecord> Records;
+
+		/** Referenced name -> every reference to it; FName hashing makes lookups case-insensitive */
+		static TMap<FName, TArray<FPosting>> Postings;
+
+		/** Guards Records and Postings; writers are the game thread and the startup load */
+		static FRWLock Lock;
+
+		static TFuture<void> LoadTask;
+		static TFuture<void> SaveTask;
+		static std::atomic<bool> bDirty;
+		static std::atomic<bool> bSaveInFlight;
+		static bool bInitialized;
+
+		static FDelegateHandle PackageSavedHandle;
+		static FDelegateHandle AssetRemovedHandle;
+		static FDelegateHandle AssetRenamedHandle;
+
+		static auto OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext) -> void;
+
+		static auto OnAssetRemoved(const FAssetData& AssetData) -> void;
+
+		static auto OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath) -> void;
+
+		static auto ExtractReferences(const UBlueprint* Blueprint, TArray<FReference>& OutReferences) -> void;
+
+		/** Requires the write lock */
+		static auto AddRecordLocked(const FString& BlueprintPath, FRecord&& Record) -> void;
+
+		/** Requires the write lock */
+		static auto RemoveRecordLocked(const FString& BlueprintPath) -> void;
+
+		static auto GetIndexFilePath() -> FString;
+
+		/** Read the persisted index, dropping entries whose package changed since. Runs on a worker thread. */
+		static auto LoadFromDisk() -> void;
+
+		/** Write the index on a worker thread unless a write is already in flight */
+		static auto ScheduleSave() -> void;
+
+		static auto SaveToDisk() -> void;
+	};
+}
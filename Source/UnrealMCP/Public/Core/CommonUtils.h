@@ -15,6 +15,7 @@ class UK2Node_VariableGet;
 class UK2Node_VariableSet;
 class UK2Node_InputAction;
 class UK2Node_Self;
+class UClass;
 class UFunction;
 
 /**
@@ -65,6 +66,13 @@ public:
 
 	static auto CreateEventNode(UEdGraph* Graph, const FString& EventName, const FVector2D& Position) -> UK2Node_Event*;
 
+	/** Find the function behind an event name in the blueprint's class hierarchy (BeginPlay -> ReceiveBeginPlay) */
+	static auto ResolveEventFunction(
+		const UBlueprint* Blueprint,
+		const FString& EventName,
+		UClass*& OutEventSourceClass
+	) -> const UFunction*;
+
 	static auto CreateFunctionCallNode(
 		UEdGraph* Graph,
 		const UFunction* Function,
@@ -101,6 +109,9 @@ public:
 		const FString& TargetPinName
 	) -> bool;
 
+	/** Link two pins, replacing the target's links, without notifying the graph or marking the blueprint */
+	static auto LinkGraphPins(UEdGraphPin* SourcePin, UEdGraphPin* TargetPin) -> void;
+
 	static auto FindPin(
 		UEdGraphNode* Node,
 		const FString& PinName,
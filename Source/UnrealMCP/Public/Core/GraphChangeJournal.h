@@ -0,0 +1,89 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class UEdGraph;
+class UEdGraphNode;
+
+namespace UnrealMCP {
+
+	/**
+	 * Per-graph change journal for incremental graph exports.
+	 *
+	 * Each node is stamped with the version at which its content (class, member, position, comment,
+	 * pins, pin defaults and links) last changed, and removed nodes leave a versioned tombstone.
+	 * Changes are detected by diffing a content hash per node on every Update, so edits made without
+	 * a graph notification (links, default values, moves, edits from the editor UI) are still caught.
+	 *
+	 * Versions come from one counter seeded from the wall clock, so they increase monotonically per
+	 * graph and across editor sessions. Each graph keeps its last MaxRetainedVersions versions; tombstones
+	 * older than those are pruned, and a version older than the journal asks for a full resend.
+	 * All methods must be called on the game thread.
+	 */
+	class UNREALMCP_API FGraphChangeJournal {
+	public:
+		/** Change versions a graph can be diffed against; older ones get a full export */
+		static constexpr int32 MaxRetainedVersions = 256;
+
+		/** What changed in a graph after a given version */
+		struct FGraphChanges {
+			/** Version of the graph's latest change */
+			int64 Version = 0;
+
+			/** The requested version predates the journal, so every node is listed */
+			bool bFull = false;
+
+			/** Added or modified nodes, in graph order */
+			TArray<UEdGraphNode*> ChangedNodes;
+
+			TArray<FGuid> RemovedNodes;
+		};
+
+		/**
+		 * Record the current state of a graph and collect what changed after a version.
+		 *
+		 * @param Graph Graph to diff
+		 * @param Since Version the caller last saw, or unset for everything
+		 * @param OutChanges Receives the graph version and the changed and removed nodes
+		 */
+		static auto GetChanges(UEdGraph* Graph, const TOptional<int64>& Since, FGraphChanges& OutChanges) -> void;
+
+		/**
+		 * Drop every journal.
+		 */
+		static auto Reset() -> void;
+
+	private:
+		struct FNodeState {
+			uint32 Hash = 0;
+			int64 Version = 0;
+		};
+
+		struct FGraphJournal {
+			TWeakObjectPtr<UEdGraph> Graph;
+
+			/** Oldest version the graph can be diffed against; moves forward as tombstones are pruned */
+			int64 TrackedSince = 0;
+			int64 Version = 0;
+
+			/** Last MaxRetainedVersions change versions, oldest first */
+			TArray<int64> Versions;
+			TMap<FGuid, FNodeState> Nodes;
+
+			/** Removed node -> version of its removal */
+			TMap<FGuid, int64> Removed;
+		};
+
+		static TMap<FObjectKey, FGraphJournal> Journals;
+		static int64 LastVersion;
+
+		/** Diff the graph against its journal and stamp differences with a new version */
+		static auto Update(UEdGraph* Graph) -> FGraphJournal&;
+
+		static auto NextVersion() -> int64;
+
+		static auto HashNode(const UEdGraphNode* Node) -> uint32;
+	};
+
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class UBlueprint;
+class UEdGraph;
+class UEdGraphNode;
+struct FEdGraphEditAction;
+
+namespace UnrealMCP {
+
+	/**
+	 * GUID -> node lookup tables for blueprint graphs.
+	 *
+	 * A graph's table is built on its first lookup and then kept current from the graph's
+	 * OnGraphChanged notifications (node added/removed), so lookups no longer walk Graph->Nodes
+	 * or format GUIDs as strings. Hits are validated, and a miss on a table whose size disagrees
+	 * with the graph triggers a rebuild, so nodes added without a notification are still found.
+	 * Blueprint-wide lookups keep the blueprint's graph list and the graph each GUID was last found
+	 * in; the list is refreshed only when a lookup misses.
+	 * All methods must be called on the game thread.
+	 */
+	class UNREALMCP_API FGraphNodeIndex {
+	public:
+		/**
+		 * Find a node by GUID in one graph.
+		 */
+		static auto FindNode(UEdGraph* Graph, const FGuid& NodeGuid) -> UEdGraphNode*;
+
+		/**
+		 * Find a node by GUID in any graph of a blueprint (event graphs, functions, macros and nested graphs).
+		 */
+		static auto FindNode(UBlueprint* Blueprint, const FGuid& NodeGuid) -> UEdGraphNode*;
+
+		/**
+		 * Drop every table and unsubscribe from graph notifications.
+		 */
+		static auto Reset() -> void;
+
+	private:
+		struct FGraphTable {
+			TWeakObjectPtr<UEdGraph> Graph;
+			TMap<FGuid, TWeakObjectPtr<UEdGraphNode>> Nodes;
+
+			/** Nodes announced by GRAPHACTION_AddNode; keyed on the next lookup once their GUID is final */
+			TArray<TWeakObjectPtr<UEdGraphNode>> PendingNodes;
+
+			FDelegateHandle GraphChangedHandle;
+		};
+
+		struct FBlueprintTable {
+			TWeakObjectPtr<UBlueprint> Blueprint;
+
+			/** Every graph of the blueprint as of the last refresh */
+			TArray<TWeakObjectPtr<UEdGraph>> Graphs;
+
+			/** Graph a node was last found in; checked first and corrected when the node has moved */
+			TMap<FGuid, TWeakObjectPtr<UEdGraph>> GraphByNode;
+		};
+
+		static TMap<FObjectKey, FGraphTable> Tables;
+
+		static TMap<FObjectKey, FBlueprintTable> BlueprintTables;
+
+		static auto GetTable(UEdGraph* Graph) -> FGraphTable&;
+
+		static auto GetBlueprintTable(UBlueprint* Blueprint) -> FBlueprintTable&;
+
+		static auto RefreshGraphs(UBlueprint* Blueprint, FBlueprintTable& Table) -> void;
+
+		/** Search the cached graph list, remembering where the node was found */
+		static auto FindInGraphs(FBlueprintTable& Table, const FGuid& NodeGuid) -> UEdGraphNode*;
+
+		static auto RebuildTable(UEdGraph* Graph, FGraphTable& Table) -> void;
+
+		static auto FlushPending(FGraphTable& Table) -> void;
+
+		static auto PruneStaleTables() -> void;
+
+		static auto HandleGraphChanged(const FEdGraphEditAction& Action) -> void;
+	};
+
+}
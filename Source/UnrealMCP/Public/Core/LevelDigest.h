@@ -0,0 +1,196 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class AActor;
+class ULevel;
+class UWorld;
+struct FPropertyChangedEvent;
+
+namespace UnrealMCP {
+
+	/**
+	 * Merkle-style digest of the editor world's actors, kept current incrementally.
+	 *
+	 * Each actor hashes its identity, class, label, folder, transform, tags, attachment and the
+	 * editable properties of the actor and its components that differ from their archetypes. The
+	 * tree above the actors is world -> level (package name) -> outliner folders (one node per path
+	 * segment). A node's digest is an order-independent sum of its children's keyed digests, so an
+	 * actor change updates only the nodes on its path.
+	 *
+	 * Engine events mark actors dirty; dirty actors are rehashed when a digest is next requested.
+	 * Every digest handed out is remembered with the version it was current at, and actors carry
+	 * the version of their last change (removed actors leave tombstones), so a client holding an
+	 * older root digest can ask for just what changed since. Versions are seeded from the wall
+	 * clock, like FGraphChangeJournal. All methods must be called on the game thread.
+	 */
+	class UNREALMCP_API FLevelDigest {
+	public:
+		/** Remembered root digests; older ones ask for a walk of the tree instead */
+		static constexpr int32 MaxHistory = 256;
+
+		struct FActorDigest {
+			FString Name;
+			uint64 Digest = 0;
+		};
+
+		/** One node of the digest tree */
+		struct FNodeDigest {
+			/** "" for the world, "<level package>" for a level, "<level package>:<folder path>" for a folder */
+			FString Path;
+			uint64 Digest = 0;
+
+			/** Actors in this subtree */
+			int32 ActorCount = 0;
+
+			/** Child nodes, filled down to the requested depth */
+			TArray<FNodeDigest> Children;
+
+			/** Actors directly in this node, when asked for */
+			TArray<FActorDigest> Actors;
+		};
+
+		/** What changed since a root digest */
+		struct FChanges {
+			uint64 Digest = 0;
+
+			/** The digest is not one this session handed out (or too old); walk the tree instead */
+			bool bFull = false;
+
+			/** Added or modified actors with their level and folder node */
+			TArray<TPair<FString, FString>> ChangedActors;
+
+			TArray<FString> RemovedActors;
+		};
+
+		/**
+		 * Subscribe to engine events. Safe to call more than once.
+		 */
+		static auto Initialize() -> void;
+
+		static auto Shutdown() -> void;
+
+		/**
+		 * Bring the digest up to date and describe a subtree.
+		 *
+		 * @param World Editor world
+		 * @param Path Node to start from ("" for the world)
+		 * @param Depth Levels of child nodes to include
+		 * @param bIncludeActors List the actor digests of the nodes at the last level
+		 * @param bRehash Rehash every actor instead of only those marked dirty, to catch changes made without events
+		 * @return false if the node does not exist
+		 */
+		static auto GetDigest(UWorld* World, const FString& Path, int32 Depth, bool bIncludeActors, bool bRehash, FNodeDigest& OutNode) -> bool;
+
+		/**
+		 * Bring the digest up to date and collect the actors changed or removed since a root digest.
+		 */
+		static auto GetChanges(UWorld* World, uint64 SinceDigest, FChanges& OutChanges) -> void;
+
+		/**
+		 * Mark an actor for rehashing after it was changed from code without an editor event.
+		 */
+		static auto MarkDirty(const AActor* Actor) -> void;
+
+		/** Drop the digest; the next request rebuilds it */
+		static auto Reset() -> void;
+
+		static auto ToHex(uint64 Digest) -> FString;
+
+		static auto ParseHex(const FString& Text, uint64& OutDigest) -> bool;
+
+	private:
+		struct FActorEntry {
+			TWeakObjectPtr<AActor> Actor;
+			FString Name;
+			FString NodePath;
+			uint64 Digest = 0;
+			int64 Version = 0;
+		};
+
+		struct FNode {
+			FString Parent;
+			uint64 Digest = 0;
+			int32 ActorCount = 0;
+			TSet<FString> Children;
+			TSet<FObjectKey> Actors;
+		};
+
+		static bool bInitialized;
+		static FObjectKey World;
+		static TMap<FObjectKey, FActorEntry> Actors;
+		static TMap<FString, FNode> Nodes;
+		static TSet<FObjectKey> Dirty;
+
+		/** A bulk change happened; the next update sweeps every known and live actor */
+		static bool bSweepPending;
+
+		/** Actor name -> version of its removal */
+		static TMap<FString, int64> Removed;
+
+		/** Root digest -> version it was current at, oldest first */
+		static TArray<TPair<uint64, int64>> History;
+		static int64 TrackedSince;
+		static int64 LastVersion;
+
+		static FDelegateHandle ActorAddedHandle;
+		static FDelegateHandle ActorDeletedHandle;
+		static FDelegateHandle ActorListChangedHandle;
+		static FDelegateHandle ActorMovedHandle;
+		static FDelegateHandle ActorLabelChangedHandle;
+		static FDelegateHandle ActorFolderChangedHandle;
+		static FDelegateHandle ObjectPropertyChangedHandle;
+		static FDelegateHandle ObjectRenamedHandle;
+		static FDelegateHandle LevelAddedHandle;
+		static FDelegateHandle LevelRemovedHandle;
+		static FDelegateHandle MapChangeHandle;
+
+		/** Rebuild for another world, rehash dirty actors and record the root digest */
+		static auto Update(UWorld* InWorld, bool bRehash) -> void;
+
+		/** Rehash one actor and move its contribution through the tree; returns true if anything changed */
+		static auto UpdateActor(AActor* Actor, int64& ChangeVersion) -> bool;
+
+		static auto RemoveActor(const FObjectKey& Key, int64& ChangeVersion) -> void;
+
+		static auto IsTracked(const AActor* Actor) -> bool;
+
+		/** Add and subtract keyed digests at a node and carry its new contribution up to the root; empty nodes are dropped */
+		static auto Propagate(const FString& NodePath, uint64 Added, uint64 Subtracted, int32 ActorDelta) -> void;
+
+		/** Node for an actor's level and folder, creating it and its parents */
+		static auto FindOrAddNode(const FString& Path) -> FNode&;
+
+		static auto GetNodePath(const AActor* Actor) -> FString;
+
+		static auto GetParentPath(const FString& Path) -> FString;
+
+		static auto HashActor(const AActor* Actor) -> uint64;
+
+		/** Mix a key into a digest before it is summed into its parent */
+		static auto KeyDigest(const FString& Key, uint64 Digest) -> uint64;
+
+		static auto FillNode(const FString& Path, int32 Depth, bool bIncludeActors, FNodeDigest& OutNode) -> void;
+
+		static auto NextVersion() -> int64;
+
+		/** Stamp a change with the version shared by one update */
+		static auto Stamp(int64& ChangeVersion) -> int64;
+
+		static auto HandleActorChanged(AActor* Actor) -> void;
+
+		static auto HandleActorListChanged() -> void;
+
+		static auto HandleActorFolderChanged(const AActor* Actor, FName OldPath) -> void;
+
+		static auto HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event) -> void;
+
+		static auto HandleObjectRenamed(UObject* Object, UObject* OldOuter, FName OldName) -> void;
+
+		static auto HandleLevelChanged(ULevel* Level, UWorld* InWorld) -> void;
+
+		static auto HandleMapChange(uint32 MapChangeFlags) -> void;
+	};
+
+}
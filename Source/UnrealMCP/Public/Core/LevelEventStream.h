@@ -0,0 +1,253 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Core/ActorIndex.h"
+#include "Core/NamePattern.h"
+#include "HAL/CriticalSection.h"
+#include "UObject/ObjectKey.h"
+#include <atomic>
+
+class AActor;
+class UBlueprint;
+class FJsonObject;
+struct FPropertyChangedEvent;
+
+namespace UnrealMCP {
+
+	enum class ELevelEventKind : uint8 {
+		ActorAdded,
+		ActorRemoved,
+		ActorRenamed,
+		TransformChanged,
+		PropertyChanged,
+		BlueprintCompiled
+	};
+
+	/**
+	 * One coalesced change of the editor level, copied out of the objects so it can leave the game thread
+	 */
+	struct UNREALMCP_API FLevelEvent {
+		ELevelEventKind Kind = ELevelEventKind::ActorAdded;
+
+		/** Increases by one per event across all subscriptions */
+		int64 Sequence = 0;
+
+		/** Actor name, or blueprint name for BlueprintCompiled */
+		FString Name;
+
+		/** Name before an ActorRenamed */
+		FString OldName;
+		FString ClassName;
+		FString Label;
+
+		/** Set for ActorAdded and TransformChanged */
+		TOptional<FTransform> Transform;
+
+		/** Changed properties for PropertyChanged; component properties are prefixed with the component name */
+		TArray<FString> Properties;
+
+		/** Blueprint status after BlueprintCompiled (see FBlueprintCompileCoordinator::GetStatusName) */
+		FString Status;
+
+		auto ToJson() const -> TSharedPtr<FJsonObject>;
+
+		/** "actor_added", "actor_removed", "actor_renamed", "transform_changed", "property_changed" or "blueprint_compiled" */
+		static auto GetKindName(ELevelEventKind Kind) -> const TCHAR*;
+
+		static auto ParseKind(const FString& KindName, ELevelEventKind& OutKind) -> bool;
+	};
+
+	/**
+	 * Server-side filter of a subscription; unset members let every event through
+	 */
+	struct UNREALMCP_API FLevelEventFilter {
+		/** Bit (1 << ELevelEventKind) per delivered kind */
+		uint32 Kinds = ~0u;
+
+		/** Actor attributes; not applied to blueprint events */
+		FActorIndexQuery Query;
+
+		/** Actor name (or blueprint name) pattern */
+		TOptional<FNamePattern> NamePattern;
+
+		/** Property names a PropertyChanged must touch; a component property matches by its own name too */
+		TSet<FString> Properties;
+
+		auto IncludesKind(const ELevelEventKind Kind) const -> bool {
+			return (Kinds & (1u << static_cast<uint32>(Kind))) != 0;
+		}
+	};
+
+	/**
+	 * Events taken from one subscription
+	 */
+	struct UNREALMCP_API FLevelEventBatch {
+		int32 SubscriptionId = 0;
+		TArray<FLevelEvent> Events;
+
+		/** Events lost to the queue bound since the previous batch; the client should resync */
+		int32 Dropped = 0;
+
+		/** {"type": "event", "subscription_id", "events", "dropped"} as pushed on the socket */
+		auto ToJson() const -> TSharedPtr<FJsonObject>;
+	};
+
+	/**
+	 * Level change subscriptions with per-frame coalescing.
+	 *
+	 * Editor-world actor events (added, deleted, renamed, moved, property and label changes) and
+	 * blueprint compiles are recorded per object while a frame runs. Once per frame they are
+	 * coalesced (an actor added and deleted in the same frame produces nothing, several moves one
+	 * TransformChanged with the final transform, property changes one PropertyChanged) and appended
+	 * to the bounded queue of every subscription whose filter matches. A full queue drops new events
+	 * and counts them, so a slow client learns that it must resync instead of stalling the editor.
+	 *
+	 * Subscriptions belong to the connection (session) open when they were created and end with it.
+	 * The server thread takes batches between requests and pushes them on the session socket.
+	 * Recording and flushing run on the game thread; sessions, queues and batches are thread safe.
+	 */
+	class UNREALMCP_API FLevelEventStream {
+	public:
+		static constexpr int32 DefaultMaxQueued = 1024;
+		static constexpr int32 MaxMaxQueued = 65536;
+
+		/**
+		 * Subscribe to engine events and start the per-frame flush. Safe to call more than once.
+		 */
+		static auto Initialize() -> void;
+
+		/**
+		 * Unsubscribe from engine events and drop every subscription.
+		 */
+		static auto Shutdown() -> void;
+
+		/** Start a client connection; later subscriptions belong to it. Called on the server thread. */
+		static auto OpenSession() -> int32;
+
+		/** End a client connection and drop its subscriptions. Called on the server thread. */
+		static auto CloseSession(int32 SessionId) -> void;
+
+		/** Session that new subscriptions belong to; 0 when no client is connected */
+		static auto GetCurrentSession() -> int32;
+
+		/**
+		 * Add a subscription owned by the current session.
+		 *
+		 * @param Filter Kinds, actor attributes, name pattern and properties to deliver
+		 * @param MaxQueued Queue bound; events beyond it are dropped and counted
+		 * @return Subscription id
+		 */
+		static auto Subscribe(FLevelEventFilter Filter, int32 MaxQueued) -> int32;
+
+		/**
+		 * Remove a subscription of a session.
+		 *
+		 * @param SessionId Session asking; another session's subscription is left alone
+		 * @return false if the session has no such subscription
+		 */
+		static auto Unsubscribe(int32 SubscriptionId, int32 SessionId) -> bool;
+
+		static auto HasSubscriptions(int32 SessionId) -> bool;
+
+		/** Take the queued events of every subscription of a session that has any */
+		static auto TakeBatches(int32 SessionId, TArray<FLevelEventBatch>& OutBatches) -> void;
+
+		/** Take the queued events of one subscription */
+		static auto TakeBatch(int32 SubscriptionId, FLevelEventBatch& OutBatch) -> bool;
+
+		/**
+		 * Coalesce the changes recorded since the last flush and queue them for the subscriptions.
+		 * Runs every frame; call it directly to deliver changes made in the current frame.
+		 */
+		static auto Flush() -> void;
+
+	private:
+		enum EChange : uint8 {
+			Added = 1 << 0,
+			Removed = 1 << 1,
+			Renamed = 1 << 2,
+			Moved = 1 << 3,
+			Changed = 1 << 4
+		};
+
+		/** Changes of one actor during the current frame */
+		struct FPendingActor {
+			TWeakObjectPtr<AActor> Actor;
+			FString Name;
+			FString OldName;
+			FString ClassName;
+			uint8 Changes = 0;
+			TArray<FString> Properties;
+
+			/** Subscriptions whose filter matched the actor when it was deleted */
+			TArray<int32> RemovedFor;
+		};
+
+		struct FSubscriber {
+			int32 SessionId = 0;
+			FLevelEventFilter Filter;
+
+			/** The filter classes at subscribe time; a class gone since then matches nothing */
+			TWeakObjectPtr<const UClass> Class;
+			TWeakObjectPtr<const UClass> ComponentClass;
+
+			int32 MaxQueued = DefaultMaxQueued;
+			TArray<FLevelEvent> Queue;
+			int32 Dropped = 0;
+		};
+
+		static bool bInitialized;
+
+		/** Guards sessions and subscribers, which the server thread reads and changes */
+		static FCriticalSection Mutex;
+		static TMap<int32, FSubscriber> Subscribers;
+		static std::atomic<int32> NumSubscribers;
+		static int32 CurrentSession;
+		static int32 LastSessionId;
+		static int32 LastSubscriptionId;
+		static int64 LastSequence;
+
+		/** Game thread only */
+		static TArray<FPendingActor> PendingActors;
+		static TMap<FObjectKey, int32> PendingIndex;
+		static TArray<TWeakObjectPtr<UBlueprint>> CompilingBlueprints;
+		static TArray<TWeakObjectPtr<UBlueprint>> CompiledBlueprints;
+
+		static FTSTicker::FDelegateHandle TickerHandle;
+		static FDelegateHandle ActorAddedHandle;
+		static FDelegateHandle ActorDeletedHandle;
+		static FDelegateHandle ActorMovedHandle;
+		static FDelegateHandle ActorLabelChangedHandle;
+		static FDelegateHandle ObjectPropertyChangedHandle;
+		static FDelegateHandle ObjectRenamedHandle;
+		static FDelegateHandle BlueprintPreCompileHandle;
+		static FDelegateHandle BlueprintCompiledHandle;
+
+		/** Pending entry of an editor-world actor, or nullptr when nobody listens or the actor is elsewhere */
+		static auto Record(AActor* Actor) -> FPendingActor*;
+
+		static auto Matches(const FSubscriber& Subscriber, const AActor* Actor, const FString& Name) -> bool;
+
+		static auto Enqueue(FSubscriber& Subscriber, const FLevelEvent& Event) -> void;
+
+		static auto Tick(float DeltaTime) -> bool;
+
+		static auto HandleActorAdded(AActor* Actor) -> void;
+
+		static auto HandleActorDeleted(AActor* Actor) -> void;
+
+		static auto HandleActorMoved(AActor* Actor) -> void;
+
+		static auto HandleActorLabelChanged(AActor* Actor) -> void;
+
+		static auto HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event) -> void;
+
+		static auto HandleObjectRenamed(UObject* Object, UObject* OldOuter, FName OldName) -> void;
+
+		static auto HandleBlueprintPreCompile(UBlueprint* Blueprint) -> void;
+
+		static auto HandleBlueprintCompiled() -> void;
+	};
+
+}
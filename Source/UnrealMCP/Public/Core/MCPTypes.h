@@ -1,6 +1,8 @@
 ﻿#pragma once
 
 // Include all specialized parameter/result type files
+#include "Types/ActorTypes.h"
+#include "Types/BlueprintGraphTypes.h"
 #include "Types/BlueprintIntrospectionTypes.h"
 #include "Types/BlueprintTypes.h"
 #include "Types/ComponentTypes.h"
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/Result.h"
+
+class FRegexPattern;
+
+namespace UnrealMCP {
+
+	/**
+	 * Name pattern compiled once per request and then matched against many names.
+	 *
+	 * Contains - substring search (the historical find_actors_by_name behavior)
+	 * Glob     - whole-name wildcard match: '*' any run, '?' one character, '[a-z]' / '[!abc]' sets, '\' escapes
+	 * Regex    - ICU regular expression, searched anywhere in the name (anchor with ^ and $)
+	 *
+	 * FRegexPattern exposes no compile status, so a malformed regex is accepted and matches no name.
+	 *
+	 * Matches() only reads the compiled state, so one pattern can be shared by worker threads.
+	 */
+	class UNREALMCP_API FNamePattern {
+	public:
+		enum class EMode : uint8 {
+			Contains,
+			Glob,
+			Regex
+		};
+
+		/**
+		 * Compile a pattern
+		 *
+		 * @param Pattern Pattern source
+		 * @param Mode How Pattern is interpreted
+		 * @param bCaseSensitive Whether letters must match case exactly
+		 * @return Success with the compiled pattern, Failure if a glob is malformed;
+		 *         a malformed regex is not detected and compiles to a pattern that never matches
+		 */
+		static auto Compile(const FString& Pattern, EMode Mode, bool bCaseSensitive) -> TResult<FNamePattern>;
+
+		/** Parse "contains", "glob" or "regex" (case-insensitive) */
+		static auto ParseMode(const FString& ModeName, EMode& OutMode) -> bool;
+
+		auto Matches(FStringView Text) const -> bool;
+
+		auto GetMode() const -> EMode {
+			return Mode;
+		}
+
+	private:
+		struct FGlobToken {
+			enum class EKind : uint8 {
+				Literal,
+				AnyChar,
+				AnyRun,
+				CharSet
+			};
+
+			EKind Kind = EKind::Literal;
+			TCHAR Char = 0;
+			bool bNegated = false;
+
+			/** Inclusive character ranges of a CharSet */
+			TArray<TPair<TCHAR, TCHAR>, TInlineAllocator<4>> Ranges;
+		};
+
+		EMode Mode = EMode::Contains;
+		bool bCaseSensitive = true;
+		FString Source;
+		TArray<FGlobToken> GlobTokens;
+		TSharedPtr<FRegexPattern> Regex;
+
+		auto MatchGlob(FStringView Text) const -> bool;
+
+		auto TokenMatches(const FGlobToken& Token, TCHAR Char) const -> bool;
+	};
+
+}
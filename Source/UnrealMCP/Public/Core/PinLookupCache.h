@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EdGraph/EdGraphPin.h"
+#include "UObject/ObjectKey.h"
+
+class UEdGraphNode;
+
+namespace UnrealMCP {
+
+	/**
+	 * Name -> pin lookup tables for graph nodes.
+	 *
+	 * A node's table is built on its first lookup and maps each pin FName (FName comparison is
+	 * case-insensitive, so this also serves case-folded requests) to the pin indices carrying it,
+	 * together with the node's default exec pins and first data output. The table remembers the pin
+	 * array it was built from; ReconstructNode replaces every pin, so a differing array rebuilds it.
+	 * All methods must be called on the game thread.
+	 */
+	class UNREALMCP_API FPinLookupCache {
+	public:
+		/**
+		 * Find a pin by name with the FCommonUtils::FindPin fallbacks
+		 *
+		 * @param Node Node to search
+		 * @param PinName Pin name; an exact-case match wins over a case-insensitive one. Empty selects the default exec pin
+		 * @param Direction Required direction, or EGPD_MAX for either
+		 * @return The pin, or nullptr if nothing matches
+		 */
+		static auto FindPin(UEdGraphNode* Node, const FString& PinName, EEdGraphPinDirection Direction) -> UEdGraphPin*;
+
+		/**
+		 * Drop the table of one node so the next lookup rebuilds it.
+		 */
+		static auto Invalidate(const UEdGraphNode* Node) -> void;
+
+		/**
+		 * Drop every table.
+		 */
+		static auto Reset() -> void;
+
+	private:
+		struct FNodeTable {
+			TWeakObjectPtr<UEdGraphNode> Node;
+
+			/** Pin array the table was built from */
+			TArray<UEdGraphPin*> Pins;
+
+			/** Indices into Pins, in pin order, for every pin of a given name */
+			TMap<FName, TArray<int32, TInlineAllocator<2>>> PinsByName;
+
+			/** First exec pin per direction (EGPD_Input, EGPD_Output) */
+			int32 DefaultExecPin[2] = {INDEX_NONE, INDEX_NONE};
+
+			int32 DefaultDataOutputPin = INDEX_NONE;
+		};
+
+		static TMap<FObjectKey, FNodeTable> Tables;
+
+		/** Table count at which stale tables are next pruned */
+		static int32 NextPruneSize;
+
+		static auto GetTable(UEdGraphNode* Node) -> FNodeTable&;
+
+		static auto BuildTable(UEdGraphNode* Node, FNodeTable& Table) -> void;
+
+		static auto FindInTable(const FNodeTable& Table, const UEdGraphNode* Node, const FString& PinName, EEdGraphPinDirection Direction) -> UEdGraphPin*;
+
+		static auto PruneStaleTables() -> void;
+
+		static auto LogPins(const UEdGraphNode* Node, const FString& PinName, EEdGraphPinDirection Direction) -> void;
+	};
+
+}
@@ -0,0 +1,196 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/Result.h"
+#include "UObject/ObjectKey.h"
+
+class FJsonValue;
+
+namespace UnrealMCP {
+
+	/**
+	 * Reflection access to dotted property paths such as "LightComponent.Intensity" or "Tags[2]".
+	 *
+	 * A path is resolved once per (class, path) into a plan: the chain of property offsets, container
+	 * element steps and object dereferences to reach the leaf, plus a converter tree that writes a JSON
+	 * value into the leaf's type (numbers of every width, bool, enums, strings, names, text, object,
+	 * class and soft references, structs, arrays, sets and maps; anything else through ImportText).
+	 * Later writes through the same path replay the plan without looking up a property by name.
+	 *
+	 * Plans are dropped when a blueprint compiles or objects are replaced by reinstancing. A dereference
+	 * whose object is not of the class the plan was built against rebuilds the plan for that write.
+	 * All methods must be called on the game thread.
+	 */
+	class UNREALMCP_API FPropertyPath {
+	public:
+		/**
+		 * Subscribe to blueprint compiles and object replacement to drop stale plans. Safe to call more than once.
+		 */
+		static auto Initialize() -> void;
+
+		static auto Shutdown() -> void;
+
+		/**
+		 * Write a JSON value to a property path of an object.
+		 *
+		 * Path segments are separated by '.'; a segment may be followed by [Index] for an array or
+		 * fixed-size array element (Index == Num appends to an array) or by [Key] for a map value,
+		 * which is added if missing. Object properties along the way are followed into their objects.
+		 *
+		 * @param Object Object the path starts from
+		 * @param Path Property path
+		 * @param Value Value to write
+		 * @param bNotify Call Modify/PostEditChangeProperty on the object owning the leaf
+		 * @return PropertyNotFound if the path does not resolve, InvalidPropertyValue if the value does not convert
+		 */
+		static auto SetValue(UObject* Object, const FString& Path, const TSharedPtr<FJsonValue>& Value, bool bNotify) -> FVoidResult;
+
+		/** Receives the object owning the leaf and its property that contains the leaf */
+		using FPreWrite = TFunctionRef<void(UObject* Owner, FProperty* OwnerProperty)>;
+
+		/**
+		 * Write a JSON value to a property path, leaving change notifications to the caller.
+		 *
+		 * @param PreWrite Called once before the value (or an appended element or map key) lands, and
+		 *                 only when the path resolves and the value converts, for callers that batch
+		 *                 Modify/PreEditChange/PostEditChange per object
+		 */
+		static auto SetValue(UObject* Object, const FString& Path, const TSharedPtr<FJsonValue>& Value, FPreWrite PreWrite) -> FVoidResult;
+
+		/**
+		 * Find the value a property path addresses, through the same cached plans, without changing anything.
+		 *
+		 * @param OutProperty Receives the leaf property (the element property for an array, set or map step)
+		 * @param OutData Receives the address of the leaf value
+		 * @return PropertyNotFound if the path does not resolve or an element or key does not exist
+		 */
+		static auto Resolve(UObject* Object, const FString& Path, const FProperty*& OutProperty, void*& OutData) -> FVoidResult;
+
+		/**
+		 * Drop every cached plan.
+		 */
+		static auto Reset() -> void;
+
+		/** Number of cached plans */
+		static auto Num() -> int32;
+
+	private:
+		struct FConverter;
+
+		/** Writes a JSON value to the memory of a property; returns false with a message on mismatch */
+		using FConvertFunction = bool (*)(const FConverter& Converter, void* Data, const TSharedPtr<FJsonValue>& Value, FString& OutError);
+
+		/** Converter for one property, with children for container elements, keys and values */
+		struct FConverter {
+			FConvertFunction Function = nullptr;
+			const FProperty* Property = nullptr;
+			TArray<FConverter> Inner;
+		};
+
+		enum class EAccess : uint8 {
+			/** Reach existing values only */
+			Find,
+			/** Check that Add would reach a value, without changing anything */
+			Probe,
+			/** Append the array element one past the end and add missing map keys */
+			Add
+		};
+
+		enum class EStepKind : uint8 {
+			/** Advance by the property offset (plus the fixed-size array index) */
+			Member,
+			ArrayElement,
+			MapValue,
+			/** Follow an object property into its object */
+			Dereference
+		};
+
+		struct FStep {
+			EStepKind Kind = EStepKind::Member;
+			const FProperty* Property = nullptr;
+			int32 Offset = 0;
+			int32 Index = 0;
+
+			/** Map key, converted on each write */
+			TSharedPtr<FJsonValue> Key;
+			TSharedPtr<FConverter> KeyConverter;
+
+			/** Class that declares the next property; a dereferenced object must be one */
+			const UClass* ExpectedClass = nullptr;
+		};
+
+		struct FPlan {
+			TArray<FStep> Steps;
+			FConverter Converter;
+
+			/** Property of the leaf's owning object that contains the leaf, for change notifications */
+			FProperty* OwnerProperty = nullptr;
+		};
+
+		struct FPlanKey {
+			FObjectKey Class;
+			FString Path;
+
+			friend auto operator==(const FPlanKey& A, const FPlanKey& B) -> bool {
+				return A.Class == B.Class && A.Path.Equals(B.Path, ESearchCase::CaseSensitive);
+			}
+
+			friend auto GetTypeHash(const FPlanKey& Key) -> uint32 {
+				return HashCombine(GetTypeHash(Key.Class), FCrc::StrCrc32(*Key.Path));
+			}
+		};
+
+		/** Shared so a write keeps its plan alive when loading a referenced asset resets the cache */
+		static TMap<FPlanKey, TSharedRef<const FPlan>> Plans;
+		static bool bInitialized;
+		static FDelegateHandle BlueprintCompiledHandle;
+		static FDelegateHandle ObjectsReplacedHandle;
+
+		/** Cached plan for the object's class and the path, built on first use */
+		static auto FindPlan(UObject* Object, const FString& Path, TSharedPtr<const FPlan>& OutPlan) -> FVoidResult;
+
+		/** Resolve a path against an object; dereferences are checked against the object's current values */
+		static auto BuildPlan(UObject* Object, const FString& Path, FPlan& OutPlan) -> FVoidResult;
+
+		/**
+		 * Replay plan steps up to the value they address.
+		 *
+		 * @return Address of the value (any non-null pointer for Probe), or nullptr with OutError set;
+		 *         OutStale is set instead when a dereference met an object of another class
+		 */
+		static auto Execute(
+			const TArray<FStep>& Steps,
+			UObject* Object,
+			EAccess Access,
+			UObject*& OutOwner,
+			bool& OutStale,
+			FString& OutError
+		) -> void*;
+
+		static auto MakeConverter(const FProperty* Property) -> FConverter;
+
+		/** Convert into a temporary value of the converter's property, optionally starting from Initial, and hand it to a consumer */
+		static auto ConvertToTemporary(
+			const FConverter& Converter,
+			const TSharedPtr<FJsonValue>& Value,
+			const void* Initial,
+			FString& OutError,
+			TFunctionRef<void(const void*)> Consumer
+		) -> bool;
+
+		static auto ConvertBool(const FConverter& Converter, void* Data, const TSharedPtr<FJsonValue>& Value, FString& OutError) -> bool;
+		static auto ConvertNumeric(const FConverter& Converter, void* Data, const TSharedPtr<FJsonValue>& Value, FString& OutError) -> bool;
+		static auto ConvertEnum(const FConverter& Converter, void* Data, const TSharedPtr<FJsonValue>& Value, FString& OutError) -> bool;
+		static auto ConvertString(const FConverter& Converter, void* Data, const TSharedPtr<FJsonValue>& Value, FString& OutError) -> bool;
+		static auto ConvertName(const FConverter& Converter, void* Data, const TSharedPtr<FJsonValue>& Value, FString& OutError) -> bool;
+		static auto ConvertText(const FConverter& Converter, void* Data, const TSharedPtr<FJsonValue>& Value, FString& OutError) -> bool;
+		static auto ConvertObject(const FConverter& Converter, void* Data, const TSharedPtr<FJsonValue>& Value, FString& OutError) -> bool;
+		static auto ConvertSoftObject(const FConverter& Converter, void* Data, const TSharedPtr<FJsonValue>& Value, FString& OutError) -> bool;
+		static auto ConvertStruct(const FConverter& Converter, void* Data, const TSharedPtr<FJsonValue>& Value, FString& OutError) -> bool;
+		static auto ConvertArray(const FConverter& Converter, void* Data, const TSharedPtr<FJsonValue>& Value, FString& OutError) -> bool;
+		static auto ConvertSet(const FConverter& Converter, void* Data, const TSharedPtr<FJsonValue>& Value, FString& OutError) -> bool;
+		static auto ConvertMap(const FConverter& Converter, void* Data, const TSharedPtr<FJsonValue>& Value, FString& OutError) -> bool;
+		static auto ConvertImportText(const FConverter& Converter, void* Data, const TSharedPtr<FJsonValue>& Value, FString& OutError) -> bool;
+	};
+
+}
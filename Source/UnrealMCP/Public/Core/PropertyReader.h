@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/Result.h"
+
+class FJsonObject;
+class FJsonValue;
+
+namespace UnrealMCP {
+
+	/**
+	 * What a property read returns
+	 */
+	struct FPropertyReadOptions {
+		/** Property paths to read (see FPropertyPath); empty reads every editable property */
+		TArray<FString> Paths;
+
+		/**
+		 * Levels of structs, containers and owned subobjects (components) expanded into JSON.
+		 * Values below this depth are returned in their text form.
+		 */
+		int32 Depth = 2;
+
+		/** Only values that differ from the object's archetype (class default or template) */
+		bool bChangedOnly = false;
+	};
+
+	/**
+	 * Reflection-driven property dump of an object into JSON.
+	 *
+	 * Numbers, booleans, strings, names and text map to JSON scalars, enums to their names, object
+	 * and soft references to paths, and structs, arrays, sets and maps to JSON objects and arrays
+	 * while the depth allows. Subobjects owned by the object being read (components, instanced
+	 * objects) are expanded in place once; further references to them are given as paths.
+	 *
+	 * In changed-only mode each property is compared with the archetype using Identical with deep
+	 * comparison, and owned subobjects are compared against their own archetypes, so the dump holds
+	 * only the overrides. All methods must be called on the game thread.
+	 */
+	class UNREALMCP_API FPropertyReader {
+	public:
+		/**
+		 * Read the properties of an object.
+		 *
+		 * @param Object Object to read
+		 * @param Options Paths, depth and changed-only mode
+		 * @return Property name (or requested path) -> value, or PropertyNotFound for a path that does not resolve
+		 */
+		static auto Read(UObject* Object, const FPropertyReadOptions& Options) -> TResult<TSharedPtr<FJsonObject>>;
+
+	private:
+		struct FContext {
+			const FPropertyReadOptions& Options;
+			const UObject* Root;
+
+			/** Subobjects already expanded */
+			TSet<const UObject*> Expanded;
+		};
+
+		static auto ReadObject(FContext& Context, const UObject* Object, int32 Depth) -> TSharedPtr<FJsonObject>;
+
+		/** Value of a property, as an array for fixed-size arrays */
+		static auto PropertyToJson(FContext& Context, const FProperty* Property, const void* Data, int32 Depth) -> TSharedPtr<FJsonValue>;
+
+		/** Value of one element of a property */
+		static auto ValueToJson(FContext& Context, const FProperty* Property, const void* Data, int32 Depth) -> TSharedPtr<FJsonValue>;
+
+		/** Object held by an object property if it lives inside the object being read */
+		static auto GetOwnedSubobject(const FContext& Context, const FProperty* Property, const void* Data) -> const UObject*;
+
+		static auto ExportText(const FProperty* Property, const void* Data) -> FString;
+	};
+
+}
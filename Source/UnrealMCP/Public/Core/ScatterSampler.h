@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UnrealMCP {
+
+	/**
+	 * Parallel 2D point sampling for instance scattering.
+	 *
+	 * Points are generated in a [0, Size.X] x [0, Size.Y] domain; callers map them onto a box,
+	 * volume or spline. Both samplers derive their random streams from the seed and the cell or
+	 * row being sampled, never from the worker that runs it, so results are deterministic.
+	 */
+	class UNREALMCP_API FScatterSampler {
+	public:
+		/**
+		 * One point per grid cell, offset from the cell center by up to Jitter * Spacing / 2 per axis
+		 *
+		 * @param Size Domain extent
+		 * @param Spacing Cell edge length
+		 * @param Jitter 0 for a regular grid, 1 for a point anywhere in its cell
+		 * @param Seed Random seed
+		 * @param OutPoints Receives the points, row by row
+		 */
+		static auto JitteredGrid(
+			const FVector2D& Size,
+			double Spacing,
+			double Jitter,
+			int32 Seed,
+			TArray<FVector2D>& OutPoints
+		) -> void;
+
+		/**
+		 * Points no closer than MinDistance to each other (Poisson-disk).
+		 *
+		 * Dart throwing over a background grid of cells of edge MinDistance / sqrt(2), which hold
+		 * at most one point each. Cells are processed in nine phases (cell coordinates mod 3) so
+		 * cells sampled concurrently never share a conflict neighbourhood.
+		 *
+		 * @param Size Domain extent
+		 * @param MinDistance Minimum distance between points
+		 * @param Seed Random seed
+		 * @param OutPoints Receives the points, in cell order
+		 */
+		static auto PoissonDisk(
+			const FVector2D& Size,
+			double MinDistance,
+			int32 Seed,
+			TArray<FVector2D>& OutPoints
+		) -> void;
+
+		/** Upper bound on the points JitteredGrid generates */
+		static auto EstimateGridCount(const FVector2D& Size, double Spacing) -> int64;
+
+		/** Upper bound on the points PoissonDisk generates (one per background cell) */
+		static auto EstimatePoissonCount(const FVector2D& Size, double MinDistance) -> int64;
+
+	private:
+		/** Dart-throwing passes over every phase; later passes fill gaps left by failed attempts */
+		static constexpr int32 PoissonPasses = 3;
+
+		/** Candidate points tried per empty cell and pass */
+		static constexpr int32 PoissonAttempts = 6;
+	};
+
+}
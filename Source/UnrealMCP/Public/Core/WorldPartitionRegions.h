@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UWorld;
+class UWorldPartitionEditorLoaderAdapter;
+
+namespace UnrealMCP {
+
+	/**
+	 * Editor-loaded regions of World Partition maps.
+	 *
+	 * Each region is a user-created box loader adapter, the same kind the World Partition editor
+	 * creates for "Load Region From Selection", so the cells it covers stay loaded (and show up in
+	 * the editor) until the region is unloaded. Regions are numbered for the session. All methods
+	 * must be called on the game thread.
+	 */
+	class UNREALMCP_API FWorldPartitionRegions {
+	public:
+		/**
+		 * Load every actor whose bounds intersect a box.
+		 *
+		 * @param World Editor world; must be partitioned
+		 * @param Bounds Region to load
+		 * @return Region id, or 0 if the world has no World Partition
+		 */
+		static auto Load(UWorld* World, const FBox& Bounds) -> int32;
+
+		/**
+		 * Unload a region. Actors another region (or the user) keeps loaded stay loaded.
+		 *
+		 * @return false if no such region exists
+		 */
+		static auto Unload(int32 RegionId) -> bool;
+
+		/** Forget every region without unloading it; the world keeps them until it closes */
+		static auto Reset() -> void;
+
+	private:
+		struct FRegion {
+			TWeakObjectPtr<UWorld> World;
+			TWeakObjectPtr<UWorldPartitionEditorLoaderAdapter> Adapter;
+		};
+
+		static TMap<int32, FRegion> Regions;
+		static int32 LastRegionId;
+	};
+
+}
@@ -25,11 +25,23 @@ public:
 
 	virtual auto Exit() -> void override;
 
+	/**
+	 * Frame one message for the wire: UTF-8 JSON on a single line, terminated by a newline.
+	 * Responses and pushed events share this framing, so a client reads either by splitting on newlines.
+	 */
+	static auto EncodeMessage(const FString& Json) -> TArray<uint8>;
+
 protected:
 	auto HandleClientConnection(TSharedPtr<FSocket> ClientSocket) -> void;
 
 	auto ProcessMessage(TSharedPtr<FSocket> Client, const FString& Message) const -> void;
 
+	/** Send the level events queued for a session's subscriptions, one JSON line per subscription */
+	auto PushEvents(int32 SessionId) const -> void;
+
+	/** Send one framed message, retrying until every byte is out */
+	static auto SendMessage(FSocket& Socket, const FString& Json) -> bool;
+
 private:
 	UUnrealMCPBridge* Bridge;
 	TSharedPtr<FSocket> ListenerSocket;
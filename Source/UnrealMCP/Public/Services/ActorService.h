@@ -1,12 +1,15 @@
 ﻿#pragma once
 
 #include "CoreMinimal.h"
+#include "Core/MCPTypes.h"
 #include "Core/Result.h"
 
 class AActor;
 class UWorld;
 
 namespace UnrealMCP {
+	struct FActorIndexQuery;
+
 	/**
 	 * Service for actor manipulation operations in the editor
 	 * Handles spawning, deleting, finding, and modifying actors
@@ -31,6 +34,64 @@ namespace UnrealMCP {
 		 */
 		static auto FindActorsByName(const FString& NamePattern, TArray<FString>& OutActorNames) -> FVoidResult;
 
+		/**
+		 * Find actors whose name (and optionally label) matches a substring, glob or regex pattern
+		 * The pattern is compiled once and matched in parallel over a snapshot of indexed names
+		 *
+		 * @param Params Pattern, match mode, case sensitivity and label matching
+		 * @return Success with the matching actors, Failure if the pattern is malformed
+		 */
+		static auto FindActorsByPattern(const FActorNameSearchParams& Params) -> TResult<TArray<AActor*>>;
+
+		/**
+		 * Find actors by class, tags, component class and outliner folder
+		 * Served from the per-world inverted indices of FActorIndex
+		 *
+		 * @param Filter Attribute constraints; all set constraints must match
+		 * @return Success with the matching actors, Failure if the world or a filter class is invalid
+		 */
+		static auto QueryActors(const FActorQueryFilter& Filter) -> TResult<TArray<AActor*>>;
+
+		/**
+		 * Find actors whose bounds intersect a sphere
+		 *
+		 * @param Center Sphere center in world space
+		 * @param Radius Sphere radius
+		 * @param Filter Optional attribute constraints
+		 * @return Success with the matching actors, Failure if the world or a filter class is invalid
+		 */
+		static auto FindActorsInRadius(
+			const FVector& Center,
+			double Radius,
+			const FActorQueryFilter& Filter
+		) -> TResult<TArray<AActor*>>;
+
+		/**
+		 * Find actors whose bounds intersect an axis-aligned box
+		 *
+		 * @param Box Query box in world space
+		 * @param Filter Optional attribute constraints
+		 * @return Success with the matching actors, Failure if the world or a filter class is invalid
+		 */
+		static auto FindActorsInBox(const FBox& Box, const FActorQueryFilter& Filter) -> TResult<TArray<AActor*>>;
+
+		/**
+		 * Find the actors nearest to a location, closest first
+		 * Distance is measured to the center of each actor's bounds
+		 *
+		 * @param Location Query location
+		 * @param Count Maximum number of actors to return
+		 * @param MaxDistance Ignore actors farther than this (<= 0 for unlimited)
+		 * @param Filter Optional attribute constraints
+		 * @return Success with actor/distance pairs, Failure if the world or a filter class is invalid
+		 */
+		static auto FindNearestActors(
+			const FVector& Location,
+			int32 Count,
+			double MaxDistance,
+			const FActorQueryFilter& Filter
+		) -> TResult<TArray<TPair<AActor*, double>>>;
+
 		/**
 		 * Spawn a new actor in the level
 		 *
@@ -47,6 +108,17 @@ namespace UnrealMCP {
 			const TOptional<FRotator>& Rotation
 		) -> TResult<AActor*>;
 
+		/**
+		 * Spawn a batch of actors in one undo transaction
+		 * Each actor is spawned with deferred construction so its properties are set before the
+		 * construction script runs; the level is dirtied and the outliner refreshed once per batch.
+		 * Classes and names are validated for the whole batch before anything is spawned.
+		 *
+		 * @param Params Class, name, transform and properties of each actor
+		 * @return Success with the spawned actors and per-actor property errors, Failure if an entry is invalid
+		 */
+		static auto SpawnActors(const FSpawnActorsParams& Params) -> TResult<FSpawnActorsResult>;
+
 		/**
 		 * Delete an actor from the level
 		 *
@@ -77,6 +149,116 @@ namespace UnrealMCP {
 			const TOptional<FVector>& Scale
 		) -> FVoidResult;
 
+		/**
+		 * Set the transforms of many actors in one undo transaction
+		 * Every name is resolved before anything moves. Actors already at their target transform are
+		 * skipped without Modify or a component update.
+		 *
+		 * @param Params Actor names and one transform per name
+		 * @return Success with updated/unchanged counts, Failure if a name does not resolve
+		 */
+		static auto SetActorTransforms(const FSetActorTransformsParams& Params) -> TResult<FSetActorTransformsResult>;
+
+		/**
+		 * Apply one relative edit (offset, rotate or scale around a pivot, snap to grid) to a set of actors
+		 * World transforms are gathered into an FActorTransformBatch, edited with SIMD, and written back in
+		 * one pass; actors whose transform does not change are left untouched.
+		 *
+		 * @param Params Actor selection (names, or filter and region) and the edit
+		 * @return Success with matched/updated counts and the pivot used, Failure if the selection is invalid
+		 */
+		static auto TransformActors(const FTransformActorsParams& Params) -> TResult<FTransformActorsResult>;
+
+		/**
+		 * Scatter static mesh instances over a box, a volume or a band along a spline
+		 * Placements are sampled in parallel (Poisson-disk or jittered grid) and added to one hierarchical
+		 * instanced static mesh component with a single AddInstances call. The component is found on or
+		 * created for the host actor, which is spawned if needed.
+		 *
+		 * @param Params Mesh, host actor, region, sampling and per-instance randomization
+		 * @return Success with the host, component and the range of new instances, Failure otherwise
+		 */
+		static auto ScatterInstances(const FScatterInstancesParams& Params) -> TResult<FScatterInstancesResult>;
+
+		/**
+		 * Write several property paths on a set of actors in one transaction
+		 * Each (class, path) is resolved once (see FPropertyPath). Every written object gets one
+		 * PreEditChange before its first write and one PostEditChange after the whole batch.
+		 *
+		 * @param Params Actor selection (names, or filter and region) and property path -> value pairs
+		 * @return Success with written/failed counts and the first errors, Failure if the selection is invalid
+		 */
+		static auto SetProperties(const FSetPropertiesParams& Params) -> TResult<FSetPropertiesResult>;
+
+		/**
+		 * Read properties of a set of actors through reflection
+		 * Either every editable property or only the given paths, expanded to a depth, optionally
+		 * limited to the values that differ from each actor's archetype (see FPropertyReader).
+		 *
+		 * @param Params Actor selection (names, or filter and region) and read options
+		 * @return Success with the properties per actor, Failure if the selection or a path is invalid
+		 */
+		static auto GetProperties(const FGetPropertiesParams& Params) -> TResult<FGetPropertiesResult>;
+
+		/**
+		 * Subscribe the current connection to level changes (see FLevelEventStream)
+		 * Events are coalesced per frame, filtered on the editor side and pushed on the connection.
+		 *
+		 * @param Params Event kinds, actor filter, name pattern, properties and queue bound
+		 * @return Success with the subscription id, Failure if a filter class or the pattern is invalid
+		 */
+		static auto Subscribe(const FSubscribeParams& Params) -> TResult<FSubscribeResult>;
+
+		/**
+		 * End a level change subscription of the current session
+		 *
+		 * @param SubscriptionId Id returned by Subscribe
+		 * @return Success, or Failure if the current session has no such subscription
+		 */
+		static auto Unsubscribe(int32 SubscriptionId) -> FVoidResult;
+
+		/**
+		 * Read the Merkle-style digest of the editor world (see FLevelDigest)
+		 * A client compares node digests top-down and fetches only the subtrees that differ.
+		 *
+		 * @param Params Node path, depth, whether to list actor digests and whether to rehash everything
+		 * @return Success with the node and its children, Failure if no such node exists
+		 */
+		static auto GetLevelDigest(const FGetLevelDigestParams& Params) -> TResult<FGetLevelDigestResult>;
+
+		/**
+		 * List the actors changed or removed since an earlier root digest
+		 *
+		 * @param Params Root digest returned by an earlier get_level_digest or diff_level
+		 * @return Success with the changes, or with full set when the digest is unknown and the tree must be walked
+		 */
+		static auto DiffLevel(const FDiffLevelParams& Params) -> TResult<FDiffLevelResult>;
+
+		/**
+		 * Query the actor descriptors of a World Partition map, loaded or not
+		 * Answered from the descriptor container alone, so unloaded cells stay unloaded.
+		 *
+		 * @param Params Class, name or label pattern, data layer, runtime grid, region, load state and limit
+		 * @return Success with the matching descriptors, Failure if the world is not partitioned or a filter is invalid
+		 */
+		static auto QueryActorDescs(const FQueryActorDescsParams& Params) -> TResult<FQueryActorDescsResult>;
+
+		/**
+		 * Load the actors of a World Partition region in the editor (see FWorldPartitionRegions)
+		 *
+		 * @param Params Region bounds
+		 * @return Success with the region id and how many actors it covers, Failure if the world is not partitioned
+		 */
+		static auto LoadRegion(const FLoadRegionParams& Params) -> TResult<FLoadRegionResult>;
+
+		/**
+		 * Unload a region loaded by LoadRegion
+		 *
+		 * @param RegionId Id returned by LoadRegion
+		 * @return Success, or Failure if no such region exists
+		 */
+		static auto UnloadRegion(int32 RegionId) -> FVoidResult;
+
 		/**
 		 * Get an actor's properties
 		 *
@@ -87,10 +269,10 @@ namespace UnrealMCP {
 		static auto GetActorProperties(const FString& ActorName, TMap<FString, FString>& OutProperties) -> FVoidResult;
 
 		/**
-		 * Set an actor's property
+		 * Set an actor's property, recording an undo step and sending the edit notifications
 		 *
 		 * @param ActorName Name of the actor
-		 * @param PropertyName Name of the property to set
+		 * @param PropertyName Name or path of the property to set (see FPropertyPath::SetValue)
 		 * @param PropertyValue Value to set (as JSON value for type flexibility)
 		 * @return Success if property was set, Failure with error message
 		 */
@@ -102,6 +284,7 @@ namespace UnrealMCP {
 
 		/**
 		 * Helper to find an actor by name in the current world
+		 * Matches the exact object name only. Served from FActorIndex in O(1).
 		 */
 		static auto FindActorByName(const FString& ActorName) -> AActor*;
 
@@ -123,5 +306,20 @@ namespace UnrealMCP {
 		 * Helper to map actor class string to UClass
 		 */
 		static auto GetActorClassByName(const FString& ClassName) -> UClass*;
+
+		/**
+		 * Helper to resolve a selection to actors; every explicit name must exist
+		 */
+		static auto SelectActors(const FActorSelection& Selection) -> TResult<TArray<AActor*>>;
+
+		/**
+		 * Helper to resolve the class and tag names of a query filter
+		 */
+		static auto ResolveFilter(const FActorQueryFilter& Filter) -> TResult<FActorIndexQuery>;
+
+		/**
+		 * Helper to refresh the index after moving an actor from code, including every actor attached below it
+		 */
+		static auto NotifyActorTreeMoved(AActor* Actor) -> void;
 	};
 }
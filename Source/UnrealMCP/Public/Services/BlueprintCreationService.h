@@ -6,6 +6,7 @@
 
 class UBlueprint;
 class UClass;
+class FCompilerResultsLog;
 
 namespace UnrealMCP {
 	/**
@@ -24,11 +25,29 @@ namespace UnrealMCP {
 		/**
 		 * Compile an existing blueprint by name
 		 * @param BlueprintName The name of the blueprint to compile
-		 * @return Result indicating success or compilation error
+		 * @param bProfile Time the skeleton and bytecode/reinstancing passes separately (costs an extra skeleton pass)
+		 * @param bCollectGarbage Also run a garbage collection, timed when profiling
+		 * @return Compile report with status and compiler messages, plus timings and recompiled dependents
+		 *         when profiling; a compile with errors is still a successful result
 		 */
-		static auto CompileBlueprint(const FString& BlueprintName) -> FVoidResult;
+		static auto CompileBlueprint(const FString& BlueprintName,
+		                             bool bProfile = false,
+		                             bool bCollectGarbage = false) -> TResult<FBlueprintCompileReport>;
+
+		/**
+		 * Compile several blueprints with a single compilation manager flush
+		 * Missing blueprints are reported per entry rather than failing the batch
+		 * @param Params Names of the blueprints to compile
+		 * @return Per-blueprint status, errors and warnings plus the batch time
+		 */
+		static auto CompileBlueprints(const FCompileBlueprintsParams& Params) -> TResult<FCompileBlueprintsResult>;
 
 	private:
+		/**
+		 * Build a report from a blueprint's compile status and the messages of its compile
+		 */
+		static auto MakeCompileReport(const UBlueprint* Blueprint, const FCompilerResultsLog& ResultsLog) -> FBlueprintCompileReport;
+
 		/**
 		 * Resolve a parent class name to a UClass instance
 		 * Attempts to find the class in Engine or Game modules with fallback to AActor
@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "CoreMinimal.h"
+#include "Core/MCPTypes.h"
 #include "Core/Result.h"
 
 class UBlueprint;
@@ -11,6 +12,7 @@ class UK2Node_CallFunction;
 class UK2Node_VariableGet;
 class UK2Node_InputAction;
 class UK2Node_Self;
+class UFunction;
 
 namespace UnrealMCP {
 	/**
@@ -24,8 +26,8 @@ namespace UnrealMCP {
 		 * Connect two blueprint nodes via their pins
 		 *
 		 * @param BlueprintName Name of the blueprint
-		 * @param SourceNodeId GUID of the source node
-		 * @param TargetNodeId GUID of the target node
+		 * @param SourceNodeId GUID of the source node (any graph of the blueprint)
+		 * @param TargetNodeId GUID of the target node (same graph as the source)
 		 * @param SourcePinName Name of the source pin
 		 * @param TargetPinName Name of the target pin
 		 * @return Success if nodes were connected, Failure with error message
@@ -111,11 +113,43 @@ namespace UnrealMCP {
 		) -> TResult<UK2Node_InputAction*>;
 
 		/**
-		 * Find nodes in a blueprint graph by type and criteria
+		 * Create a set of nodes and the links between them in the event graph in one operation
+		 *
+		 * Everything that can fail is resolved before links are made, and nodes created by a failed
+		 * build are removed again. The graph is notified and the blueprint marked modified once,
+		 * under a single undo transaction.
+		 *
+		 * @param Params Blueprint name, node specs keyed by local id, and links between local ids or existing node GUIDs
+		 * @return Local id -> GUID of every created (or reused event) node, Failure with error message
+		 */
+		static auto BuildGraph(const FBuildBlueprintGraphParams& Params) -> TResult<FBuildBlueprintGraphResult>;
+
+		/**
+		 * Query nodes across every graph of a blueprint
+		 *
+		 * Predicates are resolved to FNames and classes once, so a query costs one pass over the nodes
+		 * it scans. Pages stop at the query limit and hand back a cursor to resume from; nothing is truncated.
+		 *
+		 * @param Query Predicates, projections and pagination
+		 * @return One page of matching nodes, Failure with error message
+		 */
+		static auto QueryNodes(const FBlueprintNodeQuery& Query) -> TResult<FBlueprintNodeQueryResult>;
+
+		/**
+		 * Export the graphs of a blueprint, whole or only what changed since a version
+		 *
+		 * @param Params Blueprint name, optional graph name and the version the caller last received
+		 * @return Every graph with its version and its changed nodes and removed node GUIDs, Failure with error message
+		 */
+		static auto ExportGraph(const FExportBlueprintGraphParams& Params) -> TResult<FBlueprintGraphExport>;
+
+		/**
+		 * Find nodes in a blueprint by type and criteria
+		 * Legacy form of QueryNodes returning every match
 		 *
 		 * @param BlueprintName Name of the blueprint
-		 * @param NodeType Type of nodes to find (e.g., "Event")
-		 * @param EventName Optional event name for event node searches
+		 * @param NodeType Type of nodes to find (Event, Function or Variable)
+		 * @param EventName Event name, required for event node searches
 		 * @param OutNodeGuids Array to populate with found node GUIDs
 		 * @return Success if search completed, Failure with error message
 		 */
@@ -155,9 +189,14 @@ namespace UnrealMCP {
 		static auto GetEventGraph(UBlueprint* Blueprint, FString& OutError) -> UEdGraph*;
 
 		/**
-		 * Helper to find a node by GUID in a graph
+		 * Helper to find the function a call node should invoke: the target class first, then the
+		 * blueprint's own class, then KismetSystemLibrary for PrintString
 		 */
-		static auto FindNodeByGuid(UEdGraph* Graph, const FString& NodeGuid) -> UEdGraphNode*;
+		static auto ResolveFunction(
+			const UBlueprint* Blueprint,
+			const FString& FunctionName,
+			const TOptional<FString>& TargetClass
+		) -> const UFunction*;
 
 		/**
 		 * Helper to set function node parameters from JSON
@@ -36,6 +36,24 @@ namespace UnrealMCP {
 		 */
 		static auto BlueprintExists(const FString& BlueprintName) -> bool;
 
+		/**
+		 * Find graph nodes across all indexed blueprints that reference a name.
+		 * Served from the persistent search index without loading packages; safe to call off the game thread.
+		 *
+		 * @param Params Name, optional reference kind and path prefix, hit limit
+		 * @return Matching nodes with their blueprint and graph
+		 */
+		static auto SearchBlueprints(const FSearchBlueprintsParams& Params) -> TResult<FSearchBlueprintsResult>;
+
+		/**
+		 * Load and index blueprints under a path that the search index does not cover yet.
+		 * Blueprints are indexed automatically when saved; this fills in ones not saved since the index existed.
+		 *
+		 * @param Params Path, recursion and whether to skip already indexed blueprints
+		 * @return Number of blueprints indexed and skipped
+		 */
+		static auto IndexBlueprints(const FIndexBlueprintsParams& Params) -> TResult<FIndexBlueprintsResult>;
+
 		/**
 		 * Get comprehensive information about a blueprint.
 		 *
@@ -116,12 +116,14 @@ namespace UnrealMCP {
 		 * Get all functions from a blueprint.
 		 *
 		 * Retrieves detailed information about all functions in a blueprint including
-		 * parameters, return values, metadata, and node counts.
+		 * parameters, return values, metadata, and node counts. By default everything is read
+		 * from the function graphs and the skeleton class, without compiling.
 		 *
 		 * @param BlueprintName Name of the blueprint
+		 * @param bRequireCompiled Compile first if needed and read metadata from the generated class
 		 * @return Result with function information or error
 		 */
-		static auto GetFunctions(const FString& BlueprintName) -> TResult<FGetBlueprintFunctionsResult>;
+		static auto GetFunctions(const FString& BlueprintName, bool bRequireCompiled = false) -> TResult<FGetBlueprintFunctionsResult>;
 
 		// ============ Variable Operations ============
 
@@ -144,6 +144,20 @@ namespace UnrealMCP {
 		static auto
 		SetPawnProperties(const FString& BlueprintName, const TSharedPtr<FJsonObject>& PropertyParams) -> FVoidResult;
 
+		/**
+		 * Resolve a component type name to a UClass.
+		 *
+		 * Attempts multiple naming conventions:
+		 * - Exact name
+		 * - With "Component" suffix
+		 * - With "U" prefix
+		 * - With both "U" prefix and "Component" suffix
+		 *
+		 * @param ComponentType The component type to resolve
+		 * @return Valid component class or nullptr if not found
+		 */
+		static auto ResolveComponentClass(const FString& ComponentType) -> UClass*;
+
 	private:
 		// ============ Component Node Lookup ============
 
@@ -163,19 +177,5 @@ namespace UnrealMCP {
 		 * @return Empty string if valid, error message if invalid
 		 */
 		static auto ValidateBlueprintForComponentOps(const UBlueprint* Blueprint) -> FString;
-
-		/**
-		 * Resolve a component type name to a UClass.
-		 *
-		 * Attempts multiple naming conventions:
-		 * - Exact name
-		 * - With "Component" suffix
-		 * - With "U" prefix
-		 * - With both "U" prefix and "Component" suffix
-		 *
-		 * @param ComponentType The component type to resolve
-		 * @return Valid component class or nullptr if not found
-		 */
-		static auto ResolveComponentClass(const FString& ComponentType) -> UClass*;
 	};
 }
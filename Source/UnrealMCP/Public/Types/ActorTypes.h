@@ -0,0 +1,554 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "Core/LevelDigest.h"
+#include "Core/LevelEventStream.h"
+#include "Core/NamePattern.h"
+#include "Core/PropertyReader.h"
+#include "Core/Result.h"
+
+namespace UnrealMCP {
+	/**
+	 * Optional attribute constraints shared by actor queries; all set constraints must match
+	 */
+	struct FActorQueryFilter {
+		/** Actor class name; subclasses match too */
+		TOptional<FString> ClassName;
+
+		/** Tags the actor must all carry */
+		TArray<FString> Tags;
+
+		/** Component class name the actor must own; subclasses match too */
+		TOptional<FString> ComponentClassName;
+
+		/** Outliner folder path; subfolders match too */
+		TOptional<FString> Folder;
+
+		/** Parse from JSON parameters ("class", "tag", "tags", "component", "folder") */
+		static auto FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FActorQueryFilter>;
+	};
+
+	/**
+	 * Actors a batch edit applies to: explicit names, or a query
+	 */
+	struct FActorSelection {
+		/** Explicit actor names; when empty the actors are selected by Filter and the region */
+		TArray<FString> Names;
+		FActorQueryFilter Filter;
+
+		/** Optional selection region: a box, or a sphere when RegionRadius > 0 */
+		TOptional<FBox> RegionBox;
+		FVector RegionCenter = FVector::ZeroVector;
+		double RegionRadius = 0.0;
+
+		/**
+		 * Parse from JSON parameters: "names", or "class", "tag", "tags", "component", "folder" and
+		 * "region" ({min, max} or {center, radius}). Names and query constraints are exclusive; one is required.
+		 */
+		static auto FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FActorSelection>;
+	};
+
+	/**
+	 * Parameters for finding actors by name pattern
+	 */
+	struct FActorNameSearchParams {
+		FString Pattern;
+		FNamePattern::EMode Mode = FNamePattern::EMode::Contains;
+		bool bCaseSensitive = true;
+		/** Also match editor labels, not only object names */
+		bool bIncludeLabels = false;
+
+		/** Parse from JSON parameters */
+		static auto FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FActorNameSearchParams>;
+	};
+
+	/**
+	 * Parameters for finding actors within a radius
+	 */
+	struct FActorRadiusQueryParams {
+		FVector Center = FVector::ZeroVector;
+		double Radius = 0.0;
+		FActorQueryFilter Filter;
+
+		/** Parse from JSON parameters */
+		static auto FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FActorRadiusQueryParams>;
+	};
+
+	/**
+	 * Parameters for finding actors within an axis-aligned box
+	 */
+	struct FActorBoxQueryParams {
+		FBox Box = FBox(ForceInit);
+		FActorQueryFilter Filter;
+
+		/** Parse from JSON parameters */
+		static auto FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FActorBoxQueryParams>;
+	};
+
+	/**
+	 * Parameters for finding the actors nearest to a location
+	 */
+	struct FNearestActorsParams {
+		FVector Location = FVector::ZeroVector;
+		int32 Count = 10;
+		/** Ignore actors farther than this; 0 means unlimited */
+		double MaxDistance = 0.0;
+		FActorQueryFilter Filter;
+
+		/** Parse from JSON parameters */
+		static auto FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FNearestActorsParams>;
+	};
+
+	/**
+	 * One actor of a spawn_actors batch
+	 */
+	struct FActorSpawnSpec {
+		/** Native actor class name or blueprint name */
+		FString ClassName;
+
+		/** Object name of the new actor; empty lets the engine pick one */
+		FString Name;
+
+		FTransform Transform = FTransform::Identity;
+
+		/** Property name -> value, applied before the construction script runs */
+		TSharedPtr<FJsonObject> Properties;
+	};
+
+	/**
+	 * Parameters for spawning many actors in one undo transaction
+	 */
+	struct FSpawnActorsParams {
+		TArray<FActorSpawnSpec> Actors;
+
+		/**
+		 * Parse from JSON parameters ("actors": [{class, name, transform: {location, rotation, scale}, properties}]).
+		 * location, rotation and scale are also accepted directly on an entry.
+		 */
+		static auto FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FSpawnActorsParams>;
+	};
+
+	/**
+	 * Result of a spawn_actors batch, in request order
+	 */
+	struct FSpawnActorsResult {
+		struct FEntry {
+			FString Name;
+			FString ClassName;
+
+			/** Properties that could not be applied; the actor is spawned regardless */
+			TArray<FString> PropertyErrors;
+		};
+
+		TArray<FEntry> Actors;
+		double TotalTimeMs = 0.0;
+
+		auto ToJson() const -> TSharedPtr<FJsonObject>;
+	};
+
+	/**
+	 * Parameters for moving many actors in one undo transaction
+	 */
+	struct FSetActorTransformsParams {
+		/** Floats per actor: location (x, y, z), rotation quaternion (x, y, z, w), scale (x, y, z) */
+		static constexpr int32 FloatsPerTransform = 10;
+
+		TArray<FString> Names;
+
+		/** One transform per name, in the same order */
+		TArray<FTransform> Transforms;
+
+		/**
+		 * Parse from JSON parameters ("names", "transforms", "format").
+		 * "transforms" is a base64 string of little-endian float32 ("format": "float32", the default) or
+		 * float64 ("format": "float64") values, or a plain array of numbers.
+		 */
+		static auto FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FSetActorTransformsParams>;
+	};
+
+	/**
+	 * Result of a set_actor_transforms batch
+	 */
+	struct FSetActorTransformsResult {
+		int32 UpdatedCount = 0;
+
+		/** Actors already at the requested transform; left untouched */
+		int32 UnchangedCount = 0;
+
+		double TotalTimeMs = 0.0;
+
+		auto ToJson() const -> TSharedPtr<FJsonObject>;
+	};
+
+	/**
+	 * Relative edit applied by transform_actors
+	 */
+	enum class EActorTransformOperation : uint8 {
+		Offset,
+		Rotate,
+		Scale,
+		Snap
+	};
+
+	/**
+	 * Parameters for applying one relative transform edit to a set of actors
+	 */
+	struct FTransformActorsParams {
+		FActorSelection Selection;
+
+		EActorTransformOperation Operation = EActorTransformOperation::Offset;
+		FVector Offset = FVector::ZeroVector;
+		FQuat Rotation = FQuat::Identity;
+		double Factor = 1.0;
+		FVector GridSize = FVector::ZeroVector;
+
+		/** Pivot for rotate and scale; defaults to the centroid of the selected actors */
+		TOptional<FVector> Pivot;
+
+		/** Record the edit in the undo buffer */
+		bool bTransact = true;
+
+		/**
+		 * Parse from JSON parameters: a selection (see FActorSelection) and an "operation" (offset, rotate,
+		 * scale, snap) with its arguments ("offset", "rotation", "factor", "grid", "pivot").
+		 */
+		static auto FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FTransformActorsParams>;
+	};
+
+	/**
+	 * Result of a transform_actors edit
+	 */
+	struct FTransformActorsResult {
+		int32 MatchedCount = 0;
+		int32 UpdatedCount = 0;
+
+		/** Pivot used by rotate and scale */
+		TOptional<FVector> Pivot;
+
+		double TotalTimeMs = 0.0;
+
+		auto ToJson() const -> TSharedPtr<FJsonObject>;
+	};
+
+	/**
+	 * Area instances are scattered over
+	 */
+	enum class EScatterRegion : uint8 {
+		Box,
+		/** Bounds of a volume actor, keeping only points inside the volume */
+		Volume,
+		/** A band of Width on each side of an actor's spline */
+		Spline
+	};
+
+	enum class EScatterSampling : uint8 {
+		PoissonDisk,
+		JitteredGrid
+	};
+
+	/**
+	 * Parameters for scattering static mesh instances into one hierarchical instanced component
+	 */
+	struct FScatterInstancesParams {
+		/** Hard cap on the instances one call may create */
+		static constexpr int64 MaxInstances = 4000000;
+
+		/** Static mesh asset path */
+		FString MeshPath;
+
+		/** Actor holding the instance component; created when no actor has this name */
+		FString ActorName;
+
+		EScatterRegion Region = EScatterRegion::Box;
+		FBox Box = FBox(ForceInit);
+
+		/** Volume or spline actor, for the Volume and Spline regions */
+		FString RegionActorName;
+
+		/** Half-width of the band around a spline */
+		double Width = 100.0;
+
+		EScatterSampling Sampling = EScatterSampling::PoissonDisk;
+
+		/** Grid spacing, or the minimum distance between Poisson-disk points */
+		double Spacing = 100.0;
+
+		/** Jittered-grid offset as a fraction of the spacing, 0 to 1 */
+		double Jitter = 0.5;
+
+		int32 Seed = 0;
+		bool bRandomYaw = true;
+		FVector2D ScaleRange = FVector2D(1.0, 1.0);
+
+		/** Record the edit in the undo buffer */
+		bool bTransact = true;
+
+		/**
+		 * Parse from JSON parameters ("mesh", "actor_name", "box": {min, max} | "volume" | "spline" with "width",
+		 * "sampling" (poisson, grid), "spacing", "jitter", "seed", "random_yaw", "scale": [min, max], "transact")
+		 */
+		static auto FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FScatterInstancesParams>;
+	};
+
+	/**
+	 * Result of a scatter_instances call
+	 */
+	struct FScatterInstancesResult {
+		FString ActorName;
+		FString ComponentName;
+
+		/** The new instances are [FirstInstance, FirstInstance + InstanceCount) of the component */
+		int32 FirstInstance = 0;
+		int32 InstanceCount = 0;
+
+		double SampleTimeMs = 0.0;
+		double TotalTimeMs = 0.0;
+
+		auto ToJson() const -> TSharedPtr<FJsonObject>;
+	};
+
+	/**
+	 * Parameters for writing several property paths on a set of actors
+	 */
+	struct FSetPropertiesParams {
+		FActorSelection Selection;
+
+		/** Property path -> value, written in this order on each actor */
+		TArray<TPair<FString, TSharedPtr<FJsonValue>>> Properties;
+
+		/** Record the edit in the undo buffer */
+		bool bTransact = true;
+
+		/** Parse from JSON parameters: a selection (see FActorSelection), "properties" and "transact" */
+		static auto FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FSetPropertiesParams>;
+	};
+
+	/**
+	 * Result of a set_properties batch
+	 */
+	struct FSetPropertiesResult {
+		/** Cap on the failures listed individually; FailedCount has them all */
+		static constexpr int32 MaxErrors = 100;
+
+		struct FFailure {
+			FString ActorName;
+			FString Path;
+			FString Error;
+		};
+
+		int32 MatchedCount = 0;
+
+		/** Objects (actors and components) that received at least one write */
+		int32 UpdatedCount = 0;
+
+		int32 WrittenCount = 0;
+		int32 FailedCount = 0;
+		TArray<FFailure> Errors;
+
+		double TotalTimeMs = 0.0;
+
+		auto ToJson() const -> TSharedPtr<FJsonObject>;
+	};
+
+	/**
+	 * Parameters for reading properties of a set of actors
+	 */
+	struct FGetPropertiesParams {
+		FActorSelection Selection;
+		FPropertyReadOptions Options;
+
+		/** Parse from JSON parameters: a selection (see FActorSelection), "paths", "depth" and "changed_only" */
+		static auto FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FGetPropertiesParams>;
+	};
+
+	/**
+	 * Result of a get_properties call
+	 */
+	struct FGetPropertiesResult {
+		struct FEntry {
+			FString Name;
+			FString ClassName;
+			TSharedPtr<FJsonObject> Properties;
+		};
+
+		TArray<FEntry> Entries;
+		double TotalTimeMs = 0.0;
+
+		auto ToJson() const -> TSharedPtr<FJsonObject>;
+	};
+
+	/**
+	 * Parameters for subscribing to level changes
+	 */
+	struct FSubscribeParams {
+		/** Bit (1 << ELevelEventKind) per requested kind */
+		uint32 Kinds = ~0u;
+
+		FActorQueryFilter Filter;
+
+		/** Actor (or blueprint) name pattern */
+		TOptional<FString> Pattern;
+		FNamePattern::EMode Mode = FNamePattern::EMode::Contains;
+		bool bCaseSensitive = true;
+
+		/** Property names a property change must touch to be delivered */
+		TArray<FString> Properties;
+
+		int32 MaxQueued = FLevelEventStream::DefaultMaxQueued;
+
+		/**
+		 * Parse from JSON parameters: "events" (kind names), "class", "tag", "tags", "component", "folder",
+		 * "pattern", "mode", "case_sensitive", "properties" and "max_queued"
+		 */
+		static auto FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FSubscribeParams>;
+	};
+
+	/**
+	 * Result of a subscribe call
+	 */
+	struct FSubscribeResult {
+		int32 SubscriptionId = 0;
+		uint32 Kinds = ~0u;
+		int32 MaxQueued = 0;
+
+		auto ToJson() const -> TSharedPtr<FJsonObject>;
+	};
+
+	/**
+	 * Parameters for reading the level digest
+	 */
+	struct FGetLevelDigestParams {
+		static constexpr int32 MaxDepth = 4;
+
+		/** Node path; empty for the world */
+		FString Path;
+		int32 Depth = 1;
+		bool bIncludeActors = false;
+		bool bRehash = false;
+
+		/** Parse from JSON parameters: "path", "depth" (0-4), "actors" and "rehash" */
+		static auto FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FGetLevelDigestParams>;
+	};
+
+	/**
+	 * Result of a get_level_digest call
+	 */
+	struct FGetLevelDigestResult {
+		FLevelDigest::FNodeDigest Node;
+		double TotalTimeMs = 0.0;
+
+		auto ToJson() const -> TSharedPtr<FJsonObject>;
+	};
+
+	/**
+	 * Parameters for diffing the level against an earlier root digest
+	 */
+	struct FDiffLevelParams {
+		uint64 SinceDigest = 0;
+
+		/** Parse from JSON parameters: "since_digest" (hex, as returned by get_level_digest) */
+		static auto FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FDiffLevelParams>;
+	};
+
+	/**
+	 * Result of a diff_level call
+	 */
+	struct FDiffLevelResult {
+		FLevelDigest::FChanges Changes;
+		double TotalTimeMs = 0.0;
+
+		auto ToJson() const -> TSharedPtr<FJsonObject>;
+	};
+
+	/**
+	 * Parameters for querying World Partition actor descriptors; unset constraints match everything
+	 */
+	struct FQueryActorDescsParams {
+		static constexpr int32 DefaultLimit = 1000;
+		static constexpr int32 MaxLimit = 100000;
+
+		/** Actor class name; native subclasses match too */
+		TOptional<FString> ClassName;
+
+		/** Actor name or label pattern */
+		TOptional<FString> Pattern;
+		FNamePattern::EMode Mode = FNamePattern::EMode::Contains;
+		bool bCaseSensitive = true;
+
+		/** Data layer instance name the actor must belong to */
+		TOptional<FString> DataLayer;
+		TOptional<FString> RuntimeGrid;
+
+		/** Optional region the editor bounds must intersect: a box, or a sphere when RegionRadius > 0 */
+		TOptional<FBox> RegionBox;
+		FVector RegionCenter = FVector::ZeroVector;
+		double RegionRadius = 0.0;
+
+		TOptional<bool> bLoaded;
+		TOptional<bool> bSpatiallyLoaded;
+
+		int32 Limit = DefaultLimit;
+
+		/**
+		 * Parse from JSON parameters: "class", "pattern", "mode", "case_sensitive", "data_layer",
+		 * "runtime_grid", "region" ({min, max} or {center, radius}), "loaded", "spatially_loaded" and "limit"
+		 */
+		static auto FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FQueryActorDescsParams>;
+	};
+
+	/**
+	 * Result of a query_actor_descs call
+	 */
+	struct FQueryActorDescsResult {
+		struct FEntry {
+			FString Name;
+			FString Label;
+			FString ClassName;
+			FGuid Guid;
+			FBox Bounds = FBox(ForceInit);
+			TArray<FName> DataLayers;
+			FName RuntimeGrid;
+			bool bSpatiallyLoaded = false;
+			bool bLoaded = false;
+		};
+
+		TArray<FEntry> Entries;
+
+		/** Matching descriptors, including those beyond the limit */
+		int32 MatchedCount = 0;
+
+		/** Descriptors in the world */
+		int32 TotalCount = 0;
+		double TotalTimeMs = 0.0;
+
+		auto ToJson() const -> TSharedPtr<FJsonObject>;
+	};
+
+	/**
+	 * Parameters for loading a World Partition region in the editor
+	 */
+	struct FLoadRegionParams {
+		FBox Bounds = FBox(ForceInit);
+
+		/** Parse from JSON parameters: "region" ({min, max}, or {center, radius} loaded as its bounding box) */
+		static auto FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FLoadRegionParams>;
+	};
+
+	/**
+	 * Result of a load_region call
+	 */
+	struct FLoadRegionResult {
+		int32 RegionId = 0;
+		FBox Bounds = FBox(ForceInit);
+
+		/** Descriptors whose bounds intersect the region */
+		int32 ActorCount = 0;
+
+		/** Of those, the actors loaded after the call */
+		int32 LoadedCount = 0;
+		double TotalTimeMs = 0.0;
+
+		auto ToJson() const -> TSharedPtr<FJsonObject>;
+	};
+}
@@ -0,0 +1,179 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "Core/GraphChangeJournal.h"
+#include "Core/Result.h"
+
+class UEdGraph;
+class UEdGraphNode;
+
+namespace UnrealMCP {
+	/**
+	 * Node kinds that build_blueprint_graph can create
+	 */
+	enum class EGraphNodeKind : uint8 {
+		Event,
+		FunctionCall,
+		VariableGet,
+		VariableSet,
+		Self,
+		InputAction,
+		ComponentReference
+	};
+
+	/**
+	 * A node to create, addressed by a caller-chosen local id
+	 */
+	struct FGraphNodeSpec {
+		FString LocalId;
+		EGraphNodeKind Kind = EGraphNodeKind::FunctionCall;
+
+		/** Event, function, variable, input action or component name; unused for Self */
+		FString Name;
+
+		/** Class owning the function, for FunctionCall nodes */
+		TOptional<FString> Target;
+		FVector2D Position = FVector2D::ZeroVector;
+
+		/** Pin default values for FunctionCall nodes */
+		TSharedPtr<FJsonObject> Params;
+
+		/** Parse from JSON parameters */
+		static auto FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FGraphNodeSpec>;
+	};
+
+	/**
+	 * A link between two pins. Endpoints are local ids of nodes in the same request
+	 * or GUIDs of nodes already in the graph.
+	 */
+	struct FGraphLinkSpec {
+		FString SourceNode;
+		FString SourcePin;
+		FString TargetNode;
+		FString TargetPin;
+
+		/** Parse from JSON parameters */
+		static auto FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FGraphLinkSpec>;
+	};
+
+	/**
+	 * Parameters for building part of a blueprint event graph in one operation
+	 */
+	struct FBuildBlueprintGraphParams {
+		FString BlueprintName;
+		TArray<FGraphNodeSpec> Nodes;
+		TArray<FGraphLinkSpec> Links;
+
+		/** Parse from JSON parameters */
+		static auto FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FBuildBlueprintGraphParams>;
+	};
+
+	/**
+	 * Result structure for graph building
+	 */
+	struct FBuildBlueprintGraphResult {
+		/** Local id -> node GUID, in request order */
+		TArray<TPair<FString, FGuid>> NodeIds;
+		int32 LinkCount = 0;
+
+		/** Convert to JSON object */
+		auto ToJson() const -> TSharedPtr<FJsonObject>;
+	};
+
+	/**
+	 * Node query over every graph of a blueprint (ubergraph pages, functions, macros and nested graphs).
+	 * All set predicates must hold; unset ones match everything.
+	 */
+	struct FBlueprintNodeQuery {
+		FString BlueprintName;
+
+		/** Node classes, any of which matches (IsA); from node_class or the legacy node_type */
+		TArray<FString> NodeClasses;
+		TOptional<FString> GraphName;
+
+		/** Called function, or event name (ReceiveX also matches X) */
+		TOptional<FString> FunctionName;
+		TOptional<FString> VariableName;
+
+		/** Pin category (exec, bool, real, object, struct...) or pin subtype name (Vector, Actor...) */
+		TOptional<FString> PinType;
+
+		/** true: at least one pin is linked, false: no pin is linked */
+		TOptional<bool> bConnected;
+		TOptional<FBox2D> Bounds;
+
+		bool bIncludePins = false;
+		bool bIncludeLinks = false;
+		bool bIncludeTitle = false;
+
+		/** Maximum matches per page */
+		int32 Limit = 100;
+
+		/** Resume position returned by the previous page */
+		FString Cursor;
+
+		static constexpr int32 MaxLimit = 1000;
+
+		/** Map a legacy node type (Event, Function, Variable) to node class names; false if unsupported */
+		static auto NodeClassesForType(const FString& NodeType, TArray<FString>& OutNodeClasses) -> bool;
+
+		/** Parse from JSON parameters */
+		static auto FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FBlueprintNodeQuery>;
+	};
+
+	/**
+	 * One page of query results
+	 */
+	struct FBlueprintNodeQueryResult {
+		TArray<UEdGraphNode*> Nodes;
+
+		/** Set when the scan stopped at the limit; pass back as 'cursor' for the next page */
+		TOptional<FString> NextCursor;
+		int32 ScannedCount = 0;
+
+		bool bIncludePins = false;
+		bool bIncludeLinks = false;
+		bool bIncludeTitle = false;
+
+		/** Convert to JSON object */
+		auto ToJson() const -> TSharedPtr<FJsonObject>;
+	};
+
+	/**
+	 * Parameters for exporting the graphs of a blueprint
+	 */
+	struct FExportBlueprintGraphParams {
+		FString BlueprintName;
+
+		/** Export only this graph */
+		TOptional<FString> GraphName;
+
+		/** Version the caller last received; only nodes changed after it are exported */
+		TOptional<int64> Since;
+
+		/** Parse from JSON parameters */
+		static auto FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FExportBlueprintGraphParams>;
+	};
+
+	/**
+	 * Compact export of blueprint graphs, whole or as changes since a version.
+	 *
+	 * Pin types and node classes are interned into shared tables. Links are [source node, source pin,
+	 * target node, target pin] index quadruples from an output pin to an input pin. Node indices address
+	 * the graph's 'nodes' followed by its 'refs' (GUIDs of unchanged nodes linked to exported ones);
+	 * pin indices address the owning node's pin list. An exported node replaces the caller's copy together
+	 * with every link touching it. Every graph is listed, so a graph missing from the export was deleted.
+	 */
+	struct FBlueprintGraphExport {
+		struct FGraph {
+			UEdGraph* Graph = nullptr;
+			FGraphChangeJournal::FGraphChanges Changes;
+		};
+
+		TArray<FGraph> Graphs;
+
+		/** Convert to JSON object */
+		auto ToJson() const -> TSharedPtr<FJsonObject>;
+	};
+}
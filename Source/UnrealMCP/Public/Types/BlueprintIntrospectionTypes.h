@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Json.h"
+#include "Core/BlueprintSearchIndex.h"
 #include "Core/Result.h"
 
 namespace UnrealMCP {
@@ -76,4 +77,60 @@ namespace UnrealMCP {
 		/** Convert to JSON object */
 		auto ToJson() const -> TSharedPtr<FJsonObject>;
 	};
+
+	/**
+	 * Parameters for a project-wide search of blueprint graph references
+	 */
+	struct FSearchBlueprintsParams {
+		/** Function, variable, event or input action name */
+		FString Name;
+		TOptional<EBlueprintReferenceKind> Kind;
+
+		/** Only blueprints whose object path starts with this prefix */
+		FString Path;
+		int32 Limit = 200;
+
+		/** Parse from JSON parameters */
+		static auto FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FSearchBlueprintsParams>;
+	};
+
+	/**
+	 * Result structure for project-wide blueprint search
+	 */
+	struct FSearchBlueprintsResult {
+		TArray<FBlueprintSearchHit> Hits;
+
+		/** Matches including those beyond the limit */
+		int32 TotalMatches = 0;
+		int32 IndexedBlueprints = 0;
+
+		/** Convert to JSON object */
+		auto ToJson() const -> TSharedPtr<FJsonObject>;
+	};
+
+	/**
+	 * Parameters for adding blueprints under a path to the search index
+	 */
+	struct FIndexBlueprintsParams {
+		FString Path = TEXT("/Game");
+		bool bRecursive = true;
+
+		/** Skip blueprints already indexed since their last save */
+		bool bOnlyMissing = true;
+
+		/** Parse from JSON parameters */
+		static auto FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FIndexBlueprintsParams>;
+	};
+
+	/**
+	 * Result structure for search index population
+	 */
+	struct FIndexBlueprintsResult {
+		int32 IndexedCount = 0;
+		int32 SkippedCount = 0;
+		int32 IndexedBlueprints = 0;
+
+		/** Convert to JSON object */
+		auto ToJson() const -> TSharedPtr<FJsonObject>;
+	};
 }
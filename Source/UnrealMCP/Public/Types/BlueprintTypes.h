@@ -50,4 +50,64 @@ namespace UnrealMCP {
 		/** Convert to JSON object */
 		auto ToJson() const -> TSharedPtr<FJsonObject>;
 	};
+
+	/**
+	 * Parameters for compiling several blueprints in one pass
+	 */
+	struct FCompileBlueprintsParams {
+		TArray<FString> BlueprintNames;
+
+		/** Parse from JSON parameters */
+		static auto FromJson(const TSharedPtr<FJsonObject>& Json) -> TResult<FCompileBlueprintsParams>;
+	};
+
+	/**
+	 * Wall time of each pass of a profiled compile, in milliseconds
+	 */
+	struct FBlueprintCompileTimings {
+		double SkeletonMs = 0.0;
+
+		/** Bytecode generation and reinstancing, which the compilation manager runs as one pass */
+		double CompileMs = 0.0;
+
+		/** Set only when garbage collection was requested */
+		TOptional<double> GarbageCollectionMs;
+
+		/** Convert to JSON object */
+		auto ToJson() const -> TSharedPtr<FJsonObject>;
+	};
+
+	/**
+	 * Compile outcome of a single blueprint
+	 */
+	struct FBlueprintCompileReport {
+		FString BlueprintName;
+
+		/** "up_to_date", "up_to_date_with_warnings", "error", "dirty" or "not_found" */
+		FString Status;
+		TArray<FString> Errors;
+		TArray<FString> Warnings;
+
+		/** Profiled compiles only: phase timings and the other blueprints recompiled with this one */
+		TOptional<FBlueprintCompileTimings> Timings;
+		TArray<FString> RecompiledDependents;
+
+		auto IsSuccess() const -> bool;
+
+		/** Convert to JSON object */
+		auto ToJson() const -> TSharedPtr<FJsonObject>;
+	};
+
+	/**
+	 * Result structure for multi-blueprint compilation
+	 */
+	struct FCompileBlueprintsResult {
+		TArray<FBlueprintCompileReport> Reports;
+
+		/** Wall time of the whole batch; blueprints share one queue flush, so there is no per-blueprint split */
+		double TotalTimeMs = 0.0;
+
+		/** Convert to JSON object */
+		auto ToJson() const -> TSharedPtr<FJsonObject>;
+	};
 }
@@ -69,5 +69,14 @@ private:
 
 	TMap<FString, ECommandHandlerType> CommandRoutingMap;
 
+	/** Read-only commands served on the server thread without waiting for the game thread */
+	TSet<FString> AnyThreadCommands;
+
 	auto InitializeCommandRouting() -> void;
+
+	/** Set a response's status and its result or error from a handler result */
+	static auto SetResponseResult(const TSharedPtr<FJsonObject>& ResponseJson, const TSharedPtr<FJsonObject>& ResultJson) -> void;
+
+	/** Attach compiles run since the previous response (idle flushes included) and still-pending compiles to a response */
+	static auto AddCompileStatus(const TSharedPtr<FJsonObject>& ResponseJson) -> void;
 };